@@ -0,0 +1,244 @@
+#pragma once
+
+// Axis aligned bounding box, defined by its minimum and maximum corner.
+
+#include <limits>
+
+#include "Core/public/Math/Boilerplate.h"
+
+#include "Core/public/Math/MathCommon.hpp"
+#include "Core/public/Math/MathFwd.h"
+
+#include "Core/public/Math/Vector3.hpp"
+#include "Core/public/Math/Ray.hpp"
+
+
+#ifndef AABB_H
+#define AABB_H
+
+namespace Phanes::Core::Math {
+
+    /// <summary>
+    /// Axis aligned bounding box.
+    /// </summary>
+    /// <typeparam name="T">Type of box</typeparam>
+    /// <typeparam name="S">Vector type is aligned</typeparam>
+    template<RealType T, bool S>
+    struct TAABB
+    {
+    public:
+
+        using Real = T;
+
+        /// <summary>
+        /// Minimum corner
+        /// </summary>
+        TVector3<Real, S> min;
+
+        /// <summary>
+        /// Maximum corner
+        /// </summary>
+        TVector3<Real, S> max;
+
+    public:
+
+        /// Default constructor
+        TAABB() = default;
+
+        /// <summary>
+        /// Construct box from its corners.
+        /// </summary>
+        /// <param name="_min">Minimum corner</param>
+        /// <param name="_max">Maximum corner</param>
+        TAABB(const TVector3<Real, S>& _min, const TVector3<Real, S>& _max)
+        {
+            this->min = _min;
+            this->max = _max;
+        }
+
+        /// <summary>
+        /// Gets an empty box, with min at +infinity and max at -infinity. Merging anything into it yields the merged box.
+        /// </summary>
+        /// <returns>Empty box</returns>
+        static TAABB<Real, S> Empty()
+        {
+            constexpr Real inf = std::numeric_limits<Real>::infinity();
+            return TAABB<Real, S>(TVector3<Real, S>(inf, inf, inf), TVector3<Real, S>(-inf, -inf, -inf));
+        }
+    };
+
+
+    // ==================== //
+    //   TAABB functions    //
+    // ==================== //
+
+
+    /// <summary>
+    /// Tests whether min is less or equal than max on all axes. Empty boxes are invalid.
+    /// </summary>
+    template<RealType T, bool S>
+    FORCEINLINE bool IsValid(const TAABB<T, S>& b1)
+    {
+        return b1.min.x <= b1.max.x && b1.min.y <= b1.max.y && b1.min.z <= b1.max.z;
+    }
+
+    /// <summary>
+    /// Gets the center of the box.
+    /// </summary>
+    template<RealType T, bool S>
+    FORCEINLINE TVector3<T, S> GetCenter(const TAABB<T, S>& b1)
+    {
+        return TVector3<T, S>((b1.min.x + b1.max.x) * (T)0.5, (b1.min.y + b1.max.y) * (T)0.5, (b1.min.z + b1.max.z) * (T)0.5);
+    }
+
+    /// <summary>
+    /// Gets the half size of the box on each axis.
+    /// </summary>
+    template<RealType T, bool S>
+    FORCEINLINE TVector3<T, S> GetExtent(const TAABB<T, S>& b1)
+    {
+        return TVector3<T, S>((b1.max.x - b1.min.x) * (T)0.5, (b1.max.y - b1.min.y) * (T)0.5, (b1.max.z - b1.min.z) * (T)0.5);
+    }
+
+    /// <summary>
+    /// Gets the surface area of the box.
+    /// </summary>
+    template<RealType T, bool S>
+    FORCEINLINE T SurfaceArea(const TAABB<T, S>& b1)
+    {
+        const T x = b1.max.x - b1.min.x;
+        const T y = b1.max.y - b1.min.y;
+        const T z = b1.max.z - b1.min.z;
+
+        return (T)2.0 * (x * y + y * z + z * x);
+    }
+
+    /// <summary>
+    /// Gets the volume of the box.
+    /// </summary>
+    template<RealType T, bool S>
+    FORCEINLINE T Volume(const TAABB<T, S>& b1)
+    {
+        return (b1.max.x - b1.min.x) * (b1.max.y - b1.min.y) * (b1.max.z - b1.min.z);
+    }
+
+    /// <summary>
+    /// Grows the box to contain b2.
+    /// </summary>
+    /// <param name="b1">Box</param>
+    /// <param name="b2">Box to contain</param>
+    /// <remarks>Result is stored in b1.</remarks>
+    template<RealType T, bool S>
+    TAABB<T, S> MergeV(TAABB<T, S>& b1, const TAABB<T, S>& b2)
+    {
+        b1.min = TVector3<T, S>(Min(b1.min.x, b2.min.x), Min(b1.min.y, b2.min.y), Min(b1.min.z, b2.min.z));
+        b1.max = TVector3<T, S>(Max(b1.max.x, b2.max.x), Max(b1.max.y, b2.max.y), Max(b1.max.z, b2.max.z));
+
+        return b1;
+    }
+
+    /// <summary>
+    /// Gets the smallest box containing both boxes.
+    /// </summary>
+    template<RealType T, bool S>
+    TAABB<T, S> Merge(const TAABB<T, S>& b1, const TAABB<T, S>& b2)
+    {
+        TAABB<T, S> r = b1;
+        return MergeV(r, b2);
+    }
+
+    /// <summary>
+    /// Grows the box to contain a point.
+    /// </summary>
+    /// <param name="b1">Box</param>
+    /// <param name="p1">Point to contain</param>
+    /// <remarks>Result is stored in b1.</remarks>
+    template<RealType T, bool S>
+    TAABB<T, S> EncapsulateV(TAABB<T, S>& b1, const TVector3<T, S>& p1)
+    {
+        b1.min = TVector3<T, S>(Min(b1.min.x, p1.x), Min(b1.min.y, p1.y), Min(b1.min.z, p1.z));
+        b1.max = TVector3<T, S>(Max(b1.max.x, p1.x), Max(b1.max.y, p1.y), Max(b1.max.z, p1.z));
+
+        return b1;
+    }
+
+    /// <summary>
+    /// Gets the smallest box containing the box and a point.
+    /// </summary>
+    template<RealType T, bool S>
+    TAABB<T, S> Encapsulate(const TAABB<T, S>& b1, const TVector3<T, S>& p1)
+    {
+        TAABB<T, S> r = b1;
+        return EncapsulateV(r, p1);
+    }
+
+    /// <summary>
+    /// Tests whether a point is inside the box or on its boundary.
+    /// </summary>
+    template<RealType T, bool S>
+    FORCEINLINE bool Contains(const TAABB<T, S>& b1, const TVector3<T, S>& p1)
+    {
+        return p1.x >= b1.min.x && p1.x <= b1.max.x &&
+               p1.y >= b1.min.y && p1.y <= b1.max.y &&
+               p1.z >= b1.min.z && p1.z <= b1.max.z;
+    }
+
+    /// <summary>
+    /// Tests whether b2 is entirely inside b1.
+    /// </summary>
+    template<RealType T, bool S>
+    FORCEINLINE bool Contains(const TAABB<T, S>& b1, const TAABB<T, S>& b2)
+    {
+        return Contains(b1, b2.min) && Contains(b1, b2.max);
+    }
+
+    /// <summary>
+    /// Tests whether two boxes overlap. Touching boxes overlap.
+    /// </summary>
+    template<RealType T, bool S>
+    FORCEINLINE bool Overlaps(const TAABB<T, S>& b1, const TAABB<T, S>& b2)
+    {
+        return b1.min.x <= b2.max.x && b2.min.x <= b1.max.x &&
+               b1.min.y <= b2.max.y && b2.min.y <= b1.max.y &&
+               b1.min.z <= b2.max.z && b2.min.z <= b1.max.z;
+    }
+
+    /// <summary>
+    /// Intersects a ray with the box (slab test).
+    /// </summary>
+    /// <param name="b1">Box</param>
+    /// <param name="r1">Ray</param>
+    /// <param name="tMin">Ray parameter, where the ray enters the box. 0, if the origin is inside.</param>
+    /// <param name="tMax">Ray parameter, where the ray leaves the box.</param>
+    /// <returns>True, if the ray hits the box.</returns>
+    template<RealType T, bool S>
+    bool RayIntersect(const TAABB<T, S>& b1, const TRay<T, S>& r1, T& tMin, T& tMax)
+    {
+        // Division by a zero direction yields +-inf, which keeps the slab of that axis unbounded, or empty if the origin is outside.
+        const T ix = (T)1.0 / r1.direction.x;
+        const T iy = (T)1.0 / r1.direction.y;
+        const T iz = (T)1.0 / r1.direction.z;
+
+        const T tx0 = (b1.min.x - r1.origin.x) * ix;
+        const T tx1 = (b1.max.x - r1.origin.x) * ix;
+        const T ty0 = (b1.min.y - r1.origin.y) * iy;
+        const T ty1 = (b1.max.y - r1.origin.y) * iy;
+        const T tz0 = (b1.min.z - r1.origin.z) * iz;
+        const T tz1 = (b1.max.z - r1.origin.z) * iz;
+
+        const T t0 = Max(Max(Min(tx0, tx1), Min(ty0, ty1)), Max(Min(tz0, tz1), (T)0.0));
+        const T t1 = Min(Min(Max(tx0, tx1), Max(ty0, ty1)), Max(tz0, tz1));
+
+        if (t0 <= t1)
+        {
+            tMin = t0;
+            tMax = t1;
+            return true;
+        }
+
+        return false;
+    }
+
+} // Phanes::Core::Math
+
+#endif // !AABB_H
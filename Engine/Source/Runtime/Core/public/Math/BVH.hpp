@@ -0,0 +1,718 @@
+#pragma once
+
+// Bounding volume hierarchy over primitive bounds, built with a binned surface area heuristic (SAH).
+//
+// Nodes are stored depth first in one array: The left child of an interior node directly follows it and offset points to the right child,
+// so that descending to the near side mostly walks forward through memory. For float a node is 32 bytes, two per cache line.
+// Large subtrees are built in parallel. Queries are iterative and pass primitive indices to a callback, which tests the actual primitive.
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <limits>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include "Core/public/Math/Boilerplate.h"
+
+#include "Core/public/Math/MathCommon.hpp"
+#include "Core/public/Math/MathFwd.h"
+
+#include "Core/public/Math/Vector3.hpp"
+#include "Core/public/Math/Ray.hpp"
+#include "Core/public/Math/AABB.hpp"
+
+
+#ifndef BVH_H
+#define BVH_H
+
+namespace Phanes::Core::Math {
+
+    /// <summary>
+    /// Node of a TBVH.
+    /// </summary>
+    /// <typeparam name="T">Type of bounds</typeparam>
+    template<RealType T>
+    struct TBVHNode
+    {
+        /// <summary>
+        /// Minimum corner of the node bounds
+        /// </summary>
+        T bmin[3];
+
+        /// <summary>
+        /// Interior node: Index of the right child. Leaf: Index of the first primitive in TBVH::indices.
+        /// </summary>
+        uint32_t offset;
+
+        /// <summary>
+        /// Maximum corner of the node bounds
+        /// </summary>
+        T bmax[3];
+
+        /// <summary>
+        /// Number of primitives in the leaf. 0 for interior nodes.
+        /// </summary>
+        uint32_t count;
+    };
+
+    /// <summary>
+    /// Options of BuildBVH.
+    /// </summary>
+    struct BVHBuildOptions
+    {
+        /// <summary>
+        /// Number of bins per axis, in which split candidates are evaluated (2 - 64).
+        /// </summary>
+        uint32_t bins = 16;
+
+        /// <summary>
+        /// Maximum number of primitives per leaf. Smaller sets are kept in a leaf, if splitting does not pay off.
+        /// </summary>
+        uint32_t maxLeafSize = 8;
+
+        /// <summary>
+        /// Cost of visiting a node, relative to intersectionCost.
+        /// </summary>
+        float traversalCost = 1.0f;
+
+        /// <summary>
+        /// Cost of testing a primitive.
+        /// </summary>
+        float intersectionCost = 1.0f;
+
+        /// <summary>
+        /// Minimum number of primitives, for which a subtree is built on another thread.
+        /// </summary>
+        size_t parallelThreshold = 4096;
+
+        /// <summary>
+        /// Maximum depth, at which subtrees are still built on another thread. Up to 2^maxThreadDepth threads are used. 0 builds serially.
+        /// </summary>
+        uint32_t maxThreadDepth = 3;
+    };
+
+    /// <summary>
+    /// Bounding volume hierarchy.
+    /// </summary>
+    /// <typeparam name="T">Type of bounds</typeparam>
+    /// <typeparam name="S">Vector type is aligned</typeparam>
+    template<RealType T, bool S>
+    struct TBVH
+    {
+    public:
+
+        using Real = T;
+        using Node = TBVHNode<Real>;
+
+        /// <summary>
+        /// Nodes in depth first order. nodes[0] is the root.
+        /// </summary>
+        std::vector<Node> nodes;
+
+        /// <summary>
+        /// Primitive indices in leaf order.
+        /// </summary>
+        std::vector<uint32_t> indices;
+
+        /// <summary>
+        /// Primitive bounds in leaf order (bounds[i] belongs to indices[i]).
+        /// </summary>
+        std::vector<TAABB<Real, S>> bounds;
+
+    public:
+
+        /// Default constructor
+        TBVH() = default;
+    };
+
+
+    namespace Detail
+    {
+        // Stack size of the traversal. The build switches to median splits at BVHMedianDepth, so that trees never get deeper than the stack.
+        constexpr size_t BVHStackSize = 64;
+        constexpr uint32_t BVHMedianDepth = 32;
+
+        // Primitive during the build.
+        template<RealType T, bool S>
+        struct bvh_ref
+        {
+            TAABB<T, S> bounds;
+            T centroid[3];
+            uint32_t index;
+        };
+
+        template<RealType T>
+        struct bvh_bin
+        {
+            T bmin[3];
+            T bmax[3];
+            uint32_t count;
+        };
+
+        template<RealType T>
+        FORCEINLINE void bvh_bin_clear(bvh_bin<T>& b)
+        {
+            constexpr T inf = std::numeric_limits<T>::infinity();
+
+            b.bmin[0] = b.bmin[1] = b.bmin[2] = inf;
+            b.bmax[0] = b.bmax[1] = b.bmax[2] = -inf;
+            b.count = 0;
+        }
+
+        template<RealType T>
+        FORCEINLINE void bvh_bin_merge(bvh_bin<T>& r, const bvh_bin<T>& b)
+        {
+            for (int a = 0; a < 3; ++a)
+            {
+                r.bmin[a] = Min(r.bmin[a], b.bmin[a]);
+                r.bmax[a] = Max(r.bmax[a], b.bmax[a]);
+            }
+            r.count += b.count;
+        }
+
+        template<RealType T>
+        FORCEINLINE T bvh_bin_area(const bvh_bin<T>& b)
+        {
+            const T x = b.bmax[0] - b.bmin[0];
+            const T y = b.bmax[1] - b.bmin[1];
+            const T z = b.bmax[2] - b.bmin[2];
+
+            return x * y + y * z + z * x;
+        }
+
+        // Bin of a centroid. The same function is used for binning and partitioning, so both always agree.
+        template<RealType T>
+        FORCEINLINE uint32_t bvh_bin_index(T c, T cmin, T scale, uint32_t bins)
+        {
+            const int64_t i = (int64_t)((c - cmin) * scale);
+            return (uint32_t)Clamp<int64_t>(i, 0, (int64_t)bins - 1);
+        }
+
+        template<RealType T, bool S>
+        void bvh_build(std::vector<TBVHNode<T>>& out, bvh_ref<T, S>* refs, uint32_t begin, uint32_t end, const BVHBuildOptions& options, uint32_t depth, uint32_t threadDepth)
+        {
+            constexpr T inf = std::numeric_limits<T>::infinity();
+
+            const uint32_t n = end - begin;
+
+            // Node and centroid bounds.
+            TBVHNode<T> node;
+            T cmin[3] = { inf, inf, inf };
+            T cmax[3] = { -inf, -inf, -inf };
+
+            node.bmin[0] = node.bmin[1] = node.bmin[2] = inf;
+            node.bmax[0] = node.bmax[1] = node.bmax[2] = -inf;
+
+            for (uint32_t i = begin; i < end; ++i)
+            {
+                const bvh_ref<T, S>& r = refs[i];
+
+                node.bmin[0] = Min(node.bmin[0], r.bounds.min.x);
+                node.bmin[1] = Min(node.bmin[1], r.bounds.min.y);
+                node.bmin[2] = Min(node.bmin[2], r.bounds.min.z);
+                node.bmax[0] = Max(node.bmax[0], r.bounds.max.x);
+                node.bmax[1] = Max(node.bmax[1], r.bounds.max.y);
+                node.bmax[2] = Max(node.bmax[2], r.bounds.max.z);
+
+                for (int a = 0; a < 3; ++a)
+                {
+                    cmin[a] = Min(cmin[a], r.centroid[a]);
+                    cmax[a] = Max(cmax[a], r.centroid[a]);
+                }
+            }
+
+            const size_t self = out.size();
+            out.push_back(node);
+
+            const uint32_t maxLeafSize = Max<uint32_t>(options.maxLeafSize, 1);
+
+            if (n <= 1)
+            {
+                out[self].offset = begin;
+                out[self].count = n;
+                return;
+            }
+
+            // Binned SAH over all three axes.
+            const uint32_t bins = Clamp<uint32_t>(options.bins, 2, 64);
+
+            T bestCost = inf;
+            int bestAxis = -1;
+            uint32_t bestSplit = 0;
+
+            if (depth < BVHMedianDepth)
+            {
+                bvh_bin<T> bin[64];
+                bvh_bin<T> right[64];
+
+                for (int a = 0; a < 3; ++a)
+                {
+                    const T extent = cmax[a] - cmin[a];
+                    if (!(extent > (T)0.0))
+                    {
+                        continue;
+                    }
+
+                    const T scale = (T)bins / extent;
+
+                    for (uint32_t b = 0; b < bins; ++b)
+                    {
+                        bvh_bin_clear(bin[b]);
+                    }
+
+                    for (uint32_t i = begin; i < end; ++i)
+                    {
+                        const bvh_ref<T, S>& r = refs[i];
+                        bvh_bin<T>& b = bin[bvh_bin_index(r.centroid[a], cmin[a], scale, bins)];
+
+                        b.bmin[0] = Min(b.bmin[0], r.bounds.min.x);
+                        b.bmin[1] = Min(b.bmin[1], r.bounds.min.y);
+                        b.bmin[2] = Min(b.bmin[2], r.bounds.min.z);
+                        b.bmax[0] = Max(b.bmax[0], r.bounds.max.x);
+                        b.bmax[1] = Max(b.bmax[1], r.bounds.max.y);
+                        b.bmax[2] = Max(b.bmax[2], r.bounds.max.z);
+                        b.count++;
+                    }
+
+                    // Suffix sweep: right[b] holds bins b .. bins - 1.
+                    right[bins - 1] = bin[bins - 1];
+                    for (uint32_t b = bins - 1; b > 0; --b)
+                    {
+                        right[b - 1] = right[b];
+                        bvh_bin_merge(right[b - 1], bin[b - 1]);
+                    }
+
+                    // Prefix sweep: Split s puts bins 0 .. s - 1 left.
+                    bvh_bin<T> left;
+                    bvh_bin_clear(left);
+
+                    for (uint32_t s = 1; s < bins; ++s)
+                    {
+                        bvh_bin_merge(left, bin[s - 1]);
+
+                        if (left.count == 0 || right[s].count == 0)
+                        {
+                            continue;
+                        }
+
+                        const T cost = bvh_bin_area(left) * (T)left.count + bvh_bin_area(right[s]) * (T)right[s].count;
+                        if (cost < bestCost)
+                        {
+                            bestCost = cost;
+                            bestAxis = a;
+                            bestSplit = s;
+                        }
+                    }
+                }
+            }
+
+            // Compare against a leaf. Areas are halved surface areas, which cancels in the ratio.
+            if (n <= maxLeafSize)
+            {
+                const T x = node.bmax[0] - node.bmin[0];
+                const T y = node.bmax[1] - node.bmin[1];
+                const T z = node.bmax[2] - node.bmin[2];
+                const T area = x * y + y * z + z * x;
+
+                const T leafCost = (T)options.intersectionCost * (T)n;
+                const T splitCost = (bestAxis < 0 || !(area > (T)0.0)) ? inf : (T)options.traversalCost + (T)options.intersectionCost * bestCost / area;
+
+                if (leafCost <= splitCost)
+                {
+                    out[self].offset = begin;
+                    out[self].count = n;
+                    return;
+                }
+            }
+
+            uint32_t mid;
+            if (bestAxis >= 0)
+            {
+                const T scale = (T)bins / (cmax[bestAxis] - cmin[bestAxis]);
+                const T c0 = cmin[bestAxis];
+
+                bvh_ref<T, S>* m = std::partition(refs + begin, refs + end, [&](const bvh_ref<T, S>& r) {
+                    return bvh_bin_index(r.centroid[bestAxis], c0, scale, bins) < bestSplit;
+                });
+
+                mid = (uint32_t)(m - refs);
+            }
+            else
+            {
+                // Identical centroids, or too deep: Split at the median of the largest centroid axis.
+                int a = 0;
+                if (cmax[1] - cmin[1] > cmax[a] - cmin[a]) a = 1;
+                if (cmax[2] - cmin[2] > cmax[a] - cmin[a]) a = 2;
+
+                mid = begin + n / 2;
+                std::nth_element(refs + begin, refs + mid, refs + end, [a](const bvh_ref<T, S>& r1, const bvh_ref<T, S>& r2) {
+                    return r1.centroid[a] < r2.centroid[a];
+                });
+            }
+
+            out[self].count = 0;
+
+            if (threadDepth < options.maxThreadDepth && n >= options.parallelThreshold)
+            {
+                // Build the right subtree on another thread and append it, with its interior offsets moved behind the left subtree.
+                std::vector<TBVHNode<T>> rightNodes;
+                rightNodes.reserve(2 * (size_t)(end - mid));
+
+                std::future<void> task = std::async(std::launch::async, [&]() {
+                    bvh_build(rightNodes, refs, mid, end, options, depth + 1, threadDepth + 1);
+                });
+
+                bvh_build(out, refs, begin, mid, options, depth + 1, threadDepth + 1);
+                task.get();
+
+                const uint32_t base = (uint32_t)out.size();
+                for (TBVHNode<T>& r : rightNodes)
+                {
+                    if (r.count == 0)
+                    {
+                        r.offset += base;
+                    }
+                }
+
+                out[self].offset = base;
+                out.insert(out.end(), rightNodes.begin(), rightNodes.end());
+            }
+            else
+            {
+                bvh_build(out, refs, begin, mid, options, depth + 1, threadDepth);
+                out[self].offset = (uint32_t)out.size();
+                bvh_build(out, refs, mid, end, options, depth + 1, threadDepth);
+            }
+        }
+
+        // Slab test of a node. tEntry is the parameter, where the ray enters the node.
+        template<RealType T>
+        FORCEINLINE bool bvh_ray_node(const TBVHNode<T>& node, const T* o, const T* inv, T tMax, T& tEntry)
+        {
+            const T tx0 = (node.bmin[0] - o[0]) * inv[0];
+            const T tx1 = (node.bmax[0] - o[0]) * inv[0];
+            const T ty0 = (node.bmin[1] - o[1]) * inv[1];
+            const T ty1 = (node.bmax[1] - o[1]) * inv[1];
+            const T tz0 = (node.bmin[2] - o[2]) * inv[2];
+            const T tz1 = (node.bmax[2] - o[2]) * inv[2];
+
+            const T t0 = Max(Max(Min(tx0, tx1), Min(ty0, ty1)), Max(Min(tz0, tz1), (T)0.0));
+            const T t1 = Min(Min(Max(tx0, tx1), Max(ty0, ty1)), Min(Max(tz0, tz1), tMax));
+
+            tEntry = t0;
+            return t0 <= t1;
+        }
+
+        template<RealType T, bool S>
+        FORCEINLINE bool bvh_box_node(const TBVHNode<T>& node, const TAABB<T, S>& b1)
+        {
+            return node.bmin[0] <= b1.max.x && b1.min.x <= node.bmax[0] &&
+                   node.bmin[1] <= b1.max.y && b1.min.y <= node.bmax[1] &&
+                   node.bmin[2] <= b1.max.z && b1.min.z <= node.bmax[2];
+        }
+
+        // Walks the nodes hit by a ray, near child first. leaf(first, count, tMax) tests the primitives of a leaf and returns true to stop.
+        // tMax may shrink during the walk, which culls the nodes behind it.
+        template<RealType T, bool S, typename F>
+        void bvh_ray_walk(const TBVH<T, S>& bvh, const TRay<T, S>& r1, T& tMax, F&& leaf)
+        {
+            if (bvh.nodes.empty())
+            {
+                return;
+            }
+
+            const T o[3] = { r1.origin.x, r1.origin.y, r1.origin.z };
+            const T inv[3] = { (T)1.0 / r1.direction.x, (T)1.0 / r1.direction.y, (T)1.0 / r1.direction.z };
+
+            const TBVHNode<T>* nodes = bvh.nodes.data();
+
+            struct Entry
+            {
+                uint32_t node;
+                T t;
+            };
+
+            Entry stack[BVHStackSize];
+            size_t sp = 0;
+
+            T t;
+            if (!bvh_ray_node(nodes[0], o, inv, tMax, t))
+            {
+                return;
+            }
+            stack[sp++] = { 0, t };
+
+            while (sp > 0)
+            {
+                const Entry e = stack[--sp];
+
+                // Closer hits were found, since the node was pushed.
+                if (e.t > tMax)
+                {
+                    continue;
+                }
+
+                uint32_t i = e.node;
+                while (true)
+                {
+                    const TBVHNode<T>& node = nodes[i];
+
+                    if (node.count > 0)
+                    {
+                        if (leaf(node.offset, node.count, tMax))
+                        {
+                            return;
+                        }
+                        break;
+                    }
+
+                    const uint32_t c0 = i + 1;
+                    const uint32_t c1 = node.offset;
+
+                    T t0, t1;
+                    const bool h0 = bvh_ray_node(nodes[c0], o, inv, tMax, t0);
+                    const bool h1 = bvh_ray_node(nodes[c1], o, inv, tMax, t1);
+
+                    if (h0 && h1)
+                    {
+                        // Descend into the nearer child, revisit the other one later.
+                        if (t1 < t0)
+                        {
+                            stack[sp++] = { c0, t0 };
+                            i = c1;
+                        }
+                        else
+                        {
+                            stack[sp++] = { c1, t1 };
+                            i = c0;
+                        }
+                    }
+                    else if (h0)
+                    {
+                        i = c0;
+                    }
+                    else if (h1)
+                    {
+                        i = c1;
+                    }
+                    else
+                    {
+                        break;
+                    }
+                }
+            }
+        }
+    }
+
+
+    // ================== //
+    //   TBVH functions   //
+    // ================== //
+
+
+    /// <summary>
+    /// Builds a bounding volume hierarchy over primitive bounds.
+    /// </summary>
+    /// <param name="primitives">Bounds of the primitives. Queries report indices into this span.</param>
+    /// <param name="options">Build options</param>
+    /// <returns>BVH. Empty, if primitives is empty.</returns>
+    template<RealType T, bool S = false>
+    TBVH<T, S> BuildBVH(std::span<const std::type_identity_t<TAABB<T, S>>> primitives, const BVHBuildOptions& options = BVHBuildOptions())
+    {
+        TBVH<T, S> bvh;
+
+        if (primitives.empty())
+        {
+            return bvh;
+        }
+
+        const uint32_t n = (uint32_t)primitives.size();
+
+        std::vector<Detail::bvh_ref<T, S>> refs(n);
+        for (uint32_t i = 0; i < n; ++i)
+        {
+            Detail::bvh_ref<T, S>& r = refs[i];
+
+            r.bounds = primitives[i];
+            r.centroid[0] = (r.bounds.min.x + r.bounds.max.x) * (T)0.5;
+            r.centroid[1] = (r.bounds.min.y + r.bounds.max.y) * (T)0.5;
+            r.centroid[2] = (r.bounds.min.z + r.bounds.max.z) * (T)0.5;
+            r.index = i;
+        }
+
+        bvh.nodes.reserve(2 * (size_t)n);
+        Detail::bvh_build(bvh.nodes, refs.data(), 0, n, options, 0, 0);
+        bvh.nodes.shrink_to_fit();
+
+        bvh.indices.resize(n);
+        bvh.bounds.resize(n);
+        for (uint32_t i = 0; i < n; ++i)
+        {
+            bvh.indices[i] = refs[i].index;
+            bvh.bounds[i] = refs[i].bounds;
+        }
+
+        return bvh;
+    }
+
+    /// <summary>
+    /// Gets the bounds of all primitives.
+    /// </summary>
+    /// <returns>Bounds of the root, or an empty box if the BVH is empty.</returns>
+    template<RealType T, bool S>
+    TAABB<T, S> GetAABB(const TBVH<T, S>& bvh)
+    {
+        if (bvh.nodes.empty())
+        {
+            return TAABB<T, S>::Empty();
+        }
+
+        const TBVHNode<T>& r = bvh.nodes[0];
+        return TAABB<T, S>(TVector3<T, S>(r.bmin[0], r.bmin[1], r.bmin[2]), TVector3<T, S>(r.bmax[0], r.bmax[1], r.bmax[2]));
+    }
+
+    /// <summary>
+    /// Finds the closest primitive hit by a ray.
+    /// </summary>
+    /// <param name="bvh">BVH</param>
+    /// <param name="r1">Ray</param>
+    /// <param name="intersect">bool(uint32_t index, const TRay&lt;T, S&gt;&amp; ray, T&amp; t): Intersects primitive index with the ray and writes the ray parameter of the hit.</param>
+    /// <param name="hit">Index of the closest primitive hit</param>
+    /// <param name="t">Ray parameter of the closest hit</param>
+    /// <param name="tMax">Hits beyond tMax are ignored</param>
+    /// <returns>True, if a primitive is hit within [0, tMax].</returns>
+    template<RealType T, bool S, typename F>
+    bool RayClosestHit(const TBVH<T, S>& bvh, const TRay<T, S>& r1, F&& intersect, uint32_t& hit, T& t, T tMax = std::numeric_limits<T>::infinity())
+    {
+        bool found = false;
+
+        Detail::bvh_ray_walk(bvh, r1, tMax, [&](uint32_t first, uint32_t count, T& tCurrent) {
+            for (uint32_t i = first; i < first + count; ++i)
+            {
+                T tHit;
+                if (intersect(bvh.indices[i], r1, tHit) && tHit >= (T)0.0 && tHit <= tCurrent)
+                {
+                    tCurrent = tHit;
+                    hit = bvh.indices[i];
+                    found = true;
+                }
+            }
+            return false;
+        });
+
+        if (found)
+        {
+            t = tMax;
+        }
+
+        return found;
+    }
+
+    /// <summary>
+    /// Tests whether a ray hits any primitive. Stops at the first hit found, which is not necessarily the closest.
+    /// </summary>
+    /// <param name="bvh">BVH</param>
+    /// <param name="r1">Ray</param>
+    /// <param name="intersect">bool(uint32_t index, const TRay&lt;T, S&gt;&amp; ray, T&amp; t): Intersects primitive index with the ray and writes the ray parameter of the hit.</param>
+    /// <param name="tMax">Hits beyond tMax are ignored</param>
+    /// <returns>True, if a primitive is hit within [0, tMax].</returns>
+    template<RealType T, bool S, typename F>
+    bool RayAnyHit(const TBVH<T, S>& bvh, const TRay<T, S>& r1, F&& intersect, T tMax = std::numeric_limits<T>::infinity())
+    {
+        bool found = false;
+
+        Detail::bvh_ray_walk(bvh, r1, tMax, [&](uint32_t first, uint32_t count, T& tCurrent) {
+            for (uint32_t i = first; i < first + count; ++i)
+            {
+                T tHit;
+                if (intersect(bvh.indices[i], r1, tHit) && tHit >= (T)0.0 && tHit <= tCurrent)
+                {
+                    found = true;
+                    return true;
+                }
+            }
+            return false;
+        });
+
+        return found;
+    }
+
+    /// <summary>
+    /// Finds all primitives, whose bounds overlap a box.
+    /// </summary>
+    /// <param name="bvh">BVH</param>
+    /// <param name="b1">Box</param>
+    /// <param name="callback">void(uint32_t index): Called once for each primitive, whose bounds overlap b1.</param>
+    /// <returns>Number of primitives reported.</returns>
+    template<RealType T, bool S, typename F>
+    size_t OverlapQuery(const TBVH<T, S>& bvh, const TAABB<T, S>& b1, F&& callback)
+    {
+        if (bvh.nodes.empty() || !Detail::bvh_box_node(bvh.nodes[0], b1))
+        {
+            return 0;
+        }
+
+        const TBVHNode<T>* nodes = bvh.nodes.data();
+
+        uint32_t stack[Detail::BVHStackSize];
+        size_t sp = 0;
+        size_t count = 0;
+
+        stack[sp++] = 0;
+
+        while (sp > 0)
+        {
+            uint32_t i = stack[--sp];
+
+            while (true)
+            {
+                const TBVHNode<T>& node = nodes[i];
+
+                if (node.count > 0)
+                {
+                    for (uint32_t p = node.offset; p < node.offset + node.count; ++p)
+                    {
+                        if (Overlaps(bvh.bounds[p], b1))
+                        {
+                            callback(bvh.indices[p]);
+                            count++;
+                        }
+                    }
+                    break;
+                }
+
+                const uint32_t c0 = i + 1;
+                const uint32_t c1 = node.offset;
+
+                const bool h0 = Detail::bvh_box_node(nodes[c0], b1);
+                const bool h1 = Detail::bvh_box_node(nodes[c1], b1);
+
+                if (h0 && h1)
+                {
+                    stack[sp++] = c1;
+                    i = c0;
+                }
+                else if (h0)
+                {
+                    i = c0;
+                }
+                else if (h1)
+                {
+                    i = c1;
+                }
+                else
+                {
+                    break;
+                }
+            }
+        }
+
+        return count;
+    }
+
+} // Phanes::Core::Math
+
+#endif // !BVH_H
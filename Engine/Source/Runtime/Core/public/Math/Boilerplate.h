@@ -53,9 +53,13 @@
 namespace Phanes::Core::Math
 {
 
+    // Half precision storage type (see Half.hpp).
+    struct half;
+
     // Typenames with RealType constrain have to be floating point numbers.
+    // half is admitted, so that vector types can be specialized for it. Half vectors are storage only and have no arithmetic.
     template<typename T>
-    concept RealType = std::is_floating_point_v<T>;
+    concept RealType = std::is_floating_point_v<T> || std::is_same_v<T, half>;
 
     // Typenames with IntType constrain have to be integer number.
     template<typename T>
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Core/public/Math/Boilerplate.h"
+#include "Core/public/Math/IntDivisor.hpp"
 
 namespace Phanes::Core::Math::Detail
 {
@@ -22,6 +23,9 @@ namespace Phanes::Core::Math::Detail
     template<IntType T, bool S>
     struct compute_ivec3_mod {};
 
+    template<IntType T, bool S>
+    struct compute_ivec3_div_magic {};
+
     template<IntType T, bool S>
     struct compute_ivec3_eq {};
 
@@ -77,7 +81,7 @@ namespace Phanes::Core::Math::Detail
         {
             v1.x = x;
             v1.y = y;
-            v1.y = z;
+            v1.z = z;
             v1.w = (T)0;
         }
 
@@ -169,11 +173,9 @@ namespace Phanes::Core::Math::Detail
 
         static constexpr void map(Phanes::Core::Math::TIntVector3<T, false>& r, const Phanes::Core::Math::TIntVector3<T, false>& v1, T s)
         {
-            s = (T)1.0 / s;
-
-            r.x = v1.x * s;
-            r.y = v1.y * s;
-            r.z = v1.z * s;
+            r.x = v1.x / s;
+            r.y = v1.y / s;
+            r.z = v1.z / s;
         }
     };
 
@@ -195,6 +197,17 @@ namespace Phanes::Core::Math::Detail
         }
     };
 
+    template<>
+    struct compute_ivec3_div_magic<int, false>
+    {
+        static constexpr void map(Phanes::Core::Math::TIntVector3<int, false>& r, const Phanes::Core::Math::TIntVector3<int, false>& v1, const Phanes::Core::Math::IntDivisor& d)
+        {
+            r.x = v1.x / d;
+            r.y = v1.y / d;
+            r.z = v1.z / d;
+        }
+    };
+
     template<IntType T>
     struct compute_ivec3_eq<T, false>
     {
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Core/public/Math/Boilerplate.h"
+#include "Core/public/Math/IntDivisor.hpp"
 
 namespace Phanes::Core::Math::Detail
 {
@@ -22,6 +23,9 @@ namespace Phanes::Core::Math::Detail
     template<IntType T, bool S>
     struct compute_ivec4_mod {};
 
+    template<IntType T, bool S>
+    struct compute_ivec4_div_magic {};
+
     template<IntType T, bool S>
     struct compute_ivec4_eq {};
 
@@ -176,12 +180,10 @@ namespace Phanes::Core::Math::Detail
 
         static constexpr void map(Phanes::Core::Math::TIntVector4<T, false>& r, const Phanes::Core::Math::TIntVector4<T, false>& v1, T s)
         {
-            s = (T)1.0 / s;
-
-            r.x = v1.x * s;
-            r.y = v1.y * s;
-            r.z = v1.z * s;
-            r.w = v1.w * s;
+            r.x = v1.x / s;
+            r.y = v1.y / s;
+            r.z = v1.z / s;
+            r.w = v1.w / s;
         }
     };
 
@@ -205,6 +207,18 @@ namespace Phanes::Core::Math::Detail
         }
     };
 
+    template<>
+    struct compute_ivec4_div_magic<int, false>
+    {
+        static constexpr void map(Phanes::Core::Math::TIntVector4<int, false>& r, const Phanes::Core::Math::TIntVector4<int, false>& v1, const Phanes::Core::Math::IntDivisor& d)
+        {
+            r.x = v1.x / d;
+            r.y = v1.y / d;
+            r.z = v1.z / d;
+            r.w = v1.w / d;
+        }
+    };
+
     template<IntType T>
     struct compute_ivec4_eq<T, false>
     {
@@ -2,18 +2,32 @@
 
 #include "Core/public/Math/Boilerplate.h"
 #include "Core/public/Math/MathCommon.hpp"
+#include "Core/public/Math/SIMD/PhanesKernelsFPU.hpp"
 
 namespace Phanes::Core::Math::Detail
 {
     template<RealType T, bool S>
     struct compute_mat3_transpose {};
 
+    template<RealType T, bool S>
+    struct compute_mat3_det {};
+
+    template<RealType T, bool S>
+    struct compute_mat3_inv {};
+
+    template<RealType T, bool S>
+    struct compute_mat3_mul {};
+
+    template<RealType T, bool S>
+    struct compute_mat3_mul_vec {};
+
+
     template<RealType T>
     struct compute_mat3_transpose<T, false>
     {
         static constexpr void map(Phanes::Core::Math::TMatrix3<T, false>& r, const TMatrix3<T, false>& m1)
         {
-            r = TMatrix4<T, false>(m1(0, 0), m1(1, 0), m1(2, 0),
+            r = TMatrix3<T, false>(m1(0, 0), m1(1, 0), m1(2, 0),
                                    m1(0, 1), m1(1, 1), m1(2, 1),
                                    m1(0, 2), m1(1, 2), m1(2, 2)
                                    );
@@ -21,4 +35,40 @@ namespace Phanes::Core::Math::Detail
 
 
     };
+
+    template<RealType T>
+    struct compute_mat3_det<T, false>
+    {
+        static constexpr T map(const Phanes::Core::Math::TMatrix3<T, false>& m)
+        {
+            return Phanes::Core::Math::SIMD::FPU::mat3_det(&m.data[0][0]);
+        }
+    };
+
+    template<RealType T>
+    struct compute_mat3_inv<T, false>
+    {
+        static constexpr bool map(Phanes::Core::Math::TMatrix3<T, false>& r, const Phanes::Core::Math::TMatrix3<T, false>& m)
+        {
+            return Phanes::Core::Math::SIMD::FPU::mat3_inv(&r.data[0][0], &m.data[0][0]);
+        }
+    };
+
+    template<RealType T>
+    struct compute_mat3_mul<T, false>
+    {
+        static constexpr void map(Phanes::Core::Math::TMatrix3<T, false>& r, const Phanes::Core::Math::TMatrix3<T, false>& m1, const Phanes::Core::Math::TMatrix3<T, false>& m2)
+        {
+            Phanes::Core::Math::SIMD::FPU::mat3_mul(&r.data[0][0], &m1.data[0][0], &m2.data[0][0]);
+        }
+    };
+
+    template<RealType T>
+    struct compute_mat3_mul_vec<T, false>
+    {
+        static constexpr void map(Phanes::Core::Math::TVector3<T, false>& r, const Phanes::Core::Math::TMatrix3<T, false>& m, const Phanes::Core::Math::TVector3<T, false>& v)
+        {
+            Phanes::Core::Math::SIMD::FPU::mat3_mul_vec(&r.x, &m.data[0][0], &v.x);
+        }
+    };
 }
\ No newline at end of file
@@ -0,0 +1,218 @@
+#pragma once
+
+#include "Core/public/Math/Boilerplate.h"
+#include "Core/public/Math/MathCommon.hpp"
+
+namespace Phanes::Core::Math::Detail
+{
+    template<RealType T, bool S>
+    struct construct_quat {};
+
+    template<RealType T, bool S>
+    struct compute_quat_add {};
+
+    template<RealType T, bool S>
+    struct compute_quat_sub {};
+
+    template<RealType T, bool S>
+    struct compute_quat_scale {};
+
+    template<RealType T, bool S>
+    struct compute_quat_mul {};
+
+    template<RealType T, bool S>
+    struct compute_quat_dot {};
+
+    template<RealType T, bool S>
+    struct compute_quat_normalize {};
+
+    template<RealType T, bool S>
+    struct compute_quat_conjugate {};
+
+    template<RealType T, bool S>
+    struct compute_quat_rotate {};
+
+    template<RealType T, bool S>
+    struct compute_quat_eq {};
+
+
+    // The scalar maps are templates over S, so the FPU backend can reuse them for aligned quaternions.
+    // Results are computed into temporaries first, as r may alias the operands.
+
+    template<RealType T>
+    struct construct_quat<T, false>
+    {
+        template<bool S>
+        static constexpr void map(Phanes::Core::Math::TQuaternion<T, S>& q1, const Phanes::Core::Math::TQuaternion<T, S>& q2)
+        {
+            q1.x = q2.x;
+            q1.y = q2.y;
+            q1.z = q2.z;
+            q1.w = q2.w;
+        }
+
+        template<bool S>
+        static constexpr void map(Phanes::Core::Math::TQuaternion<T, S>& q1, T x, T y, T z, T w)
+        {
+            q1.x = x;
+            q1.y = y;
+            q1.z = z;
+            q1.w = w;
+        }
+
+        template<bool S>
+        static constexpr void map(Phanes::Core::Math::TQuaternion<T, S>& q1, const Phanes::Core::Math::TVector3<T, S>& v1, T w)
+        {
+            q1.x = v1.x;
+            q1.y = v1.y;
+            q1.z = v1.z;
+            q1.w = w;
+        }
+
+        template<bool S>
+        static constexpr void map(Phanes::Core::Math::TQuaternion<T, S>& q1, const T* comp)
+        {
+            q1.x = comp[0];
+            q1.y = comp[1];
+            q1.z = comp[2];
+            q1.w = comp[3];
+        }
+    };
+
+
+    template<RealType T>
+    struct compute_quat_add<T, false>
+    {
+        template<bool S>
+        static constexpr void map(Phanes::Core::Math::TQuaternion<T, S>& r, const Phanes::Core::Math::TQuaternion<T, S>& q1, const Phanes::Core::Math::TQuaternion<T, S>& q2)
+        {
+            r.x = q1.x + q2.x;
+            r.y = q1.y + q2.y;
+            r.z = q1.z + q2.z;
+            r.w = q1.w + q2.w;
+        }
+    };
+
+
+    template<RealType T>
+    struct compute_quat_sub<T, false>
+    {
+        template<bool S>
+        static constexpr void map(Phanes::Core::Math::TQuaternion<T, S>& r, const Phanes::Core::Math::TQuaternion<T, S>& q1, const Phanes::Core::Math::TQuaternion<T, S>& q2)
+        {
+            r.x = q1.x - q2.x;
+            r.y = q1.y - q2.y;
+            r.z = q1.z - q2.z;
+            r.w = q1.w - q2.w;
+        }
+    };
+
+
+    template<RealType T>
+    struct compute_quat_scale<T, false>
+    {
+        template<bool S>
+        static constexpr void map(Phanes::Core::Math::TQuaternion<T, S>& r, const Phanes::Core::Math::TQuaternion<T, S>& q1, T s)
+        {
+            r.x = q1.x * s;
+            r.y = q1.y * s;
+            r.z = q1.z * s;
+            r.w = q1.w * s;
+        }
+    };
+
+
+    template<RealType T>
+    struct compute_quat_mul<T, false>
+    {
+        // Hamilton product: (w1 * v2 + w2 * v1 + v1 x v2, w1 * w2 - v1 . v2)
+        template<bool S>
+        static constexpr void map(Phanes::Core::Math::TQuaternion<T, S>& r, const Phanes::Core::Math::TQuaternion<T, S>& q1, const Phanes::Core::Math::TQuaternion<T, S>& q2)
+        {
+            const T x = q1.w * q2.x + q1.x * q2.w + q1.y * q2.z - q1.z * q2.y;
+            const T y = q1.w * q2.y - q1.x * q2.z + q1.y * q2.w + q1.z * q2.x;
+            const T z = q1.w * q2.z + q1.x * q2.y - q1.y * q2.x + q1.z * q2.w;
+            const T w = q1.w * q2.w - q1.x * q2.x - q1.y * q2.y - q1.z * q2.z;
+
+            r.x = x;
+            r.y = y;
+            r.z = z;
+            r.w = w;
+        }
+    };
+
+
+    template<RealType T>
+    struct compute_quat_dot<T, false>
+    {
+        template<bool S>
+        static constexpr T map(const Phanes::Core::Math::TQuaternion<T, S>& q1, const Phanes::Core::Math::TQuaternion<T, S>& q2)
+        {
+            return q1.x * q2.x + q1.y * q2.y + q1.z * q2.z + q1.w * q2.w;
+        }
+    };
+
+
+    template<RealType T>
+    struct compute_quat_normalize<T, false>
+    {
+        // Scalar path is always exact.
+        template<bool S>
+        static constexpr void map(Phanes::Core::Math::TQuaternion<T, S>& r, const Phanes::Core::Math::TQuaternion<T, S>& q1, EPrecision)
+        {
+            T norm = sqrt(q1.x * q1.x + q1.y * q1.y + q1.z * q1.z + q1.w * q1.w);
+            norm = (norm < P_FLT_INAC) ? (T)1.0 : norm;
+
+            r.x = q1.x / norm;
+            r.y = q1.y / norm;
+            r.z = q1.z / norm;
+            r.w = q1.w / norm;
+        }
+    };
+
+
+    template<RealType T>
+    struct compute_quat_conjugate<T, false>
+    {
+        template<bool S>
+        static constexpr void map(Phanes::Core::Math::TQuaternion<T, S>& r, const Phanes::Core::Math::TQuaternion<T, S>& q1)
+        {
+            r.x = -q1.x;
+            r.y = -q1.y;
+            r.z = -q1.z;
+            r.w = q1.w;
+        }
+    };
+
+
+    template<RealType T>
+    struct compute_quat_rotate<T, false>
+    {
+        // v' = v + w * t + u x t, with t = 2 * (u x v) and u = (x, y, z). Two cross products instead of q * v * q^-1.
+        template<bool S>
+        static constexpr void map(Phanes::Core::Math::TVector3<T, S>& r, const Phanes::Core::Math::TQuaternion<T, S>& q1, const Phanes::Core::Math::TVector3<T, S>& v1)
+        {
+            const T tx = (T)2.0 * (q1.y * v1.z - q1.z * v1.y);
+            const T ty = (T)2.0 * (q1.z * v1.x - q1.x * v1.z);
+            const T tz = (T)2.0 * (q1.x * v1.y - q1.y * v1.x);
+
+            r = Phanes::Core::Math::TVector3<T, S>(v1.x + q1.w * tx + (q1.y * tz - q1.z * ty),
+                                                   v1.y + q1.w * ty + (q1.z * tx - q1.x * tz),
+                                                   v1.z + q1.w * tz + (q1.x * ty - q1.y * tx));
+        }
+    };
+
+
+    template<RealType T>
+    struct compute_quat_eq<T, false>
+    {
+        template<bool S>
+        static constexpr bool map(const Phanes::Core::Math::TQuaternion<T, S>& q1, const Phanes::Core::Math::TQuaternion<T, S>& q2, T threshold)
+        {
+            return (Abs(q1.x - q2.x) < threshold &&
+                    Abs(q1.y - q2.y) < threshold &&
+                    Abs(q1.z - q2.z) < threshold &&
+                    Abs(q1.w - q2.w) < threshold);
+        }
+    };
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Core/public/Math/Boilerplate.h"
+#include "Core/public/Math/MathCommon.hpp"
 
 namespace Phanes::Core::Math::Detail
 {
@@ -25,6 +26,12 @@ namespace Phanes::Core::Math::Detail
     template<RealType T, bool S>
     struct compute_vec3_ieq {};
 
+    template<RealType T, bool S>
+    struct compute_vec3_eq_mask {};
+
+    template<RealType T, bool S>
+    struct compute_vec3_lt_mask {};
+
     template<RealType T, bool S>
     struct compute_vec3_inc {};
 
@@ -34,6 +41,12 @@ namespace Phanes::Core::Math::Detail
     template<RealType T, bool S>
     struct compute_vec3_cross_p {};
 
+    template<RealType T, bool S>
+    struct compute_vec3_normalize {};
+
+    template<RealType T, bool S>
+    struct compute_vec3_rcp {};
+
 
 
     template<RealType T>
@@ -69,6 +82,7 @@ namespace Phanes::Core::Math::Detail
             v1.x = v2.x;
             v1.y = v2.y;
             v1.z = s;
+            v1.w = (T)0.0;
         }
 
 
@@ -159,14 +173,34 @@ namespace Phanes::Core::Math::Detail
         }
     };
 
+    template<RealType T>
+    struct compute_vec3_eq_mask<T, false>
+    {
+        static constexpr int map(const Phanes::Core::Math::TVector3<T, false>& v1, const Phanes::Core::Math::TVector3<T, false>& v2, T threshold)
+        {
+            return ((int)(Phanes::Core::Math::Abs(v1.x - v2.x) < threshold) << 0) |
+                   ((int)(Phanes::Core::Math::Abs(v1.y - v2.y) < threshold) << 1) |
+                   ((int)(Phanes::Core::Math::Abs(v1.z - v2.z) < threshold) << 2);
+        }
+    };
+
+    template<RealType T>
+    struct compute_vec3_lt_mask<T, false>
+    {
+        static constexpr int map(const Phanes::Core::Math::TVector3<T, false>& v1, const Phanes::Core::Math::TVector3<T, false>& v2)
+        {
+            return ((int)(v1.x < v2.x) << 0) |
+                   ((int)(v1.y < v2.y) << 1) |
+                   ((int)(v1.z < v2.z) << 2);
+        }
+    };
+
     template<RealType T>
     struct compute_vec3_eq<T, false>
     {
         static constexpr bool map(const Phanes::Core::Math::TVector3<T, false>& v1, const Phanes::Core::Math::TVector3<T, false>& v2)
         {
-            return (Phanes::Core::Math::Abs(v1.x - v2.x) < P_FLT_INAC &&
-                Phanes::Core::Math::Abs(v1.y - v2.y) < P_FLT_INAC &&
-                Phanes::Core::Math::Abs(v1.z - v2.z) < P_FLT_INAC);
+            return compute_vec3_eq_mask<T, false>::map(v1, v2, (T)P_FLT_INAC) == 0x7;
         }
     };
 
@@ -175,9 +209,7 @@ namespace Phanes::Core::Math::Detail
     {
         static constexpr bool map(const Phanes::Core::Math::TVector3<T, false>& v1, const Phanes::Core::Math::TVector3<T, false>& v2)
         {
-            return (Phanes::Core::Math::Abs(v1.x - v2.x) > P_FLT_INAC ||
-                Phanes::Core::Math::Abs(v1.y - v2.y) > P_FLT_INAC ||
-                Phanes::Core::Math::Abs(v1.z - v2.z) > P_FLT_INAC);
+            return compute_vec3_eq_mask<T, false>::map(v1, v2, (T)P_FLT_INAC) != 0x7;
         }
     };
 
@@ -213,5 +245,33 @@ namespace Phanes::Core::Math::Detail
             r.z = (v1.x * v2.y) - (v1.y * v2.x);
         }
     };
-}
 
+    template<RealType T>
+    struct compute_vec3_normalize<T, false>
+    {
+        // Scalar path is always exact.
+        static constexpr void map(Phanes::Core::Math::TVector3<T, false>& r, const Phanes::Core::Math::TVector3<T, false>& v1, EPrecision)
+        {
+            T vecNorm = sqrt(v1.x * v1.x + v1.y * v1.y + v1.z * v1.z);
+            vecNorm = (vecNorm < P_FLT_INAC) ? (T)1.0 : vecNorm;
+
+            r.x = v1.x / vecNorm;
+            r.y = v1.y / vecNorm;
+            r.z = v1.z / vecNorm;
+            r.w = (T)0.0;
+        }
+    };
+
+    template<RealType T>
+    struct compute_vec3_rcp<T, false>
+    {
+        // Scalar path is always exact.
+        static constexpr void map(Phanes::Core::Math::TVector3<T, false>& r, const Phanes::Core::Math::TVector3<T, false>& v1, EPrecision)
+        {
+            r.x = (T)1.0 / v1.x;
+            r.y = (T)1.0 / v1.y;
+            r.z = (T)1.0 / v1.z;
+            r.w = (T)0.0;
+        }
+    };
+}
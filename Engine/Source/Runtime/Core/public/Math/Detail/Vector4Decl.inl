@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Core/public/Math/Boilerplate.h"
+#include "Core/public/Math/MathCommon.hpp"
 
 namespace Phanes::Core::Math::Detail
 {
@@ -25,12 +26,27 @@ namespace Phanes::Core::Math::Detail
     template<RealType T, bool S>
     struct compute_vec4_ieq {};
 
+    template<RealType T, bool S>
+    struct compute_vec4_eq_mask {};
+
+    template<RealType T, bool S>
+    struct compute_vec4_lt_mask {};
+
     template<RealType T, bool S>
     struct compute_vec4_inc {};
 
     template<RealType T, bool S>
     struct compute_vec4_dec {};
 
+    template<RealType T, bool S>
+    struct compute_vec4_dot {};
+
+    template<RealType T, bool S>
+    struct compute_vec4_normalize {};
+
+    template<RealType T, bool S>
+    struct compute_vec4_rcp {};
+
 
 
     template<RealType T>
@@ -38,7 +54,7 @@ namespace Phanes::Core::Math::Detail
     {
         static constexpr void map(Phanes::Core::Math::TVector4<T, false>& v1, const TVector4<T, false>& v2)
         {
-            memcpy(v1.data, v2.data, 4 * sizeof(T));
+            memcpy(v1.data.data, v2.data.data, 4 * sizeof(T));
         }
 
 
@@ -69,7 +85,7 @@ namespace Phanes::Core::Math::Detail
 
         static constexpr void map(Phanes::Core::Math::TVector4<T, false>& v1, const T* comp)
         {
-            memcpy(v1.data, comp, 4 * sizeof(T));
+            memcpy(v1.data.data, comp, 4 * sizeof(T));
         }
     };
 
@@ -159,15 +175,36 @@ namespace Phanes::Core::Math::Detail
         }
     };
 
+    template<RealType T>
+    struct compute_vec4_eq_mask<T, false>
+    {
+        static constexpr int map(const Phanes::Core::Math::TVector4<T, false>& v1, const Phanes::Core::Math::TVector4<T, false>& v2, T threshold)
+        {
+            return ((int)(Phanes::Core::Math::Abs(v1.x - v2.x) < threshold) << 0) |
+                   ((int)(Phanes::Core::Math::Abs(v1.y - v2.y) < threshold) << 1) |
+                   ((int)(Phanes::Core::Math::Abs(v1.z - v2.z) < threshold) << 2) |
+                   ((int)(Phanes::Core::Math::Abs(v1.w - v2.w) < threshold) << 3);
+        }
+    };
+
+    template<RealType T>
+    struct compute_vec4_lt_mask<T, false>
+    {
+        static constexpr int map(const Phanes::Core::Math::TVector4<T, false>& v1, const Phanes::Core::Math::TVector4<T, false>& v2)
+        {
+            return ((int)(v1.x < v2.x) << 0) |
+                   ((int)(v1.y < v2.y) << 1) |
+                   ((int)(v1.z < v2.z) << 2) |
+                   ((int)(v1.w < v2.w) << 3);
+        }
+    };
+
     template<RealType T>
     struct compute_vec4_eq<T, false>
     {
         static constexpr bool map(const Phanes::Core::Math::TVector4<T, false>& v1, const Phanes::Core::Math::TVector4<T, false>& v2)
         {
-            return (Phanes::Core::Math::Abs(v1.x - v2.x) < P_FLT_INAC &&
-                    Phanes::Core::Math::Abs(v1.y - v2.y) < P_FLT_INAC &&
-                    Phanes::Core::Math::Abs(v1.z - v2.z) < P_FLT_INAC &&
-                    Phanes::Core::Math::Abs(v1.w - v2.w) < P_FLT_INAC);
+            return compute_vec4_eq_mask<T, false>::map(v1, v2, (T)P_FLT_INAC) == 0xF;
         }
     };
 
@@ -176,10 +213,7 @@ namespace Phanes::Core::Math::Detail
     {
         static constexpr bool map(const Phanes::Core::Math::TVector4<T, false>& v1, const Phanes::Core::Math::TVector4<T, false>& v2)
         {
-            return (Phanes::Core::Math::Abs(v1.x - v2.x) > P_FLT_INAC ||
-                    Phanes::Core::Math::Abs(v1.y - v2.y) > P_FLT_INAC ||
-                    Phanes::Core::Math::Abs(v1.z - v2.z) > P_FLT_INAC ||
-                    Phanes::Core::Math::Abs(v1.w - v2.w) > P_FLT_INAC);
+            return compute_vec4_eq_mask<T, false>::map(v1, v2, (T)P_FLT_INAC) != 0xF;
         }
     };
 
@@ -206,5 +240,33 @@ namespace Phanes::Core::Math::Detail
             r.w = v1.w - 1;
         }
     };
-}
 
+    template<RealType T>
+    struct compute_vec4_normalize<T, false>
+    {
+        // Scalar path is always exact.
+        static constexpr void map(Phanes::Core::Math::TVector4<T, false>& r, const Phanes::Core::Math::TVector4<T, false>& v1, EPrecision)
+        {
+            T vecNorm = sqrt(v1.x * v1.x + v1.y * v1.y + v1.z * v1.z + v1.w * v1.w);
+            vecNorm = (vecNorm < P_FLT_INAC) ? (T)1.0 : vecNorm;
+
+            r.x = v1.x / vecNorm;
+            r.y = v1.y / vecNorm;
+            r.z = v1.z / vecNorm;
+            r.w = v1.w / vecNorm;
+        }
+    };
+
+    template<RealType T>
+    struct compute_vec4_rcp<T, false>
+    {
+        // Scalar path is always exact.
+        static constexpr void map(Phanes::Core::Math::TVector4<T, false>& r, const Phanes::Core::Math::TVector4<T, false>& v1, EPrecision)
+        {
+            r.x = (T)1.0 / v1.x;
+            r.y = (T)1.0 / v1.y;
+            r.z = (T)1.0 / v1.z;
+            r.w = (T)1.0 / v1.w;
+        }
+    };
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstddef>
+
+#include "Core/public/Math/Boilerplate.h"
+
+namespace Phanes::Core::Math::Detail
+{
+    // Transposes N four-component vectors (array of structures) into four lane arrays (structure of arrays).
+
+    template<RealType T, size_t N>
+    struct compute_vec4p_load
+    {
+        static FORCEINLINE void map(T* x, T* y, T* z, T* w, const T* v)
+        {
+            for (size_t i = 0; i < N; ++i)
+            {
+                x[i] = v[i * 4 + 0];
+                y[i] = v[i * 4 + 1];
+                z[i] = v[i * 4 + 2];
+                w[i] = v[i * 4 + 3];
+            }
+        }
+    };
+
+    // Transposes four lane arrays back into N four-component vectors.
+
+    template<RealType T, size_t N>
+    struct compute_vec4p_store
+    {
+        static FORCEINLINE void map(T* v, const T* x, const T* y, const T* z, const T* w)
+        {
+            for (size_t i = 0; i < N; ++i)
+            {
+                v[i * 4 + 0] = x[i];
+                v[i * 4 + 1] = y[i];
+                v[i * 4 + 2] = z[i];
+                v[i * 4 + 3] = w[i];
+            }
+        }
+    };
+}
@@ -0,0 +1,266 @@
+#pragma once
+
+// Dual quaternion real + eps * dual, describing a rigid transform (rotation and translation, no scale).
+//
+// For a unit dual quaternion, real is the rotation and dual = 0.5 * (t, 0) * real holds the translation t.
+// Blends of unit dual quaternions stay rigid after normalization, which is used for skinning (see SkinningBatch.hpp).
+
+#include <cstddef>
+
+#include "Core/public/Math/Boilerplate.h"
+#include "Core/public/Math/MathCommon.hpp"
+
+#include "Core/public/Math/MathFwd.h"
+
+#include "Core/public/Math/Vector3.hpp"
+#include "Core/public/Math/Matrix4.hpp"
+#include "Core/public/Math/Quaternion.hpp"
+#include "Core/public/Math/Transform.hpp"
+
+
+#ifndef DUALQUATERNION_H
+#define DUALQUATERNION_H
+
+namespace Phanes::Core::Math
+{
+
+    /// <summary>
+    /// Dual quaternion.
+    /// </summary>
+    /// <typeparam name="T">Type of dual quaternion</typeparam>
+    /// <typeparam name="S">Quaternion types are aligned</typeparam>
+    template<RealType T, bool S = false>
+    struct TDualQuaternion
+    {
+    public:
+
+        using Real = T;
+
+        /// <summary>
+        /// Real part (rotation)
+        /// </summary>
+        TQuaternion<Real, S> real;
+
+        /// <summary>
+        /// Dual part (translation)
+        /// </summary>
+        TQuaternion<Real, S> dual;
+
+    public:
+
+        /// Default constructor
+        TDualQuaternion() = default;
+
+        /// <summary>
+        /// Construct dual quaternion from real and dual part.
+        /// </summary>
+        /// <param name="real">Real part</param>
+        /// <param name="dual">Dual part</param>
+        TDualQuaternion(const TQuaternion<Real, S>& real, const TQuaternion<Real, S>& dual) :
+            real(real),
+            dual(dual)
+        {}
+
+        /// <summary>
+        /// Construct dual quaternion from a rotation and a translation. The rotation is applied first.
+        /// </summary>
+        /// <param name="rotation">Rotation (unit quaternion)</param>
+        /// <param name="translation">Translation</param>
+        TDualQuaternion(const TQuaternion<Real, S>& rotation, const TVector3<Real, S>& translation) :
+            real(rotation),
+            dual(TQuaternion<Real, S>(translation.x * (Real)0.5, translation.y * (Real)0.5, translation.z * (Real)0.5, (Real)0.0) * rotation)
+        {}
+
+        /// <summary>
+        /// Gets the identity transform.
+        /// </summary>
+        static TDualQuaternion<Real, S> Identity()
+        {
+            return TDualQuaternion<Real, S>(TQuaternion<Real, S>::Identity(), TQuaternion<Real, S>((Real)0.0, (Real)0.0, (Real)0.0, (Real)0.0));
+        }
+    };
+
+
+    // ============================= //
+    //   TDualQuaternion operators   //
+    // ============================= //
+
+
+    /// <summary>
+    /// Concatenates two rigid transforms, so that dq2 is applied first.
+    /// </summary>
+    /// <param name="dq1">Outer transform</param>
+    /// <param name="dq2">Inner transform</param>
+    /// <returns>Product dq1 * dq2</returns>
+    template<RealType T, bool S>
+    TDualQuaternion<T, S> operator* (const TDualQuaternion<T, S>& dq1, const TDualQuaternion<T, S>& dq2)
+    {
+        return TDualQuaternion<T, S>(dq1.real * dq2.real, dq1.real * dq2.dual + dq1.dual * dq2.real);
+    }
+
+    /// <summary>
+    /// Scales both parts of a dual quaternion.
+    /// </summary>
+    /// <param name="dq1">Dual quaternion</param>
+    /// <param name="s">Scalar</param>
+    /// <returns>Scaled dual quaternion</returns>
+    template<RealType T, bool S>
+    TDualQuaternion<T, S> operator* (const TDualQuaternion<T, S>& dq1, T s)
+    {
+        return TDualQuaternion<T, S>(dq1.real * s, dq1.dual * s);
+    }
+
+    /// <summary>
+    /// Adds two dual quaternions component wise.
+    /// </summary>
+    /// <param name="dq1">Dual quaternion one</param>
+    /// <param name="dq2">Dual quaternion two</param>
+    /// <returns>Sum</returns>
+    template<RealType T, bool S>
+    TDualQuaternion<T, S> operator+ (const TDualQuaternion<T, S>& dq1, const TDualQuaternion<T, S>& dq2)
+    {
+        return TDualQuaternion<T, S>(dq1.real + dq2.real, dq1.dual + dq2.dual);
+    }
+
+    /// <summary>
+    /// Tests two dual quaternions for equality.
+    /// </summary>
+    /// <param name="dq1">Dual quaternion one</param>
+    /// <param name="dq2">Dual quaternion two</param>
+    /// <returns>True, if all components are equal within P_FLT_INAC.</returns>
+    template<RealType T, bool S>
+    bool operator== (const TDualQuaternion<T, S>& dq1, const TDualQuaternion<T, S>& dq2)
+    {
+        return dq1.real == dq2.real && dq1.dual == dq2.dual;
+    }
+
+    /// <summary>
+    /// Tests two dual quaternions for inequality.
+    /// </summary>
+    /// <param name="dq1">Dual quaternion one</param>
+    /// <param name="dq2">Dual quaternion two</param>
+    /// <returns>True, if any component differs by P_FLT_INAC or more.</returns>
+    template<RealType T, bool S>
+    bool operator!= (const TDualQuaternion<T, S>& dq1, const TDualQuaternion<T, S>& dq2)
+    {
+        return !(dq1 == dq2);
+    }
+
+
+    // ============================= //
+    //   TDualQuaternion functions   //
+    // ============================= //
+
+
+    /// <summary>
+    /// Gets the dual quaternion of a transform. The scale is dropped, as dual quaternions are rigid.
+    /// </summary>
+    /// <param name="tr">Transform</param>
+    /// <returns>Unit dual quaternion</returns>
+    template<RealType T, bool S>
+    TDualQuaternion<T, S> DualQuaternionFromTransform(const TTransform<T, S>& tr)
+    {
+        return TDualQuaternion<T, S>(tr.rotation, tr.location);
+    }
+
+    /// <summary>
+    /// Gets the translation of a unit dual quaternion.
+    /// </summary>
+    /// <param name="dq1">Unit dual quaternion</param>
+    /// <returns>Translation</returns>
+    template<RealType T, bool S>
+    TVector3<T, S> GetTranslation(const TDualQuaternion<T, S>& dq1)
+    {
+        const TQuaternion<T, S> t = dq1.dual * Conjugate(dq1.real);
+        return TVector3<T, S>(t.x * (T)2.0, t.y * (T)2.0, t.z * (T)2.0);
+    }
+
+    /// <summary>
+    /// Normalizes a dual quaternion, so that the real part has unit length.
+    /// </summary>
+    /// <param name="dq1">Dual quaternion (real part not 0)</param>
+    /// <returns>Unit dual quaternion</returns>
+    template<RealType T, bool S>
+    TDualQuaternion<T, S> Normalize(const TDualQuaternion<T, S>& dq1)
+    {
+        const T invLength = (T)1.0 / Magnitude(dq1.real);
+        return TDualQuaternion<T, S>(dq1.real * invLength, dq1.dual * invLength);
+    }
+
+    /// <summary>
+    /// Gets the quaternion conjugate of both parts. For unit dual quaternions this is the inverse transform.
+    /// </summary>
+    /// <param name="dq1">Dual quaternion</param>
+    /// <returns>Conjugated dual quaternion</returns>
+    template<RealType T, bool S>
+    TDualQuaternion<T, S> Conjugate(const TDualQuaternion<T, S>& dq1)
+    {
+        return TDualQuaternion<T, S>(Conjugate(dq1.real), Conjugate(dq1.dual));
+    }
+
+    /// <summary>
+    /// Transforms a point by a unit dual quaternion.
+    /// </summary>
+    /// <param name="dq1">Unit dual quaternion</param>
+    /// <param name="p1">Point</param>
+    /// <returns>Transformed point</returns>
+    template<RealType T, bool S>
+    TVector3<T, S> TransformPoint(const TDualQuaternion<T, S>& dq1, const TVector3<T, S>& p1)
+    {
+        return Rotate(dq1.real, p1) + GetTranslation(dq1);
+    }
+
+    /// <summary>
+    /// Transforms a direction by a unit dual quaternion. Translation does not apply.
+    /// </summary>
+    /// <param name="dq1">Unit dual quaternion</param>
+    /// <param name="v1">Direction</param>
+    /// <returns>Rotated direction</returns>
+    template<RealType T, bool S>
+    TVector3<T, S> TransformDirection(const TDualQuaternion<T, S>& dq1, const TVector3<T, S>& v1)
+    {
+        return Rotate(dq1.real, v1);
+    }
+
+    /// <summary>
+    /// Gets the rigid transform matrix of a unit dual quaternion.
+    /// </summary>
+    /// <param name="dq1">Unit dual quaternion</param>
+    /// <returns>Affine matrix</returns>
+    template<RealType T, bool S>
+    TMatrix4<T, S> ToMatrix4(const TDualQuaternion<T, S>& dq1)
+    {
+        TMatrix4<T, S> r = ToMatrix4(dq1.real);
+        const TVector3<T, S> t = GetTranslation(dq1);
+
+        r(0, 3) = t.x;
+        r(1, 3) = t.y;
+        r(2, 3) = t.z;
+
+        return r;
+    }
+
+    /// <summary>
+    /// Blends dual quaternions linearly and normalizes the result (DLB). Weights of parts with a real part opposite to the first are negated, so the blend takes the shortest path.
+    /// </summary>
+    /// <param name="dq">Unit dual quaternions</param>
+    /// <param name="weights">Weight per dual quaternion</param>
+    /// <param name="n">Number of dual quaternions (at least 1)</param>
+    /// <returns>Unit dual quaternion</returns>
+    template<RealType T, bool S>
+    TDualQuaternion<T, S> Blend(const TDualQuaternion<T, S>* dq, const T* weights, size_t n)
+    {
+        TDualQuaternion<T, S> r = dq[0] * weights[0];
+
+        for (size_t i = 1; i < n; ++i)
+        {
+            const T w = (DotP(dq[0].real, dq[i].real) < (T)0.0) ? -weights[i] : weights[i];
+            r = r + dq[i] * w;
+        }
+
+        return Normalize(r);
+    }
+
+} // Phanes::Core::Math
+
+#endif // !DUALQUATERNION_H
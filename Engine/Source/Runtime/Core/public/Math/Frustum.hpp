@@ -0,0 +1,191 @@
+#pragma once
+
+// View frustum as six planes, extracted from a view projection matrix. The plane normals point inside.
+//
+// Arrays of spheres and boxes are culled with FrustumBatch.hpp.
+
+#include "Core/public/Math/Boilerplate.h"
+
+#include "Core/public/Math/MathCommon.hpp"
+#include "Core/public/Math/MathFwd.h"
+
+#include "Core/public/Math/Vector3.hpp"
+#include "Core/public/Math/Matrix4.hpp"
+#include "Core/public/Math/Plane.hpp"
+
+
+#ifndef FRUSTUM_H
+#define FRUSTUM_H
+
+namespace Phanes::Core::Math {
+
+    /// <summary>
+    /// Depth range of the clip space, after the perspective divide.
+    /// </summary>
+    enum class EClipDepth
+    {
+        /// Direct3D / Vulkan
+        ZeroToOne,
+
+        /// OpenGL
+        MinusOneToOne
+    };
+
+    /// <summary>
+    /// Frustum bounded by six planes. A point is inside, if it is on the front side of all planes.
+    /// </summary>
+    /// <typeparam name="T">Type of frustum</typeparam>
+    /// <typeparam name="S">Vector type is aligned</typeparam>
+    template<RealType T, bool S>
+    struct TFrustum
+    {
+    public:
+
+        using Real = T;
+
+        /// <summary>
+        /// Index of each plane in planes.
+        /// </summary>
+        enum EPlane
+        {
+            Left = 0,
+            Right,
+            Bottom,
+            Top,
+            Near,
+            Far,
+
+            PlaneCount
+        };
+
+        /// <summary>
+        /// Normalized planes, with the normals pointing inside.
+        /// </summary>
+        TPlane<Real, S> planes[PlaneCount];
+
+    public:
+
+        /// Default constructor
+        TFrustum() = default;
+    };
+
+
+    namespace Detail
+    {
+        // Builds the plane w3 * row3 + s * row(i) of m (Gribb / Hartmann) and normalizes it.
+        template<RealType T, bool S>
+        TPlane<T, S> frustum_plane(const TMatrix4<T, S>& m, T w3, int i, T s)
+        {
+            // The clip space condition w3 * w + s * c >= 0 is (a, b, c) * p + e >= 0, which is the plane (a, b, c) * p = -e.
+            TPlane<T, S> pl(w3 * m(3, 0) + s * m(i, 0),
+                            w3 * m(3, 1) + s * m(i, 1),
+                            w3 * m(3, 2) + s * m(i, 2),
+                            -(w3 * m(3, 3) + s * m(i, 3)));
+
+            PlaneNormalizeV(pl);
+            return pl;
+        }
+    }
+
+
+    // ========================= //
+    //   Functions of TFrustum   //
+    // ========================= //
+
+
+    /// <summary>
+    /// Extracts the frustum from a view projection matrix. Points p with m * (p, 1) inside the clip volume are inside the frustum.
+    /// </summary>
+    /// <param name="m">View projection matrix (for column vectors)</param>
+    /// <param name="depth">Depth range of the clip space</param>
+    /// <returns>Frustum with normalized planes</returns>
+    /// <remarks>With a model view projection matrix, the frustum is in model space.</remarks>
+    template<RealType T, bool S>
+    TFrustum<T, S> ExtractFrustum(const TMatrix4<T, S>& m, EClipDepth depth = EClipDepth::ZeroToOne)
+    {
+        using F = TFrustum<T, S>;
+
+        F f;
+
+        f.planes[F::Left]   = Detail::frustum_plane(m, (T)1.0, 0, (T)1.0);
+        f.planes[F::Right]  = Detail::frustum_plane(m, (T)1.0, 0, (T)-1.0);
+        f.planes[F::Bottom] = Detail::frustum_plane(m, (T)1.0, 1, (T)1.0);
+        f.planes[F::Top]    = Detail::frustum_plane(m, (T)1.0, 1, (T)-1.0);
+        f.planes[F::Near]   = Detail::frustum_plane(m, (depth == EClipDepth::ZeroToOne) ? (T)0.0 : (T)1.0, 2, (T)1.0);
+        f.planes[F::Far]    = Detail::frustum_plane(m, (T)1.0, 2, (T)-1.0);
+
+        return f;
+    }
+
+    /// <summary>
+    /// Tests whether a point is inside the frustum.
+    /// </summary>
+    /// <param name="f">Frustum</param>
+    /// <param name="p1">Point</param>
+    /// <returns>True, if p1 is inside or on the boundary.</returns>
+    template<RealType T, bool S>
+    bool IsPointVisible(const TFrustum<T, S>& f, const TVector3<T, S>& p1)
+    {
+        for (const TPlane<T, S>& pl : f.planes)
+        {
+            if (PointDistance(pl, p1) < (T)0.0)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    /// <summary>
+    /// Tests whether a sphere is at least partially inside the frustum.
+    /// </summary>
+    /// <param name="f">Frustum</param>
+    /// <param name="center">Center of sphere</param>
+    /// <param name="radius">Radius of sphere</param>
+    /// <returns>True, if the sphere is not entirely behind any plane.</returns>
+    /// <remarks>Conservative: Spheres near a corner of the frustum may be reported visible, although they are outside.</remarks>
+    template<RealType T, bool S>
+    bool IsSphereVisible(const TFrustum<T, S>& f, const TVector3<T, S>& center, T radius)
+    {
+        for (const TPlane<T, S>& pl : f.planes)
+        {
+            if (PointDistance(pl, center) < -radius)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    /// <summary>
+    /// Tests whether an axis aligned box is at least partially inside the frustum.
+    /// </summary>
+    /// <param name="f">Frustum</param>
+    /// <param name="min">Minimum corner of box</param>
+    /// <param name="max">Maximum corner of box</param>
+    /// <returns>True, if the box is not entirely behind any plane.</returns>
+    /// <remarks>Conservative: Boxes near a corner of the frustum may be reported visible, although they are outside.</remarks>
+    template<RealType T, bool S>
+    bool IsAABBVisible(const TFrustum<T, S>& f, const TVector3<T, S>& min, const TVector3<T, S>& max)
+    {
+        for (const TPlane<T, S>& pl : f.planes)
+        {
+            // Corner furthest along the normal.
+            const TVector3<T, S> p1((pl.x >= (T)0.0) ? max.x : min.x,
+                                    (pl.y >= (T)0.0) ? max.y : min.y,
+                                    (pl.z >= (T)0.0) ? max.z : min.z);
+
+            if (PointDistance(pl, p1) < (T)0.0)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+} // Phanes::Core::Math
+
+#endif // !FRUSTUM_H
@@ -0,0 +1,293 @@
+#pragma once
+
+// Culling of sphere and box arrays against a TFrustum<float>. Kernels are selected through SIMD/Dispatch.h.
+//
+// The planes are loaded once per call and each kernel tests a block of objects against all planes at once.
+// Results are either a visibility mask with one bit per object (bit i % 32 of word i / 32), or a compacted list with the indices of the visible objects.
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+
+#include "Core/public/Math/Boilerplate.h"
+#include "Core/public/Math/SIMD/Dispatch.h"
+
+#include "Core/public/Math/Vector3.hpp"
+#include "Core/public/Math/Vector4.hpp"
+#include "Core/public/Math/Frustum.hpp"
+#include "Core/public/Math/AABB.hpp"
+#include "Core/public/Math/Sphere.hpp"
+
+
+namespace Phanes::Core::Math
+{
+    static_assert(sizeof(TVector3<float, false>) == 4 * sizeof(float), "TVector3<float> must be padded to xyzw.");
+
+    namespace Detail
+    {
+        // Number of objects culled per chunk, when writing indices.
+        constexpr size_t BatchCullChunk = 1024;
+
+        // Packs the frustum planes as (a, b, c, d) for the culling kernels.
+        template<bool S>
+        FORCEINLINE void batch_frustum_planes(float* r, const TFrustum<float, S>& f)
+        {
+            for (int i = 0; i < TFrustum<float, S>::PlaneCount; ++i)
+            {
+                r[i * 4]     = f.planes[i].x;
+                r[i * 4 + 1] = f.planes[i].y;
+                r[i * 4 + 2] = f.planes[i].z;
+                r[i * 4 + 3] = f.planes[i].d;
+            }
+        }
+
+        // Layout of TSphere<float> and TAABB<float> in floats, for the strided kernels. radius and max directly follow the first vector.
+        template<bool S>
+        constexpr size_t BatchSphereStride = sizeof(TSphere<float, S>) / sizeof(float);
+
+        template<bool S>
+        constexpr size_t BatchSphereRadius = sizeof(TVector3<float, S>) / sizeof(float);
+
+        template<bool S>
+        constexpr size_t BatchAABBStride = sizeof(TAABB<float, S>) / sizeof(float);
+
+        template<bool S>
+        constexpr size_t BatchAABBMax = sizeof(TVector3<float, S>) / sizeof(float);
+
+        // Number of objects, that fit into a mask of maskWords words.
+        FORCEINLINE size_t batch_cull_count(size_t maskWords, size_t n)
+        {
+            return (maskWords * 32 < n) ? maskWords * 32 : n;
+        }
+    }
+
+    /// <summary>
+    /// Writes the indices of the set bits of a visibility mask in ascending order.
+    /// </summary>
+    /// <param name="indices">Indices of visible objects</param>
+    /// <param name="visible">Visibility mask</param>
+    /// <param name="n">Number of objects in the mask</param>
+    /// <param name="offset">Value added to each index</param>
+    /// <returns>Number of indices written. Stops, when indices is full.</returns>
+    inline size_t CompactVisible(std::span<uint32_t> indices, std::span<const uint32_t> visible, size_t n, uint32_t offset = 0)
+    {
+        size_t count = 0;
+
+        for (size_t w = 0; w < (n + 31) / 32 && w < visible.size(); ++w)
+        {
+            uint32_t bits = visible[w];
+
+            // Bits past n are never set by the culling functions, but may be by hand.
+            if (n - w * 32 < 32)
+            {
+                bits &= (1u << (n - w * 32)) - 1u;
+            }
+
+            while (bits != 0)
+            {
+                if (count == indices.size())
+                {
+                    return count;
+                }
+
+                indices[count++] = offset + (uint32_t)(w * 32) + (uint32_t)std::countr_zero(bits);
+                bits &= bits - 1u;
+            }
+        }
+
+        return count;
+    }
+
+    /// <summary>
+    /// Culls spheres against the frustum. Spheres are stored as center (xyz) and radius (w).
+    /// </summary>
+    /// <param name="visible">Visibility mask ((n + 31) / 32 words). Bit i % 32 of word i / 32 is set, if sphere i is visible.</param>
+    /// <param name="f">Frustum</param>
+    /// <param name="spheres">Spheres</param>
+    /// <remarks>Only as many spheres, as the mask holds bits for, are culled.</remarks>
+    template<bool S>
+    void CullSpheres(std::span<uint32_t> visible, const TFrustum<float, S>& f, std::span<const std::type_identity_t<TVector4<float, S>>> spheres)
+    {
+        alignas(16) float p[24];
+        Detail::batch_frustum_planes(p, f);
+
+        const float* s = reinterpret_cast<const float*>(spheres.data());
+        SIMD::GetDispatchTable().cull_sphere_array(visible.data(), p, 6, s, s + 3, 4, Detail::batch_cull_count(visible.size(), spheres.size()));
+    }
+
+    /// <summary>
+    /// Culls axis aligned boxes against the frustum.
+    /// </summary>
+    /// <param name="visible">Visibility mask ((n + 31) / 32 words). Bit i % 32 of word i / 32 is set, if box i is visible.</param>
+    /// <param name="f">Frustum</param>
+    /// <param name="mins">Minimum corners</param>
+    /// <param name="maxs">Maximum corners</param>
+    /// <remarks>Only as many boxes, as the mask holds bits for, are culled.</remarks>
+    template<bool S>
+    void CullAABBs(std::span<uint32_t> visible, const TFrustum<float, S>& f, std::span<const std::type_identity_t<TVector3<float, S>>> mins, std::span<const std::type_identity_t<TVector3<float, S>>> maxs)
+    {
+        alignas(16) float p[24];
+        Detail::batch_frustum_planes(p, f);
+
+        const size_t n = Detail::batch_cull_count(visible.size(), (mins.size() < maxs.size()) ? mins.size() : maxs.size());
+        SIMD::GetDispatchTable().cull_aabb_array(visible.data(), p, 6, reinterpret_cast<const float*>(mins.data()), reinterpret_cast<const float*>(maxs.data()), 4, n);
+    }
+
+    /// <summary>
+    /// Culls spheres against the frustum and writes the indices of the visible ones. Spheres are stored as center (xyz) and radius (w).
+    /// </summary>
+    /// <param name="indices">Indices of visible spheres in ascending order</param>
+    /// <param name="f">Frustum</param>
+    /// <param name="spheres">Spheres</param>
+    /// <returns>Number of indices written. Stops, when indices is full.</returns>
+    template<bool S>
+    size_t CullSpheresToIndices(std::span<uint32_t> indices, const TFrustum<float, S>& f, std::span<const std::type_identity_t<TVector4<float, S>>> spheres)
+    {
+        const SIMD::DispatchTable& t = SIMD::GetDispatchTable();
+
+        alignas(16) float p[24];
+        Detail::batch_frustum_planes(p, f);
+
+        uint32_t visible[Detail::BatchCullChunk / 32];
+
+        size_t count = 0;
+        for (size_t i = 0; i < spheres.size() && count < indices.size(); i += Detail::BatchCullChunk)
+        {
+            const size_t n = (spheres.size() - i < Detail::BatchCullChunk) ? spheres.size() - i : Detail::BatchCullChunk;
+            const float* s = reinterpret_cast<const float*>(spheres.data() + i);
+
+            t.cull_sphere_array(visible, p, 6, s, s + 3, 4, n);
+            count += CompactVisible(indices.subspan(count), visible, n, (uint32_t)i);
+        }
+
+        return count;
+    }
+
+    /// <summary>
+    /// Culls axis aligned boxes against the frustum and writes the indices of the visible ones.
+    /// </summary>
+    /// <param name="indices">Indices of visible boxes in ascending order</param>
+    /// <param name="f">Frustum</param>
+    /// <param name="mins">Minimum corners</param>
+    /// <param name="maxs">Maximum corners</param>
+    /// <returns>Number of indices written. Stops, when indices is full.</returns>
+    template<bool S>
+    size_t CullAABBsToIndices(std::span<uint32_t> indices, const TFrustum<float, S>& f, std::span<const std::type_identity_t<TVector3<float, S>>> mins, std::span<const std::type_identity_t<TVector3<float, S>>> maxs)
+    {
+        const SIMD::DispatchTable& t = SIMD::GetDispatchTable();
+
+        alignas(16) float p[24];
+        Detail::batch_frustum_planes(p, f);
+
+        uint32_t visible[Detail::BatchCullChunk / 32];
+
+        const size_t total = (mins.size() < maxs.size()) ? mins.size() : maxs.size();
+
+        size_t count = 0;
+        for (size_t i = 0; i < total && count < indices.size(); i += Detail::BatchCullChunk)
+        {
+            const size_t n = (total - i < Detail::BatchCullChunk) ? total - i : Detail::BatchCullChunk;
+
+            t.cull_aabb_array(visible, p, 6, reinterpret_cast<const float*>(mins.data() + i), reinterpret_cast<const float*>(maxs.data() + i), 4, n);
+            count += CompactVisible(indices.subspan(count), visible, n, (uint32_t)i);
+        }
+
+        return count;
+    }
+
+    /// <summary>
+    /// Culls spheres against the frustum.
+    /// </summary>
+    /// <param name="visible">Visibility mask ((n + 31) / 32 words). Bit i % 32 of word i / 32 is set, if sphere i is visible.</param>
+    /// <param name="f">Frustum</param>
+    /// <param name="spheres">Spheres</param>
+    /// <remarks>Only as many spheres, as the mask holds bits for, are culled.</remarks>
+    template<bool S>
+    void CullSpheres(std::span<uint32_t> visible, const TFrustum<float, S>& f, std::span<const std::type_identity_t<TSphere<float, S>>> spheres)
+    {
+        alignas(16) float p[24];
+        Detail::batch_frustum_planes(p, f);
+
+        const float* s = reinterpret_cast<const float*>(spheres.data());
+        SIMD::GetDispatchTable().cull_sphere_array(visible.data(), p, 6, s, s + Detail::BatchSphereRadius<S>, Detail::BatchSphereStride<S>, Detail::batch_cull_count(visible.size(), spheres.size()));
+    }
+
+    /// <summary>
+    /// Culls axis aligned boxes against the frustum.
+    /// </summary>
+    /// <param name="visible">Visibility mask ((n + 31) / 32 words). Bit i % 32 of word i / 32 is set, if box i is visible.</param>
+    /// <param name="f">Frustum</param>
+    /// <param name="boxes">Boxes</param>
+    /// <remarks>Only as many boxes, as the mask holds bits for, are culled.</remarks>
+    template<bool S>
+    void CullAABBs(std::span<uint32_t> visible, const TFrustum<float, S>& f, std::span<const std::type_identity_t<TAABB<float, S>>> boxes)
+    {
+        alignas(16) float p[24];
+        Detail::batch_frustum_planes(p, f);
+
+        const float* b = reinterpret_cast<const float*>(boxes.data());
+        SIMD::GetDispatchTable().cull_aabb_array(visible.data(), p, 6, b, b + Detail::BatchAABBMax<S>, Detail::BatchAABBStride<S>, Detail::batch_cull_count(visible.size(), boxes.size()));
+    }
+
+    /// <summary>
+    /// Culls spheres against the frustum and writes the indices of the visible ones.
+    /// </summary>
+    /// <param name="indices">Indices of visible spheres in ascending order</param>
+    /// <param name="f">Frustum</param>
+    /// <param name="spheres">Spheres</param>
+    /// <returns>Number of indices written. Stops, when indices is full.</returns>
+    template<bool S>
+    size_t CullSpheresToIndices(std::span<uint32_t> indices, const TFrustum<float, S>& f, std::span<const std::type_identity_t<TSphere<float, S>>> spheres)
+    {
+        const SIMD::DispatchTable& t = SIMD::GetDispatchTable();
+
+        alignas(16) float p[24];
+        Detail::batch_frustum_planes(p, f);
+
+        uint32_t visible[Detail::BatchCullChunk / 32];
+
+        size_t count = 0;
+        for (size_t i = 0; i < spheres.size() && count < indices.size(); i += Detail::BatchCullChunk)
+        {
+            const size_t n = (spheres.size() - i < Detail::BatchCullChunk) ? spheres.size() - i : Detail::BatchCullChunk;
+            const float* s = reinterpret_cast<const float*>(spheres.data() + i);
+
+            t.cull_sphere_array(visible, p, 6, s, s + Detail::BatchSphereRadius<S>, Detail::BatchSphereStride<S>, n);
+            count += CompactVisible(indices.subspan(count), visible, n, (uint32_t)i);
+        }
+
+        return count;
+    }
+
+    /// <summary>
+    /// Culls axis aligned boxes against the frustum and writes the indices of the visible ones.
+    /// </summary>
+    /// <param name="indices">Indices of visible boxes in ascending order</param>
+    /// <param name="f">Frustum</param>
+    /// <param name="boxes">Boxes</param>
+    /// <returns>Number of indices written. Stops, when indices is full.</returns>
+    template<bool S>
+    size_t CullAABBsToIndices(std::span<uint32_t> indices, const TFrustum<float, S>& f, std::span<const std::type_identity_t<TAABB<float, S>>> boxes)
+    {
+        const SIMD::DispatchTable& t = SIMD::GetDispatchTable();
+
+        alignas(16) float p[24];
+        Detail::batch_frustum_planes(p, f);
+
+        uint32_t visible[Detail::BatchCullChunk / 32];
+
+        size_t count = 0;
+        for (size_t i = 0; i < boxes.size() && count < indices.size(); i += Detail::BatchCullChunk)
+        {
+            const size_t n = (boxes.size() - i < Detail::BatchCullChunk) ? boxes.size() - i : Detail::BatchCullChunk;
+            const float* b = reinterpret_cast<const float*>(boxes.data() + i);
+
+            t.cull_aabb_array(visible, p, 6, b, b + Detail::BatchAABBMax<S>, Detail::BatchAABBStride<S>, n);
+            count += CompactVisible(indices.subspan(count), visible, n, (uint32_t)i);
+        }
+
+        return count;
+    }
+}
@@ -0,0 +1,249 @@
+#pragma once
+
+// Half precision (IEEE 754 binary16) storage type, and vectors of halves.
+//
+// half and the half vectors only store values. Convert to float for arithmetic, either per value or for whole arrays with the functions in HalfBatch.hpp.
+// Half vectors are tightly packed (TVector3<half> is 6 bytes), as opposed to the padded float vectors. S does not change the layout.
+
+#include <cstdint>
+
+#include "Core/public/Math/Boilerplate.h"
+#include "Core/public/Math/MathFwd.h"
+
+#include "Core/public/Math/SIMD/PhanesKernelsFPU.hpp"
+
+#include "Core/public/Math/Vector2.hpp"
+#include "Core/public/Math/Vector3.hpp"
+#include "Core/public/Math/Vector4.hpp"
+
+
+#ifndef HALF_H
+#define HALF_H
+
+namespace Phanes::Core::Math
+{
+
+    /// <summary>
+    /// Half precision float. Converts from float with rounding to nearest even, and to float exactly.
+    /// </summary>
+    struct half
+    {
+    public:
+
+        /// <summary>
+        /// Bit pattern
+        /// </summary>
+        uint16_t bits;
+
+    public:
+
+        /// Default constructor
+        half() = default;
+
+        /// <summary>
+        /// Construct from float.
+        /// </summary>
+        /// <param name="f">Value</param>
+        half(float f) :
+            bits(SIMD::FPU::float_to_half(f))
+        {}
+
+        /// <summary>
+        /// Converts to float.
+        /// </summary>
+        operator float() const
+        {
+            return SIMD::FPU::half_to_float(bits);
+        }
+
+        /// <summary>
+        /// Construct from a bit pattern.
+        /// </summary>
+        /// <param name="b">Bits</param>
+        /// <returns>Half</returns>
+        static half FromBits(uint16_t b)
+        {
+            half h;
+            h.bits = b;
+            return h;
+        }
+    };
+
+
+    /// <summary>
+    /// 2D vector of halves (x, y).
+    /// </summary>
+    /// <typeparam name="S">Ignored, half vectors are never vectorized</typeparam>
+    template<bool S>
+    struct TVector2<half, S>
+    {
+    public:
+
+        using Real = half;
+
+        half x;
+        half y;
+
+    public:
+
+        /// Default constructor
+        TVector2() = default;
+
+        /// <summary>
+        /// Construct from x, y.
+        /// </summary>
+        /// <param name="x">X component</param>
+        /// <param name="y">Y component</param>
+        TVector2(half x, half y) :
+            x(x),
+            y(y)
+        {}
+
+        /// <summary>
+        /// Construct from a float vector.
+        /// </summary>
+        /// <param name="v">Vector</param>
+        explicit TVector2(const TVector2<float, S>& v) :
+            x(v.x),
+            y(v.y)
+        {}
+    };
+
+    /// <summary>
+    /// 3D vector of halves (x, y, z).
+    /// </summary>
+    /// <typeparam name="S">Ignored, half vectors are never vectorized</typeparam>
+    template<bool S>
+    struct TVector3<half, S>
+    {
+    public:
+
+        using Real = half;
+
+        half x;
+        half y;
+        half z;
+
+    public:
+
+        /// Default constructor
+        TVector3() = default;
+
+        /// <summary>
+        /// Construct from x, y, z.
+        /// </summary>
+        /// <param name="x">X component</param>
+        /// <param name="y">Y component</param>
+        /// <param name="z">Z component</param>
+        TVector3(half x, half y, half z) :
+            x(x),
+            y(y),
+            z(z)
+        {}
+
+        /// <summary>
+        /// Construct from a float vector.
+        /// </summary>
+        /// <param name="v">Vector</param>
+        explicit TVector3(const TVector3<float, S>& v) :
+            x(v.x),
+            y(v.y),
+            z(v.z)
+        {}
+    };
+
+    /// <summary>
+    /// 4D vector of halves (x, y, z, w).
+    /// </summary>
+    /// <typeparam name="S">Ignored, half vectors are never vectorized</typeparam>
+    template<bool S>
+    struct TVector4<half, S>
+    {
+    public:
+
+        using Real = half;
+
+        half x;
+        half y;
+        half z;
+        half w;
+
+    public:
+
+        /// Default constructor
+        TVector4() = default;
+
+        /// <summary>
+        /// Construct from x, y, z, w.
+        /// </summary>
+        /// <param name="x">X component</param>
+        /// <param name="y">Y component</param>
+        /// <param name="z">Z component</param>
+        /// <param name="w">W component</param>
+        TVector4(half x, half y, half z, half w) :
+            x(x),
+            y(y),
+            z(z),
+            w(w)
+        {}
+
+        /// <summary>
+        /// Construct from a float vector.
+        /// </summary>
+        /// <param name="v">Vector</param>
+        explicit TVector4(const TVector4<float, S>& v) :
+            x(v.x),
+            y(v.y),
+            z(v.z),
+            w(v.w)
+        {}
+    };
+
+
+    static_assert(sizeof(half) == 2, "half must be 2 bytes.");
+    static_assert(sizeof(TVector2<half, false>) == 2 * sizeof(half), "TVector2<half> must be tightly packed.");
+    static_assert(sizeof(TVector3<half, false>) == 3 * sizeof(half), "TVector3<half> must be tightly packed.");
+    static_assert(sizeof(TVector4<half, false>) == 4 * sizeof(half), "TVector4<half> must be tightly packed.");
+
+
+    // ========================= //
+    //   Half vector functions   //
+    // ========================= //
+
+
+    /// <summary>
+    /// Converts a half vector to float.
+    /// </summary>
+    /// <param name="v1">Half vector</param>
+    /// <returns>Float vector</returns>
+    template<bool S>
+    TVector2<float, S> ToFloat(const TVector2<half, S>& v1)
+    {
+        return TVector2<float, S>((float)v1.x, (float)v1.y);
+    }
+
+    /// <summary>
+    /// Converts a half vector to float.
+    /// </summary>
+    /// <param name="v1">Half vector</param>
+    /// <returns>Float vector</returns>
+    template<bool S>
+    TVector3<float, S> ToFloat(const TVector3<half, S>& v1)
+    {
+        return TVector3<float, S>((float)v1.x, (float)v1.y, (float)v1.z);
+    }
+
+    /// <summary>
+    /// Converts a half vector to float.
+    /// </summary>
+    /// <param name="v1">Half vector</param>
+    /// <returns>Float vector</returns>
+    template<bool S>
+    TVector4<float, S> ToFloat(const TVector4<half, S>& v1)
+    {
+        return TVector4<float, S>((float)v1.x, (float)v1.y, (float)v1.z, (float)v1.w);
+    }
+
+} // Phanes::Core::Math
+
+#endif // !HALF_H
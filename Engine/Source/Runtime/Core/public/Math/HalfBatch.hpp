@@ -0,0 +1,116 @@
+#pragma once
+
+// Conversion of arrays between float and half precision. Kernels are selected through SIMD/Dispatch.h and use F16C, if the CPU supports it.
+//
+// Float vectors keep their layout (TVector3<float> is padded to xyzw), half vectors are tightly packed. Conversion to TVector3<float> writes w as 0.
+
+#include <cstddef>
+#include <cstdint>
+
+#include "Core/public/Math/Boilerplate.h"
+#include "Core/public/Math/SIMD/Dispatch.h"
+
+#include "Core/public/Math/Half.hpp"
+
+
+namespace Phanes::Core::Math
+{
+    static_assert(sizeof(TVector3<float, false>) == 4 * sizeof(float), "TVector3<float> must be padded to xyzw.");
+    static_assert(sizeof(TVector4<float, false>) == 4 * sizeof(float), "TVector4<float> must be tightly packed.");
+
+    /// <summary>
+    /// Converts floats to half precision. Rounds to nearest even.
+    /// </summary>
+    /// <param name="r">Halves</param>
+    /// <param name="v">Floats</param>
+    /// <param name="n">Number of scalars</param>
+    inline void BatchConvert(half* r, const float* v, size_t n)
+    {
+        SIMD::GetDispatchTable().float_to_half_array(&r->bits, v, n);
+    }
+
+    /// <summary>
+    /// Converts halves to floats.
+    /// </summary>
+    /// <param name="r">Floats</param>
+    /// <param name="v">Halves</param>
+    /// <param name="n">Number of scalars</param>
+    inline void BatchConvert(float* r, const half* v, size_t n)
+    {
+        SIMD::GetDispatchTable().half_to_float_array(r, &v->bits, n);
+    }
+
+    /// <summary>
+    /// Converts vectors to half precision. Rounds to nearest even.
+    /// </summary>
+    /// <param name="r">Half vectors</param>
+    /// <param name="v">Vectors</param>
+    /// <param name="n">Number of vectors</param>
+    template<bool S>
+    void BatchConvert(TVector2<half, S>* r, const TVector2<float, S>* v, size_t n)
+    {
+        static_assert(sizeof(TVector2<float, S>) == 2 * sizeof(float), "TVector2<float> must be tightly packed.");
+        SIMD::GetDispatchTable().float_to_half_array(&r->x.bits, &v->x, n * 2);
+    }
+
+    /// <summary>
+    /// Converts half vectors to float.
+    /// </summary>
+    /// <param name="r">Vectors</param>
+    /// <param name="v">Half vectors</param>
+    /// <param name="n">Number of vectors</param>
+    template<bool S>
+    void BatchConvert(TVector2<float, S>* r, const TVector2<half, S>* v, size_t n)
+    {
+        static_assert(sizeof(TVector2<float, S>) == 2 * sizeof(float), "TVector2<float> must be tightly packed.");
+        SIMD::GetDispatchTable().half_to_float_array(&r->x, &v->x.bits, n * 2);
+    }
+
+    /// <summary>
+    /// Converts vectors to half precision. Rounds to nearest even.
+    /// </summary>
+    /// <param name="r">Half vectors</param>
+    /// <param name="v">Vectors</param>
+    /// <param name="n">Number of vectors</param>
+    template<bool S>
+    void BatchConvert(TVector3<half, S>* r, const TVector3<float, S>* v, size_t n)
+    {
+        SIMD::GetDispatchTable().vec3_float_to_half_array(&r->x.bits, &v->x, n);
+    }
+
+    /// <summary>
+    /// Converts half vectors to float.
+    /// </summary>
+    /// <param name="r">Vectors</param>
+    /// <param name="v">Half vectors</param>
+    /// <param name="n">Number of vectors</param>
+    template<bool S>
+    void BatchConvert(TVector3<float, S>* r, const TVector3<half, S>* v, size_t n)
+    {
+        SIMD::GetDispatchTable().vec3_half_to_float_array(&r->x, &v->x.bits, n);
+    }
+
+    /// <summary>
+    /// Converts vectors to half precision. Rounds to nearest even.
+    /// </summary>
+    /// <param name="r">Half vectors</param>
+    /// <param name="v">Vectors</param>
+    /// <param name="n">Number of vectors</param>
+    template<bool S>
+    void BatchConvert(TVector4<half, S>* r, const TVector4<float, S>* v, size_t n)
+    {
+        SIMD::GetDispatchTable().float_to_half_array(&r->x.bits, &v->x, n * 4);
+    }
+
+    /// <summary>
+    /// Converts half vectors to float.
+    /// </summary>
+    /// <param name="r">Vectors</param>
+    /// <param name="v">Half vectors</param>
+    /// <param name="n">Number of vectors</param>
+    template<bool S>
+    void BatchConvert(TVector4<float, S>* r, const TVector4<half, S>* v, size_t n)
+    {
+        SIMD::GetDispatchTable().half_to_float_array(&r->x, &v->x.bits, n * 4);
+    }
+}
@@ -12,6 +12,7 @@
 #include "Core/public/Math/Vector2.hpp"
 #include "Core/public/Math/Vector3.hpp"
 #include "Core/public/Math/Vector4.hpp"
+#include "Core/public/Math/Half.hpp"
 
 #include "Core/public/Math/IntVector2.hpp"
 #include "Core/public/Math/IntVector3.hpp"
@@ -25,6 +26,47 @@
 #include "Core/public/Math/Matrix4.hpp"
 
 
+// --- Rotations ------------------------
+
+#include "Core/public/Math/Quaternion.hpp"
+#include "Core/public/Math/DualQuaternion.hpp"
+#include "Core/public/Math/Transform.hpp"
+#include "Core/public/Math/TransformHierarchy.hpp"
+
+
+// --- Geometry ------------------------
+
+#include "Core/public/Math/Ray.hpp"
+#include "Core/public/Math/Line.hpp"
+#include "Core/public/Math/Plane.hpp"
+#include "Core/public/Math/Frustum.hpp"
+#include "Core/public/Math/AABB.hpp"
+#include "Core/public/Math/Sphere.hpp"
+#include "Core/public/Math/Triangle.hpp"
+#include "Core/public/Math/BVH.hpp"
+
+
+// --- Batches ------------------------
+
+#include "Core/public/Math/Vector2Batch.hpp"
+#include "Core/public/Math/Vector3Batch.hpp"
+#include "Core/public/Math/Vector4Batch.hpp"
+#include "Core/public/Math/Matrix4Batch.hpp"
+#include "Core/public/Math/QuaternionBatch.hpp"
+#include "Core/public/Math/SkinningBatch.hpp"
+#include "Core/public/Math/FrustumBatch.hpp"
+#include "Core/public/Math/HalfBatch.hpp"
+#include "Core/public/Math/Vector3PackBatch.hpp"
+
+
+// --- Packets ------------------------
+
+#include "Core/public/Math/Vector3Packet.hpp"
+#include "Core/public/Math/Vector4Packet.hpp"
+#include "Core/public/Math/RayPacket.hpp"
+#include "Core/public/Math/TrianglePacket.hpp"
+
+
 // --- Misc -----------------
 
 #include "Core/public/Math/MathTypeConversion.hpp"
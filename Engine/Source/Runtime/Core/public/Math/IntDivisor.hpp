@@ -0,0 +1,131 @@
+#pragma once
+
+#include "Core/public/Math/Boilerplate.h"
+#include "Core/public/Math/MathTypes.h"
+
+#ifndef INT_DIVISOR_H
+#define INT_DIVISOR_H
+
+namespace Phanes::Core::Math {
+
+    /**
+     * Precomputed divisor for repeated signed 32-bit division by the same value.
+     *
+     * Division is replaced by a multiplication with a magic number and a shift (Hacker's Delight, 10-4).
+     * The quotient is truncated toward zero like the built-in operator.
+     *
+     * @note Divisor must not be zero.
+     */
+
+    struct IntDivisor
+    {
+    public:
+
+        /** Divisor */
+        int divisor;
+
+        /** Magic multiplier. The quotient is the upper half of n * magic, corrected and shifted. */
+        int magic;
+
+        /** Shift after the multiplication */
+        int shift;
+
+        /** 1 if n has to be added to the product, -1 if it has to be subtracted, else 0. */
+        int correction;
+
+    public:
+
+        IntDivisor() = default;
+
+        /**
+         * Precomputes the magic number for a divisor.
+         *
+         * @param(d) Divisor (not zero)
+         */
+
+        constexpr explicit IntDivisor(int d)
+        {
+            this->divisor = d;
+
+            if (d == 1 || d == -1)
+            {
+                // Division by +-1 is special cased, as there is no 32-bit magic number for it.
+                this->magic = 0;
+                this->shift = 0;
+                this->correction = 0;
+                return;
+            }
+
+            const Phanes::Core::Types::uint32 two31 = 0x80000000u;
+
+            const Phanes::Core::Types::uint32 ad = (d < 0) ? 0u - (Phanes::Core::Types::uint32)d : (Phanes::Core::Types::uint32)d;
+            const Phanes::Core::Types::uint32 t = two31 + ((Phanes::Core::Types::uint32)d >> 31);
+            const Phanes::Core::Types::uint32 anc = t - 1 - t % ad;
+
+            int p = 31;
+            Phanes::Core::Types::uint32 q1 = two31 / anc;
+            Phanes::Core::Types::uint32 r1 = two31 - q1 * anc;
+            Phanes::Core::Types::uint32 q2 = two31 / ad;
+            Phanes::Core::Types::uint32 r2 = two31 - q2 * ad;
+            Phanes::Core::Types::uint32 delta;
+
+            do
+            {
+                ++p;
+
+                q1 *= 2;
+                r1 *= 2;
+                if (r1 >= anc)
+                {
+                    ++q1;
+                    r1 -= anc;
+                }
+
+                q2 *= 2;
+                r2 *= 2;
+                if (r2 >= ad)
+                {
+                    ++q2;
+                    r2 -= ad;
+                }
+
+                delta = ad - r2;
+            } while (q1 < delta || (q1 == delta && r1 == 0));
+
+            this->magic = (int)(q2 + 1);
+            if (d < 0)
+            {
+                this->magic = -this->magic;
+            }
+
+            this->shift = p - 32;
+            this->correction = (d > 0 && this->magic < 0) ? 1 : ((d < 0 && this->magic > 0) ? -1 : 0);
+        }
+    };
+
+    /**
+     * Divides by a precomputed divisor.
+     *
+     * @param(n) Dividend
+     * @param(d) Divisor
+     *
+     * @return Quotient, truncated toward zero.
+     */
+
+    constexpr int operator/ (int n, const IntDivisor& d)
+    {
+        if (d.magic == 0)
+        {
+            return n * d.divisor;
+        }
+
+        // 64-bit, as n * correction overflows for n = INT_MIN and correction = -1.
+        Phanes::Core::Types::int64 q = (((Phanes::Core::Types::int64)n * d.magic) >> 32) + (Phanes::Core::Types::int64)n * d.correction;
+        q >>= d.shift;
+
+        return (int)(q + (q < 0));
+    }
+
+} // Phanes::Core::Math
+
+#endif // !INT_DIVISOR_H
\ No newline at end of file
@@ -6,6 +6,7 @@
 #include "Core/public/Math/MathFwd.h"
 
 #include "Core/public/Math/SIMD/Storage.h"
+#include "Core/public/Math/IntDivisor.hpp"
 
 #include "Core/public/Math/IntVector4.hpp"
 
@@ -143,6 +144,16 @@ namespace Phanes::Core::Math {
     template<IntType T, bool A>
     inline TIntVector3<T, A> operator/= (TIntVector3<T, A>& v1, T s);
 
+    /**
+     * Division of vector by a precomputed divisor
+     *
+     * @param(v1) vector one
+     * @param(d) divisor
+     */
+
+    template<bool A>
+    TIntVector3<int, A> operator/= (TIntVector3<int, A>& v1, const IntDivisor& d);
+
 
     template<IntType T, bool A>
     TIntVector2<T, A> operator%= (TIntVector2<T, A>& v1, const TIntVector2<T, A>& v2);
@@ -216,6 +227,18 @@ namespace Phanes::Core::Math {
     template<IntType T, bool A>
     inline TIntVector3<T, A> operator/ (const TIntVector3<T, A>& v1, T s);
 
+    /**
+     * Division of vector by a precomputed divisor. Faster than division by a scalar, if the same divisor is used repeatedly.
+     *
+     * @param(v1) vector
+     * @param(d) divisor
+     *
+     * @return Solution vector
+     */
+
+    template<bool A>
+    TIntVector3<int, A> operator/ (const TIntVector3<int, A>& v1, const IntDivisor& d);
+
     template<IntType T, bool A>
     FORCEINLINE TIntVector3<T, A> operator/ (T s, const TIntVector3<T, A>& v1) { return v1 / s;  };
 
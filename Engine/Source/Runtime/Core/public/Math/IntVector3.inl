@@ -99,6 +99,13 @@ namespace Phanes::Core::Math
         return v1;
     }
 
+    template<bool S>
+    TIntVector3<int, S> operator/=(TIntVector3<int, S>& v1, const IntDivisor& d)
+    {
+        Detail::compute_ivec3_div_magic<int, S>::map(v1, v1, d);
+        return v1;
+    }
+
     template<IntType T, bool S>
     TIntVector3<T, S> operator%=(TIntVector3<T, S>& v1, const TIntVector3<T, S>& v2)
     {
@@ -178,6 +185,14 @@ namespace Phanes::Core::Math
         return r;
     }
 
+    template<bool S>
+    TIntVector3<int, S> operator/(const TIntVector3<int, S>& v1, const IntDivisor& d)
+    {
+        TIntVector3<int, S> r;
+        Detail::compute_ivec3_div_magic<int, S>::map(r, v1, d);
+        return r;
+    }
+
     template<IntType T, bool S>
     TIntVector3<T, S> operator%(TIntVector3<T, S>& v1, const TIntVector3<T, S>& v2)
     {
@@ -274,7 +289,7 @@ namespace Phanes::Core::Math
     template<IntType T, bool S>
     TIntVector3<T, S> operator&(TIntVector3<T, S>& v1, const TIntVector3<T, S>& v2)
     {
-        TVector2<T, S> r;
+        TIntVector3<T, S> r;
         Detail::compute_ivec3_and<T, S>::map(r, v1, v2);
         return r;
     }
@@ -282,7 +297,7 @@ namespace Phanes::Core::Math
     template<IntType T, bool S>
     TIntVector3<T, S> operator&(TIntVector3<T, S>& v1, T s)
     {
-        TVector2<T, S> r;
+        TIntVector3<T, S> r;
         Detail::compute_ivec3_and<T, S>::map(r, v1, s);
         return r;
     }
@@ -290,7 +305,7 @@ namespace Phanes::Core::Math
     template<IntType T, bool S>
     TIntVector3<T, S> operator|(TIntVector3<T, S>& v1, const TIntVector3<T, S>& v2)
     {
-        TVector2<T, S> r;
+        TIntVector3<T, S> r;
         Detail::compute_ivec3_or<T, S>::map(r, v1, v2);
         return r;
     }
@@ -298,7 +313,7 @@ namespace Phanes::Core::Math
     template<IntType T, bool S>
     TIntVector3<T, S> operator|(TIntVector3<T, S>& v1, T s)
     {
-        TVector2<T, S> r;
+        TIntVector3<T, S> r;
         Detail::compute_ivec3_or<T, S>::map(r, v1, s);
         return r;
     }
@@ -306,7 +321,7 @@ namespace Phanes::Core::Math
     template<IntType T, bool S>
     TIntVector3<T, S> operator^(TIntVector3<T, S>& v1, const TIntVector3<T, S>& v2)
     {
-        TVector2<T, S> r;
+        TIntVector3<T, S> r;
         Detail::compute_ivec3_xor<T, S>::map(r, v1, v2);
         return r;
     }
@@ -314,7 +329,7 @@ namespace Phanes::Core::Math
     template<IntType T, bool S>
     TIntVector3<T, S> operator^(TIntVector3<T, S>& v1, T s)
     {
-        TVector2<T, S> r;
+        TIntVector3<T, S> r;
         Detail::compute_ivec3_xor<T, S>::map(r, v1, s);
         return r;
     }
@@ -322,7 +337,7 @@ namespace Phanes::Core::Math
     template<IntType T, bool S>
     TIntVector3<T, S> operator<<(TIntVector3<T, S>& v1, const TIntVector3<T, S>& v2)
     {
-        TVector2<T, S> r;
+        TIntVector3<T, S> r;
         Detail::compute_ivec3_left_shift<T, S>::map(r, v1, v2);
         return r;
     }
@@ -330,7 +345,7 @@ namespace Phanes::Core::Math
     template<IntType T, bool S>
     TIntVector3<T, S> operator<<(TIntVector3<T, S>& v1, T s)
     {
-        TVector2<T, S> r;
+        TIntVector3<T, S> r;
         Detail::compute_ivec3_left_shift<T, S>::map(r, v1, s);
         return r;
     }
@@ -338,7 +353,7 @@ namespace Phanes::Core::Math
     template<IntType T, bool S>
     TIntVector3<T, S> operator>>(TIntVector3<T, S>& v1, const TIntVector3<T, S>& v2)
     {
-        TVector2<T, S> r;
+        TIntVector3<T, S> r;
         Detail::compute_ivec3_right_shift<T, S>::map(r, v1, v2);
         return r;
     }
@@ -346,7 +361,7 @@ namespace Phanes::Core::Math
     template<IntType T, bool S>
     TIntVector3<T, S> operator>>(TIntVector3<T, S>& v1, T s)
     {
-        TVector2<T, S> r;
+        TIntVector3<T, S> r;
         Detail::compute_ivec3_right_shift<T, S>::map(r, v1, s);
         return r;
     }
@@ -354,7 +369,7 @@ namespace Phanes::Core::Math
     template<IntType T, bool S>
     TIntVector3<T, S> operator~(TIntVector3<T, S>& v1)
     {
-        TVector2<T, S> r;
+        TIntVector3<T, S> r;
         Detail::compute_ivec3_bnot<T, S>::map(r, v1);
         return r;
     }
@@ -383,14 +398,14 @@ namespace Phanes::Core::Math
     template<IntType T, bool S>
     TIntVector3<T, S>& operator++(TIntVector3<T, S>& v1)
     {
-        Detail::compute_ivec3_inc<T, S>::map(v1);
+        Detail::compute_ivec3_inc<T, S>::map(v1, v1);
         return v1;
     }
 
     template<IntType T, bool S>
     TIntVector3<T, S>& operator--(TIntVector3<T, S>& v1)
     {
-        Detail::compute_ivec3_inc<T, S>::map(v1);
+        Detail::compute_ivec3_dec<T, S>::map(v1, v1);
         return v1;
     }
 
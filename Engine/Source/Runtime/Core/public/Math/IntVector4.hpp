@@ -6,6 +6,7 @@
 #include "Core/public/Math/MathFwd.h"
 
 #include "Core/public/Math/SIMD/Storage.h"
+#include "Core/public/Math/IntDivisor.hpp"
 
 #include "Core/public/Math/IntVector2.hpp"
 
@@ -193,6 +194,16 @@ namespace Phanes::Core::Math {
     template<IntType T, bool A>
     TIntVector4<T, A> operator/= (TIntVector4<T, A>& v1, T s);
 
+    /**
+     * Division of vector by a precomputed divisor
+     *
+     * @param(v1) vector one
+     * @param(d) divisor
+     */
+
+    template<bool A>
+    TIntVector4<int, A> operator/= (TIntVector4<int, A>& v1, const IntDivisor& d);
+
     /**
      * Stores the remainder of division by a scalar.
      *
@@ -263,6 +274,18 @@ namespace Phanes::Core::Math {
     template<IntType T, bool A>
     TIntVector4<T, A> operator/ (const TIntVector4<T, A>& v1, T s);
 
+    /**
+     * Division of vector by a precomputed divisor. Faster than division by a scalar, if the same divisor is used repeatedly.
+     *
+     * @param(v1) vector
+     * @param(d) divisor
+     *
+     * @return Solution vector
+     */
+
+    template<bool A>
+    TIntVector4<int, A> operator/ (const TIntVector4<int, A>& v1, const IntDivisor& d);
+
     /**
      * Scale of Vector by floating point. (> Creates a new TIntVector4<T, A>)
      *
@@ -98,6 +98,13 @@ namespace Phanes::Core::Math
         return v1;
     }
 
+    template<bool S>
+    TIntVector4<int, S> operator/=(TIntVector4<int, S>& v1, const IntDivisor& d)
+    {
+        Detail::compute_ivec4_div_magic<int, S>::map(v1, v1, d);
+        return v1;
+    }
+
     template<IntType T, bool S>
     TIntVector4<T, S> operator%=(TIntVector4<T, S>& v1, const TIntVector4<T, S>& v2)
     {
@@ -177,6 +184,14 @@ namespace Phanes::Core::Math
         return r;
     }
 
+    template<bool S>
+    TIntVector4<int, S> operator/(const TIntVector4<int, S>& v1, const IntDivisor& d)
+    {
+        TIntVector4<int, S> r;
+        Detail::compute_ivec4_div_magic<int, S>::map(r, v1, d);
+        return r;
+    }
+
     template<IntType T, bool S>
     TIntVector4<T, S> operator%(TIntVector4<T, S>& v1, const TIntVector4<T, S>& v2)
     {
@@ -273,7 +288,7 @@ namespace Phanes::Core::Math
     template<IntType T, bool S>
     TIntVector4<T, S> operator&(TIntVector4<T, S>& v1, const TIntVector4<T, S>& v2)
     {
-        TVector2<T, S> r;
+        TIntVector4<T, S> r;
         Detail::compute_ivec4_and<T, S>::map(r, v1, v2);
         return r;
     }
@@ -281,7 +296,7 @@ namespace Phanes::Core::Math
     template<IntType T, bool S>
     TIntVector4<T, S> operator&(TIntVector4<T, S>& v1, T s)
     {
-        TVector2<T, S> r;
+        TIntVector4<T, S> r;
         Detail::compute_ivec4_and<T, S>::map(r, v1, s);
         return r;
     }
@@ -289,7 +304,7 @@ namespace Phanes::Core::Math
     template<IntType T, bool S>
     TIntVector4<T, S> operator|(TIntVector4<T, S>& v1, const TIntVector4<T, S>& v2)
     {
-        TVector2<T, S> r;
+        TIntVector4<T, S> r;
         Detail::compute_ivec4_or<T, S>::map(r, v1, v2);
         return r;
     }
@@ -297,7 +312,7 @@ namespace Phanes::Core::Math
     template<IntType T, bool S>
     TIntVector4<T, S> operator|(TIntVector4<T, S>& v1, T s)
     {
-        TVector2<T, S> r;
+        TIntVector4<T, S> r;
         Detail::compute_ivec4_or<T, S>::map(r, v1, s);
         return r;
     }
@@ -305,7 +320,7 @@ namespace Phanes::Core::Math
     template<IntType T, bool S>
     TIntVector4<T, S> operator^(TIntVector4<T, S>& v1, const TIntVector4<T, S>& v2)
     {
-        TVector2<T, S> r;
+        TIntVector4<T, S> r;
         Detail::compute_ivec4_xor<T, S>::map(r, v1, v2);
         return r;
     }
@@ -313,7 +328,7 @@ namespace Phanes::Core::Math
     template<IntType T, bool S>
     TIntVector4<T, S> operator^(TIntVector4<T, S>& v1, T s)
     {
-        TVector2<T, S> r;
+        TIntVector4<T, S> r;
         Detail::compute_ivec4_xor<T, S>::map(r, v1, s);
         return r;
     }
@@ -321,7 +336,7 @@ namespace Phanes::Core::Math
     template<IntType T, bool S>
     TIntVector4<T, S> operator<<(TIntVector4<T, S>& v1, const TIntVector4<T, S>& v2)
     {
-        TVector2<T, S> r;
+        TIntVector4<T, S> r;
         Detail::compute_ivec4_left_shift<T, S>::map(r, v1, v2);
         return r;
     }
@@ -329,7 +344,7 @@ namespace Phanes::Core::Math
     template<IntType T, bool S>
     TIntVector4<T, S> operator<<(TIntVector4<T, S>& v1, T s)
     {
-        TVector2<T, S> r;
+        TIntVector4<T, S> r;
         Detail::compute_ivec4_left_shift<T, S>::map(r, v1, s);
         return r;
     }
@@ -337,7 +352,7 @@ namespace Phanes::Core::Math
     template<IntType T, bool S>
     TIntVector4<T, S> operator>>(TIntVector4<T, S>& v1, const TIntVector4<T, S>& v2)
     {
-        TVector2<T, S> r;
+        TIntVector4<T, S> r;
         Detail::compute_ivec4_right_shift<T, S>::map(r, v1, v2);
         return r;
     }
@@ -345,7 +360,7 @@ namespace Phanes::Core::Math
     template<IntType T, bool S>
     TIntVector4<T, S> operator>>(TIntVector4<T, S>& v1, T s)
     {
-        TVector2<T, S> r;
+        TIntVector4<T, S> r;
         Detail::compute_ivec4_right_shift<T, S>::map(r, v1, s);
         return r;
     }
@@ -353,7 +368,7 @@ namespace Phanes::Core::Math
     template<IntType T, bool S>
     TIntVector4<T, S> operator~(TIntVector4<T, S>& v1)
     {
-        TVector2<T, S> r;
+        TIntVector4<T, S> r;
         Detail::compute_ivec4_bnot<T, S>::map(r, v1);
         return r;
     }
@@ -382,14 +397,14 @@ namespace Phanes::Core::Math
     template<IntType T, bool S>
     TIntVector4<T, S>& operator++(TIntVector4<T, S>& v1)
     {
-        Detail::compute_ivec4_inc<T, S>::map(v1);
+        Detail::compute_ivec4_inc<T, S>::map(v1, v1);
         return v1;
     }
 
     template<IntType T, bool S>
     TIntVector4<T, S>& operator--(TIntVector4<T, S>& v1)
     {
-        Detail::compute_ivec4_inc<T, S>::map(v1);
+        Detail::compute_ivec4_dec<T, S>::map(v1, v1);
         return v1;
     }
 
@@ -6,15 +6,13 @@
 
 #include "Core/public/Math/Vector3.hpp"
 
-#include <any>
-
 
 namespace Phanes::Core::Math
 {
 
     // Line with direction and moment
 
-    template<RealType T>
+    template<RealType T, bool S>
     struct TLine
     {
     public:
@@ -22,11 +20,11 @@ namespace Phanes::Core::Math
 
         /** Direction of line */
 
-        TVector3<Real> direction;
+        TVector3<Real, S> direction;
 
         /** Base point of line */
 
-        TVector3<Real> base;
+        TVector3<Real, S> base;
 
     public:
 
@@ -36,7 +34,7 @@ namespace Phanes::Core::Math
          * @param(p) Base of line 
          */
 
-        TLine(const TVector3<T>& direction, const TVector3<T>& p) : direction(direction), base(p) {};
+        TLine(const TVector3<T, S>& direction, const TVector3<T, S>& p) : direction(direction), base(p) {};
 
     };
 
@@ -46,11 +44,9 @@ namespace Phanes::Core::Math
      * @param(l1) Line 
      */
 
-    template<RealType T>
-    TLine<T> NormalizeV(TLine<T>& l1)
+    template<RealType T, bool S>
+    TLine<T, S> NormalizeV(TLine<T, S>& l1)
     {
-        std::any
-
         NormalizeV(l1.direction);
         return l1;
     }
@@ -64,9 +60,9 @@ namespace Phanes::Core::Math
      * @return Line with normalized direction.
      */
 
-    template<RealType T>
-    TLine<T> NormalizeV(const TLine<T>& l1)
+    template<RealType T, bool S>
+    TLine<T, S> Normalize(const TLine<T, S>& l1)
     {
-        return TLine<T>(Normalize(l1.direction), l1.base);
+        return TLine<T, S>(Normalize(l1.direction), l1.base);
     }
 }
\ No newline at end of file
@@ -99,6 +99,21 @@ namespace Phanes::Core::Math {
         return (abs(x - y) < threshold);
     }
 
+    /**
+     * Precision of reciprocal and reciprocal square root based operations (e.g. Normalize) on SIMD vectors.
+     *
+     * @note Approximate uses the hardware estimate (about 12 bits on SSE / AVX, 14 bits on AVX-512).
+     * @note Refined adds one Newton-Raphson step to the estimate (about 22 bits).
+     * @note Exact uses a full precision division / square root.
+     */
+
+    enum class EPrecision
+    {
+        Approximate,
+        Refined,
+        Exact
+    };
+
     /**
      * Calculates the reciprocal of the square root of n using the algorithm of A Quake III
      * 
@@ -27,11 +27,16 @@ namespace Phanes::Core::Math {
 
     template<RealType T>    struct TColor;
     template<RealType T>    struct TLinearColor;
-    template<RealType T>    struct TRay;
-    template<RealType T>    struct TLine;
-    template<RealType T>    struct TPlane;
-    template<RealType T>    struct TQuaternion;
-    template<RealType T>    struct TTransform;
+    template<RealType T, bool S>    struct TRay;
+    template<RealType T, bool S>    struct TLine;
+    template<RealType T, bool S>    struct TPlane;
+    template<RealType T, bool S>    struct TAABB;
+    template<RealType T, bool S>    struct TSphere;
+    template<RealType T, bool S>    struct TTriangle;
+    template<RealType T, bool S>    struct TQuaternion;
+    template<RealType T, bool S>    struct TDualQuaternion;
+    template<RealType T, bool S>    struct TTransform;
+    template<RealType T, bool S>    struct TTransformHierarchy;
     template<RealType T>    struct TPoint2;
     template<RealType T>    struct TPoint3;
     template<RealType T>    struct TPoint4;
@@ -47,6 +52,11 @@ namespace Phanes::Core::Math {
     template<IntType T, bool S>		struct TIntVector2;
     template<IntType T, bool S>		struct TIntVector3;
     template<IntType T, bool S>		struct TIntVector4;
+    template<RealType T, size_t N>  struct TPacket;
+    template<RealType T, size_t N>  struct TVector3Packet;
+    template<RealType T, size_t N>  struct TVector4Packet;
+    template<RealType T, size_t N>  struct TRayPacket;
+    template<RealType T, size_t N>  struct TTrianglePacket;
 
     /**
      * Specific instantiation of forward declarations.
@@ -57,6 +67,7 @@ namespace Phanes::Core::Math {
     typedef TVector2<float, false>      Vector2;
     typedef TVector2<float, false>      Vector2f;
     typedef TVector2<double, false>     Vector2d;
+    typedef TVector2<half, false>       Vector2h;
 
     typedef TVector2<double, SIMD::use_simd<double, 2, true>::value>        Vector2Regf64;
     typedef TVector2<double, SIMD::use_simd<double, 2, true>::value>        Vector2Reg;
@@ -68,6 +79,7 @@ namespace Phanes::Core::Math {
     typedef TVector3<float, false>      Vector3;
     typedef TVector3<float, false>      Vector3f;
     typedef TVector3<double, false>     Vector3d;
+    typedef TVector3<half, false>       Vector3h;
 
     typedef TVector3<float, SIMD::use_simd<float, 3, true>::value>          Vector3Reg;
     typedef TVector3<float, SIMD::use_simd<float, 3, true>::value>          Vector3Regf32;
@@ -80,11 +92,47 @@ namespace Phanes::Core::Math {
     typedef TVector4<float, false>      Vector4;
     typedef TVector4<float, false>      Vector4f;
     typedef TVector4<double, false>     Vector4d;
+    typedef TVector4<half, false>       Vector4h;
 
     typedef TVector4<float, SIMD::use_simd<float, 4, true>::value>          Vector4Reg;
     typedef TVector4<float, SIMD::use_simd<float, 4, true>::value>          Vector4Regf32;
     typedef TVector4<double, SIMD::use_simd<double, 4, true>::value>        Vector4Regd;
     typedef TVector4<double, SIMD::use_simd<double, 4, true>::value>        Vector4Regf64;
+
+
+    // Quaternion
+
+    typedef TQuaternion<float, false>   Quaternion;
+    typedef TQuaternion<float, false>   Quaternionf;
+    typedef TQuaternion<double, false>  Quaterniond;
+
+    typedef TQuaternion<float, SIMD::use_simd<float, 4, true>::value>       QuaternionReg;
+    typedef TQuaternion<float, SIMD::use_simd<float, 4, true>::value>       QuaternionRegf32;
+    typedef TQuaternion<double, SIMD::use_simd<double, 4, true>::value>     QuaternionRegd;
+    typedef TQuaternion<double, SIMD::use_simd<double, 4, true>::value>     QuaternionRegf64;
+
+
+    // Dual quaternion
+
+    typedef TDualQuaternion<float, false>   DualQuaternion;
+    typedef TDualQuaternion<float, false>   DualQuaternionf;
+    typedef TDualQuaternion<double, false>  DualQuaterniond;
+
+    typedef TDualQuaternion<float, SIMD::use_simd<float, 4, true>::value>       DualQuaternionReg;
+    typedef TDualQuaternion<float, SIMD::use_simd<float, 4, true>::value>       DualQuaternionRegf32;
+    typedef TDualQuaternion<double, SIMD::use_simd<double, 4, true>::value>     DualQuaternionRegd;
+    typedef TDualQuaternion<double, SIMD::use_simd<double, 4, true>::value>     DualQuaternionRegf64;
+
+
+    // Transform (no plain "Transform" typedef, the name is taken by the transform functions)
+
+    typedef TTransform<float, false>    Transformf;
+    typedef TTransform<double, false>   Transformd;
+
+    typedef TTransform<float, SIMD::use_simd<float, 4, true>::value>        TransformReg;
+    typedef TTransform<float, SIMD::use_simd<float, 4, true>::value>        TransformRegf32;
+    typedef TTransform<double, SIMD::use_simd<double, 4, true>::value>      TransformRegd;
+    typedef TTransform<double, SIMD::use_simd<double, 4, true>::value>      TransformRegf64;
     
 
 } // Phanes::Core::Math::coretypes
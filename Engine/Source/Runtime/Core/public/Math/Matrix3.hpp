@@ -39,9 +39,12 @@ namespace Phanes::Core::Math {
                 /// </summary>
                 TVector3<T, S> c2;
             };
-        };
 
-        T data[3][3];
+            /// <summary>
+            /// Columns as scalars. Each column is padded to four components (w).
+            /// </summary>
+            T data[3][4];
+        };
 
 
     public:
@@ -107,6 +110,15 @@ namespace Phanes::Core::Math {
             this->c2 = v3;
         }
 
+        TMatrix3<T, S>& operator= (const TMatrix3<T, S>& m1)
+        {
+            this->c0 = m1.c0;
+            this->c1 = m1.c1;
+            this->c2 = m1.c2;
+
+            return *this;
+        }
+
     public:
 
         FORCEINLINE T& operator() (int n, int m)
@@ -116,7 +128,7 @@ namespace Phanes::Core::Math {
 
         FORCEINLINE TVector3<T, S>& operator[] (int m)
         {
-            return (*reinterpret_cast<TVector3<T, S>*>(this->m[m]));
+            return (*reinterpret_cast<TVector3<T, S>*>(this->data[m]));
         }
 
         FORCEINLINE const T& operator() (int n, int m) const
@@ -126,7 +138,7 @@ namespace Phanes::Core::Math {
 
         FORCEINLINE const TVector3<T, S>& operator[] (int m) const
         {
-            return (*reinterpret_cast<TVector3<T, S>*>(this->m[m]));
+            return (*reinterpret_cast<const TVector3<T, S>*>(this->data[m]));
         }
 
     };
@@ -222,21 +234,16 @@ namespace Phanes::Core::Math {
     }
 
     /**
-     * Matrix on matrix (componentwise)
+     * Multiply matrix with matrix (m1 * m2)
      *
      * @param(m1) Matrix
      * @param(m2) Matrix
+     *
+     * @note Result is stored in m1.
      */
 
     template<RealType T, bool S>
-    TMatrix3<T, S> operator*= (TMatrix3<T, S>& m1, const TMatrix3<T, S>& m2)
-    {
-        m1.c0 *= m2.c0;
-        m1.c1 *= m2.c1;
-        m1.c2 *= m2.c2;
-
-        return m1;
-    }
+    TMatrix3<T, S> operator*= (TMatrix3<T, S>& m1, const TMatrix3<T, S>& m2);
 
     /**
      * Multiply matrix with scalar
@@ -298,7 +305,7 @@ namespace Phanes::Core::Math {
     template<RealType T, bool S>
     TMatrix3<T, S> operator+ (const TMatrix3<T, S>& m1, const TMatrix3<T, S>& m2)
     {
-        return TMatrix2<T>(m1.c0 + m2.c0,
+        return TMatrix3<T, S>(m1.c0 + m2.c0,
                            m1.c1 + m2.c1,
                            m1.c2 + m2.c2);
     }
@@ -380,19 +387,24 @@ namespace Phanes::Core::Math {
     }
 
     /**
-     * Multiplay matrix by matrix (componentwise)
+     * Multiply matrix with matrix (m1 * m2)
      *
      * @param(m1) Matrix
      * @param(m2) Matrix
      */
 
     template<RealType T, bool S>
-    TMatrix3<T, S> operator* (const TMatrix3<T, S>& m1, const TMatrix3<T, S>& m2)
-    {
-        return TMatrix3<T, S>(m1.c0 * m2.c0,
-            m1.c1 * m2.c1,
-            m1.c2 * m2.c2);
-    }
+    TMatrix3<T, S> operator* (const TMatrix3<T, S>& m1, const TMatrix3<T, S>& m2);
+
+    /**
+     * Transform vector by matrix (m1 * v)
+     *
+     * @param(m1) Matrix
+     * @param(v) Vector
+     */
+
+    template<RealType T, bool S>
+    TVector3<T, S> operator* (const TMatrix3<T, S>& m1, const TVector3<T, S>& v);
 
     /**
      * Compare matrix with other matrix.
@@ -404,7 +416,7 @@ namespace Phanes::Core::Math {
     template<RealType T, bool S>
     bool operator== (const TMatrix3<T, S>& m1, const TMatrix3<T, S>& m2)
     {
-        return (m1.c0 == m2.c0 && m1.c1 == m2.c1 && m1.c2 == m2.c2);
+        return (CompareEq(m1.c0, m2.c0) & CompareEq(m1.c1, m2.c1) & CompareEq(m1.c2, m2.c2)) == 0x7;
     }
 
     /**
@@ -417,7 +429,7 @@ namespace Phanes::Core::Math {
     template<RealType T, bool S>
     bool operator!= (const TMatrix3<T, S>& m1, const TMatrix3<T, S>& m2)
     {
-        return (m1.c0 != m2.c0 || m1.c1 != m2.c1 || m1.c2 != m2.c2);
+        return !(m1 == m2);
     }
 
 
@@ -432,12 +444,7 @@ namespace Phanes::Core::Math {
      */
     
     template<RealType T, bool S>
-    T Determinant(const TMatrix3<T, S>& m1)
-    {
-        return   m1(0, 0) * (m1(1, 1) * m1(2, 2) - m1(1, 2) * m1(2, 1))
-               - m1(0, 1) * (m1(1, 0) * m1(2, 2) - m1(1, 2) * m1(2, 0))
-               + m1(0, 2) * (m1(1, 0) * m1(2, 1) - m1(1, 1) * m1(2, 0));
-    }
+    T Determinant(const TMatrix3<T, S>& m1);
 
     /**
      * Calculate inverse of 3x3 Matrix
@@ -446,31 +453,11 @@ namespace Phanes::Core::Math {
      * 
      * @param(m1) Matrix
      * 
-     * @note Stores result in m1.
+     * @note Stores result in m1. m1 is left untouched, if it is singular.
      */
 
     template<RealType T, bool S>
-    bool InverseV(TMatrix3<T, S>& m1)
-    {
-        TVector3<T, S> r0 = CrossP(m1.c1, m1.c2);
-        TVector3<T, S> r1 = CrossP(m1.c2, m1.c0);
-        TVector3<T, S> r2 = CrossP(m1.c0, m1.c1);
-
-        T _1_det = (T)1.0 / Determinant(m1);
-
-        if (_1_det == (T)0.0)
-        {
-            return false;
-        }
-
-        m1 = TMatrix3<T, S>(r0.x, r0.y, r0.z,
-                            r1.x, r1.y, r1.z,
-                            r2.x, r2.y, r2.z);
-
-        m1 *= _1_det;
-
-        return true;
-    }
+    bool InverseV(TMatrix3<T, S>& m1);
 
     /**
      * Get transpose of matrix.
@@ -491,31 +478,14 @@ namespace Phanes::Core::Math {
     /**
      * Calculate inverse of 3x3 Matrix
      *
+     * @param(r) Inverse
      * @param(m1) Matrix
+     *
+     * @note r is left untouched, if m1 is singular.
      */
 
     template<RealType T, bool S>
-    bool Inverse(TMatrix3<T, S>& r, const TMatrix3<T, S>& m1)
-    {
-        TVector3<T, S> r0 = CrossP(m1.c1, m1.c2);
-        TVector3<T, S> r1 = CrossP(m1.c2, m1.c0);
-        TVector3<T, S> r2 = CrossP(m1.c0, m1.c1);
-
-        T _1_det = (T)1.0 / Determinant(m1);
-
-        if (_1_det == (T)0.0)
-        {
-            return false;
-        }
-
-        r = TMatrix3<T, S>(r0.x, r0.y, r0.z,
-            r1.x, r1.y, r1.z,
-            r2.x, r2.y, r2.z);
-
-        r *= _1_det;
-
-        return true;
-    }
+    bool Inverse(TMatrix3<T, S>& r, const TMatrix3<T, S>& m1);
 
     /**
      * Get transpose of matrix.
@@ -535,9 +505,9 @@ namespace Phanes::Core::Math {
     template<RealType T, bool S>
     bool IsIdentityMatrix(const TMatrix3<T, S>& m1)
     {
-        return (abs(m1(0, 0) - (T)1.0) < P_FLT_INAC && abs(m1(0, 1) - (T)0.0) < P_FLT_INAC && abs(m1(0, 2) - (T)0.0) < P_FLT_INAC &&
-                abs(m1(1, 0) - (T)0.0) < P_FLT_INAC && abs(m1(1, 1) - (T)1.0) < P_FLT_INAC && abs(m1(1, 2) - (T)0.0) < P_FLT_INAC &&
-                abs(m1(2, 0) - (T)0.0) < P_FLT_INAC && abs(m1(2, 1) - (T)0.0) < P_FLT_INAC && abs(m1(2, 2) - (T)1.0) < P_FLT_INAC);
+        return (CompareEq(m1.c0, TVector3<T, S>((T)1.0, (T)0.0, (T)0.0)) &
+                CompareEq(m1.c1, TVector3<T, S>((T)0.0, (T)1.0, (T)0.0)) &
+                CompareEq(m1.c2, TVector3<T, S>((T)0.0, (T)0.0, (T)1.0))) == 0x7;
     }
 
 } // Phanes::Core::Math
@@ -10,7 +10,48 @@
 namespace Phanes::Core::Math
 {
     template<RealType T, bool S>
-    TMatrix3<T, S> TransposeV(const TMatrix3<T, S>& m)
+    TMatrix3<T, S> operator*= (TMatrix3<T, S>& m1, const TMatrix3<T, S>& m2)
+    {
+        Detail::compute_mat3_mul<T, S>::map(m1, m1, m2);
+        return m1;
+    }
+
+    template<RealType T, bool S>
+    TMatrix3<T, S> operator* (const TMatrix3<T, S>& m1, const TMatrix3<T, S>& m2)
+    {
+        TMatrix3<T, S> r;
+        Detail::compute_mat3_mul<T, S>::map(r, m1, m2);
+        return r;
+    }
+
+    template<RealType T, bool S>
+    TVector3<T, S> operator* (const TMatrix3<T, S>& m1, const TVector3<T, S>& v)
+    {
+        TVector3<T, S> r;
+        Detail::compute_mat3_mul_vec<T, S>::map(r, m1, v);
+        return r;
+    }
+
+    template<RealType T, bool S>
+    T Determinant(const TMatrix3<T, S>& m1)
+    {
+        return Detail::compute_mat3_det<T, S>::map(m1);
+    }
+
+    template<RealType T, bool S>
+    bool InverseV(TMatrix3<T, S>& m1)
+    {
+        return Detail::compute_mat3_inv<T, S>::map(m1, m1);
+    }
+
+    template<RealType T, bool S>
+    bool Inverse(TMatrix3<T, S>& r, const TMatrix3<T, S>& m1)
+    {
+        return Detail::compute_mat3_inv<T, S>::map(r, m1);
+    }
+
+    template<RealType T, bool S>
+    TMatrix3<T, S> TransposeV(TMatrix3<T, S>& m)
     {
         Detail::compute_mat3_transpose<T, S>::map(m, m);
         return m;
@@ -31,6 +31,85 @@ namespace Phanes::Core::Math {
 			T data[4][4];
 		};
 
+	public:
+
+		TMatrix4() = default;
+
+		/**
+		 * Copy constructor.
+		 */
+
+		TMatrix4(const TMatrix4<T, S>& m1)
+		{
+			this->c0 = m1.c0;
+			this->c1 = m1.c1;
+			this->c2 = m1.c2;
+			this->c3 = m1.c3;
+		}
+
+		/**
+		 * Construct Matrix from 2d array.
+		 *
+		 * @param(fields) 2D Array with row major order.
+		 */
+
+		TMatrix4(T fields[4][4])
+		{
+			this->c0 = TVector4<T, S>(fields[0][0], fields[1][0], fields[2][0], fields[3][0]);
+			this->c1 = TVector4<T, S>(fields[0][1], fields[1][1], fields[2][1], fields[3][1]);
+			this->c2 = TVector4<T, S>(fields[0][2], fields[1][2], fields[2][2], fields[3][2]);
+			this->c3 = TVector4<T, S>(fields[0][3], fields[1][3], fields[2][3], fields[3][3]);
+		}
+
+		/**
+		 * Construct Matrix from parameters.
+		 *
+		 * @param(n00) M[0][0]
+		 * @param(n01) M[0][1]
+		 * @param(n10) M[1][0]
+		 * ...
+		 *
+		 * @note nXY = n[Row][Col]
+		 */
+
+		TMatrix4(T n00, T n01, T n02, T n03,
+				 T n10, T n11, T n12, T n13,
+				 T n20, T n21, T n22, T n23,
+				 T n30, T n31, T n32, T n33)
+		{
+			this->c0 = TVector4<T, S>(n00, n10, n20, n30);
+			this->c1 = TVector4<T, S>(n01, n11, n21, n31);
+			this->c2 = TVector4<T, S>(n02, n12, n22, n32);
+			this->c3 = TVector4<T, S>(n03, n13, n23, n33);
+		}
+
+		/**
+		 * Construct Matrix from four 4d vector columns.
+		 *
+		 * @param(v1) Column zero
+		 * @param(v2) Column one
+		 * @param(v3) Column two
+		 * @param(v4) Column three
+		 */
+
+		TMatrix4(const TVector4<T, S>& v1, const TVector4<T, S>& v2, const TVector4<T, S>& v3, const TVector4<T, S>& v4)
+		{
+			this->c0 = v1;
+			this->c1 = v2;
+			this->c2 = v3;
+			this->c3 = v4;
+		}
+
+		TMatrix4<T, S>& operator= (const TMatrix4<T, S>& m1)
+		{
+			this->c0 = m1.c0;
+			this->c1 = m1.c1;
+			this->c2 = m1.c2;
+			this->c3 = m1.c3;
+
+			return *this;
+		}
+
 	public:
 
 		FORCEINLINE T& operator() (int n, int m)
@@ -39,7 +118,7 @@ namespace Phanes::Core::Math {
 		}
 		FORCEINLINE TVector4<T, S>& operator[] (int m)
 		{
-			return (*reinterpret_cast<TVector4<T, S>*>(this->m[m]));
+			return (*reinterpret_cast<TVector4<T, S>*>(this->data[m]));
 		}
 
 		FORCEINLINE const T& operator() (int n, int m) const
@@ -48,7 +127,7 @@ namespace Phanes::Core::Math {
 		}
 		FORCEINLINE const TVector4<T, S>& operator[] (int m) const
 		{
-			return (*reinterpret_cast<TVector4<T, S>*>(this->m[m]));
+			return (*reinterpret_cast<const TVector4<T, S>*>(this->data[m]));
 		}
 	};
 
@@ -111,16 +190,14 @@ namespace Phanes::Core::Math {
 		return m1;
 	}
 
+	/// <summary>
+	/// Multiplies two matrices (m1 * m2) and stores the product in m1.
+	/// </summary>
+	/// <param name="m1">Matrix one</param>
+	/// <param name="m2">Matrix two</param>
+	/// <returns>Copy of m1</returns>
 	template<RealType T, bool S>
-	TMatrix4<T, S> operator*= (TMatrix4<T, S>& m1, const TMatrix4<T, S>& m2)
-	{
-		m1.c0 *= m2.c0;
-		m1.c1 *= m2.c1;
-		m1.c2 *= m2.c2;
-		m1.c3 *= m2.c3;
-
-		return m1;
-	}
+	TMatrix4<T, S> operator*= (TMatrix4<T, S>& m1, const TMatrix4<T, S>& m2);
 
 	template<RealType T, bool S>
 	TMatrix4<T, S> operator/= (TMatrix4<T, S>& m1, T s)
@@ -195,15 +272,14 @@ namespace Phanes::Core::Math {
 						      );
 	}
 
+	/// <summary>
+	/// Multiplies two matrices (m1 * m2).
+	/// </summary>
+	/// <param name="m1">Matrix one</param>
+	/// <param name="m2">Matrix two</param>
+	/// <returns>Product</returns>
 	template<RealType T, bool S>
-	TMatrix4<T, S> operator* (const TMatrix4<T, S>& m1, const TMatrix4<T, S>& m2)
-	{
-		return TMatrix4<T, S>(m1.c0 * m2.c0,
-							  m1.c1 * m2.c1,
-							  m1.c2 * m2.c2,
-							  m1.c3 * m2.c3
-		);
-	}
+	TMatrix4<T, S> operator* (const TMatrix4<T, S>& m1, const TMatrix4<T, S>& m2);
 
 	template<RealType T, bool S>
 	TMatrix4<T, S> operator/ (const TMatrix4<T, S>& m1, T s)
@@ -226,26 +302,31 @@ namespace Phanes::Core::Math {
 		);
 	}
 
+	/// <summary>
+	/// Transforms a vector with a matrix (m1 * v).
+	/// </summary>
+	/// <param name="m1">Matrix</param>
+	/// <param name="v">Vector</param>
+	/// <returns>Transformed vector</returns>
 	template<RealType T, bool S>
-	TVector4<T, S> operator* (const TMatrix4<T, S>& m1, const TVector4<T, S>& v)
-	{
-		return TVector4<T, S>(DotP(m1.c0, v),
-						      DotP(m1.c1, v),
-						      DotP(m1.c2, v),
-						      DotP(m1.c3, v)
-							  );
-	}
-
+	TVector4<T, S> operator* (const TMatrix4<T, S>& m1, const TVector4<T, S>& v);
+
+	/// <summary>
+	/// Compares two matrices with P_FLT_INAC tolerance. The column masks are combined before the single test.
+	/// </summary>
+	/// <param name="m1">Matrix one</param>
+	/// <param name="m2">Matrix two</param>
+	/// <returns>True if equal</returns>
 	template<RealType T, bool S>
 	bool operator== (const TMatrix4<T, S>& m1, const TMatrix4<T, S>& m2)
 	{
-		return (m1.c0 == m2.c0 && m1.c1 == m2.c1 && m1.c2 == m2.c2 && m1.c3 == m2.c3);
+		return (CompareEq(m1.c0, m2.c0) & CompareEq(m1.c1, m2.c1) & CompareEq(m1.c2, m2.c2) & CompareEq(m1.c3, m2.c3)) == 0xF;
 	}
 
 	template<RealType T, bool S>
 	bool operator!= (const TMatrix4<T, S>& m1, const TMatrix4<T, S>& m2)
 	{
-		return (m1.c0 != m2.c0 || m1.c1 != m2.c1 || m1.c2 != m2.c2 || m1.c3 != m2.c3);
+		return !(m1 == m2);
 	}
 
 
@@ -260,7 +341,7 @@ namespace Phanes::Core::Math {
 	bool InverseV(TMatrix4<T, S>& a);
 
 	template<RealType T, bool S>
-	TMatrix4<T, S> TransposeV(TMatrix4<T, S>& a);
+	void TransposeV(TMatrix4<T, S>& a);
 
 
 	// =============== //
@@ -277,10 +358,10 @@ namespace Phanes::Core::Math {
 	template<RealType T, bool S>
 	FORCEINLINE bool IsIndentityMatrix(const TMatrix4<T, S>& m1)
 	{
-		return (abs(m1(0, 0) - (T)1.0) < P_FLT_INAC && abs(m1(0, 1) - (T)0.0) < P_FLT_INAC && abs(m1(0, 2) - (T)0.0) < P_FLT_INAC && abs(m1(0, 3) - (T)0.0) < P_FLT_INAC && 
-				abs(m1(1, 0) - (T)0.0) < P_FLT_INAC && abs(m1(1, 1) - (T)1.0) < P_FLT_INAC && abs(m1(1, 2) - (T)0.0) < P_FLT_INAC && abs(m1(1, 3) - (T)0.0) < P_FLT_INAC && 
-				abs(m1(2, 0) - (T)0.0) < P_FLT_INAC && abs(m1(2, 1) - (T)0.0) < P_FLT_INAC && abs(m1(2, 2) - (T)1.0) < P_FLT_INAC && abs(m1(2, 3) - (T)0.0) < P_FLT_INAC && 
-				abs(m1(3, 0) - (T)0.0) < P_FLT_INAC && abs(m1(3, 1) - (T)0.0) < P_FLT_INAC && abs(m1(3, 2) - (T)1.0) < P_FLT_INAC && abs(m1(3, 3) - (T)0.0) < P_FLT_INAC);
+		return (CompareEq(m1.c0, TVector4<T, S>((T)1.0, (T)0.0, (T)0.0, (T)0.0)) &
+				CompareEq(m1.c1, TVector4<T, S>((T)0.0, (T)1.0, (T)0.0, (T)0.0)) &
+				CompareEq(m1.c2, TVector4<T, S>((T)0.0, (T)0.0, (T)1.0, (T)0.0)) &
+				CompareEq(m1.c3, TVector4<T, S>((T)0.0, (T)0.0, (T)0.0, (T)1.0))) == 0xF;
 	}
 
 
@@ -10,6 +10,29 @@
 
 namespace Phanes::Core::Math
 {
+    template<RealType T, bool S>
+    TMatrix4<T, S> operator*= (TMatrix4<T, S>& m1, const TMatrix4<T, S>& m2)
+    {
+        Detail::compute_mat4_mul<T, S>::map(m1, m1, m2);
+        return m1;
+    }
+
+    template<RealType T, bool S>
+    TMatrix4<T, S> operator* (const TMatrix4<T, S>& m1, const TMatrix4<T, S>& m2)
+    {
+        TMatrix4<T, S> r;
+        Detail::compute_mat4_mul<T, S>::map(r, m1, m2);
+        return r;
+    }
+
+    template<RealType T, bool S>
+    TVector4<T, S> operator* (const TMatrix4<T, S>& m1, const TVector4<T, S>& v)
+    {
+        TVector4<T, S> r;
+        Detail::compute_mat4_mul_vec<T, S>::map(r, m1, v);
+        return r;
+    }
+
     template<RealType T, bool S>
     T Determinant(const TMatrix4<T, S>& m)
     {
@@ -23,9 +46,9 @@ namespace Phanes::Core::Math
     }
 
     template<RealType T, bool S>
-    TMatrix4<T, S> TransposeV(TMatrix4<T, S>& a)
+    void TransposeV(TMatrix4<T, S>& a)
     {
-        return Detail::compute_mat4_transpose<T, S>::map(a, a);
+        Detail::compute_mat4_transpose<T, S>::map(a, a);
     }
 
     template<RealType T, bool S>
@@ -37,10 +60,10 @@ namespace Phanes::Core::Math
     }
 
     template<RealType T, bool S>
-    TMatrix4<T, S> Transpose(TMatrix4<T, S>& a)
+    TMatrix4<T, S> Transpose(const TMatrix4<T, S>& a)
     {
         TMatrix4<T, S> r;
-        return Detail::compute_mat4_transpose<T, S>::map(r, a);
+        Detail::compute_mat4_transpose<T, S>::map(r, a);
         return r;
     }
 }
\ No newline at end of file
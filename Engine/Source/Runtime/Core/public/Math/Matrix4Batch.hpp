@@ -0,0 +1,155 @@
+#pragma once
+
+// Transforms of TVector3<float> / TVector4<float> arrays by one TMatrix4<float>. Kernels are selected through SIMD/Dispatch.h.
+//
+// The matrix is loaded once per call, not once per vector. r and v must have the same size and r may alias v.
+// With nonTemporal set, r is written with non-temporal stores, which bypass the cache. Use it for large outputs, that are not read again soon.
+
+#include <cassert>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+
+#include "Core/public/Math/Boilerplate.h"
+#include "Core/public/Math/SIMD/Dispatch.h"
+
+#include "Core/public/Math/Vector3.hpp"
+#include "Core/public/Math/Vector4.hpp"
+#include "Core/public/Math/Matrix4.hpp"
+
+
+namespace Phanes::Core::Math
+{
+    static_assert(sizeof(TVector3<float, false>) == 4 * sizeof(float), "TVector3<float> must be padded to xyzw.");
+    static_assert(sizeof(TMatrix4<float, false>) == 16 * sizeof(float), "TMatrix4<float> must be tightly packed.");
+
+    namespace Detail
+    {
+        // Copies m with its last row cleared, so that w of transformed TVector3 stays 0.
+        template<bool S>
+        FORCEINLINE void batch_mat4_clear_w(float* r, const TMatrix4<float, S>& m)
+        {
+            const float* a = &m.data[0][0];
+
+            for (int i = 0; i < 16; ++i)
+            {
+                r[i] = ((i & 3) == 3) ? 0.0f : a[i];
+            }
+        }
+    }
+
+    /// <summary>
+    /// Transforms points (m * (x, y, z, 1)). The projective part of m is dropped, w of the results is 0.
+    /// </summary>
+    /// <param name="r">Transformed points</param>
+    /// <param name="v">Points</param>
+    /// <param name="m">Matrix</param>
+    /// <param name="nonTemporal">Write r with non-temporal stores</param>
+    template<bool S>
+    void TransformPoints(std::span<std::type_identity_t<TVector3<float, S>>> r, std::span<const std::type_identity_t<TVector3<float, S>>> v, const TMatrix4<float, S>& m, bool nonTemporal = false)
+    {
+        assert(r.size() == v.size());
+
+        alignas(16) float a[16];
+        Detail::batch_mat4_clear_w(a, m);
+
+        SIMD::GetDispatchTable().mat4_transform_point_array(reinterpret_cast<float*>(r.data()), a, reinterpret_cast<const float*>(v.data()), r.size(), nonTemporal);
+    }
+
+    /// <summary>
+    /// Transforms points (m * (x, y, z, 1)). w of the input is ignored.
+    /// </summary>
+    /// <param name="r">Transformed points</param>
+    /// <param name="v">Points</param>
+    /// <param name="m">Matrix</param>
+    /// <param name="nonTemporal">Write r with non-temporal stores</param>
+    template<bool S>
+    void TransformPoints(std::span<std::type_identity_t<TVector4<float, S>>> r, std::span<const std::type_identity_t<TVector4<float, S>>> v, const TMatrix4<float, S>& m, bool nonTemporal = false)
+    {
+        assert(r.size() == v.size());
+        SIMD::GetDispatchTable().mat4_transform_point_array(reinterpret_cast<float*>(r.data()), &m.data[0][0], reinterpret_cast<const float*>(v.data()), r.size(), nonTemporal);
+    }
+
+    /// <summary>
+    /// Transforms directions (m * (x, y, z, 0)). The translation of m does not apply, w of the results is 0.
+    /// </summary>
+    /// <param name="r">Transformed directions</param>
+    /// <param name="v">Directions</param>
+    /// <param name="m">Matrix</param>
+    /// <param name="nonTemporal">Write r with non-temporal stores</param>
+    template<bool S>
+    void TransformDirections(std::span<std::type_identity_t<TVector3<float, S>>> r, std::span<const std::type_identity_t<TVector3<float, S>>> v, const TMatrix4<float, S>& m, bool nonTemporal = false)
+    {
+        assert(r.size() == v.size());
+
+        alignas(16) float a[16];
+        Detail::batch_mat4_clear_w(a, m);
+
+        SIMD::GetDispatchTable().mat4_transform_dir_array(reinterpret_cast<float*>(r.data()), a, reinterpret_cast<const float*>(v.data()), r.size(), nonTemporal);
+    }
+
+    /// <summary>
+    /// Transforms directions (m * (x, y, z, 0)). w of the input is ignored.
+    /// </summary>
+    /// <param name="r">Transformed directions</param>
+    /// <param name="v">Directions</param>
+    /// <param name="m">Matrix</param>
+    /// <param name="nonTemporal">Write r with non-temporal stores</param>
+    template<bool S>
+    void TransformDirections(std::span<std::type_identity_t<TVector4<float, S>>> r, std::span<const std::type_identity_t<TVector4<float, S>>> v, const TMatrix4<float, S>& m, bool nonTemporal = false)
+    {
+        assert(r.size() == v.size());
+        SIMD::GetDispatchTable().mat4_transform_dir_array(reinterpret_cast<float*>(r.data()), &m.data[0][0], reinterpret_cast<const float*>(v.data()), r.size(), nonTemporal);
+    }
+
+    /// <summary>
+    /// Transforms homogeneous vectors (m * v).
+    /// </summary>
+    /// <param name="r">Transformed vectors</param>
+    /// <param name="v">Vectors</param>
+    /// <param name="m">Matrix</param>
+    /// <param name="nonTemporal">Write r with non-temporal stores</param>
+    template<bool S>
+    void TransformVectors(std::span<std::type_identity_t<TVector4<float, S>>> r, std::span<const std::type_identity_t<TVector4<float, S>>> v, const TMatrix4<float, S>& m, bool nonTemporal = false)
+    {
+        assert(r.size() == v.size());
+        SIMD::GetDispatchTable().mat4_transform_array(reinterpret_cast<float*>(r.data()), &m.data[0][0], reinterpret_cast<const float*>(v.data()), r.size(), nonTemporal);
+    }
+
+    /// <summary>
+    /// Transforms planes by a point transform m. Planes are stored as (a, b, c, d), describing ax + by + cz = d like TPlane.
+    /// The planes are multiplied with the inverse transpose of m, which is computed once.
+    /// </summary>
+    /// <param name="r">Transformed planes</param>
+    /// <param name="planes">Planes</param>
+    /// <param name="m">Matrix</param>
+    /// <param name="nonTemporal">Write r with non-temporal stores</param>
+    /// <returns>False, if m is singular. r is left untouched.</returns>
+    /// <remarks>Normals are not renormalized, non-uniform scaling leaves them with a length other than 1.</remarks>
+    template<bool S>
+    bool TransformPlanes(std::span<std::type_identity_t<TVector4<float, S>>> r, std::span<const std::type_identity_t<TVector4<float, S>>> planes, const TMatrix4<float, S>& m, bool nonTemporal = false)
+    {
+        assert(r.size() == planes.size());
+
+        const SIMD::DispatchTable& t = SIMD::GetDispatchTable();
+
+        alignas(16) float inv[16];
+        if (!t.mat4_inv(inv, &m.data[0][0]))
+        {
+            return false;
+        }
+
+        // (a, b, c, -d) is transformed by the inverse transpose. The sign of d is folded into the matrix.
+        alignas(16) float a[16];
+        for (int c = 0; c < 4; ++c)
+        {
+            for (int i = 0; i < 4; ++i)
+            {
+                a[c * 4 + i] = ((c == 3) != (i == 3)) ? -inv[i * 4 + c] : inv[i * 4 + c];
+            }
+        }
+
+        t.mat4_transform_array(reinterpret_cast<float*>(r.data()), a, reinterpret_cast<const float*>(planes.data()), r.size(), nonTemporal);
+        return true;
+    }
+}
@@ -0,0 +1,253 @@
+#pragma once
+
+// Structure of arrays building block. A TPacket holds one scalar per lane, so that N independent values can be processed with one instruction.
+//
+// The lane loops have a fixed trip count over aligned storage and are vectorized by the compiler.
+
+#include <cstddef>
+
+#include "Core/public/Math/Boilerplate.h"
+
+#include "Core/public/Math/MathCommon.hpp"
+#include "Core/public/Math/MathFwd.h"
+
+
+#ifndef PACKET_H
+#define PACKET_H
+
+namespace Phanes::Core::Math {
+
+    /// <summary>
+    /// N scalars, one per lane.
+    /// </summary>
+    /// <typeparam name="T">Scalar type</typeparam>
+    /// <typeparam name="N">Number of lanes (power of two)</typeparam>
+    template<RealType T, size_t N>
+    struct TPacket
+    {
+        static_assert(N > 0 && (N & (N - 1)) == 0, "TPacket: Lane count must be a power of two.");
+
+    public:
+
+        using Real = T;
+
+        static constexpr size_t Width = N;
+
+        /// <summary>
+        /// Lanes
+        /// </summary>
+        alignas(N * sizeof(T)) Real data[N];
+
+    public:
+
+        /// Default constructor
+        TPacket() = default;
+
+        /// <summary>
+        /// Broadcast s into all lanes.
+        /// </summary>
+        /// <param name="s">Scalar</param>
+        TPacket(Real s)
+        {
+            for (size_t i = 0; i < N; ++i)
+            {
+                this->data[i] = s;
+            }
+        }
+
+        /// <summary>
+        /// Construct from array of at least N scalars.
+        /// </summary>
+        /// <param name="comp">Scalars</param>
+        explicit TPacket(const Real* comp)
+        {
+            for (size_t i = 0; i < N; ++i)
+            {
+                this->data[i] = comp[i];
+            }
+        }
+
+        FORCEINLINE Real& operator[] (size_t i) { return this->data[i]; }
+
+        FORCEINLINE const Real& operator[] (size_t i) const { return this->data[i]; }
+    };
+
+
+    // ==================== //
+    //   TPacket operators  //
+    // ==================== //
+
+    template<RealType T, size_t N>
+    FORCEINLINE TPacket<T, N> operator+= (TPacket<T, N>& p1, const TPacket<T, N>& p2)
+    {
+        for (size_t i = 0; i < N; ++i) { p1.data[i] += p2.data[i]; }
+        return p1;
+    }
+
+    template<RealType T, size_t N>
+    FORCEINLINE TPacket<T, N> operator-= (TPacket<T, N>& p1, const TPacket<T, N>& p2)
+    {
+        for (size_t i = 0; i < N; ++i) { p1.data[i] -= p2.data[i]; }
+        return p1;
+    }
+
+    template<RealType T, size_t N>
+    FORCEINLINE TPacket<T, N> operator*= (TPacket<T, N>& p1, const TPacket<T, N>& p2)
+    {
+        for (size_t i = 0; i < N; ++i) { p1.data[i] *= p2.data[i]; }
+        return p1;
+    }
+
+    template<RealType T, size_t N>
+    FORCEINLINE TPacket<T, N> operator/= (TPacket<T, N>& p1, const TPacket<T, N>& p2)
+    {
+        for (size_t i = 0; i < N; ++i) { p1.data[i] /= p2.data[i]; }
+        return p1;
+    }
+
+    template<RealType T, size_t N>
+    FORCEINLINE TPacket<T, N> operator+ (const TPacket<T, N>& p1, const TPacket<T, N>& p2)
+    {
+        TPacket<T, N> r;
+        for (size_t i = 0; i < N; ++i) { r.data[i] = p1.data[i] + p2.data[i]; }
+        return r;
+    }
+
+    template<RealType T, size_t N>
+    FORCEINLINE TPacket<T, N> operator- (const TPacket<T, N>& p1, const TPacket<T, N>& p2)
+    {
+        TPacket<T, N> r;
+        for (size_t i = 0; i < N; ++i) { r.data[i] = p1.data[i] - p2.data[i]; }
+        return r;
+    }
+
+    template<RealType T, size_t N>
+    FORCEINLINE TPacket<T, N> operator* (const TPacket<T, N>& p1, const TPacket<T, N>& p2)
+    {
+        TPacket<T, N> r;
+        for (size_t i = 0; i < N; ++i) { r.data[i] = p1.data[i] * p2.data[i]; }
+        return r;
+    }
+
+    template<RealType T, size_t N>
+    FORCEINLINE TPacket<T, N> operator/ (const TPacket<T, N>& p1, const TPacket<T, N>& p2)
+    {
+        TPacket<T, N> r;
+        for (size_t i = 0; i < N; ++i) { r.data[i] = p1.data[i] / p2.data[i]; }
+        return r;
+    }
+
+    template<RealType T, size_t N>
+    FORCEINLINE TPacket<T, N> operator- (const TPacket<T, N>& p1)
+    {
+        TPacket<T, N> r;
+        for (size_t i = 0; i < N; ++i) { r.data[i] = -p1.data[i]; }
+        return r;
+    }
+
+    template<RealType T, size_t N>
+    FORCEINLINE TPacket<T, N> operator+ (const TPacket<T, N>& p1, T s) { return p1 + TPacket<T, N>(s); }
+
+    template<RealType T, size_t N>
+    FORCEINLINE TPacket<T, N> operator- (const TPacket<T, N>& p1, T s) { return p1 - TPacket<T, N>(s); }
+
+    template<RealType T, size_t N>
+    FORCEINLINE TPacket<T, N> operator* (const TPacket<T, N>& p1, T s) { return p1 * TPacket<T, N>(s); }
+
+    template<RealType T, size_t N>
+    FORCEINLINE TPacket<T, N> operator* (T s, const TPacket<T, N>& p1) { return p1 * TPacket<T, N>(s); }
+
+    template<RealType T, size_t N>
+    FORCEINLINE TPacket<T, N> operator/ (const TPacket<T, N>& p1, T s) { return p1 / TPacket<T, N>(s); }
+
+
+    // ==================== //
+    //   TPacket functions  //
+    // ==================== //
+
+    /// <summary>
+    /// Square root of each lane.
+    /// </summary>
+    template<RealType T, size_t N>
+    FORCEINLINE TPacket<T, N> Sqrt(const TPacket<T, N>& p)
+    {
+        TPacket<T, N> r;
+        for (size_t i = 0; i < N; ++i) { r.data[i] = sqrt(p.data[i]); }
+        return r;
+    }
+
+    /// <summary>
+    /// Absolute value of each lane.
+    /// </summary>
+    template<RealType T, size_t N>
+    FORCEINLINE TPacket<T, N> Abs(const TPacket<T, N>& p)
+    {
+        TPacket<T, N> r;
+        for (size_t i = 0; i < N; ++i) { r.data[i] = (p.data[i] < (T)0.0) ? -p.data[i] : p.data[i]; }
+        return r;
+    }
+
+    /// <summary>
+    /// Lane-wise minimum.
+    /// </summary>
+    template<RealType T, size_t N>
+    FORCEINLINE TPacket<T, N> Min(const TPacket<T, N>& p1, const TPacket<T, N>& p2)
+    {
+        TPacket<T, N> r;
+        for (size_t i = 0; i < N; ++i) { r.data[i] = (p1.data[i] < p2.data[i]) ? p1.data[i] : p2.data[i]; }
+        return r;
+    }
+
+    /// <summary>
+    /// Lane-wise maximum.
+    /// </summary>
+    template<RealType T, size_t N>
+    FORCEINLINE TPacket<T, N> Max(const TPacket<T, N>& p1, const TPacket<T, N>& p2)
+    {
+        TPacket<T, N> r;
+        for (size_t i = 0; i < N; ++i) { r.data[i] = (p1.data[i] > p2.data[i]) ? p1.data[i] : p2.data[i]; }
+        return r;
+    }
+
+    /// <summary>
+    /// Compares each lane with a tolerance.
+    /// </summary>
+    /// <param name="p1">Packet one</param>
+    /// <param name="p2">Packet two</param>
+    /// <param name="threshold">Allowed difference per lane</param>
+    /// <returns>Bitmask with bit i set, if lane i is equal.</returns>
+    template<RealType T, size_t N>
+    FORCEINLINE unsigned int CompareEq(const TPacket<T, N>& p1, const TPacket<T, N>& p2, T threshold = P_FLT_INAC)
+    {
+        static_assert(N <= 32, "TPacket: Lane mask is limited to 32 lanes.");
+
+        unsigned int r = 0;
+        for (size_t i = 0; i < N; ++i) { r |= (unsigned int)(Abs(p1.data[i] - p2.data[i]) < threshold) << i; }
+        return r;
+    }
+
+    /// <summary>
+    /// Compares each lane.
+    /// </summary>
+    /// <param name="p1">Packet one</param>
+    /// <param name="p2">Packet two</param>
+    /// <returns>Bitmask with bit i set, if lane i of p1 is less than lane i of p2.</returns>
+    template<RealType T, size_t N>
+    FORCEINLINE unsigned int CompareLess(const TPacket<T, N>& p1, const TPacket<T, N>& p2)
+    {
+        static_assert(N <= 32, "TPacket: Lane mask is limited to 32 lanes.");
+
+        unsigned int r = 0;
+        for (size_t i = 0; i < N; ++i) { r |= (unsigned int)(p1.data[i] < p2.data[i]) << i; }
+        return r;
+    }
+
+    /// <summary>
+    /// Mask with all N lane bits set.
+    /// </summary>
+    template<size_t N>
+    constexpr unsigned int PacketFullMask() { return (N >= 32) ? 0xFFFFFFFFu : ((1u << N) - 1u); }
+
+} // Phanes::Core::Math
+
+#endif // !PACKET_H
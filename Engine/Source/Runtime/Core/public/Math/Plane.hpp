@@ -1,20 +1,18 @@
 #pragma once
 
-
-// TODO: Transform
-
 #include "Core/public/Math/Boilerplate.h"
 #include "Core/public/Math/MathFwd.h"
 
 #include "Core/public/Math/Line.hpp"
 #include "Core/public/Math/Ray.hpp"
 #include "Core/public/Math/Vector3.hpp"
+#include "Core/public/Math/Transform.hpp"
 
 namespace Phanes::Core::Math {
 
     // Plane in 3D space, defined as:  P: ax + by + cz = d;
 
-    template<RealType T>
+    template<RealType T, bool S>
     struct TPlane
     {
     public:
@@ -34,7 +32,7 @@ namespace Phanes::Core::Math {
                 Real z;
             };
 
-            TVector3<Real> normal;
+            TVector3<Real, S> normal;
         };
 
         /** Scalar component of plane. */
@@ -56,17 +54,29 @@ namespace Phanes::Core::Math {
          * Copy constructor
          */
 
-        TPlane(const TPlane<Real>& plane) : normal(plane.normal), d(plane.d) {};
+        TPlane(const TPlane<Real, S>& plane) : normal(plane.normal), d(plane.d) {};
 
         /**
          * Move constructor 
          */
 
-        TPlane(TPlane<Real>&& plane) :
+        TPlane(TPlane<Real, S>&& plane) :
             normal(std::move(plane.normal)),
             d(std::move(plane.d))
         {}
 
+        /**
+         * Copy assignment
+         */
+
+        TPlane<Real, S>& operator= (const TPlane<Real, S>& plane)
+        {
+            this->normal = plane.normal;
+            this->d = plane.d;
+
+            return *this;
+        }
+
 
         /**
          * Construct plane from normal and d 
@@ -77,7 +87,7 @@ namespace Phanes::Core::Math {
          * @note Normal is NOT normalized, make sure to normalize [PARAM]normal, or use [FUNC]CreateFromVector. Otherwise unexpected results may occur using the plane.
          */
         
-        TPlane(const TVector3<Real>& normal, Real d) :
+        TPlane(const TVector3<Real, S>& normal, Real d) :
             normal(normal),
             d(d)
         {}
@@ -89,7 +99,7 @@ namespace Phanes::Core::Math {
          * @param(base) Base point
          */
        
-        TPlane(const TVector3<Real>& normal, const TVector3<Real>& base) :
+        TPlane(const TVector3<Real, S>& normal, const TVector3<Real, S>& base) :
             normal(normal)
         {
             this->d = DotP(this->normal, base);
@@ -107,7 +117,7 @@ namespace Phanes::Core::Math {
         TPlane(Real x, Real y, Real z, Real d) :
             d(d)
         {
-            this->normal = TVector3<Real>(x, y, z);
+            this->normal = TVector3<Real, S>(x, y, z);
         }
 
         /**
@@ -118,7 +128,7 @@ namespace Phanes::Core::Math {
          * @param(p3) Point three
          */
 
-        TPlane(const TVector3<Real>& p1, const TVector3<Real>& p2, const TVector3<Real>& p3)
+        TPlane(const TVector3<Real, S>& p1, const TVector3<Real, S>& p2, const TVector3<Real, S>& p3)
         {
             this->normal = Normalize(CrossP(p1, p2));
             this->d = DotP(this->normal, p3);
@@ -141,8 +151,8 @@ namespace Phanes::Core::Math {
      * @see [FUNC] PlaneNormalizeV
      */
 
-    template<RealType T>
-    TPlane<T> operator+= (TPlane<T>& pl1, const TPlane<T>& pl2)
+    template<RealType T, bool S>
+    TPlane<T, S> operator+= (TPlane<T, S>& pl1, const TPlane<T, S>& pl2)
     {
         pl1.normal += pl2.normal; pl1.d += pl2.d;
 
@@ -159,8 +169,8 @@ namespace Phanes::Core::Math {
      * @see [FUNC] PlaneNormalizeV
      */
 
-    template<RealType T>
-    TPlane<T> operator-= (TPlane<T>& pl1, const TPlane<T>& pl2)
+    template<RealType T, bool S>
+    TPlane<T, S> operator-= (TPlane<T, S>& pl1, const TPlane<T, S>& pl2)
     {
         pl1.normal -= pl2.normal; pl1.d -= pl2.d;
 
@@ -177,8 +187,8 @@ namespace Phanes::Core::Math {
      * @see [FUNC] PlaneNormalizeV
      */
 
-    template<RealType T>
-    TPlane<T> operator*= (TPlane<T>& pl1, const TPlane<T>& pl2)
+    template<RealType T, bool S>
+    TPlane<T, S> operator*= (TPlane<T, S>& pl1, const TPlane<T, S>& pl2)
     {
         pl1.x *= pl2.x; pl1.y *= pl2.y; pl1.z *= pl2.z; pl1.d *= pl2.d;
 
@@ -192,10 +202,10 @@ namespace Phanes::Core::Math {
      * @param(s) Scalar to multiply with
      */
 
-    template<RealType T>
-    TPlane<T> operator*= (TPlane<T>& pl1, T s)
+    template<RealType T, bool S>
+    TPlane<T, S> operator*= (TPlane<T, S>& pl1, T s)
     {
-        pl1.normal *= s; pl1 *= s;
+        pl1.normal *= s; pl1.d *= s;
 
         return pl1;
     }
@@ -207,12 +217,12 @@ namespace Phanes::Core::Math {
      * @param(s) Scalar to divide with
      */
 
-    template<RealType T>
-    TPlane<T> operator/= (TPlane<T>& pl1, T s)
+    template<RealType T, bool S>
+    TPlane<T, S> operator/= (TPlane<T, S>& pl1, T s)
     {
         T _1_s = (T)1.0 / s;
 
-        pl1.normal *= _1_s; pl1 *= _1_s;
+        pl1.normal *= _1_s; pl1.d *= _1_s;
 
         return pl1;
     }
@@ -227,10 +237,10 @@ namespace Phanes::Core::Math {
      * @return Sum of planes
      */
 
-    template<RealType T>
-    TPlane<T> operator+ (const TPlane<T>& pl1, const TPlane<T>& pl2)
+    template<RealType T, bool S>
+    TPlane<T, S> operator+ (const TPlane<T, S>& pl1, const TPlane<T, S>& pl2)
     {
-        return TPlane<T>(pl1.normal + pl2.normal, pl1.d + pl2.d);
+        return TPlane<T, S>(pl1.normal + pl2.normal, pl1.d + pl2.d);
     }
 
     /**
@@ -242,10 +252,10 @@ namespace Phanes::Core::Math {
      * @return Difference of the planes
      */
 
-    template<RealType T>
-    TPlane<T> operator- (const TPlane<T>& pl1, const TPlane<T>& pl2)
+    template<RealType T, bool S>
+    TPlane<T, S> operator- (const TPlane<T, S>& pl1, const TPlane<T, S>& pl2)
     {
-        return TPlane<T>(pl1.normal - pl2.normal, pl1.d - pl2.d);
+        return TPlane<T, S>(pl1.normal - pl2.normal, pl1.d - pl2.d);
     }
 
     /**
@@ -257,10 +267,10 @@ namespace Phanes::Core::Math {
      * @return Product of planes
      */
 
-    template<RealType T>
-    TPlane<T> operator* (const TPlane<T>& pl1, const TPlane<T>& pl2)
+    template<RealType T, bool S>
+    TPlane<T, S> operator* (const TPlane<T, S>& pl1, const TPlane<T, S>& pl2)
     {
-        return TPlane<T>(pl1.x * pl2.x, pl1.y * pl2.y, pl1.z * pl2.z, pl1.d * pl2.d);
+        return TPlane<T, S>(pl1.x * pl2.x, pl1.y * pl2.y, pl1.z * pl2.z, pl1.d * pl2.d);
     }
 
     /**
@@ -272,10 +282,10 @@ namespace Phanes::Core::Math {
      * @return Product of plane and scalar
      */
 
-    template<RealType T>
-    TPlane<T> operator*= (const TPlane<T>& pl1, T s)
+    template<RealType T, bool S>
+    TPlane<T, S> operator* (const TPlane<T, S>& pl1, T s)
     {
-        return TPlane<T>(pl1.normal * s, pl1.d * s);
+        return TPlane<T, S>(pl1.normal * s, pl1.d * s);
     }
 
     /**
@@ -287,12 +297,12 @@ namespace Phanes::Core::Math {
      * @return Quotient of plane and scalar
      */
 
-    template<RealType T>
-    TPlane<T> operator/= (const TPlane<T>& pl1, T s)
+    template<RealType T, bool S>
+    TPlane<T, S> operator/ (const TPlane<T, S>& pl1, T s)
     {
         T _1_s = (T)1.0 / s;
 
-        return TPlane<T>(pl1.normal * _1_s, pl1.d * _1_s);
+        return TPlane<T, S>(pl1.normal * _1_s, pl1.d * _1_s);
     }
 
     /**
@@ -306,10 +316,10 @@ namespace Phanes::Core::Math {
      * @return True, if planes are equal, false, if not.
      */
 
-    template<RealType T>
-    bool operator== (const TPlane<T>& pl1, const TPlane<T>& pl2)
+    template<RealType T, bool S>
+    bool operator== (const TPlane<T, S>& pl1, const TPlane<T, S>& pl2)
     {
-        return pl1.normal == pl2.normal && abs(pl1.d - pl2.d) < P_FLT_INAC;
+        return pl1.normal == pl2.normal && Abs(pl1.d - pl2.d) < P_FLT_INAC;
     }
 
     /**
@@ -323,10 +333,10 @@ namespace Phanes::Core::Math {
      * @return True, if planes are inequal, false, if not.
      */
 
-    template<RealType T>
-    bool operator!= (const TPlane<T>& pl1, const TPlane<T>& pl2)
+    template<RealType T, bool S>
+    bool operator!= (const TPlane<T, S>& pl1, const TPlane<T, S>& pl2)
     {
-        return pl1.normal != pl2.normal || abs(pl1.d - pl2.d) >= P_FLT_INAC;
+        return pl1.normal != pl2.normal || Abs(pl1.d - pl2.d) >= P_FLT_INAC;
     }
 
 
@@ -347,10 +357,10 @@ namespace Phanes::Core::Math {
      * @return True if perpendicular, false if not.
      */
 
-    template<RealType T>
-    inline bool IsPerpendicular(const TPlane<T>& pl1, const TPlane<T>& pl2, T threshold = P_FLT_INAC)
+    template<RealType T, bool S>
+    inline bool IsPerpendicular(const TPlane<T, S>& pl1, const TPlane<T, S>& pl2, T threshold = P_FLT_INAC)
     {
-        return (abs(DotP(pl1.normal, pl2.normal)) < threshold);
+        return (Abs(DotP(pl1.normal, pl2.normal)) < threshold);
     }
 
     /**
@@ -363,10 +373,10 @@ namespace Phanes::Core::Math {
      * @return True if parallel, false if not.
      */
 
-    template<RealType T>
-    inline bool IsParallel(const TPlane<T>& pl1, const TPlane<T>& pl2, T threshold = 1.0f - P_FLT_INAC)
+    template<RealType T, bool S>
+    inline bool IsParallel(const TPlane<T, S>& pl1, const TPlane<T, S>& pl2, T threshold = 1.0f - P_FLT_INAC)
     {
-        return (abs(DotP(pl1.normal, pl2.normal)) > threshold);
+        return (Abs(DotP(pl1.normal, pl2.normal)) > threshold);
     }
 
     /**
@@ -379,8 +389,8 @@ namespace Phanes::Core::Math {
      * @return True if coincident, false if not.
      */
 
-    template<RealType T>
-    inline bool IsCoincident(const TPlane<T>& pl1, const TPlane<T>& pl2, T threshold = 1.0f - P_FLT_INAC)
+    template<RealType T, bool S>
+    inline bool IsCoincident(const TPlane<T, S>& pl1, const TPlane<T, S>& pl2, T threshold = 1.0f - P_FLT_INAC)
     {
         return (DotP(pl1.normal, pl2.normal) > threshold);
     }
@@ -394,10 +404,10 @@ namespace Phanes::Core::Math {
      * @return True if unit vector, false if not.
      */
 
-    template<RealType T>
-    inline bool IsNormalized(const TPlane<T>& pl1, T threshold = P_FLT_INAC)
+    template<RealType T, bool S>
+    inline bool IsNormalized(const TPlane<T, S>& pl1, T threshold = P_FLT_INAC)
     {
-        return (SqrMagnitude(pl1.normal) < threshold);
+        return (Abs(SqrMagnitude(pl1.normal) - (T)1.0) < threshold);
     }
 
     /**
@@ -413,11 +423,11 @@ namespace Phanes::Core::Math {
      * @note Planes must be normalized.
      */
 
-    template<RealType T>
-    inline bool IsSame(const TPlane<T>& pl1, const TPlane<T>& pl2, T threshold = P_FLT_INAC)
+    template<RealType T, bool S>
+    inline bool IsSame(const TPlane<T, S>& pl1, const TPlane<T, S>& pl2, T threshold = P_FLT_INAC)
     {
 
-        return DotP(pl1.normal, pl2.normal) > threshold && abs(pl1.d - pl2.d) < P_FLT_INAC;
+        return DotP(pl1.normal, pl2.normal) > threshold && Abs(pl1.d - pl2.d) < P_FLT_INAC;
     }
 
     /** 
@@ -426,10 +436,10 @@ namespace Phanes::Core::Math {
      * @param(pl1) Plane
      */
 
-    template<RealType T>
-    TPlane<T> PlaneNormalizeV(TPlane<T>& pl1)
+    template<RealType T, bool S>
+    TPlane<T, S> PlaneNormalizeV(TPlane<T, S>& pl1)
     {
-        T normVec = SqrMagnitude(pl1);
+        T normVec = SqrMagnitude(pl1.normal);
 
         T scale = (normVec > P_FLT_INAC) ? (T)1.0 / sqrt(normVec) : 1.0f;
 
@@ -446,14 +456,14 @@ namespace Phanes::Core::Math {
      * @return Normalized plane
      */
 
-    template<RealType T>
-    TPlane<T> PlaneNormalize(TPlane<T>& pl1)
+    template<RealType T, bool S>
+    TPlane<T, S> PlaneNormalize(const TPlane<T, S>& pl1)
     {
-        T normVec = SqrMagnitude(pl1);
+        T normVec = SqrMagnitude(pl1.normal);
 
         T scale = (normVec > P_FLT_INAC) ? (T)1.0 / sqrt(normVec) : 1.0f;
 
-        return TPlane<T>(pl1.normal * scale, pl1.d * scale);
+        return TPlane<T, S>(pl1.normal * scale, pl1.d * scale);
     }
 
     /**
@@ -464,10 +474,10 @@ namespace Phanes::Core::Math {
      * @note Does not check for zero vector pl1.normal.
      */
 
-    template<RealType T>
-    TPlane<T> PlaneUnsafeNormalizeV(TPlane<T>& pl1)
+    template<RealType T, bool S>
+    TPlane<T, S> PlaneUnsafeNormalizeV(TPlane<T, S>& pl1)
     {
-        T scale = (T)1.0 / Magnitude(pl1);
+        T scale = (T)1.0 / Magnitude(pl1.normal);
 
         pl1.normal *= scale; pl1.d *= scale;
 
@@ -484,12 +494,12 @@ namespace Phanes::Core::Math {
      * @note Does not check for zero vector pl1.normal.
      */
 
-    template<RealType T>
-    TPlane<T> PlaneUnsafeNormalize(TPlane<T>& pl1)
+    template<RealType T, bool S>
+    TPlane<T, S> PlaneUnsafeNormalize(const TPlane<T, S>& pl1)
     {
-        T scale = (T)1.0 / Magnitude(pl1);
+        T scale = (T)1.0 / Magnitude(pl1.normal);
 
-        return TPlane<T>(pl1.normal * scale, pl1.d * scale);
+        return TPlane<T, S>(pl1.normal * scale, pl1.d * scale);
     }
 
     /**
@@ -499,8 +509,8 @@ namespace Phanes::Core::Math {
      * @param(pl2) Plane two
      */
 
-    template<RealType T>
-    FORCEINLINE T PlaneDotP(const TPlane<T>& pl1, const TPlane<T>& pl2)
+    template<RealType T, bool S>
+    FORCEINLINE T PlaneDotP(const TPlane<T, S>& pl1, const TPlane<T, S>& pl2)
     {
         return DotP(pl1.normal, pl2.normal);
     }
@@ -512,8 +522,8 @@ namespace Phanes::Core::Math {
      * @param(pl2) Plane two
      */
 
-    template<RealType T>
-    FORCEINLINE T PlaneAngle(const TPlane<T>& pl1, const TPlane<T>& pl2)
+    template<RealType T, bool S>
+    FORCEINLINE T PlaneAngle(const TPlane<T, S>& pl1, const TPlane<T, S>& pl2)
     {
         return Angle(pl1.normal, pl2.normal);
     }
@@ -525,8 +535,8 @@ namespace Phanes::Core::Math {
      * @param(pl2) Plane two
      */
 
-    template<RealType T>
-    FORCEINLINE T PlaneCosAngle(const TPlane<T>& pl1, const TPlane<T>& pl2)
+    template<RealType T, bool S>
+    FORCEINLINE T PlaneCosAngle(const TPlane<T, S>& pl1, const TPlane<T, S>& pl2)
     {
         return CosineAngle(pl1.normal, pl2.normal);
     }
@@ -537,11 +547,13 @@ namespace Phanes::Core::Math {
      * @param(pl1) Plane 
      */
 
-    template<RealType T>
-    TPlane<T> FlipV(const TPlane<T>& pl1)
+    template<RealType T, bool S>
+    TPlane<T, S> FlipV(TPlane<T, S>& pl1)
     {
-        pl1.normal = -pl1.normal;
-        pl1.d      = -pl1.d;
+        NegateV(pl1.normal);
+        pl1.d = -pl1.d;
+
+        return pl1;
     }
 
 
@@ -553,10 +565,10 @@ namespace Phanes::Core::Math {
      * @return Flipped plane
      */
 
-    template<RealType T>
-    TPlane<T> Flip(const TPlane<T>& pl1)
+    template<RealType T, bool S>
+    TPlane<T, S> Flip(const TPlane<T, S>& pl1)
     {
-        return TPlane<T>(-pl1.normal, -pl1.d);
+        return TPlane<T, S>(Negate(pl1.normal), -pl1.d);
     }
 
     /**
@@ -566,10 +578,12 @@ namespace Phanes::Core::Math {
      * @param(tr) Transform
      */
 
-    template<RealType T>
-    FORCEINLINE TPlane<T> TransformV(TPlane<T>& pl, const TTransform<T>& tr)
+    template<RealType T, bool S>
+    FORCEINLINE TPlane<T, S> TransformV(TPlane<T, S>& pl, const TTransform<T, S>& tr)
     {
-        // TODO: Do with operator*
+        pl = Transform(pl, tr);
+
+        return pl;
     }
 
 
@@ -582,10 +596,14 @@ namespace Phanes::Core::Math {
      * @return Transformed plane.
      */
 
-    template<RealType T>
-    FORCEINLINE TPlane<T> Transform(const TPlane<T>& pl, const TTransform<T>& tr)
+    template<RealType T, bool S>
+    FORCEINLINE TPlane<T, S> Transform(const TPlane<T, S>& pl, const TTransform<T, S>& tr)
     {
-        // TODO: Do with operator*
+        // Normals transform with the inverse transpose, which divides by the scale instead of multiplying.
+        TVector3<T, S> normal = Rotate(tr.rotation, TVector3<T, S>(pl.x / tr.scale.x, pl.y / tr.scale.y, pl.z / tr.scale.z));
+        NormalizeV(normal);
+
+        return TPlane<T, S>(normal, TransformPoint(tr, pl.normal * pl.d));
     }
 
     /**
@@ -598,8 +616,8 @@ namespace Phanes::Core::Math {
      * @note Distance is 0 if point is on plane, >0 if it's in front and <0 if it's on the backside.
      */
 
-    template<RealType T>
-    T PointDistance(const TPlane<T>& pl1, const TVector3<T>& p1)
+    template<RealType T, bool S>
+    T PointDistance(const TPlane<T, S>& pl1, const TVector3<T, S>& p1)
     {
         return (pl1.x * p1.x + pl1.y * p1.y + pl1.z * p1.z) - pl1.d;
     }
@@ -612,10 +630,10 @@ namespace Phanes::Core::Math {
      * @return Base of plane
      */
 
-    template<RealType T>
-    TVector3<T> GetOrigin(const TPlane<T>& pl1)
+    template<RealType T, bool S>
+    TVector3<T, S> GetOrigin(const TPlane<T, S>& pl1)
     {
-        return TVector3<T>(pl1.normal * d);
+        return TVector3<T, S>(pl1.normal * pl1.d);
     }
 
     /**
@@ -625,11 +643,11 @@ namespace Phanes::Core::Math {
      * @param(v1) Vector
      */
 
-    template<RealType T>
-    TPlane<T> TranslateV(TPlane<T>& pl1, const TVector3<T>& v1)
+    template<RealType T, bool S>
+    TPlane<T, S> TranslateV(TPlane<T, S>& pl1, const TVector3<T, S>& v1)
     {
         
-        pl1.d = DotP(this->normal, GetOrigin(pl1) + v1);
+        pl1.d = DotP(pl1.normal, GetOrigin(pl1) + v1);
 
         return pl1;
     }
@@ -641,10 +659,10 @@ namespace Phanes::Core::Math {
      * @param(v1) Vector
      */
 
-    template<RealType T>
-    TPlane<T> Translate(TPlane<T>& pl1, const TVector3<T>& v1)
+    template<RealType T, bool S>
+    TPlane<T, S> Translate(const TPlane<T, S>& pl1, const TVector3<T, S>& v1)
     {
-        return TPlane<T>(pl1.normal, GetOrigin(pl1) + v1);
+        return TPlane<T, S>(pl1.normal, GetOrigin(pl1) + v1);
     }
 
     /**
@@ -656,8 +674,8 @@ namespace Phanes::Core::Math {
      * @return True, if it's in the front and false, if it's on the back.
      */
 
-    template<RealType T>
-    bool GetSide(const TPlane<T>& pl1, const TVector3<T>& p1)
+    template<RealType T, bool S>
+    bool GetSide(const TPlane<T, S>& pl1, const TVector3<T, S>& p1)
     {
         return (pl1.d <= DotP(pl1.normal, p1));
     }
@@ -672,8 +690,8 @@ namespace Phanes::Core::Math {
      * @note Simply rejects v1 from normal
      */
 
-    template<RealType T>
-    FORCEINLINE TVector3<T> ProjectOntoPlaneV(TVector3<T>& v1, const TPlane<T>& plane)
+    template<RealType T, bool S>
+    FORCEINLINE TVector3<T, S> ProjectOntoPlaneV(TVector3<T, S>& v1, const TPlane<T, S>& plane)
     {
         return RejectV(v1, plane.normal);
     }
@@ -689,8 +707,8 @@ namespace Phanes::Core::Math {
      * @note Simply rejects v1 from normal
      */
 
-    template<RealType T>
-    FORCEINLINE TVector3<T> ProjectOntoPlaneV(TVector3<T>& v1, const TVector3<T>& normal)
+    template<RealType T, bool S>
+    FORCEINLINE TVector3<T, S> ProjectOntoPlaneV(TVector3<T, S>& v1, const TVector3<T, S>& normal)
     {
         return RejectV(v1, normal);
     }
@@ -704,8 +722,8 @@ namespace Phanes::Core::Math {
      * @note result is stored in v1.
      */
 
-    template<RealType T>
-    FORCEINLINE TVector3<T> ReflectFromPlaneV(TVector3<T>& v1, const TPlane<T>& plane)
+    template<RealType T, bool S>
+    FORCEINLINE TVector3<T, S> ReflectFromPlaneV(TVector3<T, S>& v1, const TPlane<T, S>& plane)
     {
         return ReflectV(v1, plane.normal);
     }
@@ -719,8 +737,8 @@ namespace Phanes::Core::Math {
      * @note result is stored in v1.
      */
 
-    template<RealType T>
-    FORCEINLINE TVector3<T> ReflectFromPlaneV(TVector3<T>& v1, const TVector3<T>& normal)
+    template<RealType T, bool S>
+    FORCEINLINE TVector3<T, S> ReflectFromPlaneV(TVector3<T, S>& v1, const TVector3<T, S>& normal)
     {
         return ReflectV(v1, normal);
     }
@@ -735,8 +753,8 @@ namespace Phanes::Core::Math {
      * @return Reflected vector
      */
 
-    template<RealType T>
-    FORCEINLINE TVector3<T> ReflectFromPlane(const TVector3<T>& v1, const TPlane<T>& plane)
+    template<RealType T, bool S>
+    FORCEINLINE TVector3<T, S> ReflectFromPlane(const TVector3<T, S>& v1, const TPlane<T, S>& plane)
     {
         return Reflect(v1, plane.normal);
     }
@@ -750,8 +768,8 @@ namespace Phanes::Core::Math {
      * @return Reflected vector
      */
 
-    template<RealType T>
-    FORCEINLINE TVector3<T> ReflectFromPlane(const TVector3<T>& v1, const TVector3<T>& normal)
+    template<RealType T, bool S>
+    FORCEINLINE TVector3<T, S> ReflectFromPlane(const TVector3<T, S>& v1, const TVector3<T, S>& normal)
     {
         return Reflect(v1, normal);
     }
@@ -768,8 +786,8 @@ namespace Phanes::Core::Math {
      * @note Simply rejects the vector from normal
      */
 
-    template<RealType T>
-    FORCEINLINE TVector3<T> ProjectOntoPlane(const TVector3<T>& v1, const TVector3<T>& normal)
+    template<RealType T, bool S>
+    FORCEINLINE TVector3<T, S> ProjectOntoPlane(const TVector3<T, S>& v1, const TVector3<T, S>& normal)
     {
         return Reject(v1, normal);
     }
@@ -787,8 +805,8 @@ namespace Phanes::Core::Math {
      * @note Simply rejects the vector from normal
      */
 
-    template<RealType T>
-    FORCEINLINE TVector3<T> ProjectOntoPlane(const TVector3<T>& v1, const TPlane<T>& plane)
+    template<RealType T, bool S>
+    FORCEINLINE TVector3<T, S> ProjectOntoPlane(const TVector3<T, S>& v1, const TPlane<T, S>& plane)
     {
         return Reject(v1, plane.normal);
     }
@@ -803,10 +821,10 @@ namespace Phanes::Core::Math {
      * @return True, if equal, false if not.
      */
 
-    template<RealType T>
-    inline bool Equals(const TPlane<T>& pl1, const TPlane<T>& pl2, T threshold = P_FLT_INAC)
+    template<RealType T, bool S>
+    inline bool Equals(const TPlane<T, S>& pl1, const TPlane<T, S>& pl2, T threshold = P_FLT_INAC)
     {
-        return Equals(pl1.normal, pl2.normal, threshold) && abs(pl1.d - pl2.d) < threshold;
+        return Equals(pl1.normal, pl2.normal, threshold) && Abs(pl1.d - pl2.d) < threshold;
     }
 
 
@@ -817,10 +835,10 @@ namespace Phanes::Core::Math {
      * 
      * @return True, if p1 on pl1, false if not.
      */
-    template<RealType T>
-    FORCEINLINE bool IsPointOnPlane(const TPlane<T>& pl1, const TVector3<T>& p1)
+    template<RealType T, bool S>
+    FORCEINLINE bool IsPointOnPlane(const TPlane<T, S>& pl1, const TVector3<T, S>& p1)
     {
-        return (Equals(DotP(pl1.normal, p1), d));
+        return (Abs(DotP(pl1.normal, p1) - pl1.d) < P_FLT_INAC);
     }
 
     /**
@@ -834,15 +852,15 @@ namespace Phanes::Core::Math {
      * @return True, if planes intersect, false, if not.
      */
 
-    template<RealType T>
-    bool PlanesIntersect2(const TPlane<T>& pl1, const TPlane<T>& pl2, Ref<TLine<T>> interLine, T threshold = P_FLT_INAC)
+    template<RealType T, bool S>
+    bool PlanesIntersect2(const TPlane<T, S>& pl1, const TPlane<T, S>& pl2, TLine<T, S>& interLine, T threshold = P_FLT_INAC)
     {
-        TVector3<T> dirLine = CrossP(pl1.normal, pl2.normal);
+        TVector3<T, S> dirLine = CrossP(pl1.normal, pl2.normal);
         T det = SqrMagnitude(dirLine);
 
-        if (abs(det) > P_FLT_INAC)
+        if (Abs(det) > threshold)
         {
-            interLine = MakeRef<TLine<T>(dirLine, (CrossP(dirLine, pl2.normal) * pl1.d + CrossP(dirLine, pl1.normal) * pl2.d) / det);
+            interLine = TLine<T, S>(dirLine, (CrossP(pl2.normal, dirLine) * pl1.d + CrossP(dirLine, pl1.normal) * pl2.d) / det);
             NormalizeV(interLine);
             return true;
         }
@@ -851,7 +869,7 @@ namespace Phanes::Core::Math {
     }
 
     /**
-     * Tests whether three planes intersect. Sets line to intersection-line if true.
+     * Tests whether three planes intersect. Sets point to intersection-point if true.
      *
      * @param(pl1) Plane one
      * @param(pl2) Plane two
@@ -862,14 +880,14 @@ namespace Phanes::Core::Math {
      * @return True, if all planes intersect, false, if not.
      */
 
-    template<RealType T>
-    bool PlanesIntersect3(const TPlane<T>& pl1, const TPlane<T>& pl2, const TPlane<T>& pl3, Ref<TVector3<T>> interPoint, T threshold = P_FLT_INAC)
+    template<RealType T, bool S>
+    bool PlanesIntersect3(const TPlane<T, S>& pl1, const TPlane<T, S>& pl2, const TPlane<T, S>& pl3, TVector3<T, S>& interPoint, T threshold = P_FLT_INAC)
     {
         T det = DotP(CrossP(pl1.normal, pl2.normal), pl3.normal);
 
-        if (abs(det) > P_FLT_INAC)
+        if (Abs(det) > threshold)
         {
-            interPoint = MakeRef<TVector3<T>>((CrossP(pl3.normal, pl2.normal) * pl1.d + CrossP(pl1.normal, pl3.normal) * pl2.d) / det);
+            interPoint = (CrossP(pl2.normal, pl3.normal) * pl1.d + CrossP(pl3.normal, pl1.normal) * pl2.d + CrossP(pl1.normal, pl2.normal) * pl3.d) / det;
             return true;
         }
 
@@ -885,8 +903,8 @@ namespace Phanes::Core::Math {
      * @return Mirrored point.
      */
 
-    template<RealType T>
-    TVector3<T> PlaneMirrorPoint(const TVector3<T>& p1, const TPlane<T>& pl1)
+    template<RealType T, bool S>
+    TVector3<T, S> PlaneMirrorPoint(const TVector3<T, S>& p1, const TPlane<T, S>& pl1)
     {
         return p1 - pl1.normal * ((T)2.0 * PointDistance(pl1, p1));
     }
@@ -900,10 +918,10 @@ namespace Phanes::Core::Math {
      * @return Projected point.
      */
 
-    template<RealType T>
-    TVector3<T> PointProjectOntoPlane(const TVector3<T>& p1, const TPlane<T>& pl1)
+    template<RealType T, bool S>
+    TVector3<T, S> PointProjectOntoPlane(const TVector3<T, S>& p1, const TPlane<T, S>& pl1)
     {
-        p1 - PointDistance(pl1, p1) * pl1.normal;
+        return p1 - pl1.normal * PointDistance(pl1, p1);
     }
 
     /**
@@ -916,20 +934,49 @@ namespace Phanes::Core::Math {
      * @return True, if they intersect, false if not.
      */
 
-    template<RealType T>
-    bool LineIntersect(const TPlane<T>& pl1, const TLine<T>& l1, Ref<TVector3<T>> p1)
+    template<RealType T, bool S>
+    bool LineIntersect(const TPlane<T, S>& pl1, const TLine<T, S>& l1, TVector3<T, S>& p1)
     {
-        T dotProduct = DotP(l1.normal, pl1.normal);
+        T dotProduct = DotP(l1.direction, pl1.normal);
 
-        if (abs(dotProduct) > P_FLT_INAC)
+        if (Abs(dotProduct) > P_FLT_INAC)
         {
-            p1 = MakeRef<TVector3<T>>(l1.base - l1.normal * (DotP(l1.normal * p1.base) / dotProduct));
+            p1 = l1.base + l1.direction * (-PointDistance(pl1, l1.base) / dotProduct);
             return true;
         }
 
         return false;
     }
 
+    /**
+     * Calculates the ray parameter, at which a ray hits a plane.
+     *
+     * @param(pl1) Plane
+     * @param(r1) Ray
+     * @param(t) Ray parameter of the intersection. Equals the distance, if the direction of r1 is normalized.
+     *
+     * @return True, if they intersect, false if not.
+     */
+
+    template<RealType T, bool S>
+    bool RayIntersect(const TPlane<T, S>& pl1, const TRay<T, S>& r1, T& t)
+    {
+        T pr = DotP(pl1.normal, r1.direction);
+
+        if (Abs(pr) > P_FLT_INAC)
+        {
+            T parameter = -PointDistance(pl1, r1.origin) / pr;
+
+            if (parameter >= 0)
+            {
+                t = parameter;
+                return true;
+            }
+        }
+
+        return false;
+    }
+
     /**
      * Calculates, the intersection point, of a plane and a ray.
      * 
@@ -940,15 +987,14 @@ namespace Phanes::Core::Math {
      * @return True, if they intersect, false if not.
      */
 
-    template<RealType T>
-    bool RayIntersect(const TPlane<T>& pl1, const TRay<T>& r1, Ref<TVector3<T>> p1)
+    template<RealType T, bool S>
+    bool RayIntersect(const TPlane<T, S>& pl1, const TRay<T, S>& r1, TVector3<T, S>& p1)
     {
-        T pr = DotP(pl1.normal, Normalize(r1.direction));
-        T parameter = DotP((GetOrigin(pl1) - r1.origin), pl1.normal) / pr;
+        T parameter;
 
-        if (p1 > P_FLT_INAC && parameter >= 0)
+        if (RayIntersect(pl1, r1, parameter))
         {
-            p1 = MakeRef<TVector3<T>>(PointAt(r1, parameter));
+            p1 = PointAt(r1, parameter);
             return true;
         }
 
@@ -0,0 +1,521 @@
+#pragma once
+
+// Quaternion (x, y, z, w), where (x, y, z) is the vector part and w the scalar part.
+//
+// Rotations are unit quaternions. Multiplication q1 * q2 applies q2 first, like the matrix product.
+// Arrays of quaternions are interpolated with QuaternionBatch.hpp.
+
+#include <cmath>
+
+#include "Core/public/Math/Boilerplate.h"
+#include "Core/public/Math/MathCommon.hpp"
+#include "Core/public/Math/SIMD/Storage.h"
+
+#include "Core/public/Math/MathFwd.h"
+
+#include "Core/public/Math/Vector3.hpp"
+#include "Core/public/Math/Matrix3.hpp"
+#include "Core/public/Math/Matrix4.hpp"
+
+
+#ifndef QUATERNION_H
+#define QUATERNION_H
+
+namespace Phanes::Core::Math
+{
+
+    /// Quaternion defined with x, y, z, w.
+    /// Alignment allows for possible simd optimization.
+    template<RealType T, bool S = false>
+    struct TQuaternion
+    {
+    public:
+        using Real = T;
+        union
+        {
+            struct {
+                /// <summary>
+                /// X component of vector part
+                /// </summary>
+                Real x;
+
+                /// <summary>
+                /// Y component of vector part
+                /// </summary>
+                Real y;
+
+                /// <summary>
+                /// Z component of vector part
+                /// </summary>
+                Real z;
+
+                /// <summary>
+                /// Scalar part
+                /// </summary>
+                Real w;
+
+            };
+            /// <summary>
+            /// Wraps components in one array / xmm register.
+            /// </summary>
+            union
+            {
+                typename SIMD::Storage<4, Real, SIMD::use_simd<T, 4, S>::value>::type comp;
+                typename SIMD::Storage<4, Real, SIMD::use_simd<T, 4, S>::value>::type data;
+            };
+
+        };
+
+        /// Default constructor
+        TQuaternion() = default;
+
+        /// Copy constructor
+        TQuaternion(const TQuaternion<Real, S>& q);
+
+        /// <summary>
+        /// Construct quaternion from x, y, z, w components.
+        /// </summary>
+        /// <param name="_x">X component of vector part</param>
+        /// <param name="_y">Y component of vector part</param>
+        /// <param name="_z">Z component of vector part</param>
+        /// <param name="_w">Scalar part</param>
+        TQuaternion(Real _x, Real _y, Real _z, Real _w);
+
+        /// <summary>
+        /// Construct quaternion from vector and scalar part.
+        /// </summary>
+        /// <param name="v">Vector part</param>
+        /// <param name="_w">Scalar part</param>
+        TQuaternion(const TVector3<Real, S>& v, Real _w);
+
+        /// <summary>
+        /// Construct quaternion from array of components
+        /// </summary>
+        /// <param name="comp">Array of at least 4 components (x, y, z, w)</param>
+        explicit TQuaternion(const Real* comp);
+
+        TQuaternion<Real, S>& operator= (const TQuaternion<Real, S>& q) = default;
+
+        /// <summary>
+        /// Gets the identity rotation (0, 0, 0, 1).
+        /// </summary>
+        /// <returns>Identity quaternion</returns>
+        static TQuaternion<Real, S> Identity()
+        {
+            return TQuaternion<Real, S>((Real)0.0, (Real)0.0, (Real)0.0, (Real)1.0);
+        }
+    };
+
+    // ======================== //
+    //   TQuaternion operators  //
+    // ======================== //
+
+    /// <summary>
+    /// Quaternion addition.
+    /// </summary>
+    /// <param name="q1">Quaternion one</param>
+    /// <param name="q2">Quaternion two</param>
+    /// <returns>Copy of q1.</returns>
+    template<RealType T, bool S>
+    TQuaternion<T, S> operator+= (TQuaternion<T, S>& q1, const TQuaternion<T, S>& q2);
+
+    /// <summary>
+    /// Quaternion substraction.
+    /// </summary>
+    /// <param name="q1">Quaternion one</param>
+    /// <param name="q2">Quaternion two</param>
+    /// <returns>Copy of q1.</returns>
+    template<RealType T, bool S>
+    TQuaternion<T, S> operator-= (TQuaternion<T, S>& q1, const TQuaternion<T, S>& q2);
+
+    /// <summary>
+    /// Quaternion multiplication (Hamilton product). q2 is applied first.
+    /// </summary>
+    /// <param name="q1">Quaternion one</param>
+    /// <param name="q2">Quaternion two</param>
+    /// <returns>Copy of q1.</returns>
+    template<RealType T, bool S>
+    TQuaternion<T, S> operator*= (TQuaternion<T, S>& q1, const TQuaternion<T, S>& q2);
+
+    /// <summary>
+    /// Quaternion - scalar multiplication.
+    /// </summary>
+    /// <param name="q1">Quaternion</param>
+    /// <param name="s">Scalar</param>
+    /// <returns>Copy of q1.</returns>
+    template<RealType T, bool S>
+    TQuaternion<T, S> operator*= (TQuaternion<T, S>& q1, T s);
+
+    /// <summary>
+    /// Quaternion - scalar division.
+    /// </summary>
+    /// <param name="q1">Quaternion</param>
+    /// <param name="s">Scalar</param>
+    /// <returns>Copy of q1.</returns>
+    template<RealType T, bool S>
+    TQuaternion<T, S> operator/= (TQuaternion<T, S>& q1, T s);
+
+    /// <summary>
+    /// Quaternion addition.
+    /// </summary>
+    /// <param name="q1">Quaternion one</param>
+    /// <param name="q2">Quaternion two</param>
+    /// <returns>Sum</returns>
+    template<RealType T, bool S>
+    TQuaternion<T, S> operator+ (const TQuaternion<T, S>& q1, const TQuaternion<T, S>& q2);
+
+    /// <summary>
+    /// Quaternion substraction.
+    /// </summary>
+    /// <param name="q1">Quaternion one</param>
+    /// <param name="q2">Quaternion two</param>
+    /// <returns>Difference</returns>
+    template<RealType T, bool S>
+    TQuaternion<T, S> operator- (const TQuaternion<T, S>& q1, const TQuaternion<T, S>& q2);
+
+    /// <summary>
+    /// Negates all components. Represents the same rotation.
+    /// </summary>
+    /// <param name="q1">Quaternion</param>
+    /// <returns>Negated quaternion</returns>
+    template<RealType T, bool S>
+    TQuaternion<T, S> operator- (const TQuaternion<T, S>& q1);
+
+    /// <summary>
+    /// Quaternion multiplication (Hamilton product). q2 is applied first.
+    /// </summary>
+    /// <param name="q1">Quaternion one</param>
+    /// <param name="q2">Quaternion two</param>
+    /// <returns>Product</returns>
+    template<RealType T, bool S>
+    TQuaternion<T, S> operator* (const TQuaternion<T, S>& q1, const TQuaternion<T, S>& q2);
+
+    /// <summary>
+    /// Quaternion - scalar multiplication.
+    /// </summary>
+    /// <param name="q1">Quaternion</param>
+    /// <param name="s">Scalar</param>
+    /// <returns>Scaled quaternion</returns>
+    template<RealType T, bool S>
+    TQuaternion<T, S> operator* (const TQuaternion<T, S>& q1, T s);
+
+    /// <summary>
+    /// Scalar - quaternion multiplication.
+    /// </summary>
+    /// <param name="s">Scalar</param>
+    /// <param name="q1">Quaternion</param>
+    /// <returns>Scaled quaternion</returns>
+    template<RealType T, bool S>
+    TQuaternion<T, S> operator* (T s, const TQuaternion<T, S>& q1);
+
+    /// <summary>
+    /// Quaternion - scalar division.
+    /// </summary>
+    /// <param name="q1">Quaternion</param>
+    /// <param name="s">Scalar</param>
+    /// <returns>Scaled quaternion</returns>
+    template<RealType T, bool S>
+    TQuaternion<T, S> operator/ (const TQuaternion<T, S>& q1, T s);
+
+    /// <summary>
+    /// Rotates a vector by a unit quaternion.
+    /// </summary>
+    /// <param name="q1">Rotation</param>
+    /// <param name="v1">Vector</param>
+    /// <returns>Rotated vector</returns>
+    template<RealType T, bool S>
+    TVector3<T, S> operator* (const TQuaternion<T, S>& q1, const TVector3<T, S>& v1);
+
+    /// <summary>
+    /// Tests whether the components are equal (with a tolerance of P_FLT_INAC). q and -q are not equal, though they are the same rotation.
+    /// </summary>
+    /// <param name="q1">Quaternion one</param>
+    /// <param name="q2">Quaternion two</param>
+    /// <returns>True, if equal.</returns>
+    template<RealType T, bool S>
+    bool operator== (const TQuaternion<T, S>& q1, const TQuaternion<T, S>& q2);
+
+    /// <summary>
+    /// Tests whether any components are unequal (with a tolerance of P_FLT_INAC).
+    /// </summary>
+    /// <param name="q1">Quaternion one</param>
+    /// <param name="q2">Quaternion two</param>
+    /// <returns>True, if unequal.</returns>
+    template<RealType T, bool S>
+    bool operator!= (const TQuaternion<T, S>& q1, const TQuaternion<T, S>& q2);
+
+
+    // ========================= //
+    //   TQuaternion functions   //
+    // ========================= //
+
+    /// <summary>
+    /// Gets the dot product of two quaternions. Cosine of half the angle between two unit quaternions.
+    /// </summary>
+    /// <param name="q1">Quaternion one</param>
+    /// <param name="q2">Quaternion two</param>
+    /// <returns>Dot product</returns>
+    template<RealType T, bool S>
+    T DotP(const TQuaternion<T, S>& q1, const TQuaternion<T, S>& q2);
+
+    /// <summary>
+    /// Gets the magnitude of a quaternion.
+    /// </summary>
+    /// <param name="q1">Quaternion</param>
+    /// <returns>Magnitude</returns>
+    template<RealType T, bool S>
+    T Magnitude(const TQuaternion<T, S>& q1);
+
+    /// <summary>
+    /// Gets the square of the magnitude of a quaternion.
+    /// </summary>
+    /// <param name="q1">Quaternion</param>
+    /// <returns>Square of magnitude</returns>
+    template<RealType T, bool S>
+    T SqrMagnitude(const TQuaternion<T, S>& q1);
+
+    /// <summary>
+    /// Normalizes a quaternion. Quaternions shorter than P_FLT_INAC are returned unchanged.
+    /// </summary>
+    /// <param name="q1">Quaternion</param>
+    /// <param name="p">Precision of the reciprocal square root. Scalar quaternions are always exact.</param>
+    /// <returns>Normalized quaternion</returns>
+    template<RealType T, bool S>
+    TQuaternion<T, S> Normalize(const TQuaternion<T, S>& q1, EPrecision p = EPrecision::Exact);
+
+    /// <summary>
+    /// Normalizes a quaternion. Quaternions shorter than P_FLT_INAC are left unchanged.
+    /// </summary>
+    /// <param name="q1">Quaternion</param>
+    /// <param name="p">Precision of the reciprocal square root. Scalar quaternions are always exact.</param>
+    /// <returns>Copy of q1.</returns>
+    template<RealType T, bool S>
+    TQuaternion<T, S> NormalizeV(TQuaternion<T, S>& q1, EPrecision p = EPrecision::Exact);
+
+    /// <summary>
+    /// Tests whether a quaternion has unit length.
+    /// </summary>
+    /// <param name="q1">Quaternion</param>
+    /// <param name="threshold">Allowed difference of the squared magnitude to 1</param>
+    /// <returns>True, if normalized.</returns>
+    template<RealType T, bool S>
+    FORCEINLINE bool IsNormalized(const TQuaternion<T, S>& q1, T threshold = P_FLT_INAC)
+    {
+        return Abs(SqrMagnitude(q1) - (T)1.0) < threshold;
+    }
+
+    /// <summary>
+    /// Gets the conjugate (-x, -y, -z, w). Inverse of unit quaternions.
+    /// </summary>
+    /// <param name="q1">Quaternion</param>
+    /// <returns>Conjugate</returns>
+    template<RealType T, bool S>
+    TQuaternion<T, S> Conjugate(const TQuaternion<T, S>& q1);
+
+    /// <summary>
+    /// Conjugates a quaternion.
+    /// </summary>
+    /// <param name="q1">Quaternion</param>
+    /// <returns>Copy of q1.</returns>
+    template<RealType T, bool S>
+    TQuaternion<T, S> ConjugateV(TQuaternion<T, S>& q1);
+
+    /// <summary>
+    /// Gets the inverse of a quaternion. Use Conjugate for unit quaternions.
+    /// </summary>
+    /// <param name="q1">Quaternion (not zero)</param>
+    /// <returns>Inverse</returns>
+    template<RealType T, bool S>
+    FORCEINLINE TQuaternion<T, S> Inverse(const TQuaternion<T, S>& q1)
+    {
+        return Conjugate(q1) / SqrMagnitude(q1);
+    }
+
+    /// <summary>
+    /// Inverts a quaternion. Use ConjugateV for unit quaternions.
+    /// </summary>
+    /// <param name="q1">Quaternion (not zero)</param>
+    /// <returns>Copy of q1.</returns>
+    template<RealType T, bool S>
+    FORCEINLINE TQuaternion<T, S> InverseV(TQuaternion<T, S>& q1)
+    {
+        const T s = SqrMagnitude(q1);
+        ConjugateV(q1);
+        return q1 /= s;
+    }
+
+    /// <summary>
+    /// Rotates a vector by a unit quaternion.
+    /// </summary>
+    /// <param name="q1">Rotation</param>
+    /// <param name="v1">Vector</param>
+    /// <returns>Rotated vector</returns>
+    template<RealType T, bool S>
+    TVector3<T, S> Rotate(const TQuaternion<T, S>& q1, const TVector3<T, S>& v1);
+
+    /// <summary>
+    /// Gets the rotation around an axis.
+    /// </summary>
+    /// <param name="axisNormal">Normalized axis</param>
+    /// <param name="angle">Angle in radians (counter clockwise, when looking against the axis)</param>
+    /// <returns>Unit quaternion</returns>
+    template<RealType T, bool S>
+    TQuaternion<T, S> QuaternionFromAxisAngle(const TVector3<T, S>& axisNormal, T angle)
+    {
+        const T s = sin(angle * (T)0.5);
+
+        return TQuaternion<T, S>(axisNormal.x * s, axisNormal.y * s, axisNormal.z * s, cos(angle * (T)0.5));
+    }
+
+    /// <summary>
+    /// Interpolates between two rotations linearly and normalizes the result. Takes the shortest path.
+    /// </summary>
+    /// <param name="q1">Start rotation</param>
+    /// <param name="q2">Destination rotation</param>
+    /// <param name="t">Interpolation value (not clamped)</param>
+    /// <returns>Interpolated unit quaternion</returns>
+    /// <remarks>Angular velocity is not constant, but it is cheaper than Slerp and commutative for blending.</remarks>
+    template<RealType T, bool S>
+    TQuaternion<T, S> Nlerp(const TQuaternion<T, S>& q1, const TQuaternion<T, S>& q2, T t)
+    {
+        const T s = (DotP(q1, q2) < (T)0.0) ? -t : t;
+
+        return Normalize(q1 * ((T)1.0 - t) + q2 * s);
+    }
+
+    /// <summary>
+    /// Interpolates between two rotations with constant angular velocity. Takes the shortest path.
+    /// </summary>
+    /// <param name="q1">Start rotation (unit quaternion)</param>
+    /// <param name="q2">Destination rotation (unit quaternion)</param>
+    /// <param name="t">Interpolation value</param>
+    /// <returns>Interpolated unit quaternion</returns>
+    /// <note>Does not clamp t between 0.0 and 1.0.</note>
+    template<RealType T, bool S>
+    TQuaternion<T, S> SlerpUnclamped(const TQuaternion<T, S>& q1, const TQuaternion<T, S>& q2, T t)
+    {
+        T cosAngle = DotP(q1, q2);
+        T s = (T)1.0;
+
+        if (cosAngle < (T)0.0)
+        {
+            cosAngle = -cosAngle;
+            s = (T)-1.0;
+        }
+
+        // sin(angle) runs towards 0. Both rotations are nearly the same, so Nlerp is exact enough.
+        if (cosAngle > (T)1.0 - (T)P_FLT_INAC)
+        {
+            return Normalize(q1 * ((T)1.0 - t) + q2 * (s * t));
+        }
+
+        const T angle = (T)acos(cosAngle);
+        const T invSin = (T)1.0 / (T)sin(angle);
+
+        return q1 * ((T)sin(((T)1.0 - t) * angle) * invSin) + q2 * (s * (T)sin(t * angle) * invSin);
+    }
+
+    /// <summary>
+    /// Interpolates between two rotations with constant angular velocity. Takes the shortest path.
+    /// </summary>
+    /// <param name="q1">Start rotation (unit quaternion)</param>
+    /// <param name="q2">Destination rotation (unit quaternion)</param>
+    /// <param name="t">Interpolation value (clamped between 0.0 and 1.0)</param>
+    /// <returns>Interpolated unit quaternion</returns>
+    template<RealType T, bool S>
+    FORCEINLINE TQuaternion<T, S> Slerp(const TQuaternion<T, S>& q1, const TQuaternion<T, S>& q2, T t)
+    {
+        return SlerpUnclamped(q1, q2, Clamp(t, (T)0.0, (T)1.0));
+    }
+
+    /// <summary>
+    /// Gets the rotation matrix of a unit quaternion.
+    /// </summary>
+    /// <param name="q1">Rotation</param>
+    /// <returns>Rotation matrix</returns>
+    template<RealType T, bool S>
+    TMatrix3<T, S> ToMatrix3(const TQuaternion<T, S>& q1)
+    {
+        const T xx = q1.x * q1.x, yy = q1.y * q1.y, zz = q1.z * q1.z;
+        const T xy = q1.x * q1.y, xz = q1.x * q1.z, yz = q1.y * q1.z;
+        const T wx = q1.w * q1.x, wy = q1.w * q1.y, wz = q1.w * q1.z;
+
+        return TMatrix3<T, S>((T)1.0 - (T)2.0 * (yy + zz), (T)2.0 * (xy - wz), (T)2.0 * (xz + wy),
+                              (T)2.0 * (xy + wz), (T)1.0 - (T)2.0 * (xx + zz), (T)2.0 * (yz - wx),
+                              (T)2.0 * (xz - wy), (T)2.0 * (yz + wx), (T)1.0 - (T)2.0 * (xx + yy));
+    }
+
+    /// <summary>
+    /// Gets the homogeneous rotation matrix of a unit quaternion.
+    /// </summary>
+    /// <param name="q1">Rotation</param>
+    /// <returns>Rotation matrix without translation</returns>
+    template<RealType T, bool S>
+    TMatrix4<T, S> ToMatrix4(const TQuaternion<T, S>& q1)
+    {
+        const T xx = q1.x * q1.x, yy = q1.y * q1.y, zz = q1.z * q1.z;
+        const T xy = q1.x * q1.y, xz = q1.x * q1.z, yz = q1.y * q1.z;
+        const T wx = q1.w * q1.x, wy = q1.w * q1.y, wz = q1.w * q1.z;
+
+        return TMatrix4<T, S>((T)1.0 - (T)2.0 * (yy + zz), (T)2.0 * (xy - wz), (T)2.0 * (xz + wy), (T)0.0,
+                              (T)2.0 * (xy + wz), (T)1.0 - (T)2.0 * (xx + zz), (T)2.0 * (yz - wx), (T)0.0,
+                              (T)2.0 * (xz - wy), (T)2.0 * (yz + wx), (T)1.0 - (T)2.0 * (xx + yy), (T)0.0,
+                              (T)0.0, (T)0.0, (T)0.0, (T)1.0);
+    }
+
+    namespace Detail
+    {
+        // Shepperd's method: Takes the square root of the largest of w, x, y, z, so the divisor never gets small.
+        template<RealType T, bool S, typename M>
+        TQuaternion<T, S> quat_from_matrix(const M& m)
+        {
+            const T trace = m(0, 0) + m(1, 1) + m(2, 2);
+
+            if (trace > (T)0.0)
+            {
+                const T s = sqrt(trace + (T)1.0) * (T)2.0;
+                return TQuaternion<T, S>((m(2, 1) - m(1, 2)) / s, (m(0, 2) - m(2, 0)) / s, (m(1, 0) - m(0, 1)) / s, (T)0.25 * s);
+            }
+            if (m(0, 0) > m(1, 1) && m(0, 0) > m(2, 2))
+            {
+                const T s = sqrt((T)1.0 + m(0, 0) - m(1, 1) - m(2, 2)) * (T)2.0;
+                return TQuaternion<T, S>((T)0.25 * s, (m(0, 1) + m(1, 0)) / s, (m(0, 2) + m(2, 0)) / s, (m(2, 1) - m(1, 2)) / s);
+            }
+            if (m(1, 1) > m(2, 2))
+            {
+                const T s = sqrt((T)1.0 + m(1, 1) - m(0, 0) - m(2, 2)) * (T)2.0;
+                return TQuaternion<T, S>((m(0, 1) + m(1, 0)) / s, (T)0.25 * s, (m(1, 2) + m(2, 1)) / s, (m(0, 2) - m(2, 0)) / s);
+            }
+
+            const T s = sqrt((T)1.0 + m(2, 2) - m(0, 0) - m(1, 1)) * (T)2.0;
+            return TQuaternion<T, S>((m(0, 2) + m(2, 0)) / s, (m(1, 2) + m(2, 1)) / s, (T)0.25 * s, (m(1, 0) - m(0, 1)) / s);
+        }
+    }
+
+    /// <summary>
+    /// Gets the unit quaternion of a rotation matrix.
+    /// </summary>
+    /// <param name="m1">Orthonormal matrix with determinant 1</param>
+    /// <returns>Rotation</returns>
+    template<RealType T, bool S>
+    FORCEINLINE TQuaternion<T, S> QuaternionFromMatrix(const TMatrix3<T, S>& m1)
+    {
+        return Detail::quat_from_matrix<T, S>(m1);
+    }
+
+    /// <summary>
+    /// Gets the unit quaternion of the upper 3x3 rotation of a matrix. Translation is ignored.
+    /// </summary>
+    /// <param name="m1">Matrix with an orthonormal upper 3x3 part with determinant 1</param>
+    /// <returns>Rotation</returns>
+    template<RealType T, bool S>
+    FORCEINLINE TQuaternion<T, S> QuaternionFromMatrix(const TMatrix4<T, S>& m1)
+    {
+        return Detail::quat_from_matrix<T, S>(m1);
+    }
+
+} // Phanes::Core::Math
+
+#endif // !QUATERNION_H
+
+#include "Core/public/Math/Quaternion.inl"
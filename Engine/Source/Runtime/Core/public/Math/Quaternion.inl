@@ -0,0 +1,203 @@
+#pragma once
+
+#include "Core/public/Math/Boilerplate.h"
+
+#include "Core/public/Math/Detail/QuaternionDecl.inl"
+#include "Core/public/Math/SIMD/SIMDIntrinsics.h"
+
+
+#include "Core/public/Math/SIMD/PhanesSIMDTypes.h"
+
+namespace Phanes::Core::Math
+{
+    template<RealType T, bool S>
+    TQuaternion<T, S>::TQuaternion(const TQuaternion<Real, S>& q)
+    {
+        Detail::construct_quat<T, S>::map(*this, q);
+    }
+
+    template<RealType T, bool S>
+    TQuaternion<T, S>::TQuaternion(Real _x, Real _y, Real _z, Real _w)
+    {
+        Detail::construct_quat<T, S>::map(*this, _x, _y, _z, _w);
+    }
+
+    template<RealType T, bool S>
+    TQuaternion<T, S>::TQuaternion(const TVector3<Real, S>& v, Real _w)
+    {
+        Detail::construct_quat<T, S>::map(*this, v, _w);
+    }
+
+    template<RealType T, bool S>
+    TQuaternion<T, S>::TQuaternion(const Real* comp)
+    {
+        Detail::construct_quat<T, S>::map(*this, comp);
+    }
+
+
+    template<RealType T, bool S>
+    TQuaternion<T, S> operator+=(TQuaternion<T, S>& q1, const TQuaternion<T, S>& q2)
+    {
+        Detail::compute_quat_add<T, S>::map(q1, q1, q2);
+        return q1;
+    }
+
+    template<RealType T, bool S>
+    TQuaternion<T, S> operator-=(TQuaternion<T, S>& q1, const TQuaternion<T, S>& q2)
+    {
+        Detail::compute_quat_sub<T, S>::map(q1, q1, q2);
+        return q1;
+    }
+
+    template<RealType T, bool S>
+    TQuaternion<T, S> operator*=(TQuaternion<T, S>& q1, const TQuaternion<T, S>& q2)
+    {
+        Detail::compute_quat_mul<T, S>::map(q1, q1, q2);
+        return q1;
+    }
+
+    template<RealType T, bool S>
+    TQuaternion<T, S> operator*=(TQuaternion<T, S>& q1, T s)
+    {
+        Detail::compute_quat_scale<T, S>::map(q1, q1, s);
+        return q1;
+    }
+
+    template<RealType T, bool S>
+    TQuaternion<T, S> operator/=(TQuaternion<T, S>& q1, T s)
+    {
+        Detail::compute_quat_scale<T, S>::map(q1, q1, (T)1.0 / s);
+        return q1;
+    }
+
+    template<RealType T, bool S>
+    TQuaternion<T, S> operator+(const TQuaternion<T, S>& q1, const TQuaternion<T, S>& q2)
+    {
+        TQuaternion<T, S> r;
+        Detail::compute_quat_add<T, S>::map(r, q1, q2);
+        return r;
+    }
+
+    template<RealType T, bool S>
+    TQuaternion<T, S> operator-(const TQuaternion<T, S>& q1, const TQuaternion<T, S>& q2)
+    {
+        TQuaternion<T, S> r;
+        Detail::compute_quat_sub<T, S>::map(r, q1, q2);
+        return r;
+    }
+
+    template<RealType T, bool S>
+    TQuaternion<T, S> operator-(const TQuaternion<T, S>& q1)
+    {
+        TQuaternion<T, S> r;
+        Detail::compute_quat_scale<T, S>::map(r, q1, (T)-1.0);
+        return r;
+    }
+
+    template<RealType T, bool S>
+    TQuaternion<T, S> operator*(const TQuaternion<T, S>& q1, const TQuaternion<T, S>& q2)
+    {
+        TQuaternion<T, S> r;
+        Detail::compute_quat_mul<T, S>::map(r, q1, q2);
+        return r;
+    }
+
+    template<RealType T, bool S>
+    TQuaternion<T, S> operator*(const TQuaternion<T, S>& q1, T s)
+    {
+        TQuaternion<T, S> r;
+        Detail::compute_quat_scale<T, S>::map(r, q1, s);
+        return r;
+    }
+
+    template<RealType T, bool S>
+    TQuaternion<T, S> operator*(T s, const TQuaternion<T, S>& q1)
+    {
+        return q1 * s;
+    }
+
+    template<RealType T, bool S>
+    TQuaternion<T, S> operator/(const TQuaternion<T, S>& q1, T s)
+    {
+        TQuaternion<T, S> r;
+        Detail::compute_quat_scale<T, S>::map(r, q1, (T)1.0 / s);
+        return r;
+    }
+
+    template<RealType T, bool S>
+    TVector3<T, S> operator*(const TQuaternion<T, S>& q1, const TVector3<T, S>& v1)
+    {
+        TVector3<T, S> r;
+        Detail::compute_quat_rotate<T, S>::map(r, q1, v1);
+        return r;
+    }
+
+    template<RealType T, bool S>
+    bool operator==(const TQuaternion<T, S>& q1, const TQuaternion<T, S>& q2)
+    {
+        return Detail::compute_quat_eq<T, S>::map(q1, q2, (T)P_FLT_INAC);
+    }
+
+    template<RealType T, bool S>
+    bool operator!=(const TQuaternion<T, S>& q1, const TQuaternion<T, S>& q2)
+    {
+        return !Detail::compute_quat_eq<T, S>::map(q1, q2, (T)P_FLT_INAC);
+    }
+
+
+    template<RealType T, bool S>
+    T DotP(const TQuaternion<T, S>& q1, const TQuaternion<T, S>& q2)
+    {
+        return Detail::compute_quat_dot<T, S>::map(q1, q2);
+    }
+
+    template<RealType T, bool S>
+    T Magnitude(const TQuaternion<T, S>& q1)
+    {
+        return sqrt(DotP(q1, q1));
+    }
+
+    template<RealType T, bool S>
+    T SqrMagnitude(const TQuaternion<T, S>& q1)
+    {
+        return DotP(q1, q1);
+    }
+
+    template<RealType T, bool S>
+    TQuaternion<T, S> Normalize(const TQuaternion<T, S>& q1, EPrecision p)
+    {
+        TQuaternion<T, S> r;
+        Detail::compute_quat_normalize<T, S>::map(r, q1, p);
+        return r;
+    }
+
+    template<RealType T, bool S>
+    TQuaternion<T, S> NormalizeV(TQuaternion<T, S>& q1, EPrecision p)
+    {
+        Detail::compute_quat_normalize<T, S>::map(q1, q1, p);
+        return q1;
+    }
+
+    template<RealType T, bool S>
+    TQuaternion<T, S> Conjugate(const TQuaternion<T, S>& q1)
+    {
+        TQuaternion<T, S> r;
+        Detail::compute_quat_conjugate<T, S>::map(r, q1);
+        return r;
+    }
+
+    template<RealType T, bool S>
+    TQuaternion<T, S> ConjugateV(TQuaternion<T, S>& q1)
+    {
+        Detail::compute_quat_conjugate<T, S>::map(q1, q1);
+        return q1;
+    }
+
+    template<RealType T, bool S>
+    TVector3<T, S> Rotate(const TQuaternion<T, S>& q1, const TVector3<T, S>& v1)
+    {
+        TVector3<T, S> r;
+        Detail::compute_quat_rotate<T, S>::map(r, q1, v1);
+        return r;
+    }
+}
@@ -0,0 +1,88 @@
+#pragma once
+
+// Operations on arrays of TQuaternion<float>, e.g. for blending animation poses. Kernels are selected through SIMD/Dispatch.h.
+//
+// r may alias q1 or q2. The spans passed to one function must have the same size.
+
+#include <cassert>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+
+#include "Core/public/Math/Boilerplate.h"
+#include "Core/public/Math/SIMD/Dispatch.h"
+
+#include "Core/public/Math/Quaternion.hpp"
+
+
+namespace Phanes::Core::Math
+{
+    static_assert(sizeof(TQuaternion<float, false>) == 4 * sizeof(float), "TQuaternion<float> must be tightly packed.");
+
+    /// <summary>
+    /// Interpolates each pair of unit quaternions spherically. Takes the shortest path.
+    /// </summary>
+    /// <param name="r">Interpolated rotations</param>
+    /// <param name="q1">Start rotations</param>
+    /// <param name="q2">Destination rotations</param>
+    /// <param name="n">Number of quaternions</param>
+    /// <param name="t">Interpolation value (clamped between 0.0 and 1.0)</param>
+    /// <remarks>The weights are approximated by a polynomial, instead of acos and sin. The error is in the order of float precision.</remarks>
+    template<bool S>
+    void BatchSlerp(TQuaternion<float, S>* r, const TQuaternion<float, S>* q1, const TQuaternion<float, S>* q2, size_t n, float t)
+    {
+        SIMD::GetDispatchTable().quat_slerp_array(&r->x, &q1->x, &q2->x, n, Clamp(t, 0.0f, 1.0f));
+    }
+
+    /// <summary>
+    /// Normalizes quaternions. Quaternions with a length smaller than P_FLT_INAC are set to zero.
+    /// </summary>
+    /// <param name="r">Normalized quaternions</param>
+    /// <param name="q">Quaternions</param>
+    /// <param name="n">Number of quaternions</param>
+    /// <param name="p">Precision of the reciprocal square root</param>
+    template<bool S>
+    void BatchNormalize(TQuaternion<float, S>* r, const TQuaternion<float, S>* q, size_t n, EPrecision p = EPrecision::Exact)
+    {
+        if (p == EPrecision::Exact)
+        {
+            SIMD::GetDispatchTable().vec4_normalize_array(&r->x, &q->x, n, P_FLT_INAC);
+        }
+        else
+        {
+            SIMD::GetDispatchTable().vec4_normalize_est_array(&r->x, &q->x, n, P_FLT_INAC, p == EPrecision::Refined);
+        }
+    }
+
+    // ========= //
+    //   Spans   //
+    // ========= //
+
+    /// <summary>
+    /// Interpolates each pair of unit quaternions spherically. Takes the shortest path.
+    /// </summary>
+    /// <param name="r">Interpolated rotations</param>
+    /// <param name="q1">Start rotations</param>
+    /// <param name="q2">Destination rotations</param>
+    /// <param name="t">Interpolation value (clamped between 0.0 and 1.0)</param>
+    /// <remarks>The weights are approximated by a polynomial, instead of acos and sin. The error is in the order of float precision.</remarks>
+    template<bool S = false>
+    void BatchSlerp(std::span<std::type_identity_t<TQuaternion<float, S>>> r, std::span<const std::type_identity_t<TQuaternion<float, S>>> q1, std::span<const std::type_identity_t<TQuaternion<float, S>>> q2, float t)
+    {
+        assert(r.size() == q1.size() && r.size() == q2.size());
+        BatchSlerp(r.data(), q1.data(), q2.data(), r.size(), t);
+    }
+
+    /// <summary>
+    /// Normalizes quaternions. Quaternions with a length smaller than P_FLT_INAC are set to zero.
+    /// </summary>
+    /// <param name="r">Normalized quaternions</param>
+    /// <param name="q">Quaternions</param>
+    /// <param name="p">Precision of the reciprocal square root</param>
+    template<bool S = false>
+    void BatchNormalize(std::span<std::type_identity_t<TQuaternion<float, S>>> r, std::span<const std::type_identity_t<TQuaternion<float, S>>> q, EPrecision p = EPrecision::Exact)
+    {
+        assert(r.size() == q.size());
+        BatchNormalize(r.data(), q.data(), r.size(), p);
+    }
+}
@@ -0,0 +1,157 @@
+#pragma once
+
+// Structure of arrays packet of N coherent rays. Lane i of origin and direction forms ray i.
+//
+// Intersections write one ray parameter per lane and return a lane mask, so that no result is allocated.
+
+#include <cstddef>
+#include <limits>
+#include <span>
+#include <type_traits>
+
+#include "Core/public/Math/Boilerplate.h"
+
+#include "Core/public/Math/MathCommon.hpp"
+#include "Core/public/Math/MathFwd.h"
+
+#include "Core/public/Math/Packet.hpp"
+#include "Core/public/Math/Vector3Packet.hpp"
+#include "Core/public/Math/Ray.hpp"
+#include "Core/public/Math/Plane.hpp"
+
+
+#ifndef RAYPACKET_H
+#define RAYPACKET_H
+
+namespace Phanes::Core::Math {
+
+    /// <summary>
+    /// N rays in structure of arrays layout.
+    /// </summary>
+    /// <typeparam name="T">Type of ray</typeparam>
+    /// <typeparam name="N">Number of rays (power of two)</typeparam>
+    template<RealType T, size_t N>
+    struct TRayPacket
+    {
+    public:
+
+        using Real = T;
+
+        static constexpr size_t Width = N;
+
+        /// <summary>
+        /// Origins
+        /// </summary>
+        TVector3Packet<Real, N> origin;
+
+
+        /// <summary>
+        /// Directions
+        /// </summary>
+        TVector3Packet<Real, N> direction;
+
+
+    public:
+
+        /// Default constructor
+        TRayPacket() = default;
+
+        /// <summary>
+        /// Construct from origin and direction packets.
+        /// </summary>
+        TRayPacket(const TVector3Packet<Real, N>& _origin, const TVector3Packet<Real, N>& _direction)
+        {
+            this->origin = _origin;
+            this->direction = _direction;
+        }
+    };
+
+
+    // ========================= //
+    //   TRayPacket functions    //
+    // ========================= //
+
+
+    /// <summary>
+    /// Loads N rays into a packet.
+    /// </summary>
+    /// <param name="r">Packet</param>
+    /// <param name="rays">Array of at least N rays</param>
+    template<RealType T, size_t N, bool S>
+    FORCEINLINE void LoadPacket(TRayPacket<T, N>& r, const TRay<T, S>* rays)
+    {
+        for (size_t i = 0; i < N; ++i)
+        {
+            r.origin.x.data[i] = rays[i].origin.x;
+            r.origin.y.data[i] = rays[i].origin.y;
+            r.origin.z.data[i] = rays[i].origin.z;
+
+            r.direction.x.data[i] = rays[i].direction.x;
+            r.direction.y.data[i] = rays[i].direction.y;
+            r.direction.z.data[i] = rays[i].direction.z;
+        }
+    }
+
+    /// <summary>
+    /// Gets the point of each ray at its parameter.
+    /// </summary>
+    /// <param name="r1">Rays</param>
+    /// <param name="t">Parameters</param>
+    /// <returns>Points at t</returns>
+    template<RealType T, size_t N>
+    FORCEINLINE TVector3Packet<T, N> PointAt(const TRayPacket<T, N>& r1, const TPacket<T, N>& t)
+    {
+        return r1.origin + r1.direction * t;
+    }
+
+    /// <summary>
+    /// Intersects N rays with a plane.
+    /// </summary>
+    /// <param name="pl1">Plane</param>
+    /// <param name="rays">Rays</param>
+    /// <param name="distances">N ray parameters of the intersections. Lanes, that miss the plane, are set to infinity.</param>
+    /// <returns>Bitmask with bit i set, if ray i hits the plane.</returns>
+    /// <remarks>The parameters equal the distances, if the directions are normalized. Like the scalar RayIntersect, rays parallel to the plane miss it.</remarks>
+    template<RealType T, size_t N, bool S>
+    unsigned int RayIntersect(const TPlane<T, S>& pl1, const TRayPacket<T, N>& rays, T* distances)
+    {
+        static_assert(N <= 32, "TRayPacket: Lane mask is limited to 32 lanes.");
+
+        const TVector3Packet<T, N> normal(pl1.normal);
+
+        const TPacket<T, N> pr = DotP(rays.direction, normal);
+        const TPacket<T, N> t = (TPacket<T, N>(pl1.d) - DotP(rays.origin, normal)) / pr;
+
+        constexpr T inf = std::numeric_limits<T>::infinity();
+
+        unsigned int mask = 0;
+        for (size_t i = 0; i < N; ++i)
+        {
+            const bool hit = (Abs(pr.data[i]) > (T)P_FLT_INAC) & (t.data[i] >= (T)0.0);
+
+            distances[i] = hit ? t.data[i] : inf;
+            mask |= (unsigned int)hit << i;
+        }
+
+        return mask;
+    }
+
+    /// <summary>
+    /// Intersects N rays with each plane of a set. The ray packet is reused for all planes.
+    /// </summary>
+    /// <param name="planes">Planes</param>
+    /// <param name="rays">Rays</param>
+    /// <param name="distances">planes.size() * N ray parameters, N per plane in the order of planes. Lanes, that miss a plane, are set to infinity.</param>
+    /// <param name="masks">planes.size() hit masks, one per plane.</param>
+    template<RealType T, size_t N, bool S = false>
+    void RayIntersect(std::span<const std::type_identity_t<TPlane<T, S>>> planes, const TRayPacket<T, N>& rays, T* distances, unsigned int* masks)
+    {
+        for (size_t i = 0; i < planes.size(); ++i)
+        {
+            masks[i] = RayIntersect(planes[i], rays, distances + i * N);
+        }
+    }
+
+} // Phanes::Core::Math
+
+#endif // !RAYPACKET_H
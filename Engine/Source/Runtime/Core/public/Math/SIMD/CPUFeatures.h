@@ -0,0 +1,181 @@
+#pragma once
+
+// Probes the instruction sets of the executing CPU. Used by Dispatch.h to select kernels at runtime.
+
+#include "Core/public/Math/SIMD/Platform.h"
+
+#if defined(_MSC_VER)
+#   include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#   include <cpuid.h>
+#endif
+
+
+namespace Phanes::Core::Math::SIMD
+{
+    /// <summary>
+    /// Instruction sets a kernel can be compiled for. Values match P_INTRINSICS_*.
+    /// </summary>
+    enum class EInstructionSet : int
+    {
+        FPU     = P_INTRINSICS_FPU,
+        SSE     = P_INTRINSICS_SSE,
+        AVX     = P_INTRINSICS_AVX,
+        AVX2    = P_INTRINSICS_AVX2,
+        NEON    = P_INTRINSICS_NEON,
+        AVX512  = P_INTRINSICS_AVX512
+    };
+
+    /// <summary>
+    /// Instruction set extensions supported by the executing CPU and operating system.
+    /// </summary>
+    struct CPUFeatures
+    {
+        bool SSE42  = false;
+        bool AVX    = false;
+        bool AVX2   = false;
+        bool FMA    = false;
+        bool F16C   = false;
+
+        // AVX512F + AVX512VL + AVX512DQ
+        bool AVX512 = false;
+    };
+
+
+    namespace Internal
+    {
+        inline void CPUID(int leaf, int subleaf, unsigned int regs[4])
+        {
+#if defined(_MSC_VER)
+            int r[4];
+            __cpuidex(r, leaf, subleaf);
+
+            for (int i = 0; i < 4; ++i)
+            {
+                regs[i] = (unsigned int)r[i];
+            }
+#elif defined(__x86_64__) || defined(__i386__)
+            __cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#else
+            regs[0] = regs[1] = regs[2] = regs[3] = 0;
+#endif
+        }
+
+        // Reads XCR0, to check if the OS saves the extended registers on context switch.
+        inline unsigned long long XGetBV()
+        {
+#if defined(_MSC_VER)
+            return _xgetbv(0);
+#elif defined(__x86_64__) || defined(__i386__)
+            unsigned int eax, edx;
+            __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+            return ((unsigned long long)edx << 32) | eax;
+#else
+            return 0;
+#endif
+        }
+
+        inline CPUFeatures ProbeCPUFeatures()
+        {
+            CPUFeatures f;
+
+            unsigned int regs[4];
+            CPUID(0, 0, regs);
+            const unsigned int maxLeaf = regs[0];
+
+            if (maxLeaf < 1)
+            {
+                return f;
+            }
+
+            CPUID(1, 0, regs);
+            const unsigned int ecx1 = regs[2];
+
+            f.SSE42 = (ecx1 >> 20) & 1;
+
+            const bool osxsave = (ecx1 >> 27) & 1;
+            const bool osYmm = osxsave && ((XGetBV() & 0x6) == 0x6);
+
+            f.AVX = osYmm && ((ecx1 >> 28) & 1);
+            f.FMA = osYmm && ((ecx1 >> 12) & 1);
+            f.F16C = osYmm && ((ecx1 >> 29) & 1);
+
+            if (maxLeaf >= 7)
+            {
+                CPUID(7, 0, regs);
+                const unsigned int ebx7 = regs[1];
+
+                f.AVX2 = f.AVX && ((ebx7 >> 5) & 1);
+
+                // XCR0 bits 5 - 7: opmask and upper zmm state.
+                const bool osZmm = osYmm && ((XGetBV() & 0xE0) == 0xE0);
+
+                f.AVX512 = f.AVX2 && osZmm && ((ebx7 >> 16) & 1) && ((ebx7 >> 17) & 1) && ((ebx7 >> 31) & 1);
+            }
+
+            return f;
+        }
+    }
+
+
+    /// <summary>
+    /// Gets the features of the executing CPU. The CPU is only probed on the first call.
+    /// </summary>
+    /// <returns>Supported features</returns>
+    inline const CPUFeatures& GetCPUFeatures()
+    {
+        static const CPUFeatures features = Internal::ProbeCPUFeatures();
+        return features;
+    }
+
+    /// <summary>
+    /// Gets the highest instruction set, which is supported by the executing CPU and has kernels in the engine.
+    /// </summary>
+    /// <returns>Highest usable instruction set</returns>
+    inline EInstructionSet GetSupportedInstructionSet()
+    {
+#if P_INTRINSICS == P_INTRINSICS_NEON
+        return EInstructionSet::NEON;
+#else
+        const CPUFeatures& f = GetCPUFeatures();
+
+        // The AVX2 and AVX-512 kernels use FMA3.
+        if (f.AVX512 && f.FMA)
+        {
+            return EInstructionSet::AVX512;
+        }
+        if (f.AVX2 && f.FMA)
+        {
+            return EInstructionSet::AVX2;
+        }
+        if (f.AVX)
+        {
+            return EInstructionSet::AVX;
+        }
+        if (f.SSE42)
+        {
+            return EInstructionSet::SSE;
+        }
+        return EInstructionSet::FPU;
+#endif
+    }
+
+    /// <summary>
+    /// Gets the name of an instruction set.
+    /// </summary>
+    /// <param name="set">Instruction set</param>
+    /// <returns>Name of instruction set</returns>
+    inline const char* ToString(EInstructionSet set)
+    {
+        switch (set)
+        {
+        case EInstructionSet::FPU:  return "FPU";
+        case EInstructionSet::SSE:  return "SSE4.2";
+        case EInstructionSet::AVX:  return "AVX";
+        case EInstructionSet::AVX2: return "AVX2";
+        case EInstructionSet::NEON: return "NEON";
+        case EInstructionSet::AVX512: return "AVX-512";
+        }
+        return "Unknown";
+    }
+}
@@ -0,0 +1,367 @@
+#pragma once
+
+// Selects the math kernels used by batch functions and, with P_RUNTIME_DISPATCH, by the TMatrix4 specializations.
+//
+// Without P_RUNTIME_DISPATCH the table is fixed to the instruction set selected through P_INTRINSICS.
+// With P_RUNTIME_DISPATCH the CPU is probed once and the best supported kernels are selected.
+
+#include <cstddef>
+#include <cstdint>
+
+#include "Core/public/Math/SIMD/Platform.h"
+#include "Core/public/Math/SIMD/CPUFeatures.h"
+
+#include "Core/public/Math/SIMD/PhanesKernelsFPU.hpp"
+
+#if P_INTRINSICS != P_INTRINSICS_NEON
+#   include "Core/public/Math/SIMD/PhanesKernelsSSE.hpp"
+#   include "Core/public/Math/SIMD/PhanesKernelsAVX.hpp"
+#   include "Core/public/Math/SIMD/PhanesKernelsFMA.hpp"
+#   include "Core/public/Math/SIMD/PhanesKernelsAVX512.hpp"
+#endif
+
+
+namespace Phanes::Core::Math::SIMD
+{
+    /// <summary>
+    /// Kernels for one instruction set.
+    /// </summary>
+    struct DispatchTable
+    {
+        /// <summary>
+        /// Instruction set the kernels are compiled for.
+        /// </summary>
+        EInstructionSet instructionSet;
+
+        // Matrix4
+
+        float (*mat4_det)(const float* m);
+        bool  (*mat4_inv)(float* r, const float* m);
+        void  (*mat4_transpose)(float* r, const float* m);
+        void  (*mat4_mul)(float* r, const float* a, const float* b);
+        void  (*mat4_mul_vec)(float* r, const float* m, const float* v);
+        void  (*mat4_mul_array)(float* r, const float* a, const float* b, size_t n);
+        void  (*mat4_transform_array)(float* r, const float* m, const float* v, size_t n, bool stream);
+        void  (*mat4_transform_point_array)(float* r, const float* m, const float* v, size_t n, bool stream);
+        void  (*mat4_transform_dir_array)(float* r, const float* m, const float* v, size_t n, bool stream);
+
+        // Vector4 array
+
+        void  (*vec4_add_array)(float* r, const float* a, const float* b, size_t n);
+        void  (*vec4_sub_array)(float* r, const float* a, const float* b, size_t n);
+        void  (*vec4_mul_array)(float* r, const float* a, const float* b, size_t n);
+        void  (*vec4_div_array)(float* r, const float* a, const float* b, size_t n);
+        void  (*vec4_dot_array)(float* r, const float* a, const float* b, size_t n);
+        void  (*vec4_eq_array)(bool* r, const float* a, const float* b, size_t n, float threshold);
+        void  (*vec4_normalize_array)(float* r, const float* v, size_t n, float minLength);
+        void  (*vec4_normalize_est_array)(float* r, const float* v, size_t n, float minLength, bool refine);
+        void  (*vec4_magnitude_array)(float* r, const float* v, size_t n);
+        void  (*vec4_lerp_array)(float* r, const float* a, const float* b, size_t n, float t);
+        void  (*vec4_min_reduce)(float* r, const float* v, size_t n);
+        void  (*vec4_max_reduce)(float* r, const float* v, size_t n);
+
+        // Vector3 array
+
+        void  (*vec3_dot_array)(float* r, const float* a, const float* b, size_t n);
+        void  (*vec3_cross_array)(float* r, const float* a, const float* b, size_t n);
+        void  (*vec3_magnitude_array)(float* r, const float* v, size_t n);
+        void  (*vec3_normalize_array)(float* r, const float* v, size_t n, float minLength);
+        void  (*vec3_normalize_est_array)(float* r, const float* v, size_t n, float minLength, bool refine);
+
+        // Vector2 array
+
+        void  (*vec2_add_array)(float* r, const float* a, const float* b, size_t n);
+        void  (*vec2_mul_array)(float* r, const float* a, const float* b, size_t n);
+        void  (*vec2_lerp_array)(float* r, const float* a, const float* b, size_t n, float t);
+        void  (*vec2_normalize_array)(float* r, const float* v, size_t n, float minLength);
+
+        // Culling
+
+        void  (*cull_sphere_array)(uint32_t* r, const float* p, size_t planeCount, const float* c, const float* radius, size_t stride, size_t n);
+        void  (*cull_aabb_array)(uint32_t* r, const float* p, size_t planeCount, const float* mn, const float* mx, size_t stride, size_t n);
+
+        // Quaternion array
+
+        void  (*quat_slerp_array)(float* r, const float* a, const float* b, size_t n, float t);
+
+        // Skinning
+
+        void  (*dq_skin_array)(float* rp, float* rn, const float* p, const float* nrm, const uint32_t* bones, const float* weights, const float* dq, size_t n, size_t pitch);
+        void  (*lbs_skin_array)(float* rp, float* rn, const float* p, const float* nrm, const uint32_t* bones, const float* weights, const float* m, size_t columnStride, size_t n, size_t pitch);
+
+        // Half precision
+
+        void  (*float_to_half_array)(uint16_t* r, const float* v, size_t n);
+        void  (*half_to_float_array)(float* r, const uint16_t* v, size_t n);
+        void  (*vec3_float_to_half_array)(uint16_t* r, const float* v, size_t n);
+        void  (*vec3_half_to_float_array)(float* r, const uint16_t* v, size_t n);
+
+        // Vector3 packing
+
+        void  (*vec3_encode_oct_array)(uint32_t* r, const float* v, size_t n);
+        void  (*vec3_decode_oct_array)(float* r, const uint32_t* v, size_t n);
+        void  (*vec3_encode_1010102_array)(uint32_t* r, const float* v, size_t n);
+        void  (*vec3_decode_1010102_array)(float* r, const uint32_t* v, size_t n);
+        void  (*vec3_quantize_array)(uint16_t* r, const float* v, const float* offset, const float* scale, size_t n);
+        void  (*vec3_dequantize_array)(float* r, const uint16_t* v, const float* offset, const float* scale, size_t n);
+    };
+
+
+    /// <summary>
+    /// Builds the kernel table for an instruction set. Instruction sets without own kernels use the next lower ones.
+    /// </summary>
+    /// <param name="set">Instruction set</param>
+    /// <param name="f16c">Whether F16C is supported. It has its own CPUID flag and is selected independently of set.</param>
+    /// <returns>Kernel table</returns>
+    inline DispatchTable BuildDispatchTable(EInstructionSet set, bool f16c)
+    {
+        DispatchTable t;
+
+        t.instructionSet = EInstructionSet::FPU;
+
+        t.mat4_det          = &FPU::mat4_det<float>;
+        t.mat4_inv          = &FPU::mat4_inv<float>;
+        t.mat4_transpose    = &FPU::mat4_transpose<float>;
+        t.mat4_mul          = &FPU::mat4_mul<float>;
+        t.mat4_mul_vec      = &FPU::mat4_mul_vec<float>;
+        t.mat4_mul_array    = &FPU::mat4_mul_array;
+        t.mat4_transform_array          = &FPU::mat4_transform_array;
+        t.mat4_transform_point_array    = &FPU::mat4_transform_point_array;
+        t.mat4_transform_dir_array      = &FPU::mat4_transform_dir_array;
+
+        t.vec4_add_array    = &FPU::vec4_add_array;
+        t.vec4_sub_array    = &FPU::vec4_sub_array;
+        t.vec4_mul_array    = &FPU::vec4_mul_array;
+        t.vec4_div_array    = &FPU::vec4_div_array;
+        t.vec4_dot_array    = &FPU::vec4_dot_array;
+        t.vec4_eq_array     = &FPU::vec4_eq_array;
+        t.vec4_normalize_array      = &FPU::vec4_normalize_array;
+        t.vec4_normalize_est_array  = &FPU::vec4_normalize_est_array;
+        t.vec4_magnitude_array      = &FPU::vec4_magnitude_array;
+        t.vec4_lerp_array   = &FPU::vec4_lerp_array;
+        t.vec4_min_reduce   = &FPU::vec4_min_reduce;
+        t.vec4_max_reduce   = &FPU::vec4_max_reduce;
+
+        t.vec3_dot_array    = &FPU::vec3_dot_array;
+        t.vec3_cross_array  = &FPU::vec3_cross_array;
+        t.vec3_magnitude_array      = &FPU::vec3_magnitude_array;
+        t.vec3_normalize_array      = &FPU::vec3_normalize_array;
+        t.vec3_normalize_est_array  = &FPU::vec3_normalize_est_array;
+
+        t.vec2_add_array    = &FPU::vec2_add_array;
+        t.vec2_mul_array    = &FPU::vec2_mul_array;
+        t.vec2_lerp_array   = &FPU::vec2_lerp_array;
+        t.vec2_normalize_array  = &FPU::vec2_normalize_array;
+
+        t.cull_sphere_array = &FPU::cull_sphere_array;
+        t.cull_aabb_array   = &FPU::cull_aabb_array;
+
+        t.quat_slerp_array  = &FPU::quat_slerp_array;
+
+        t.dq_skin_array     = &FPU::dq_skin_array;
+        t.lbs_skin_array    = &FPU::lbs_skin_array;
+
+        t.float_to_half_array       = &FPU::float_to_half_array;
+        t.half_to_float_array       = &FPU::half_to_float_array;
+        t.vec3_float_to_half_array  = &FPU::vec3_float_to_half_array;
+        t.vec3_half_to_float_array  = &FPU::vec3_half_to_float_array;
+
+        t.vec3_encode_oct_array     = &FPU::vec3_encode_oct_array;
+        t.vec3_decode_oct_array     = &FPU::vec3_decode_oct_array;
+        t.vec3_encode_1010102_array = &FPU::vec3_encode_1010102_array;
+        t.vec3_decode_1010102_array = &FPU::vec3_decode_1010102_array;
+        t.vec3_quantize_array       = &FPU::vec3_quantize_array;
+        t.vec3_dequantize_array     = &FPU::vec3_dequantize_array;
+
+#if P_INTRINSICS != P_INTRINSICS_NEON
+        if (set == EInstructionSet::SSE || set == EInstructionSet::AVX || set == EInstructionSet::AVX2 || set == EInstructionSet::AVX512)
+        {
+            t.instructionSet = EInstructionSet::SSE;
+
+            t.mat4_det          = &SSE::mat4_det;
+            t.mat4_inv          = &SSE::mat4_inv;
+            t.mat4_transpose    = &SSE::mat4_transpose;
+            t.mat4_mul          = &SSE::mat4_mul;
+            t.mat4_mul_vec      = &SSE::mat4_mul_vec;
+            t.mat4_mul_array    = &SSE::mat4_mul_array;
+            t.mat4_transform_array          = &SSE::mat4_transform_array;
+            t.mat4_transform_point_array    = &SSE::mat4_transform_point_array;
+            t.mat4_transform_dir_array      = &SSE::mat4_transform_dir_array;
+
+            t.vec4_add_array    = &SSE::vec4_add_array;
+            t.vec4_sub_array    = &SSE::vec4_sub_array;
+            t.vec4_mul_array    = &SSE::vec4_mul_array;
+            t.vec4_div_array    = &SSE::vec4_div_array;
+            t.vec4_dot_array    = &SSE::vec4_dot_array;
+            t.vec4_eq_array     = &SSE::vec4_eq_array;
+            t.vec4_normalize_array      = &SSE::vec4_normalize_array;
+            t.vec4_normalize_est_array  = &SSE::vec4_normalize_est_array;
+            t.vec4_magnitude_array      = &SSE::vec4_magnitude_array;
+            t.vec4_lerp_array   = &SSE::vec4_lerp_array;
+            t.vec4_min_reduce   = &SSE::vec4_min_reduce;
+            t.vec4_max_reduce   = &SSE::vec4_max_reduce;
+
+            t.vec3_dot_array    = &SSE::vec3_dot_array;
+            t.vec3_cross_array  = &SSE::vec3_cross_array;
+            t.vec3_magnitude_array      = &SSE::vec3_magnitude_array;
+            t.vec3_normalize_array      = &SSE::vec3_normalize_array;
+            t.vec3_normalize_est_array  = &SSE::vec3_normalize_est_array;
+
+            t.vec2_add_array    = &SSE::vec2_add_array;
+            t.vec2_mul_array    = &SSE::vec2_mul_array;
+            t.vec2_lerp_array   = &SSE::vec2_lerp_array;
+            t.vec2_normalize_array  = &SSE::vec2_normalize_array;
+
+            t.cull_sphere_array = &SSE::cull_sphere_array;
+            t.cull_aabb_array   = &SSE::cull_aabb_array;
+
+            t.quat_slerp_array  = &SSE::quat_slerp_array;
+
+            t.dq_skin_array     = &SSE::dq_skin_array;
+            t.lbs_skin_array    = &SSE::lbs_skin_array;
+
+            t.vec3_encode_oct_array     = &SSE::vec3_encode_oct_array;
+            t.vec3_decode_oct_array     = &SSE::vec3_decode_oct_array;
+            t.vec3_encode_1010102_array = &SSE::vec3_encode_1010102_array;
+            t.vec3_decode_1010102_array = &SSE::vec3_decode_1010102_array;
+            t.vec3_quantize_array       = &SSE::vec3_quantize_array;
+            t.vec3_dequantize_array     = &SSE::vec3_dequantize_array;
+        }
+
+        if (set == EInstructionSet::AVX || set == EInstructionSet::AVX2 || set == EInstructionSet::AVX512)
+        {
+            t.instructionSet = set;
+
+            t.mat4_mul          = &AVX::mat4_mul;
+            t.mat4_mul_array    = &AVX::mat4_mul_array;
+            t.mat4_transform_array          = &AVX::mat4_transform_array;
+            t.mat4_transform_point_array    = &AVX::mat4_transform_point_array;
+            t.mat4_transform_dir_array      = &AVX::mat4_transform_dir_array;
+
+            t.vec4_add_array    = &AVX::vec4_add_array;
+            t.vec4_sub_array    = &AVX::vec4_sub_array;
+            t.vec4_mul_array    = &AVX::vec4_mul_array;
+            t.vec4_div_array    = &AVX::vec4_div_array;
+            t.vec4_dot_array    = &AVX::vec4_dot_array;
+            t.vec4_eq_array     = &AVX::vec4_eq_array;
+            t.vec4_normalize_array      = &AVX::vec4_normalize_array;
+            t.vec4_normalize_est_array  = &AVX::vec4_normalize_est_array;
+            t.vec4_magnitude_array      = &AVX::vec4_magnitude_array;
+            t.vec4_lerp_array   = &AVX::vec4_lerp_array;
+            t.vec4_min_reduce   = &AVX::vec4_min_reduce;
+            t.vec4_max_reduce   = &AVX::vec4_max_reduce;
+
+            t.vec3_dot_array    = &AVX::vec3_dot_array;
+            t.vec3_cross_array  = &AVX::vec3_cross_array;
+            t.vec3_magnitude_array      = &AVX::vec3_magnitude_array;
+            t.vec3_normalize_array      = &AVX::vec3_normalize_array;
+            t.vec3_normalize_est_array  = &AVX::vec3_normalize_est_array;
+
+            t.vec2_add_array    = &AVX::vec2_add_array;
+            t.vec2_mul_array    = &AVX::vec2_mul_array;
+            t.vec2_lerp_array   = &AVX::vec2_lerp_array;
+            t.vec2_normalize_array  = &AVX::vec2_normalize_array;
+
+            t.cull_sphere_array = &AVX::cull_sphere_array;
+            t.cull_aabb_array   = &AVX::cull_aabb_array;
+
+            t.quat_slerp_array  = &AVX::quat_slerp_array;
+
+            t.dq_skin_array     = &AVX::dq_skin_array;
+        }
+
+        if (set == EInstructionSet::AVX2 || set == EInstructionSet::AVX512)
+        {
+            t.mat4_det          = &FMA::mat4_det;
+            t.mat4_inv          = &FMA::mat4_inv;
+            t.mat4_mul          = &FMA::mat4_mul;
+            t.mat4_mul_vec      = &FMA::mat4_mul_vec;
+            t.mat4_mul_array    = &FMA::mat4_mul_array;
+            t.mat4_transform_array          = &FMA::mat4_transform_array;
+            t.mat4_transform_point_array    = &FMA::mat4_transform_point_array;
+            t.mat4_transform_dir_array      = &FMA::mat4_transform_dir_array;
+
+            t.lbs_skin_array    = &FMA::lbs_skin_array;
+
+            t.vec3_encode_oct_array     = &FMA::vec3_encode_oct_array;
+            t.vec3_decode_oct_array     = &FMA::vec3_decode_oct_array;
+            t.vec3_encode_1010102_array = &FMA::vec3_encode_1010102_array;
+            t.vec3_decode_1010102_array = &FMA::vec3_decode_1010102_array;
+        }
+
+        if (set == EInstructionSet::AVX512)
+        {
+            t.instructionSet = set;
+
+            t.mat4_transform_array          = &AVX512::mat4_transform_array;
+            t.mat4_transform_point_array    = &AVX512::mat4_transform_point_array;
+            t.mat4_transform_dir_array      = &AVX512::mat4_transform_dir_array;
+
+            t.vec4_add_array    = &AVX512::vec4_add_array;
+            t.vec4_sub_array    = &AVX512::vec4_sub_array;
+            t.vec4_mul_array    = &AVX512::vec4_mul_array;
+            t.vec4_div_array    = &AVX512::vec4_div_array;
+            t.vec4_dot_array    = &AVX512::vec4_dot_array;
+            t.vec4_eq_array     = &AVX512::vec4_eq_array;
+            t.vec4_normalize_array      = &AVX512::vec4_normalize_array;
+            t.vec4_normalize_est_array  = &AVX512::vec4_normalize_est_array;
+            t.vec4_magnitude_array      = &AVX512::vec4_magnitude_array;
+            t.vec4_lerp_array   = &AVX512::vec4_lerp_array;
+            t.vec4_min_reduce   = &AVX512::vec4_min_reduce;
+            t.vec4_max_reduce   = &AVX512::vec4_max_reduce;
+
+            t.vec3_dot_array    = &AVX512::vec3_dot_array;
+            t.vec3_cross_array  = &AVX512::vec3_cross_array;
+            t.vec3_magnitude_array      = &AVX512::vec3_magnitude_array;
+            t.vec3_normalize_array      = &AVX512::vec3_normalize_array;
+            t.vec3_normalize_est_array  = &AVX512::vec3_normalize_est_array;
+
+            t.vec2_add_array    = &AVX512::vec2_add_array;
+            t.vec2_mul_array    = &AVX512::vec2_mul_array;
+            t.vec2_lerp_array   = &AVX512::vec2_lerp_array;
+            t.vec2_normalize_array  = &AVX512::vec2_normalize_array;
+
+            t.cull_sphere_array = &AVX512::cull_sphere_array;
+            t.cull_aabb_array   = &AVX512::cull_aabb_array;
+
+            t.quat_slerp_array  = &AVX512::quat_slerp_array;
+
+            t.dq_skin_array     = &AVX512::dq_skin_array;
+            t.lbs_skin_array    = &AVX512::lbs_skin_array;
+        }
+
+        if (f16c)
+        {
+            t.float_to_half_array       = &AVX::float_to_half_array;
+            t.half_to_float_array       = &AVX::half_to_float_array;
+            t.vec3_float_to_half_array  = &AVX::vec3_float_to_half_array;
+            t.vec3_half_to_float_array  = &AVX::vec3_half_to_float_array;
+        }
+#endif
+
+        return t;
+    }
+
+    /// <summary>
+    /// Gets the kernel table. With P_RUNTIME_DISPATCH the table is built on the first call, after probing the CPU.
+    /// </summary>
+    /// <returns>Kernel table</returns>
+    inline const DispatchTable& GetDispatchTable()
+    {
+#if P_DISPATCH__
+        static const DispatchTable table = BuildDispatchTable(GetSupportedInstructionSet(), GetCPUFeatures().F16C);
+#else
+        static const DispatchTable table = BuildDispatchTable(static_cast<EInstructionSet>(P_INTRINSICS), P_F16C__);
+#endif
+        return table;
+    }
+
+    /// <summary>
+    /// Gets the instruction set of the selected kernels.
+    /// </summary>
+    /// <returns>Selected instruction set</returns>
+    inline EInstructionSet GetDispatchedInstructionSet()
+    {
+        return GetDispatchTable().instructionSet;
+    }
+}
@@ -0,0 +1,1277 @@
+#pragma once
+
+// AVX kernels on raw memory. Two xyzw vectors are processed per ymm register.
+//
+// Vector arrays are tightly packed xyzw.
+
+#include <cstddef>
+#include <cstdint>
+#include <immintrin.h>
+
+#include "Core/public/Math/SIMD/Platform.h"
+#include "Core/public/Math/SIMD/PhanesKernelsSSE.hpp"
+
+
+namespace Phanes::Core::Math::SIMD::AVX
+{
+    namespace Internal
+    {
+        /// <summary>
+        /// Multiplies the matrix, with its columns duplicated into both lanes, with two columns (one per lane).
+        /// </summary>
+        /// <param name="a0">Column 0 in both lanes</param>
+        /// <param name="a1">Column 1 in both lanes</param>
+        /// <param name="a2">Column 2 in both lanes</param>
+        /// <param name="a3">Column 3 in both lanes</param>
+        /// <param name="b">Two columns</param>
+        /// <returns>Two product columns</returns>
+        P_TARGET_AVX inline __m256 mat4_mul_col2(__m256 a0, __m256 a1, __m256 a2, __m256 a3, __m256 b)
+        {
+            __m256 s0 = _mm256_mul_ps(a0, _mm256_permute_ps(b, _MM_SHUFFLE(0, 0, 0, 0)));
+            __m256 s1 = _mm256_mul_ps(a1, _mm256_permute_ps(b, _MM_SHUFFLE(1, 1, 1, 1)));
+            __m256 s2 = _mm256_mul_ps(a2, _mm256_permute_ps(b, _MM_SHUFFLE(2, 2, 2, 2)));
+            __m256 s3 = _mm256_mul_ps(a3, _mm256_permute_ps(b, _MM_SHUFFLE(3, 3, 3, 3)));
+
+            return _mm256_add_ps(_mm256_add_ps(s0, s1), _mm256_add_ps(s2, s3));
+        }
+
+        // Gets 1 / sqrt(l) (or sqrt(l) for Exact, as the vectors are divided then).
+        template<SSE::Internal::ENormalizeMode M>
+        P_TARGET_AVX inline __m256 vec4x2_rsqrt(__m256 l)
+        {
+            if constexpr (M == SSE::Internal::ENormalizeMode::Exact)
+            {
+                return _mm256_sqrt_ps(l);
+            }
+            else
+            {
+                __m256 rs = _mm256_rsqrt_ps(l);
+
+                if constexpr (M == SSE::Internal::ENormalizeMode::Refined)
+                {
+                    // Newton-Raphson: r = r * (1.5 - 0.5 * l * r * r)
+                    __m256 hl = _mm256_mul_ps(l, _mm256_set1_ps(0.5f));
+                    rs = _mm256_mul_ps(rs, _mm256_sub_ps(_mm256_set1_ps(1.5f), _mm256_mul_ps(_mm256_mul_ps(hl, rs), rs)));
+                }
+                return rs;
+            }
+        }
+
+        // Scales two vectors by their broadcast (reciprocal) lengths. Vectors with a too short length are set to zero.
+        template<SSE::Internal::ENormalizeMode M>
+        P_TARGET_AVX inline __m256 vec4x2_scale_normalize(__m256 v, __m256 s, __m256 isShort)
+        {
+            __m256 r = (M == SSE::Internal::ENormalizeMode::Exact) ? _mm256_div_ps(v, s) : _mm256_mul_ps(v, s);
+            return _mm256_andnot_ps(isShort, r);
+        }
+
+        template<SSE::Internal::ENormalizeMode M>
+        P_TARGET_AVX inline void vec4_normalize_array(float* r, const float* v, size_t n, float minLength)
+        {
+            const __m256 minLen2 = _mm256_set1_ps(minLength * minLength);
+
+            size_t i = 0;
+
+            for (; i + 8 <= n; i += 8)
+            {
+                // x0 = (v0, v1), x1 = (v2, v3), x2 = (v4, v5), x3 = (v6, v7)
+                __m256 x0 = _mm256_loadu_ps(v + i * 4);
+                __m256 x1 = _mm256_loadu_ps(v + i * 4 + 8);
+                __m256 x2 = _mm256_loadu_ps(v + i * 4 + 16);
+                __m256 x3 = _mm256_loadu_ps(v + i * 4 + 24);
+
+                // Squared lengths [l0 l2 l4 l6 | l1 l3 l5 l7]
+                __m256 l = _mm256_hadd_ps(_mm256_hadd_ps(_mm256_mul_ps(x0, x0), _mm256_mul_ps(x1, x1)),
+                                          _mm256_hadd_ps(_mm256_mul_ps(x2, x2), _mm256_mul_ps(x3, x3)));
+
+                __m256 s = vec4x2_rsqrt<M>(l);
+                __m256 isShort = _mm256_cmp_ps(l, minLen2, _CMP_LT_OQ);
+
+                _mm256_storeu_ps(r + i * 4,      vec4x2_scale_normalize<M>(x0, _mm256_permute_ps(s, 0x00), _mm256_permute_ps(isShort, 0x00)));
+                _mm256_storeu_ps(r + i * 4 + 8,  vec4x2_scale_normalize<M>(x1, _mm256_permute_ps(s, 0x55), _mm256_permute_ps(isShort, 0x55)));
+                _mm256_storeu_ps(r + i * 4 + 16, vec4x2_scale_normalize<M>(x2, _mm256_permute_ps(s, 0xAA), _mm256_permute_ps(isShort, 0xAA)));
+                _mm256_storeu_ps(r + i * 4 + 24, vec4x2_scale_normalize<M>(x3, _mm256_permute_ps(s, 0xFF), _mm256_permute_ps(isShort, 0xFF)));
+            }
+
+            SSE::Internal::vec4_normalize_array<M>(r + i * 4, v + i * 4, n - i, minLength);
+        }
+
+        // Transposes the 4x4 block in each lane of r0 - r3.
+        P_TARGET_AVX inline void vec4x8_transpose(__m256& r0, __m256& r1, __m256& r2, __m256& r3)
+        {
+            __m256 t0 = _mm256_unpacklo_ps(r0, r1);
+            __m256 t1 = _mm256_unpacklo_ps(r2, r3);
+            __m256 t2 = _mm256_unpackhi_ps(r0, r1);
+            __m256 t3 = _mm256_unpackhi_ps(r2, r3);
+
+            r0 = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(1, 0, 1, 0));
+            r1 = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(3, 2, 3, 2));
+            r2 = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(1, 0, 1, 0));
+            r3 = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(3, 2, 3, 2));
+        }
+
+        // Loads eight xyzw vectors as x = (v0.x, ..., v7.x), y, z and w.
+        P_TARGET_AVX inline void vec4x8_load_soa(const float* v, __m256& x, __m256& y, __m256& z, __m256& w)
+        {
+            // Lane 0 holds v0 - v3, lane 1 v4 - v7.
+            x = _mm256_loadu2_m128(v + 16, v);
+            y = _mm256_loadu2_m128(v + 20, v + 4);
+            z = _mm256_loadu2_m128(v + 24, v + 8);
+            w = _mm256_loadu2_m128(v + 28, v + 12);
+
+            vec4x8_transpose(x, y, z, w);
+        }
+
+        // Stores x, y, z and w as eight xyzw vectors. Inverse of vec4x8_load_soa.
+        P_TARGET_AVX inline void vec4x8_store_aos(float* r, __m256 x, __m256 y, __m256 z, __m256 w)
+        {
+            vec4x8_transpose(x, y, z, w);
+
+            _mm256_storeu2_m128(r + 16, r,      x);
+            _mm256_storeu2_m128(r + 20, r + 4,  y);
+            _mm256_storeu2_m128(r + 24, r + 8,  z);
+            _mm256_storeu2_m128(r + 28, r + 12, w);
+        }
+
+        // Loads the dual quaternions dq[b[0]], dq[b[stride]], ..., dq[b[7 * stride]] (8 floats each) as q[c] = component c of all eight.
+        P_TARGET_AVX inline void dq8_load_soa(const float* dq, const uint32_t* b, size_t stride, __m256* q)
+        {
+            __m256 r[8];
+            for (size_t j = 0; j < 8; ++j)
+            {
+                r[j] = _mm256_loadu_ps(dq + (size_t)b[j * stride] * 8);
+            }
+
+            // 8x8 transpose. Lane 0 ends up with components 0 - 3, lane 1 with 4 - 7, which the final permutes regroup.
+            __m256 t0 = _mm256_unpacklo_ps(r[0], r[1]);
+            __m256 t1 = _mm256_unpackhi_ps(r[0], r[1]);
+            __m256 t2 = _mm256_unpacklo_ps(r[2], r[3]);
+            __m256 t3 = _mm256_unpackhi_ps(r[2], r[3]);
+            __m256 t4 = _mm256_unpacklo_ps(r[4], r[5]);
+            __m256 t5 = _mm256_unpackhi_ps(r[4], r[5]);
+            __m256 t6 = _mm256_unpacklo_ps(r[6], r[7]);
+            __m256 t7 = _mm256_unpackhi_ps(r[6], r[7]);
+
+            __m256 s0 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+            __m256 s1 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+            __m256 s2 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+            __m256 s3 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+            __m256 s4 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(1, 0, 1, 0));
+            __m256 s5 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(3, 2, 3, 2));
+            __m256 s6 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(1, 0, 1, 0));
+            __m256 s7 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(3, 2, 3, 2));
+
+            q[0] = _mm256_permute2f128_ps(s0, s4, 0x20);
+            q[1] = _mm256_permute2f128_ps(s1, s5, 0x20);
+            q[2] = _mm256_permute2f128_ps(s2, s6, 0x20);
+            q[3] = _mm256_permute2f128_ps(s3, s7, 0x20);
+            q[4] = _mm256_permute2f128_ps(s0, s4, 0x31);
+            q[5] = _mm256_permute2f128_ps(s1, s5, 0x31);
+            q[6] = _mm256_permute2f128_ps(s2, s6, 0x31);
+            q[7] = _mm256_permute2f128_ps(s3, s7, 0x31);
+        }
+
+        template<SSE::Internal::ENormalizeMode M>
+        P_TARGET_AVX inline void vec3_normalize_array(float* r, const float* v, size_t n, float minLength)
+        {
+            const __m256 minLen2 = _mm256_set1_ps(minLength * minLength);
+
+            size_t i = 0;
+
+            for (; i + 8 <= n; i += 8)
+            {
+                __m256 x, y, z, w;
+                vec4x8_load_soa(v + i * 4, x, y, z, w);
+
+                __m256 l = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x, x), _mm256_mul_ps(y, y)), _mm256_mul_ps(z, z));
+
+                __m256 s = vec4x2_rsqrt<M>(l);
+                __m256 isShort = _mm256_cmp_ps(l, minLen2, _CMP_LT_OQ);
+
+                vec4x8_store_aos(r + i * 4, vec4x2_scale_normalize<M>(x, s, isShort), vec4x2_scale_normalize<M>(y, s, isShort), vec4x2_scale_normalize<M>(z, s, isShort), _mm256_setzero_ps());
+            }
+
+            SSE::Internal::vec3_normalize_array<M>(r + i * 4, v + i * 4, n - i, minLength);
+        }
+
+        // Transforms two vectors (one per lane) with the matrix columns c0 - c3, duplicated into both lanes.
+        template<SSE::Internal::ETransformMode M>
+        P_TARGET_AVX inline __m256 mat4_transform2(__m256 c0, __m256 c1, __m256 c2, __m256 c3, __m256 v)
+        {
+            __m256 s01 = _mm256_add_ps(_mm256_mul_ps(c0, _mm256_permute_ps(v, _MM_SHUFFLE(0, 0, 0, 0))), _mm256_mul_ps(c1, _mm256_permute_ps(v, _MM_SHUFFLE(1, 1, 1, 1))));
+            __m256 s2 = _mm256_mul_ps(c2, _mm256_permute_ps(v, _MM_SHUFFLE(2, 2, 2, 2)));
+
+            if constexpr (M == SSE::Internal::ETransformMode::Vector)
+            {
+                return _mm256_add_ps(s01, _mm256_add_ps(s2, _mm256_mul_ps(c3, _mm256_permute_ps(v, _MM_SHUFFLE(3, 3, 3, 3)))));
+            }
+            else if constexpr (M == SSE::Internal::ETransformMode::Point)
+            {
+                return _mm256_add_ps(s01, _mm256_add_ps(s2, c3));
+            }
+            else
+            {
+                return _mm256_add_ps(s01, s2);
+            }
+        }
+
+        template<SSE::Internal::ETransformMode M>
+        P_TARGET_AVX inline void mat4_transform_array(float* r, const float* m, const float* v, size_t n, bool stream)
+        {
+            stream = stream && (reinterpret_cast<uintptr_t>(r) & 15) == 0;
+
+            size_t i = 0;
+
+            // Non-temporal ymm stores need 32 byte aligned memory, one vector is peeled off otherwise.
+            if (stream && (reinterpret_cast<uintptr_t>(r) & 31) != 0 && n > 0)
+            {
+                SSE::Internal::mat4_transform_array<M>(r, m, v, 1, true);
+                i = 1;
+            }
+
+            const __m256 c0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(m));
+            const __m256 c1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(m + 4));
+            const __m256 c2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(m + 8));
+            const __m256 c3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(m + 12));
+
+            // Four vectors fill one cache line.
+            for (; i + 4 <= n; i += 4)
+            {
+                _mm_prefetch(reinterpret_cast<const char*>(v + i * 4 + SSE::Internal::TransformPrefetchDistance), _MM_HINT_T0);
+
+                __m256 t0 = mat4_transform2<M>(c0, c1, c2, c3, _mm256_loadu_ps(v + i * 4));
+                __m256 t1 = mat4_transform2<M>(c0, c1, c2, c3, _mm256_loadu_ps(v + i * 4 + 8));
+
+                if (stream)
+                {
+                    _mm256_stream_ps(r + i * 4,     t0);
+                    _mm256_stream_ps(r + i * 4 + 8, t1);
+                }
+                else
+                {
+                    _mm256_storeu_ps(r + i * 4,     t0);
+                    _mm256_storeu_ps(r + i * 4 + 8, t1);
+                }
+            }
+
+            // Also fences the non-temporal stores.
+            SSE::Internal::mat4_transform_array<M>(r + i * 4, m, v + i * 4, n - i, stream);
+        }
+    }
+
+
+    // =========== //
+    //   Matrix4   //
+    // =========== //
+
+    /// <summary>
+    /// Multiplies two 4x4 matrices (a * b). Two columns of the product are computed per ymm register. r may alias a or b.
+    /// </summary>
+    /// <param name="r">Product</param>
+    /// <param name="a">Matrix one</param>
+    /// <param name="b">Matrix two</param>
+    P_TARGET_AVX inline void mat4_mul(float* r, const float* a, const float* b)
+    {
+        __m256 a0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(a));
+        __m256 a1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(a + 4));
+        __m256 a2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(a + 8));
+        __m256 a3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(a + 12));
+
+        __m256 c01 = Internal::mat4_mul_col2(a0, a1, a2, a3, _mm256_loadu_ps(b));
+        __m256 c23 = Internal::mat4_mul_col2(a0, a1, a2, a3, _mm256_loadu_ps(b + 8));
+
+        _mm256_storeu_ps(r,     c01);
+        _mm256_storeu_ps(r + 8, c23);
+    }
+
+    /// <summary>
+    /// Multiplies n pairs of 4x4 matrices (a[i] * b[i]). Two products are computed at once, with one matrix per lane.
+    /// </summary>
+    /// <param name="r">Products (16 * n floats)</param>
+    /// <param name="a">Matrices one</param>
+    /// <param name="b">Matrices two</param>
+    /// <param name="n">Number of matrices</param>
+    P_TARGET_AVX inline void mat4_mul_array(float* r, const float* a, const float* b, size_t n)
+    {
+        size_t i = 0;
+
+        for (; i + 2 <= n; i += 2)
+        {
+            const float* a_0 = a + i * 16;
+            const float* a_1 = a_0 + 16;
+            const float* b_0 = b + i * 16;
+            const float* b_1 = b_0 + 16;
+
+            // Lane 0 holds matrix i, lane 1 matrix i + 1.
+            __m256 a0 = _mm256_loadu2_m128(a_1,      a_0);
+            __m256 a1 = _mm256_loadu2_m128(a_1 + 4,  a_0 + 4);
+            __m256 a2 = _mm256_loadu2_m128(a_1 + 8,  a_0 + 8);
+            __m256 a3 = _mm256_loadu2_m128(a_1 + 12, a_0 + 12);
+
+            float* r_0 = r + i * 16;
+            float* r_1 = r_0 + 16;
+
+            for (int c = 0; c < 4; ++c)
+            {
+                __m256 p = Internal::mat4_mul_col2(a0, a1, a2, a3, _mm256_loadu2_m128(b_1 + c * 4, b_0 + c * 4));
+                _mm256_storeu2_m128(r_1 + c * 4, r_0 + c * 4, p);
+            }
+        }
+
+        if (i < n)
+        {
+            mat4_mul(r + i * 16, a + i * 16, b + i * 16);
+        }
+    }
+
+
+    /// <summary>
+    /// Transforms n vectors with a 4x4 matrix (m * v[i]). r may alias v.
+    /// </summary>
+    /// <param name="r">Transformed vectors (4 * n floats)</param>
+    /// <param name="m">Matrix</param>
+    /// <param name="v">Vectors</param>
+    /// <param name="n">Number of vectors</param>
+    /// <param name="stream">Write r with non-temporal stores, if r is 16 byte aligned</param>
+    P_TARGET_AVX inline void mat4_transform_array(float* r, const float* m, const float* v, size_t n, bool stream)
+    {
+        Internal::mat4_transform_array<SSE::Internal::ETransformMode::Vector>(r, m, v, n, stream);
+    }
+
+    /// <summary>
+    /// Transforms n points with a 4x4 matrix (m * (x, y, z, 1)). w of the input is ignored. r may alias v.
+    /// </summary>
+    /// <param name="r">Transformed points (4 * n floats)</param>
+    /// <param name="m">Matrix</param>
+    /// <param name="v">Points</param>
+    /// <param name="n">Number of points</param>
+    /// <param name="stream">Write r with non-temporal stores, if r is 16 byte aligned</param>
+    P_TARGET_AVX inline void mat4_transform_point_array(float* r, const float* m, const float* v, size_t n, bool stream)
+    {
+        Internal::mat4_transform_array<SSE::Internal::ETransformMode::Point>(r, m, v, n, stream);
+    }
+
+    /// <summary>
+    /// Transforms n directions with a 4x4 matrix (m * (x, y, z, 0)). w of the input is ignored. r may alias v.
+    /// </summary>
+    /// <param name="r">Transformed directions (4 * n floats)</param>
+    /// <param name="m">Matrix</param>
+    /// <param name="v">Directions</param>
+    /// <param name="n">Number of directions</param>
+    /// <param name="stream">Write r with non-temporal stores, if r is 16 byte aligned</param>
+    P_TARGET_AVX inline void mat4_transform_dir_array(float* r, const float* m, const float* v, size_t n, bool stream)
+    {
+        Internal::mat4_transform_array<SSE::Internal::ETransformMode::Direction>(r, m, v, n, stream);
+    }
+
+    // ================= //
+    //   Vector4 array   //
+    // ================= //
+
+    /// <summary>
+    /// Adds n vectors component-wise.
+    /// </summary>
+    /// <param name="r">Result (4 * n floats)</param>
+    /// <param name="a">Vectors one</param>
+    /// <param name="b">Vectors two</param>
+    /// <param name="n">Number of vectors</param>
+    P_TARGET_AVX inline void vec4_add_array(float* r, const float* a, const float* b, size_t n)
+    {
+        size_t i = 0;
+        for (; i + 8 <= n * 4; i += 8)
+        {
+            _mm256_storeu_ps(r + i, _mm256_add_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i)));
+        }
+        if (i < n * 4)
+        {
+            _mm_storeu_ps(r + i, _mm_add_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+        }
+    }
+
+    /// <summary>
+    /// Subtracts n vectors component-wise.
+    /// </summary>
+    /// <param name="r">Result (4 * n floats)</param>
+    /// <param name="a">Vectors one</param>
+    /// <param name="b">Vectors two</param>
+    /// <param name="n">Number of vectors</param>
+    P_TARGET_AVX inline void vec4_sub_array(float* r, const float* a, const float* b, size_t n)
+    {
+        size_t i = 0;
+        for (; i + 8 <= n * 4; i += 8)
+        {
+            _mm256_storeu_ps(r + i, _mm256_sub_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i)));
+        }
+        if (i < n * 4)
+        {
+            _mm_storeu_ps(r + i, _mm_sub_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+        }
+    }
+
+    /// <summary>
+    /// Multiplies n vectors component-wise.
+    /// </summary>
+    /// <param name="r">Result (4 * n floats)</param>
+    /// <param name="a">Vectors one</param>
+    /// <param name="b">Vectors two</param>
+    /// <param name="n">Number of vectors</param>
+    P_TARGET_AVX inline void vec4_mul_array(float* r, const float* a, const float* b, size_t n)
+    {
+        size_t i = 0;
+        for (; i + 8 <= n * 4; i += 8)
+        {
+            _mm256_storeu_ps(r + i, _mm256_mul_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i)));
+        }
+        if (i < n * 4)
+        {
+            _mm_storeu_ps(r + i, _mm_mul_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+        }
+    }
+
+    /// <summary>
+    /// Divides n vectors component-wise.
+    /// </summary>
+    /// <param name="r">Result (4 * n floats)</param>
+    /// <param name="a">Vectors one</param>
+    /// <param name="b">Vectors two</param>
+    /// <param name="n">Number of vectors</param>
+    P_TARGET_AVX inline void vec4_div_array(float* r, const float* a, const float* b, size_t n)
+    {
+        size_t i = 0;
+        for (; i + 8 <= n * 4; i += 8)
+        {
+            _mm256_storeu_ps(r + i, _mm256_div_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i)));
+        }
+        if (i < n * 4)
+        {
+            _mm_storeu_ps(r + i, _mm_div_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+        }
+    }
+
+    /// <summary>
+    /// Gets the dot products of n vector pairs. Eight products are reduced with horizontal adds at once.
+    /// </summary>
+    /// <param name="r">Dot products (n floats)</param>
+    /// <param name="a">Vectors one</param>
+    /// <param name="b">Vectors two</param>
+    /// <param name="n">Number of vectors</param>
+    P_TARGET_AVX inline void vec4_dot_array(float* r, const float* a, const float* b, size_t n)
+    {
+        size_t i = 0;
+
+        for (; i + 8 <= n; i += 8)
+        {
+            const float* v1 = a + i * 4;
+            const float* v2 = b + i * 4;
+
+            // p0 = (v0, v1), p1 = (v2, v3), p2 = (v4, v5), p3 = (v6, v7)
+            __m256 p0 = _mm256_mul_ps(_mm256_loadu_ps(v1),      _mm256_loadu_ps(v2));
+            __m256 p1 = _mm256_mul_ps(_mm256_loadu_ps(v1 + 8),  _mm256_loadu_ps(v2 + 8));
+            __m256 p2 = _mm256_mul_ps(_mm256_loadu_ps(v1 + 16), _mm256_loadu_ps(v2 + 16));
+            __m256 p3 = _mm256_mul_ps(_mm256_loadu_ps(v1 + 24), _mm256_loadu_ps(v2 + 24));
+
+            // [d0 d2 d4 d6 | d1 d3 d5 d7]
+            __m256 h = _mm256_hadd_ps(_mm256_hadd_ps(p0, p1), _mm256_hadd_ps(p2, p3));
+
+            __m128 lo = _mm256_castps256_ps128(h);
+            __m128 hi = _mm256_extractf128_ps(h, 1);
+
+            _mm_storeu_ps(r + i,     _mm_unpacklo_ps(lo, hi));
+            _mm_storeu_ps(r + i + 4, _mm_unpackhi_ps(lo, hi));
+        }
+
+        for (; i < n; ++i)
+        {
+            r[i] = _mm_cvtss_f32(_mm_dp_ps(_mm_loadu_ps(a + i * 4), _mm_loadu_ps(b + i * 4), 0xF1));
+        }
+    }
+
+    /// <summary>
+    /// Compares n vector pairs. Two vectors are equal, if all components differ by less than threshold.
+    /// </summary>
+    /// <param name="r">Results (n bools)</param>
+    /// <param name="a">Vectors one</param>
+    /// <param name="b">Vectors two</param>
+    /// <param name="n">Number of vectors</param>
+    /// <param name="threshold">Allowed difference per component</param>
+    P_TARGET_AVX inline void vec4_eq_array(bool* r, const float* a, const float* b, size_t n, float threshold)
+    {
+        const __m256 absMask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7FFFFFFF));
+        const __m256 t = _mm256_set1_ps(threshold);
+
+        size_t i = 0;
+        for (; i + 2 <= n; i += 2)
+        {
+            __m256 d = _mm256_and_ps(_mm256_sub_ps(_mm256_loadu_ps(a + i * 4), _mm256_loadu_ps(b + i * 4)), absMask);
+            int mask = _mm256_movemask_ps(_mm256_cmp_ps(d, t, _CMP_LT_OQ));
+
+            r[i]     = (mask & 0x0F) == 0x0F;
+            r[i + 1] = (mask & 0xF0) == 0xF0;
+        }
+        if (i < n)
+        {
+            __m128 d = _mm_and_ps(_mm_sub_ps(_mm_loadu_ps(a + i * 4), _mm_loadu_ps(b + i * 4)), _mm256_castps256_ps128(absMask));
+            r[i] = _mm_movemask_ps(_mm_cmplt_ps(d, _mm256_castps256_ps128(t))) == 0xF;
+        }
+    }
+
+    /// <summary>
+    /// Normalizes n vectors. Eight lengths are computed at once. Vectors shorter than minLength are set to zero, like Normalize does. r may alias v.
+    /// </summary>
+    /// <param name="r">Normalized vectors (4 * n floats)</param>
+    /// <param name="v">Vectors</param>
+    /// <param name="n">Number of vectors</param>
+    /// <param name="minLength">Smallest length, that is normalized</param>
+    P_TARGET_AVX inline void vec4_normalize_array(float* r, const float* v, size_t n, float minLength)
+    {
+        Internal::vec4_normalize_array<SSE::Internal::ENormalizeMode::Exact>(r, v, n, minLength);
+    }
+
+    /// <summary>
+    /// Normalizes n vectors with the reciprocal square root estimate (12 bits). Vectors shorter than minLength are set to zero, like Normalize does. r may alias v.
+    /// </summary>
+    /// <param name="r">Normalized vectors (4 * n floats)</param>
+    /// <param name="v">Vectors</param>
+    /// <param name="n">Number of vectors</param>
+    /// <param name="minLength">Smallest length, that is normalized</param>
+    /// <param name="refine">Refine the estimate with a Newton-Raphson step</param>
+    P_TARGET_AVX inline void vec4_normalize_est_array(float* r, const float* v, size_t n, float minLength, bool refine)
+    {
+        if (refine)
+        {
+            Internal::vec4_normalize_array<SSE::Internal::ENormalizeMode::Refined>(r, v, n, minLength);
+        }
+        else
+        {
+            Internal::vec4_normalize_array<SSE::Internal::ENormalizeMode::Approximate>(r, v, n, minLength);
+        }
+    }
+
+    /// <summary>
+    /// Gets the length of n vectors. Eight lengths are computed at once.
+    /// </summary>
+    /// <param name="r">Lengths (n floats)</param>
+    /// <param name="v">Vectors</param>
+    /// <param name="n">Number of vectors</param>
+    P_TARGET_AVX inline void vec4_magnitude_array(float* r, const float* v, size_t n)
+    {
+        size_t i = 0;
+
+        for (; i + 8 <= n; i += 8)
+        {
+            __m256 x, y, z, w;
+            Internal::vec4x8_load_soa(v + i * 4, x, y, z, w);
+
+            __m256 l = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x, x), _mm256_mul_ps(y, y)), _mm256_add_ps(_mm256_mul_ps(z, z), _mm256_mul_ps(w, w)));
+            _mm256_storeu_ps(r + i, _mm256_sqrt_ps(l));
+        }
+
+        SSE::vec4_magnitude_array(r + i, v + i * 4, n - i);
+    }
+
+    /// <summary>
+    /// Interpolates n vector pairs linearly (a + t * (b - a)). r may alias a or b.
+    /// </summary>
+    /// <param name="r">Result (4 * n floats)</param>
+    /// <param name="a">Start vectors</param>
+    /// <param name="b">Destination vectors</param>
+    /// <param name="n">Number of vectors</param>
+    /// <param name="t">Interpolation value</param>
+    P_TARGET_AVX inline void vec4_lerp_array(float* r, const float* a, const float* b, size_t n, float t)
+    {
+        const __m256 ts = _mm256_set1_ps(t);
+
+        size_t i = 0;
+        for (; i + 8 <= n * 4; i += 8)
+        {
+            __m256 x = _mm256_loadu_ps(a + i);
+            _mm256_storeu_ps(r + i, _mm256_add_ps(x, _mm256_mul_ps(ts, _mm256_sub_ps(_mm256_loadu_ps(b + i), x))));
+        }
+        if (i < n * 4)
+        {
+            __m128 x = _mm_loadu_ps(a + i);
+            _mm_storeu_ps(r + i, _mm_add_ps(x, _mm_mul_ps(_mm256_castps256_ps128(ts), _mm_sub_ps(_mm_loadu_ps(b + i), x))));
+        }
+    }
+
+    /// <summary>
+    /// Gets the component-wise minimum of n vectors. Two vectors are compared per ymm register.
+    /// </summary>
+    /// <param name="r">Minimum (4 floats)</param>
+    /// <param name="v">Vectors</param>
+    /// <param name="n">Number of vectors (at least 1)</param>
+    P_TARGET_AVX inline void vec4_min_reduce(float* r, const float* v, size_t n)
+    {
+        __m256 m0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(v));
+        __m256 m1 = m0;
+
+        size_t i = 0;
+        for (; i + 16 <= n * 4; i += 16)
+        {
+            m0 = _mm256_min_ps(m0, _mm256_loadu_ps(v + i));
+            m1 = _mm256_min_ps(m1, _mm256_loadu_ps(v + i + 8));
+        }
+        if (i + 8 <= n * 4)
+        {
+            m0 = _mm256_min_ps(m0, _mm256_loadu_ps(v + i));
+            i += 8;
+        }
+
+        m0 = _mm256_min_ps(m0, m1);
+        __m128 m = _mm_min_ps(_mm256_castps256_ps128(m0), _mm256_extractf128_ps(m0, 1));
+
+        if (i < n * 4)
+        {
+            m = _mm_min_ps(m, _mm_loadu_ps(v + i));
+        }
+
+        _mm_storeu_ps(r, m);
+    }
+
+    /// <summary>
+    /// Gets the component-wise maximum of n vectors. Two vectors are compared per ymm register.
+    /// </summary>
+    /// <param name="r">Maximum (4 floats)</param>
+    /// <param name="v">Vectors</param>
+    /// <param name="n">Number of vectors (at least 1)</param>
+    P_TARGET_AVX inline void vec4_max_reduce(float* r, const float* v, size_t n)
+    {
+        __m256 m0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(v));
+        __m256 m1 = m0;
+
+        size_t i = 0;
+        for (; i + 16 <= n * 4; i += 16)
+        {
+            m0 = _mm256_max_ps(m0, _mm256_loadu_ps(v + i));
+            m1 = _mm256_max_ps(m1, _mm256_loadu_ps(v + i + 8));
+        }
+        if (i + 8 <= n * 4)
+        {
+            m0 = _mm256_max_ps(m0, _mm256_loadu_ps(v + i));
+            i += 8;
+        }
+
+        m0 = _mm256_max_ps(m0, m1);
+        __m128 m = _mm_max_ps(_mm256_castps256_ps128(m0), _mm256_extractf128_ps(m0, 1));
+
+        if (i < n * 4)
+        {
+            m = _mm_max_ps(m, _mm_loadu_ps(v + i));
+        }
+
+        _mm_storeu_ps(r, m);
+    }
+
+    // ================= //
+    //   Vector3 array   //
+    // ================= //
+
+    // 3d vectors are stored as xyzw like TVector3. The vectors are transposed to x, y and z registers in blocks of eight.
+
+    /// <summary>
+    /// Gets the dot product of n 3d vector pairs. w is ignored.
+    /// </summary>
+    /// <param name="r">Dot products (n floats)</param>
+    /// <param name="a">Vectors one</param>
+    /// <param name="b">Vectors two</param>
+    /// <param name="n">Number of vectors</param>
+    P_TARGET_AVX inline void vec3_dot_array(float* r, const float* a, const float* b, size_t n)
+    {
+        size_t i = 0;
+
+        for (; i + 8 <= n; i += 8)
+        {
+            __m256 ax, ay, az, aw;
+            __m256 bx, by, bz, bw;
+            Internal::vec4x8_load_soa(a + i * 4, ax, ay, az, aw);
+            Internal::vec4x8_load_soa(b + i * 4, bx, by, bz, bw);
+
+            _mm256_storeu_ps(r + i, _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(ax, bx), _mm256_mul_ps(ay, by)), _mm256_mul_ps(az, bz)));
+        }
+
+        SSE::vec3_dot_array(r + i, a + i * 4, b + i * 4, n - i);
+    }
+
+    /// <summary>
+    /// Gets the cross product of n 3d vector pairs. w of the result is 0. r may alias a or b.
+    /// </summary>
+    /// <param name="r">Cross products (4 * n floats)</param>
+    /// <param name="a">Vectors one</param>
+    /// <param name="b">Vectors two</param>
+    /// <param name="n">Number of vectors</param>
+    P_TARGET_AVX inline void vec3_cross_array(float* r, const float* a, const float* b, size_t n)
+    {
+        size_t i = 0;
+
+        for (; i + 8 <= n; i += 8)
+        {
+            __m256 ax, ay, az, aw;
+            __m256 bx, by, bz, bw;
+            Internal::vec4x8_load_soa(a + i * 4, ax, ay, az, aw);
+            Internal::vec4x8_load_soa(b + i * 4, bx, by, bz, bw);
+
+            __m256 cx = _mm256_sub_ps(_mm256_mul_ps(ay, bz), _mm256_mul_ps(az, by));
+            __m256 cy = _mm256_sub_ps(_mm256_mul_ps(az, bx), _mm256_mul_ps(ax, bz));
+            __m256 cz = _mm256_sub_ps(_mm256_mul_ps(ax, by), _mm256_mul_ps(ay, bx));
+
+            Internal::vec4x8_store_aos(r + i * 4, cx, cy, cz, _mm256_setzero_ps());
+        }
+
+        SSE::vec3_cross_array(r + i * 4, a + i * 4, b + i * 4, n - i);
+    }
+
+    /// <summary>
+    /// Gets the length of n 3d vectors. w is ignored.
+    /// </summary>
+    /// <param name="r">Lengths (n floats)</param>
+    /// <param name="v">Vectors</param>
+    /// <param name="n">Number of vectors</param>
+    P_TARGET_AVX inline void vec3_magnitude_array(float* r, const float* v, size_t n)
+    {
+        size_t i = 0;
+
+        for (; i + 8 <= n; i += 8)
+        {
+            __m256 x, y, z, w;
+            Internal::vec4x8_load_soa(v + i * 4, x, y, z, w);
+
+            __m256 l = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x, x), _mm256_mul_ps(y, y)), _mm256_mul_ps(z, z));
+            _mm256_storeu_ps(r + i, _mm256_sqrt_ps(l));
+        }
+
+        SSE::vec3_magnitude_array(r + i, v + i * 4, n - i);
+    }
+
+    /// <summary>
+    /// Normalizes n 3d vectors. Eight lengths are computed at once. Vectors shorter than minLength are set to zero, like Normalize does. w of the result is 0. r may alias v.
+    /// </summary>
+    /// <param name="r">Normalized vectors (4 * n floats)</param>
+    /// <param name="v">Vectors</param>
+    /// <param name="n">Number of vectors</param>
+    /// <param name="minLength">Smallest length, that is normalized</param>
+    P_TARGET_AVX inline void vec3_normalize_array(float* r, const float* v, size_t n, float minLength)
+    {
+        Internal::vec3_normalize_array<SSE::Internal::ENormalizeMode::Exact>(r, v, n, minLength);
+    }
+
+    /// <summary>
+    /// Normalizes n 3d vectors with the reciprocal square root estimate (12 bits). Vectors shorter than minLength are set to zero, like Normalize does. w of the result is 0. r may alias v.
+    /// </summary>
+    /// <param name="r">Normalized vectors (4 * n floats)</param>
+    /// <param name="v">Vectors</param>
+    /// <param name="n">Number of vectors</param>
+    /// <param name="minLength">Smallest length, that is normalized</param>
+    /// <param name="refine">Refine the estimate with a Newton-Raphson step</param>
+    P_TARGET_AVX inline void vec3_normalize_est_array(float* r, const float* v, size_t n, float minLength, bool refine)
+    {
+        if (refine)
+        {
+            Internal::vec3_normalize_array<SSE::Internal::ENormalizeMode::Refined>(r, v, n, minLength);
+        }
+        else
+        {
+            Internal::vec3_normalize_array<SSE::Internal::ENormalizeMode::Approximate>(r, v, n, minLength);
+        }
+    }
+
+    // ================= //
+    //   Vector2 array   //
+    // ================= //
+
+    namespace Internal
+    {
+        P_TARGET_AVX inline __m256 vec2x4_normalize(__m256 v, __m256 minLen2)
+        {
+            __m256 sq = _mm256_mul_ps(v, v);
+            __m256 l = _mm256_add_ps(sq, _mm256_permute_ps(sq, _MM_SHUFFLE(2, 3, 0, 1)));  // l0 l0 l1 l1 | l2 l2 l3 l3
+
+            // Too short vectors are set to zero.
+            return _mm256_andnot_ps(_mm256_cmp_ps(l, minLen2, _CMP_LT_OQ), _mm256_div_ps(v, _mm256_sqrt_ps(l)));
+        }
+    }
+
+    /// <summary>
+    /// Adds n 2d vectors component-wise.
+    /// </summary>
+    /// <param name="r">Result (2 * n floats)</param>
+    /// <param name="a">Vectors one</param>
+    /// <param name="b">Vectors two</param>
+    /// <param name="n">Number of vectors</param>
+    P_TARGET_AVX inline void vec2_add_array(float* r, const float* a, const float* b, size_t n)
+    {
+        size_t i = 0;
+        for (; i + 8 <= n * 2; i += 8)
+        {
+            _mm256_storeu_ps(r + i, _mm256_add_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i)));
+        }
+        SSE::vec2_add_array(r + i, a + i, b + i, n - i / 2);
+    }
+
+    /// <summary>
+    /// Multiplies n 2d vectors component-wise.
+    /// </summary>
+    /// <param name="r">Result (2 * n floats)</param>
+    /// <param name="a">Vectors one</param>
+    /// <param name="b">Vectors two</param>
+    /// <param name="n">Number of vectors</param>
+    P_TARGET_AVX inline void vec2_mul_array(float* r, const float* a, const float* b, size_t n)
+    {
+        size_t i = 0;
+        for (; i + 8 <= n * 2; i += 8)
+        {
+            _mm256_storeu_ps(r + i, _mm256_mul_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i)));
+        }
+        SSE::vec2_mul_array(r + i, a + i, b + i, n - i / 2);
+    }
+
+    /// <summary>
+    /// Interpolates n pairs of 2d vectors with (1 - t) * a + t * b. t is not clamped.
+    /// </summary>
+    /// <param name="r">Result (2 * n floats)</param>
+    /// <param name="a">Start vectors (t = 0)</param>
+    /// <param name="b">Destination vectors (t = 1)</param>
+    /// <param name="n">Number of vectors</param>
+    /// <param name="t">Interpolation value</param>
+    P_TARGET_AVX inline void vec2_lerp_array(float* r, const float* a, const float* b, size_t n, float t)
+    {
+        const __m256 vt = _mm256_set1_ps(t);
+        const __m256 vt1 = _mm256_set1_ps(1.0f - t);
+
+        size_t i = 0;
+        for (; i + 8 <= n * 2; i += 8)
+        {
+            _mm256_storeu_ps(r + i, _mm256_add_ps(_mm256_mul_ps(_mm256_loadu_ps(a + i), vt1), _mm256_mul_ps(_mm256_loadu_ps(b + i), vt)));
+        }
+        SSE::vec2_lerp_array(r + i, a + i, b + i, n - i / 2, t);
+    }
+
+    /// <summary>
+    /// Normalizes n 2d vectors. Vectors shorter than minLength are set to zero, like Normalize does. r may alias v.
+    /// </summary>
+    /// <param name="r">Normalized vectors (2 * n floats)</param>
+    /// <param name="v">Vectors</param>
+    /// <param name="n">Number of vectors</param>
+    /// <param name="minLength">Smallest length, that is normalized</param>
+    P_TARGET_AVX inline void vec2_normalize_array(float* r, const float* v, size_t n, float minLength)
+    {
+        const __m256 minLen2 = _mm256_set1_ps(minLength * minLength);
+
+        size_t i = 0;
+        for (; i + 8 <= n * 2; i += 8)
+        {
+            _mm256_storeu_ps(r + i, Internal::vec2x4_normalize(_mm256_loadu_ps(v + i), minLen2));
+        }
+        SSE::vec2_normalize_array(r + i, v + i, n - i / 2, minLength);
+    }
+
+    // =========== //
+    //   Culling   //
+    // =========== //
+
+    // Planes are stored as (a, b, c, d) like TPlane (ax + by + cz = d). The side, the normal points to, is inside.
+    // Objects are records of stride floats. r holds one bit per object in (n + 31) / 32 words. A set bit means visible.
+
+    namespace Internal
+    {
+        // Loads eight records of stride floats as x = (v0.x, ..., v7.x), y, z and w.
+        P_TARGET_AVX inline void vec4x8_load_strided(const float* v, size_t stride, __m256& x, __m256& y, __m256& z, __m256& w)
+        {
+            // Lane 0 holds v0 - v3, lane 1 v4 - v7.
+            x = _mm256_loadu2_m128(v + stride * 4, v);
+            y = _mm256_loadu2_m128(v + stride * 5, v + stride);
+            z = _mm256_loadu2_m128(v + stride * 6, v + stride * 2);
+            w = _mm256_loadu2_m128(v + stride * 7, v + stride * 3);
+
+            vec4x8_transpose(x, y, z, w);
+        }
+
+        // Gets a * x + b * y + c * z - d of plane p for eight points.
+        P_TARGET_AVX inline __m256 plane_distance8(const float* p, __m256 x, __m256 y, __m256 z)
+        {
+            __m256 d = _mm256_add_ps(_mm256_mul_ps(_mm256_broadcast_ss(p), x), _mm256_mul_ps(_mm256_broadcast_ss(p + 1), y));
+            d = _mm256_add_ps(d, _mm256_mul_ps(_mm256_broadcast_ss(p + 2), z));
+
+            return _mm256_sub_ps(d, _mm256_broadcast_ss(p + 3));
+        }
+    }
+
+    /// <summary>
+    /// Tests n spheres against a set of planes. A sphere is visible, if it is not entirely behind any plane. Eight spheres are tested at once.
+    /// </summary>
+    /// <param name="r">Visibility mask ((n + 31) / 32 words)</param>
+    /// <param name="p">Planes (4 * planeCount floats)</param>
+    /// <param name="planeCount">Number of planes</param>
+    /// <param name="c">Center of the first sphere (xyz)</param>
+    /// <param name="radius">Radius of the first sphere</param>
+    /// <param name="stride">Distance between two spheres in floats (at least 4)</param>
+    /// <param name="n">Number of spheres</param>
+    P_TARGET_AVX inline void cull_sphere_array(uint32_t* r, const float* p, size_t planeCount, const float* c, const float* radius, size_t stride, size_t n)
+    {
+        for (size_t w = 0; w < (n + 31) / 32; ++w)
+        {
+            r[w] = 0;
+        }
+
+        size_t i = 0;
+
+        for (; i + 8 <= n; i += 8)
+        {
+            const float* s = c + i * stride;
+            const float* sr = radius + i * stride;
+
+            __m256 x, y, z, w;
+            Internal::vec4x8_load_strided(s, stride, x, y, z, w);
+
+            // Radius in w of the center, like TVector4 spheres, saves the extra loads.
+            if (sr != s + 3)
+            {
+                w = _mm256_setr_ps(sr[0], sr[stride], sr[stride * 2], sr[stride * 3], sr[stride * 4], sr[stride * 5], sr[stride * 6], sr[stride * 7]);
+            }
+            const __m256 nr = _mm256_sub_ps(_mm256_setzero_ps(), w);
+
+            __m256 out = _mm256_setzero_ps();
+            for (size_t k = 0; k < planeCount; ++k)
+            {
+                out = _mm256_or_ps(out, _mm256_cmp_ps(Internal::plane_distance8(p + k * 4, x, y, z), nr, _CMP_LT_OQ));
+
+                if (_mm256_movemask_ps(out) == 0xFF)
+                {
+                    break;
+                }
+            }
+
+            r[i >> 5] |= ((uint32_t)~_mm256_movemask_ps(out) & 0xFFu) << (i & 31);
+        }
+
+        for (; i < n; i += 4)
+        {
+            r[i >> 5] |= SSE::Internal::cull_sphere4(p, planeCount, c + i * stride, radius + i * stride, stride, n - i) << (i & 31);
+        }
+    }
+
+    /// <summary>
+    /// Tests n axis aligned boxes against a set of planes. A box is visible, if it is not entirely behind any plane. Eight boxes are tested at once.
+    /// </summary>
+    /// <param name="r">Visibility mask ((n + 31) / 32 words)</param>
+    /// <param name="p">Planes (4 * planeCount floats)</param>
+    /// <param name="planeCount">Number of planes</param>
+    /// <param name="mn">Minimum corner of the first box (xyz)</param>
+    /// <param name="mx">Maximum corner of the first box (xyz)</param>
+    /// <param name="stride">Distance between two boxes in floats (at least 4)</param>
+    /// <param name="n">Number of boxes</param>
+    P_TARGET_AVX inline void cull_aabb_array(uint32_t* r, const float* p, size_t planeCount, const float* mn, const float* mx, size_t stride, size_t n)
+    {
+        for (size_t w = 0; w < (n + 31) / 32; ++w)
+        {
+            r[w] = 0;
+        }
+
+        const __m256 half = _mm256_set1_ps(0.5f);
+        const __m256 absMask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7FFFFFFF));
+
+        size_t i = 0;
+
+        for (; i + 8 <= n; i += 8)
+        {
+            __m256 x0, y0, z0, w0;
+            __m256 x1, y1, z1, w1;
+            Internal::vec4x8_load_strided(mn + i * stride, stride, x0, y0, z0, w0);
+            Internal::vec4x8_load_strided(mx + i * stride, stride, x1, y1, z1, w1);
+
+            // Center and half extent.
+            const __m256 cx = _mm256_mul_ps(_mm256_add_ps(x1, x0), half);
+            const __m256 cy = _mm256_mul_ps(_mm256_add_ps(y1, y0), half);
+            const __m256 cz = _mm256_mul_ps(_mm256_add_ps(z1, z0), half);
+            const __m256 ex = _mm256_mul_ps(_mm256_sub_ps(x1, x0), half);
+            const __m256 ey = _mm256_mul_ps(_mm256_sub_ps(y1, y0), half);
+            const __m256 ez = _mm256_mul_ps(_mm256_sub_ps(z1, z0), half);
+
+            __m256 out = _mm256_setzero_ps();
+            for (size_t k = 0; k < planeCount; ++k)
+            {
+                const float* pl = p + k * 4;
+
+                // Projected half extent on the normal: |a| * ex + |b| * ey + |c| * ez.
+                __m256 e = _mm256_add_ps(_mm256_mul_ps(_mm256_and_ps(_mm256_broadcast_ss(pl), absMask), ex), _mm256_mul_ps(_mm256_and_ps(_mm256_broadcast_ss(pl + 1), absMask), ey));
+                e = _mm256_add_ps(e, _mm256_mul_ps(_mm256_and_ps(_mm256_broadcast_ss(pl + 2), absMask), ez));
+
+                out = _mm256_or_ps(out, _mm256_cmp_ps(_mm256_add_ps(Internal::plane_distance8(pl, cx, cy, cz), e), _mm256_setzero_ps(), _CMP_LT_OQ));
+
+                if (_mm256_movemask_ps(out) == 0xFF)
+                {
+                    break;
+                }
+            }
+
+            r[i >> 5] |= ((uint32_t)~_mm256_movemask_ps(out) & 0xFFu) << (i & 31);
+        }
+
+        for (; i < n; i += 4)
+        {
+            r[i >> 5] |= SSE::Internal::cull_aabb4(p, planeCount, mn + i * stride, mx + i * stride, stride, n - i) << (i & 31);
+        }
+    }
+
+    // ==================== //
+    //   Quaternion array   //
+    // ==================== //
+
+    /// <summary>
+    /// Interpolates n pairs of unit quaternions spherically. Takes the shortest path. r may alias a or b. Eight quaternions are interpolated at once.
+    /// </summary>
+    /// <param name="r">Result (4 * n floats)</param>
+    /// <param name="a">Start rotations</param>
+    /// <param name="b">Destination rotations</param>
+    /// <param name="n">Number of quaternions</param>
+    /// <param name="t">Interpolation value between 0 and 1</param>
+    P_TARGET_AVX inline void quat_slerp_array(float* r, const float* a, const float* b, size_t n, float t)
+    {
+        float ct[FPU::QuatSlerpTerms];
+        float cd[FPU::QuatSlerpTerms];
+        FPU::quat_slerp_coefficients(ct, t);
+        FPU::quat_slerp_coefficients(cd, 1.0f - t);
+
+        const __m256 one = _mm256_set1_ps(1.0f);
+        const __m256 sign = _mm256_set1_ps(-0.0f);
+
+        size_t i = 0;
+
+        for (; i + 8 <= n; i += 8)
+        {
+            __m256 ax, ay, az, aw;
+            __m256 bx, by, bz, bw;
+            Internal::vec4x8_load_soa(a + i * 4, ax, ay, az, aw);
+            Internal::vec4x8_load_soa(b + i * 4, bx, by, bz, bw);
+
+            __m256 d = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(ax, bx), _mm256_mul_ps(ay, by)), _mm256_add_ps(_mm256_mul_ps(az, bz), _mm256_mul_ps(aw, bw)));
+            __m256 xm1 = _mm256_sub_ps(_mm256_andnot_ps(sign, d), one);
+
+            __m256 wt = one;
+            __m256 wd = one;
+            for (size_t k = FPU::QuatSlerpTerms; k-- > 0;)
+            {
+                wt = _mm256_add_ps(one, _mm256_mul_ps(_mm256_mul_ps(_mm256_set1_ps(ct[k]), xm1), wt));
+                wd = _mm256_add_ps(one, _mm256_mul_ps(_mm256_mul_ps(_mm256_set1_ps(cd[k]), xm1), wd));
+            }
+
+            // Negative dot products flip b, for the shortest path.
+            wt = _mm256_xor_ps(_mm256_mul_ps(wt, _mm256_set1_ps(t)), _mm256_and_ps(d, sign));
+            wd = _mm256_mul_ps(wd, _mm256_set1_ps(1.0f - t));
+
+            Internal::vec4x8_store_aos(r + i * 4,
+                                       _mm256_add_ps(_mm256_mul_ps(ax, wd), _mm256_mul_ps(bx, wt)),
+                                       _mm256_add_ps(_mm256_mul_ps(ay, wd), _mm256_mul_ps(by, wt)),
+                                       _mm256_add_ps(_mm256_mul_ps(az, wd), _mm256_mul_ps(bz, wt)),
+                                       _mm256_add_ps(_mm256_mul_ps(aw, wd), _mm256_mul_ps(bw, wt)));
+        }
+
+        SSE::quat_slerp_array(r + i * 4, a + i * 4, b + i * 4, n - i, t);
+    }
+
+    // ============ //
+    //   Skinning   //
+    // ============ //
+
+    // Eight vertices per iteration. A bone dual quaternion fills one ymm register, so each influence costs eight loads and an 8x8 transpose instead of gathers.
+
+    /// <summary>
+    /// Skins n vertices with blended dual quaternions (DLB). Positions and normals may be skinned in place. See FPU::dq_skin_array for the layout.
+    /// </summary>
+    /// <param name="rp">Skinned positions (planar, pitch floats per component)</param>
+    /// <param name="rn">Skinned normals, or nullptr</param>
+    /// <param name="p">Bind pose positions</param>
+    /// <param name="nrm">Bind pose normals, or nullptr</param>
+    /// <param name="bones">Bone indices (FPU::SkinInfluences per vertex)</param>
+    /// <param name="weights">Bone weights (FPU::SkinInfluences per vertex)</param>
+    /// <param name="dq">Unit dual quaternions of the bones (8 floats per bone)</param>
+    /// <param name="n">Number of vertices</param>
+    /// <param name="pitch">Distance between the x, y and z arrays in floats (at least n)</param>
+    P_TARGET_AVX inline void dq_skin_array(float* rp, float* rn, const float* p, const float* nrm, const uint32_t* bones, const float* weights, const float* dq, size_t n, size_t pitch)
+    {
+        static_assert(FPU::SkinInfluences == 4, "dq_skin_array: Weights are loaded as xyzw vectors.");
+
+        const __m256 sign = _mm256_set1_ps(-0.0f);
+        const __m256 two = _mm256_set1_ps(2.0f);
+
+        size_t i = 0;
+
+        for (; i + 8 <= n; i += 8)
+        {
+            __m256 w[4];
+            Internal::vec4x8_load_soa(weights + i * 4, w[0], w[1], w[2], w[3]);
+
+            // The first bone is kept unweighted for the sign tests.
+            __m256 f[8];
+            __m256 q[8];
+            __m256 b[8];
+
+            Internal::dq8_load_soa(dq, bones + i * 4, 4, f);
+            for (size_t c = 0; c < 8; ++c)
+            {
+                q[c] = _mm256_mul_ps(f[c], w[0]);
+            }
+
+            for (size_t k = 1; k < 4; ++k)
+            {
+                Internal::dq8_load_soa(dq, bones + i * 4 + k, 4, b);
+
+                // Negates the weight, where the real part is opposite to the first bone.
+                __m256 dot = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(f[0], b[0]), _mm256_mul_ps(f[1], b[1])), _mm256_add_ps(_mm256_mul_ps(f[2], b[2]), _mm256_mul_ps(f[3], b[3])));
+                __m256 wk = _mm256_xor_ps(w[k], _mm256_and_ps(dot, sign));
+
+                for (size_t c = 0; c < 8; ++c)
+                {
+                    q[c] = _mm256_add_ps(q[c], _mm256_mul_ps(b[c], wk));
+                }
+            }
+
+            __m256 l = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(q[0], q[0]), _mm256_mul_ps(q[1], q[1])), _mm256_add_ps(_mm256_mul_ps(q[2], q[2]), _mm256_mul_ps(q[3], q[3])));
+            __m256 invLength = _mm256_div_ps(_mm256_set1_ps(1.0f), _mm256_sqrt_ps(l));
+
+            for (size_t c = 0; c < 8; ++c)
+            {
+                q[c] = _mm256_mul_ps(q[c], invLength);
+            }
+
+            // Translation: 2 * (rw * dv - dw * rv + rv x dv)
+            __m256 tx = _mm256_mul_ps(two, _mm256_add_ps(_mm256_sub_ps(_mm256_mul_ps(q[3], q[4]), _mm256_mul_ps(q[7], q[0])), _mm256_sub_ps(_mm256_mul_ps(q[1], q[6]), _mm256_mul_ps(q[2], q[5]))));
+            __m256 ty = _mm256_mul_ps(two, _mm256_add_ps(_mm256_sub_ps(_mm256_mul_ps(q[3], q[5]), _mm256_mul_ps(q[7], q[1])), _mm256_sub_ps(_mm256_mul_ps(q[2], q[4]), _mm256_mul_ps(q[0], q[6]))));
+            __m256 tz = _mm256_mul_ps(two, _mm256_add_ps(_mm256_sub_ps(_mm256_mul_ps(q[3], q[6]), _mm256_mul_ps(q[7], q[2])), _mm256_sub_ps(_mm256_mul_ps(q[0], q[5]), _mm256_mul_ps(q[1], q[4]))));
+
+            // Rotation: v + 2 * rv x (rv x v + rw * v)
+            __m256 vx = _mm256_loadu_ps(p + i);
+            __m256 vy = _mm256_loadu_ps(p + pitch + i);
+            __m256 vz = _mm256_loadu_ps(p + 2 * pitch + i);
+
+            __m256 cx = _mm256_add_ps(_mm256_sub_ps(_mm256_mul_ps(q[1], vz), _mm256_mul_ps(q[2], vy)), _mm256_mul_ps(q[3], vx));
+            __m256 cy = _mm256_add_ps(_mm256_sub_ps(_mm256_mul_ps(q[2], vx), _mm256_mul_ps(q[0], vz)), _mm256_mul_ps(q[3], vy));
+            __m256 cz = _mm256_add_ps(_mm256_sub_ps(_mm256_mul_ps(q[0], vy), _mm256_mul_ps(q[1], vx)), _mm256_mul_ps(q[3], vz));
+
+            _mm256_storeu_ps(rp + i,             _mm256_add_ps(_mm256_add_ps(vx, _mm256_mul_ps(two, _mm256_sub_ps(_mm256_mul_ps(q[1], cz), _mm256_mul_ps(q[2], cy)))), tx));
+            _mm256_storeu_ps(rp + pitch + i,     _mm256_add_ps(_mm256_add_ps(vy, _mm256_mul_ps(two, _mm256_sub_ps(_mm256_mul_ps(q[2], cx), _mm256_mul_ps(q[0], cz)))), ty));
+            _mm256_storeu_ps(rp + 2 * pitch + i, _mm256_add_ps(_mm256_add_ps(vz, _mm256_mul_ps(two, _mm256_sub_ps(_mm256_mul_ps(q[0], cy), _mm256_mul_ps(q[1], cx)))), tz));
+
+            if (nrm != nullptr)
+            {
+                vx = _mm256_loadu_ps(nrm + i);
+                vy = _mm256_loadu_ps(nrm + pitch + i);
+                vz = _mm256_loadu_ps(nrm + 2 * pitch + i);
+
+                cx = _mm256_add_ps(_mm256_sub_ps(_mm256_mul_ps(q[1], vz), _mm256_mul_ps(q[2], vy)), _mm256_mul_ps(q[3], vx));
+                cy = _mm256_add_ps(_mm256_sub_ps(_mm256_mul_ps(q[2], vx), _mm256_mul_ps(q[0], vz)), _mm256_mul_ps(q[3], vy));
+                cz = _mm256_add_ps(_mm256_sub_ps(_mm256_mul_ps(q[0], vy), _mm256_mul_ps(q[1], vx)), _mm256_mul_ps(q[3], vz));
+
+                _mm256_storeu_ps(rn + i,             _mm256_add_ps(vx, _mm256_mul_ps(two, _mm256_sub_ps(_mm256_mul_ps(q[1], cz), _mm256_mul_ps(q[2], cy)))));
+                _mm256_storeu_ps(rn + pitch + i,     _mm256_add_ps(vy, _mm256_mul_ps(two, _mm256_sub_ps(_mm256_mul_ps(q[2], cx), _mm256_mul_ps(q[0], cz)))));
+                _mm256_storeu_ps(rn + 2 * pitch + i, _mm256_add_ps(vz, _mm256_mul_ps(two, _mm256_sub_ps(_mm256_mul_ps(q[0], cy), _mm256_mul_ps(q[1], cx)))));
+            }
+        }
+
+        if (i < n)
+        {
+            SSE::dq_skin_array(rp + i, (rn != nullptr) ? rn + i : nullptr, p + i, (nrm != nullptr) ? nrm + i : nullptr, bones + i * 4, weights + i * 4, dq, n - i, pitch);
+        }
+    }
+
+    // ================== //
+    //   Half precision   //
+    // ================== //
+
+    // F16C has its own CPUID flag. The dispatcher selects these kernels, whenever the CPU reports it, independent of the instruction set tier.
+    // Rounding is to nearest even, like FPU::float_to_half.
+
+    /// <summary>
+    /// Converts n floats to half precision.
+    /// </summary>
+    /// <param name="r">Halves</param>
+    /// <param name="v">Floats</param>
+    /// <param name="n">Number of scalars</param>
+    P_TARGET_F16C inline void float_to_half_array(uint16_t* r, const float* v, size_t n)
+    {
+        size_t i = 0;
+        for (; i + 16 <= n; i += 16)
+        {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(r + i),     _mm256_cvtps_ph(_mm256_loadu_ps(v + i),     _MM_FROUND_TO_NEAREST_INT));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(r + i + 8), _mm256_cvtps_ph(_mm256_loadu_ps(v + i + 8), _MM_FROUND_TO_NEAREST_INT));
+        }
+
+        for (; i + 4 <= n; i += 4)
+        {
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(r + i), _mm_cvtps_ph(_mm_loadu_ps(v + i), _MM_FROUND_TO_NEAREST_INT));
+        }
+
+        FPU::float_to_half_array(r + i, v + i, n - i);
+    }
+
+    /// <summary>
+    /// Converts n halves to floats.
+    /// </summary>
+    /// <param name="r">Floats</param>
+    /// <param name="v">Halves</param>
+    /// <param name="n">Number of scalars</param>
+    P_TARGET_F16C inline void half_to_float_array(float* r, const uint16_t* v, size_t n)
+    {
+        size_t i = 0;
+        for (; i + 16 <= n; i += 16)
+        {
+            _mm256_storeu_ps(r + i,     _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(v + i))));
+            _mm256_storeu_ps(r + i + 8, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(v + i + 8))));
+        }
+
+        for (; i + 4 <= n; i += 4)
+        {
+            _mm_storeu_ps(r + i, _mm_cvtph_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(v + i))));
+        }
+
+        FPU::half_to_float_array(r + i, v + i, n - i);
+    }
+
+    /// <summary>
+    /// Converts n xyzw vectors to tightly packed xyz halves. w is dropped.
+    /// </summary>
+    /// <param name="r">Halves (3 * n)</param>
+    /// <param name="v">Vectors (4 * n floats)</param>
+    /// <param name="n">Number of vectors</param>
+    P_TARGET_F16C inline void vec3_float_to_half_array(uint16_t* r, const float* v, size_t n)
+    {
+        // xyzw xyzw -> xyz xyz, upper 4 bytes zero.
+        const __m128i pack = _mm_setr_epi8(0, 1, 2, 3, 4, 5, 8, 9, 10, 11, 12, 13, -1, -1, -1, -1);
+
+        size_t i = 0;
+        for (; i + 4 <= n; i += 4)
+        {
+            const __m128i h0 = _mm_shuffle_epi8(_mm256_cvtps_ph(_mm256_loadu_ps(v + i * 4),     _MM_FROUND_TO_NEAREST_INT), pack);
+            const __m128i h1 = _mm_shuffle_epi8(_mm256_cvtps_ph(_mm256_loadu_ps(v + i * 4 + 8), _MM_FROUND_TO_NEAREST_INT), pack);
+
+            // Twelve halves: h0 (6) and h1 (6).
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(r + i * 3), _mm_or_si128(h0, _mm_slli_si128(h1, 12)));
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(r + i * 3 + 8), _mm_srli_si128(h1, 4));
+        }
+
+        FPU::vec3_float_to_half_array(r + i * 3, v + i * 4, n - i);
+    }
+
+    /// <summary>
+    /// Converts n tightly packed xyz halves to xyzw vectors. w is written as 0.
+    /// </summary>
+    /// <param name="r">Vectors (4 * n floats)</param>
+    /// <param name="v">Halves (3 * n)</param>
+    /// <param name="n">Number of vectors</param>
+    P_TARGET_F16C inline void vec3_half_to_float_array(float* r, const uint16_t* v, size_t n)
+    {
+        // xyz xyz -> xyz0 xyz0. A zero half is 0.0f.
+        const __m128i unpack = _mm_setr_epi8(0, 1, 2, 3, 4, 5, -1, -1, 6, 7, 8, 9, 10, 11, -1, -1);
+
+        size_t i = 0;
+        for (; i + 4 <= n; i += 4)
+        {
+            const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(v + i * 3));
+            const __m128i b = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(v + i * 3 + 8));
+
+            _mm256_storeu_ps(r + i * 4,     _mm256_cvtph_ps(_mm_shuffle_epi8(a, unpack)));
+            _mm256_storeu_ps(r + i * 4 + 8, _mm256_cvtph_ps(_mm_shuffle_epi8(_mm_alignr_epi8(b, a, 12), unpack)));
+        }
+
+        FPU::vec3_half_to_float_array(r + i * 4, v + i * 3, n - i);
+    }
+}
@@ -0,0 +1,1204 @@
+#pragma once
+
+// AVX-512 kernels on raw memory. Four xyzw vectors are processed per zmm register.
+//
+// Vector arrays are tightly packed xyzw. Remaining vectors are handled with masked loads and stores, so no scalar tail is needed.
+// Requires AVX512F, AVX512VL and AVX512DQ.
+
+#include <cstddef>
+#include <cstdint>
+#include <immintrin.h>
+
+#include "Core/public/Math/SIMD/Platform.h"
+#include "Core/public/Math/SIMD/PhanesKernelsSSE.hpp"
+
+
+namespace Phanes::Core::Math::SIMD::AVX512
+{
+    namespace Internal
+    {
+        /// <summary>
+        /// Gets the mask for the first count floats of a zmm register.
+        /// </summary>
+        /// <param name="count">Number of floats (0 - 16)</param>
+        /// <returns>Lane mask</returns>
+        inline __mmask16 tail_mask(size_t count)
+        {
+            return (__mmask16)((1u << count) - 1u);
+        }
+
+        /// <summary>
+        /// Sums the components of each vector in p and broadcasts the sum over its four lanes.
+        /// </summary>
+        /// <param name="p">Four vectors</param>
+        /// <returns>Four sums</returns>
+        P_TARGET_AVX512 inline __m512 vec4x4_hadd(__m512 p)
+        {
+            p = _mm512_add_ps(p, _mm512_permute_ps(p, _MM_SHUFFLE(2, 3, 0, 1)));
+            return _mm512_add_ps(p, _mm512_permute_ps(p, _MM_SHUFFLE(1, 0, 3, 2)));
+        }
+
+        template<SSE::Internal::ENormalizeMode M>
+        P_TARGET_AVX512 inline void vec4_normalize_array(float* r, const float* v, size_t n, float minLength)
+        {
+            const __m512 minLen2 = _mm512_set1_ps(minLength * minLength);
+
+            for (size_t i = 0; i < n; i += 4)
+            {
+                const size_t count = (n - i < 4) ? n - i : 4;
+                const __mmask16 k = tail_mask(count * 4);
+
+                __m512 x = _mm512_maskz_loadu_ps(k, v + i * 4);
+                __m512 l = vec4x4_hadd(_mm512_mul_ps(x, x));
+
+                __m512 res;
+
+                if constexpr (M == SSE::Internal::ENormalizeMode::Exact)
+                {
+                    res = _mm512_div_ps(x, _mm512_sqrt_ps(l));
+                }
+                else
+                {
+                    __m512 rs = _mm512_rsqrt14_ps(l);
+
+                    if constexpr (M == SSE::Internal::ENormalizeMode::Refined)
+                    {
+                        // Newton-Raphson: r = r * (1.5 - 0.5 * l * r * r)
+                        __m512 hl = _mm512_mul_ps(l, _mm512_set1_ps(0.5f));
+                        rs = _mm512_mul_ps(rs, _mm512_fnmadd_ps(_mm512_mul_ps(hl, rs), rs, _mm512_set1_ps(1.5f)));
+                    }
+                    res = _mm512_mul_ps(x, rs);
+                }
+
+                // Vectors with a too short length are set to zero.
+                res = _mm512_maskz_mov_ps(_mm512_cmp_ps_mask(l, minLen2, _CMP_GE_OQ), res);
+
+                _mm512_mask_storeu_ps(r + i * 4, k, res);
+            }
+        }
+
+        /// <summary>
+        /// Gets the mask of zmm register j, for count floats stored over consecutive registers.
+        /// </summary>
+        /// <param name="count">Number of floats</param>
+        /// <param name="j">Register index</param>
+        /// <returns>Lane mask</returns>
+        inline __mmask16 block_mask(size_t count, size_t j)
+        {
+            return (count > j * 16) ? tail_mask((count - j * 16 < 16) ? count - j * 16 : 16) : (__mmask16)0;
+        }
+
+        // Transposes the 4x4 block in each 128 bit lane of r0 - r3.
+        P_TARGET_AVX512 inline void vec4x16_transpose(__m512& r0, __m512& r1, __m512& r2, __m512& r3)
+        {
+            __m512 t0 = _mm512_unpacklo_ps(r0, r1);
+            __m512 t1 = _mm512_unpacklo_ps(r2, r3);
+            __m512 t2 = _mm512_unpackhi_ps(r0, r1);
+            __m512 t3 = _mm512_unpackhi_ps(r2, r3);
+
+            r0 = _mm512_shuffle_ps(t0, t1, _MM_SHUFFLE(1, 0, 1, 0));
+            r1 = _mm512_shuffle_ps(t0, t1, _MM_SHUFFLE(3, 2, 3, 2));
+            r2 = _mm512_shuffle_ps(t2, t3, _MM_SHUFFLE(1, 0, 1, 0));
+            r3 = _mm512_shuffle_ps(t2, t3, _MM_SHUFFLE(3, 2, 3, 2));
+        }
+
+        // Transposes the 4x4 matrix of 128 bit lanes in r0 - r3.
+        P_TARGET_AVX512 inline void vec4x16_transpose_lanes(__m512& r0, __m512& r1, __m512& r2, __m512& r3)
+        {
+            __m512 t0 = _mm512_shuffle_f32x4(r0, r1, _MM_SHUFFLE(1, 0, 1, 0));
+            __m512 t1 = _mm512_shuffle_f32x4(r0, r1, _MM_SHUFFLE(3, 2, 3, 2));
+            __m512 t2 = _mm512_shuffle_f32x4(r2, r3, _MM_SHUFFLE(1, 0, 1, 0));
+            __m512 t3 = _mm512_shuffle_f32x4(r2, r3, _MM_SHUFFLE(3, 2, 3, 2));
+
+            r0 = _mm512_shuffle_f32x4(t0, t2, _MM_SHUFFLE(2, 0, 2, 0));
+            r1 = _mm512_shuffle_f32x4(t0, t2, _MM_SHUFFLE(3, 1, 3, 1));
+            r2 = _mm512_shuffle_f32x4(t1, t3, _MM_SHUFFLE(2, 0, 2, 0));
+            r3 = _mm512_shuffle_f32x4(t1, t3, _MM_SHUFFLE(3, 1, 3, 1));
+        }
+
+        // Loads count (up to 16) xyzw vectors as x = (v0.x, ..., v15.x), y, z and w. Missing vectors are 0.
+        P_TARGET_AVX512 inline void vec4x16_load_soa(const float* v, size_t count, __m512& x, __m512& y, __m512& z, __m512& w)
+        {
+            x = _mm512_maskz_loadu_ps(block_mask(count * 4, 0), v);
+            y = _mm512_maskz_loadu_ps(block_mask(count * 4, 1), v + 16);
+            z = _mm512_maskz_loadu_ps(block_mask(count * 4, 2), v + 32);
+            w = _mm512_maskz_loadu_ps(block_mask(count * 4, 3), v + 48);
+
+            // Lane k of register j holds vector 4 * k + j.
+            vec4x16_transpose_lanes(x, y, z, w);
+            vec4x16_transpose(x, y, z, w);
+        }
+
+        // Stores the first count vectors of x, y, z and w as xyzw vectors. Inverse of vec4x16_load_soa.
+        P_TARGET_AVX512 inline void vec4x16_store_aos(float* r, size_t count, __m512 x, __m512 y, __m512 z, __m512 w)
+        {
+            vec4x16_transpose(x, y, z, w);
+            vec4x16_transpose_lanes(x, y, z, w);
+
+            _mm512_mask_storeu_ps(r,      block_mask(count * 4, 0), x);
+            _mm512_mask_storeu_ps(r + 16, block_mask(count * 4, 1), y);
+            _mm512_mask_storeu_ps(r + 32, block_mask(count * 4, 2), z);
+            _mm512_mask_storeu_ps(r + 48, block_mask(count * 4, 3), w);
+        }
+
+        template<SSE::Internal::ENormalizeMode M>
+        P_TARGET_AVX512 inline void vec3_normalize_array(float* r, const float* v, size_t n, float minLength)
+        {
+            const __m512 minLen2 = _mm512_set1_ps(minLength * minLength);
+
+            for (size_t i = 0; i < n; i += 16)
+            {
+                const size_t count = (n - i < 16) ? n - i : 16;
+
+                __m512 x, y, z, w;
+                vec4x16_load_soa(v + i * 4, count, x, y, z, w);
+
+                __m512 l = _mm512_fmadd_ps(z, z, _mm512_fmadd_ps(y, y, _mm512_mul_ps(x, x)));
+
+                // Vectors with a too short length are set to zero.
+                const __mmask16 norm = _mm512_cmp_ps_mask(l, minLen2, _CMP_GE_OQ);
+
+                if constexpr (M == SSE::Internal::ENormalizeMode::Exact)
+                {
+                    __m512 s = _mm512_sqrt_ps(l);
+
+                    x = _mm512_maskz_div_ps(norm, x, s);
+                    y = _mm512_maskz_div_ps(norm, y, s);
+                    z = _mm512_maskz_div_ps(norm, z, s);
+                }
+                else
+                {
+                    __m512 rs = _mm512_rsqrt14_ps(l);
+
+                    if constexpr (M == SSE::Internal::ENormalizeMode::Refined)
+                    {
+                        // Newton-Raphson: r = r * (1.5 - 0.5 * l * r * r)
+                        __m512 hl = _mm512_mul_ps(l, _mm512_set1_ps(0.5f));
+                        rs = _mm512_mul_ps(rs, _mm512_fnmadd_ps(_mm512_mul_ps(hl, rs), rs, _mm512_set1_ps(1.5f)));
+                    }
+
+                    x = _mm512_maskz_mul_ps(norm, x, rs);
+                    y = _mm512_maskz_mul_ps(norm, y, rs);
+                    z = _mm512_maskz_mul_ps(norm, z, rs);
+                }
+
+                vec4x16_store_aos(r + i * 4, count, x, y, z, _mm512_setzero_ps());
+            }
+        }
+
+        // Transforms four vectors (one per 128 bit lane) with the matrix columns c0 - c3, broadcast into all lanes.
+        template<SSE::Internal::ETransformMode M>
+        P_TARGET_AVX512 inline __m512 mat4_transform4(__m512 c0, __m512 c1, __m512 c2, __m512 c3, __m512 v)
+        {
+            __m512 s = _mm512_fmadd_ps(c1, _mm512_permute_ps(v, _MM_SHUFFLE(1, 1, 1, 1)), _mm512_mul_ps(c0, _mm512_permute_ps(v, _MM_SHUFFLE(0, 0, 0, 0))));
+
+            if constexpr (M == SSE::Internal::ETransformMode::Vector)
+            {
+                return _mm512_add_ps(s, _mm512_fmadd_ps(c3, _mm512_permute_ps(v, _MM_SHUFFLE(3, 3, 3, 3)), _mm512_mul_ps(c2, _mm512_permute_ps(v, _MM_SHUFFLE(2, 2, 2, 2)))));
+            }
+            else if constexpr (M == SSE::Internal::ETransformMode::Point)
+            {
+                return _mm512_add_ps(s, _mm512_fmadd_ps(c2, _mm512_permute_ps(v, _MM_SHUFFLE(2, 2, 2, 2)), c3));
+            }
+            else
+            {
+                return _mm512_fmadd_ps(c2, _mm512_permute_ps(v, _MM_SHUFFLE(2, 2, 2, 2)), s);
+            }
+        }
+
+        template<SSE::Internal::ETransformMode M>
+        P_TARGET_AVX512 inline void mat4_transform_array(float* r, const float* m, const float* v, size_t n, bool stream)
+        {
+            stream = stream && (reinterpret_cast<uintptr_t>(r) & 15) == 0;
+
+            const __m512 c0 = _mm512_broadcast_f32x4(_mm_loadu_ps(m));
+            const __m512 c1 = _mm512_broadcast_f32x4(_mm_loadu_ps(m + 4));
+            const __m512 c2 = _mm512_broadcast_f32x4(_mm_loadu_ps(m + 8));
+            const __m512 c3 = _mm512_broadcast_f32x4(_mm_loadu_ps(m + 12));
+
+            size_t i = 0;
+
+            // Non-temporal zmm stores need 64 byte aligned memory, up to three vectors are peeled off otherwise.
+            if (stream)
+            {
+                const size_t peel = ((64 - (reinterpret_cast<uintptr_t>(r) & 63)) & 63) / 16;
+                i = (peel < n) ? peel : n;
+
+                const __mmask16 k = tail_mask(i * 4);
+                _mm512_mask_storeu_ps(r, k, mat4_transform4<M>(c0, c1, c2, c3, _mm512_maskz_loadu_ps(k, v)));
+            }
+
+            // One zmm register fills one cache line.
+            for (; i + 8 <= n; i += 8)
+            {
+                _mm_prefetch(reinterpret_cast<const char*>(v + i * 4 + SSE::Internal::TransformPrefetchDistance),      _MM_HINT_T0);
+                _mm_prefetch(reinterpret_cast<const char*>(v + i * 4 + SSE::Internal::TransformPrefetchDistance + 16), _MM_HINT_T0);
+
+                __m512 t0 = mat4_transform4<M>(c0, c1, c2, c3, _mm512_loadu_ps(v + i * 4));
+                __m512 t1 = mat4_transform4<M>(c0, c1, c2, c3, _mm512_loadu_ps(v + i * 4 + 16));
+
+                if (stream)
+                {
+                    _mm512_stream_ps(r + i * 4,      t0);
+                    _mm512_stream_ps(r + i * 4 + 16, t1);
+                }
+                else
+                {
+                    _mm512_storeu_ps(r + i * 4,      t0);
+                    _mm512_storeu_ps(r + i * 4 + 16, t1);
+                }
+            }
+
+            for (; i < n; i += 4)
+            {
+                const size_t count = (n - i < 4) ? n - i : 4;
+                const __mmask16 k = tail_mask(count * 4);
+
+                _mm512_mask_storeu_ps(r + i * 4, k, mat4_transform4<M>(c0, c1, c2, c3, _mm512_maskz_loadu_ps(k, v + i * 4)));
+            }
+
+            if (stream)
+            {
+                _mm_sfence();
+            }
+        }
+    }
+
+
+    // =========== //
+    //   Matrix4   //
+    // =========== //
+
+    /// <summary>
+    /// Transforms n vectors with a 4x4 matrix (m * v[i]). r may alias v.
+    /// </summary>
+    /// <param name="r">Transformed vectors (4 * n floats)</param>
+    /// <param name="m">Matrix</param>
+    /// <param name="v">Vectors</param>
+    /// <param name="n">Number of vectors</param>
+    /// <param name="stream">Write r with non-temporal stores, if r is 16 byte aligned</param>
+    P_TARGET_AVX512 inline void mat4_transform_array(float* r, const float* m, const float* v, size_t n, bool stream)
+    {
+        Internal::mat4_transform_array<SSE::Internal::ETransformMode::Vector>(r, m, v, n, stream);
+    }
+
+    /// <summary>
+    /// Transforms n points with a 4x4 matrix (m * (x, y, z, 1)). w of the input is ignored. r may alias v.
+    /// </summary>
+    /// <param name="r">Transformed points (4 * n floats)</param>
+    /// <param name="m">Matrix</param>
+    /// <param name="v">Points</param>
+    /// <param name="n">Number of points</param>
+    /// <param name="stream">Write r with non-temporal stores, if r is 16 byte aligned</param>
+    P_TARGET_AVX512 inline void mat4_transform_point_array(float* r, const float* m, const float* v, size_t n, bool stream)
+    {
+        Internal::mat4_transform_array<SSE::Internal::ETransformMode::Point>(r, m, v, n, stream);
+    }
+
+    /// <summary>
+    /// Transforms n directions with a 4x4 matrix (m * (x, y, z, 0)). w of the input is ignored. r may alias v.
+    /// </summary>
+    /// <param name="r">Transformed directions (4 * n floats)</param>
+    /// <param name="m">Matrix</param>
+    /// <param name="v">Directions</param>
+    /// <param name="n">Number of directions</param>
+    /// <param name="stream">Write r with non-temporal stores, if r is 16 byte aligned</param>
+    P_TARGET_AVX512 inline void mat4_transform_dir_array(float* r, const float* m, const float* v, size_t n, bool stream)
+    {
+        Internal::mat4_transform_array<SSE::Internal::ETransformMode::Direction>(r, m, v, n, stream);
+    }
+
+
+    // ================= //
+    //   Vector4 array   //
+    // ================= //
+
+    /// <summary>
+    /// Adds n vectors component-wise.
+    /// </summary>
+    /// <param name="r">Result (4 * n floats)</param>
+    /// <param name="a">Vectors one</param>
+    /// <param name="b">Vectors two</param>
+    /// <param name="n">Number of vectors</param>
+    P_TARGET_AVX512 inline void vec4_add_array(float* r, const float* a, const float* b, size_t n)
+    {
+        size_t i = 0;
+        for (; i + 16 <= n * 4; i += 16)
+        {
+            _mm512_storeu_ps(r + i, _mm512_add_ps(_mm512_loadu_ps(a + i), _mm512_loadu_ps(b + i)));
+        }
+        if (i < n * 4)
+        {
+            const __mmask16 k = Internal::tail_mask(n * 4 - i);
+            _mm512_mask_storeu_ps(r + i, k, _mm512_add_ps(_mm512_maskz_loadu_ps(k, a + i), _mm512_maskz_loadu_ps(k, b + i)));
+        }
+    }
+
+    /// <summary>
+    /// Subtracts n vectors component-wise.
+    /// </summary>
+    /// <param name="r">Result (4 * n floats)</param>
+    /// <param name="a">Vectors one</param>
+    /// <param name="b">Vectors two</param>
+    /// <param name="n">Number of vectors</param>
+    P_TARGET_AVX512 inline void vec4_sub_array(float* r, const float* a, const float* b, size_t n)
+    {
+        size_t i = 0;
+        for (; i + 16 <= n * 4; i += 16)
+        {
+            _mm512_storeu_ps(r + i, _mm512_sub_ps(_mm512_loadu_ps(a + i), _mm512_loadu_ps(b + i)));
+        }
+        if (i < n * 4)
+        {
+            const __mmask16 k = Internal::tail_mask(n * 4 - i);
+            _mm512_mask_storeu_ps(r + i, k, _mm512_sub_ps(_mm512_maskz_loadu_ps(k, a + i), _mm512_maskz_loadu_ps(k, b + i)));
+        }
+    }
+
+    /// <summary>
+    /// Multiplies n vectors component-wise.
+    /// </summary>
+    /// <param name="r">Result (4 * n floats)</param>
+    /// <param name="a">Vectors one</param>
+    /// <param name="b">Vectors two</param>
+    /// <param name="n">Number of vectors</param>
+    P_TARGET_AVX512 inline void vec4_mul_array(float* r, const float* a, const float* b, size_t n)
+    {
+        size_t i = 0;
+        for (; i + 16 <= n * 4; i += 16)
+        {
+            _mm512_storeu_ps(r + i, _mm512_mul_ps(_mm512_loadu_ps(a + i), _mm512_loadu_ps(b + i)));
+        }
+        if (i < n * 4)
+        {
+            const __mmask16 k = Internal::tail_mask(n * 4 - i);
+            _mm512_mask_storeu_ps(r + i, k, _mm512_mul_ps(_mm512_maskz_loadu_ps(k, a + i), _mm512_maskz_loadu_ps(k, b + i)));
+        }
+    }
+
+    /// <summary>
+    /// Divides n vectors component-wise.
+    /// </summary>
+    /// <param name="r">Result (4 * n floats)</param>
+    /// <param name="a">Vectors one</param>
+    /// <param name="b">Vectors two</param>
+    /// <param name="n">Number of vectors</param>
+    P_TARGET_AVX512 inline void vec4_div_array(float* r, const float* a, const float* b, size_t n)
+    {
+        size_t i = 0;
+        for (; i + 16 <= n * 4; i += 16)
+        {
+            _mm512_storeu_ps(r + i, _mm512_div_ps(_mm512_loadu_ps(a + i), _mm512_loadu_ps(b + i)));
+        }
+        if (i < n * 4)
+        {
+            // Masked out lanes are divided by zero, so only the enabled lanes are divided.
+            const __mmask16 k = Internal::tail_mask(n * 4 - i);
+            _mm512_mask_storeu_ps(r + i, k, _mm512_maskz_div_ps(k, _mm512_maskz_loadu_ps(k, a + i), _mm512_maskz_loadu_ps(k, b + i)));
+        }
+    }
+
+    /// <summary>
+    /// Gets the dot products of n vector pairs. Sixteen products are reduced at once.
+    /// </summary>
+    /// <param name="r">Dot products (n floats)</param>
+    /// <param name="a">Vectors one</param>
+    /// <param name="b">Vectors two</param>
+    /// <param name="n">Number of vectors</param>
+    P_TARGET_AVX512 inline void vec4_dot_array(float* r, const float* a, const float* b, size_t n)
+    {
+        // Lane 4 * g + k of the blended sums holds the dot of vector 4 * k + g.
+        const __m512i order = _mm512_setr_epi32(0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15);
+
+        size_t i = 0;
+
+        for (; i + 16 <= n; i += 16)
+        {
+            const float* v1 = a + i * 4;
+            const float* v2 = b + i * 4;
+
+            __m512 d0 = Internal::vec4x4_hadd(_mm512_mul_ps(_mm512_loadu_ps(v1),      _mm512_loadu_ps(v2)));
+            __m512 d1 = Internal::vec4x4_hadd(_mm512_mul_ps(_mm512_loadu_ps(v1 + 16), _mm512_loadu_ps(v2 + 16)));
+            __m512 d2 = Internal::vec4x4_hadd(_mm512_mul_ps(_mm512_loadu_ps(v1 + 32), _mm512_loadu_ps(v2 + 32)));
+            __m512 d3 = Internal::vec4x4_hadd(_mm512_mul_ps(_mm512_loadu_ps(v1 + 48), _mm512_loadu_ps(v2 + 48)));
+
+            __m512 d = _mm512_mask_blend_ps(0x2222, d0, d1);
+            d = _mm512_mask_blend_ps(0x4444, d, d2);
+            d = _mm512_mask_blend_ps(0x8888, d, d3);
+
+            _mm512_storeu_ps(r + i, _mm512_permutexvar_ps(order, d));
+        }
+
+        for (; i < n; i += 4)
+        {
+            const size_t count = (n - i < 4) ? n - i : 4;
+            const __mmask16 k = Internal::tail_mask(count * 4);
+
+            __m512 d = Internal::vec4x4_hadd(_mm512_mul_ps(_mm512_maskz_loadu_ps(k, a + i * 4), _mm512_maskz_loadu_ps(k, b + i * 4)));
+
+            _mm512_mask_compressstoreu_ps(r + i, (__mmask16)(0x1111 & k), d);
+        }
+    }
+
+    /// <summary>
+    /// Compares n vector pairs. Two vectors are equal, if all components differ by less than threshold.
+    /// </summary>
+    /// <param name="r">Results (n bools)</param>
+    /// <param name="a">Vectors one</param>
+    /// <param name="b">Vectors two</param>
+    /// <param name="n">Number of vectors</param>
+    /// <param name="threshold">Allowed difference per component</param>
+    P_TARGET_AVX512 inline void vec4_eq_array(bool* r, const float* a, const float* b, size_t n, float threshold)
+    {
+        const __m512 t = _mm512_set1_ps(threshold);
+
+        for (size_t i = 0; i < n; i += 4)
+        {
+            const size_t count = (n - i < 4) ? n - i : 4;
+            const __mmask16 k = Internal::tail_mask(count * 4);
+
+            __m512 d = _mm512_abs_ps(_mm512_sub_ps(_mm512_maskz_loadu_ps(k, a + i * 4), _mm512_maskz_loadu_ps(k, b + i * 4)));
+            const unsigned int eq = _mm512_cmp_ps_mask(d, t, _CMP_LT_OQ);
+
+            for (size_t j = 0; j < count; ++j)
+            {
+                r[i + j] = ((eq >> (j * 4)) & 0xF) == 0xF;
+            }
+        }
+    }
+
+    /// <summary>
+    /// Normalizes n vectors. Four vectors are processed per zmm register. Vectors shorter than minLength are set to zero, like Normalize does. r may alias v.
+    /// </summary>
+    /// <param name="r">Normalized vectors (4 * n floats)</param>
+    /// <param name="v">Vectors</param>
+    /// <param name="n">Number of vectors</param>
+    /// <param name="minLength">Smallest length, that is normalized</param>
+    P_TARGET_AVX512 inline void vec4_normalize_array(float* r, const float* v, size_t n, float minLength)
+    {
+        Internal::vec4_normalize_array<SSE::Internal::ENormalizeMode::Exact>(r, v, n, minLength);
+    }
+
+    /// <summary>
+    /// Normalizes n vectors with the reciprocal square root estimate (14 bits). Vectors shorter than minLength are set to zero, like Normalize does. r may alias v.
+    /// </summary>
+    /// <param name="r">Normalized vectors (4 * n floats)</param>
+    /// <param name="v">Vectors</param>
+    /// <param name="n">Number of vectors</param>
+    /// <param name="minLength">Smallest length, that is normalized</param>
+    /// <param name="refine">Refine the estimate with a Newton-Raphson step</param>
+    P_TARGET_AVX512 inline void vec4_normalize_est_array(float* r, const float* v, size_t n, float minLength, bool refine)
+    {
+        if (refine)
+        {
+            Internal::vec4_normalize_array<SSE::Internal::ENormalizeMode::Refined>(r, v, n, minLength);
+        }
+        else
+        {
+            Internal::vec4_normalize_array<SSE::Internal::ENormalizeMode::Approximate>(r, v, n, minLength);
+        }
+    }
+
+    /// <summary>
+    /// Gets the length of n vectors. Sixteen lengths are computed at once.
+    /// </summary>
+    /// <param name="r">Lengths (n floats)</param>
+    /// <param name="v">Vectors</param>
+    /// <param name="n">Number of vectors</param>
+    P_TARGET_AVX512 inline void vec4_magnitude_array(float* r, const float* v, size_t n)
+    {
+        for (size_t i = 0; i < n; i += 16)
+        {
+            const size_t count = (n - i < 16) ? n - i : 16;
+
+            __m512 x, y, z, w;
+            Internal::vec4x16_load_soa(v + i * 4, count, x, y, z, w);
+
+            __m512 l = _mm512_fmadd_ps(w, w, _mm512_fmadd_ps(z, z, _mm512_fmadd_ps(y, y, _mm512_mul_ps(x, x))));
+            _mm512_mask_storeu_ps(r + i, Internal::tail_mask(count), _mm512_sqrt_ps(l));
+        }
+    }
+
+    /// <summary>
+    /// Interpolates n vector pairs linearly (a + t * (b - a)). r may alias a or b.
+    /// </summary>
+    /// <param name="r">Result (4 * n floats)</param>
+    /// <param name="a">Start vectors</param>
+    /// <param name="b">Destination vectors</param>
+    /// <param name="n">Number of vectors</param>
+    /// <param name="t">Interpolation value</param>
+    P_TARGET_AVX512 inline void vec4_lerp_array(float* r, const float* a, const float* b, size_t n, float t)
+    {
+        const __m512 ts = _mm512_set1_ps(t);
+
+        size_t i = 0;
+        for (; i + 16 <= n * 4; i += 16)
+        {
+            __m512 x = _mm512_loadu_ps(a + i);
+            _mm512_storeu_ps(r + i, _mm512_fmadd_ps(ts, _mm512_sub_ps(_mm512_loadu_ps(b + i), x), x));
+        }
+        if (i < n * 4)
+        {
+            const __mmask16 k = Internal::tail_mask(n * 4 - i);
+
+            __m512 x = _mm512_maskz_loadu_ps(k, a + i);
+            _mm512_mask_storeu_ps(r + i, k, _mm512_fmadd_ps(ts, _mm512_sub_ps(_mm512_maskz_loadu_ps(k, b + i), x), x));
+        }
+    }
+
+    /// <summary>
+    /// Gets the component-wise minimum of n vectors. Four vectors are compared per zmm register.
+    /// </summary>
+    /// <param name="r">Minimum (4 floats)</param>
+    /// <param name="v">Vectors</param>
+    /// <param name="n">Number of vectors (at least 1)</param>
+    P_TARGET_AVX512 inline void vec4_min_reduce(float* r, const float* v, size_t n)
+    {
+        __m512 m = _mm512_broadcast_f32x4(_mm_loadu_ps(v));
+
+        size_t i = 0;
+        for (; i + 16 <= n * 4; i += 16)
+        {
+            m = _mm512_min_ps(m, _mm512_loadu_ps(v + i));
+        }
+        if (i < n * 4)
+        {
+            const __mmask16 k = Internal::tail_mask(n * 4 - i);
+            m = _mm512_mask_min_ps(m, k, m, _mm512_maskz_loadu_ps(k, v + i));
+        }
+
+        __m256 h = _mm256_min_ps(_mm512_castps512_ps256(m), _mm512_extractf32x8_ps(m, 1));
+        _mm_storeu_ps(r, _mm_min_ps(_mm256_castps256_ps128(h), _mm256_extractf128_ps(h, 1)));
+    }
+
+    /// <summary>
+    /// Gets the component-wise maximum of n vectors. Four vectors are compared per zmm register.
+    /// </summary>
+    /// <param name="r">Maximum (4 floats)</param>
+    /// <param name="v">Vectors</param>
+    /// <param name="n">Number of vectors (at least 1)</param>
+    P_TARGET_AVX512 inline void vec4_max_reduce(float* r, const float* v, size_t n)
+    {
+        __m512 m = _mm512_broadcast_f32x4(_mm_loadu_ps(v));
+
+        size_t i = 0;
+        for (; i + 16 <= n * 4; i += 16)
+        {
+            m = _mm512_max_ps(m, _mm512_loadu_ps(v + i));
+        }
+        if (i < n * 4)
+        {
+            const __mmask16 k = Internal::tail_mask(n * 4 - i);
+            m = _mm512_mask_max_ps(m, k, m, _mm512_maskz_loadu_ps(k, v + i));
+        }
+
+        __m256 h = _mm256_max_ps(_mm512_castps512_ps256(m), _mm512_extractf32x8_ps(m, 1));
+        _mm_storeu_ps(r, _mm_max_ps(_mm256_castps256_ps128(h), _mm256_extractf128_ps(h, 1)));
+    }
+
+    // ================= //
+    //   Vector3 array   //
+    // ================= //
+
+    // 3d vectors are stored as xyzw like TVector3. The vectors are transposed to x, y and z registers in blocks of sixteen.
+
+    /// <summary>
+    /// Gets the dot product of n 3d vector pairs. w is ignored.
+    /// </summary>
+    /// <param name="r">Dot products (n floats)</param>
+    /// <param name="a">Vectors one</param>
+    /// <param name="b">Vectors two</param>
+    /// <param name="n">Number of vectors</param>
+    P_TARGET_AVX512 inline void vec3_dot_array(float* r, const float* a, const float* b, size_t n)
+    {
+        for (size_t i = 0; i < n; i += 16)
+        {
+            const size_t count = (n - i < 16) ? n - i : 16;
+
+            __m512 ax, ay, az, aw;
+            __m512 bx, by, bz, bw;
+            Internal::vec4x16_load_soa(a + i * 4, count, ax, ay, az, aw);
+            Internal::vec4x16_load_soa(b + i * 4, count, bx, by, bz, bw);
+
+            __m512 d = _mm512_fmadd_ps(az, bz, _mm512_fmadd_ps(ay, by, _mm512_mul_ps(ax, bx)));
+            _mm512_mask_storeu_ps(r + i, Internal::tail_mask(count), d);
+        }
+    }
+
+    /// <summary>
+    /// Gets the cross product of n 3d vector pairs. w of the result is 0. r may alias a or b.
+    /// </summary>
+    /// <param name="r">Cross products (4 * n floats)</param>
+    /// <param name="a">Vectors one</param>
+    /// <param name="b">Vectors two</param>
+    /// <param name="n">Number of vectors</param>
+    P_TARGET_AVX512 inline void vec3_cross_array(float* r, const float* a, const float* b, size_t n)
+    {
+        for (size_t i = 0; i < n; i += 16)
+        {
+            const size_t count = (n - i < 16) ? n - i : 16;
+
+            __m512 ax, ay, az, aw;
+            __m512 bx, by, bz, bw;
+            Internal::vec4x16_load_soa(a + i * 4, count, ax, ay, az, aw);
+            Internal::vec4x16_load_soa(b + i * 4, count, bx, by, bz, bw);
+
+            __m512 cx = _mm512_fmsub_ps(ay, bz, _mm512_mul_ps(az, by));
+            __m512 cy = _mm512_fmsub_ps(az, bx, _mm512_mul_ps(ax, bz));
+            __m512 cz = _mm512_fmsub_ps(ax, by, _mm512_mul_ps(ay, bx));
+
+            Internal::vec4x16_store_aos(r + i * 4, count, cx, cy, cz, _mm512_setzero_ps());
+        }
+    }
+
+    /// <summary>
+    /// Gets the length of n 3d vectors. w is ignored.
+    /// </summary>
+    /// <param name="r">Lengths (n floats)</param>
+    /// <param name="v">Vectors</param>
+    /// <param name="n">Number of vectors</param>
+    P_TARGET_AVX512 inline void vec3_magnitude_array(float* r, const float* v, size_t n)
+    {
+        for (size_t i = 0; i < n; i += 16)
+        {
+            const size_t count = (n - i < 16) ? n - i : 16;
+
+            __m512 x, y, z, w;
+            Internal::vec4x16_load_soa(v + i * 4, count, x, y, z, w);
+
+            __m512 l = _mm512_fmadd_ps(z, z, _mm512_fmadd_ps(y, y, _mm512_mul_ps(x, x)));
+            _mm512_mask_storeu_ps(r + i, Internal::tail_mask(count), _mm512_sqrt_ps(l));
+        }
+    }
+
+    /// <summary>
+    /// Normalizes n 3d vectors. Sixteen lengths are computed at once. Vectors shorter than minLength are set to zero, like Normalize does. w of the result is 0. r may alias v.
+    /// </summary>
+    /// <param name="r">Normalized vectors (4 * n floats)</param>
+    /// <param name="v">Vectors</param>
+    /// <param name="n">Number of vectors</param>
+    /// <param name="minLength">Smallest length, that is normalized</param>
+    P_TARGET_AVX512 inline void vec3_normalize_array(float* r, const float* v, size_t n, float minLength)
+    {
+        Internal::vec3_normalize_array<SSE::Internal::ENormalizeMode::Exact>(r, v, n, minLength);
+    }
+
+    /// <summary>
+    /// Normalizes n 3d vectors with the reciprocal square root estimate (14 bits). Vectors shorter than minLength are set to zero, like Normalize does. w of the result is 0. r may alias v.
+    /// </summary>
+    /// <param name="r">Normalized vectors (4 * n floats)</param>
+    /// <param name="v">Vectors</param>
+    /// <param name="n">Number of vectors</param>
+    /// <param name="minLength">Smallest length, that is normalized</param>
+    /// <param name="refine">Refine the estimate with a Newton-Raphson step</param>
+    P_TARGET_AVX512 inline void vec3_normalize_est_array(float* r, const float* v, size_t n, float minLength, bool refine)
+    {
+        if (refine)
+        {
+            Internal::vec3_normalize_array<SSE::Internal::ENormalizeMode::Refined>(r, v, n, minLength);
+        }
+        else
+        {
+            Internal::vec3_normalize_array<SSE::Internal::ENormalizeMode::Approximate>(r, v, n, minLength);
+        }
+    }
+
+    // ================= //
+    //   Vector2 array   //
+    // ================= //
+
+    /// <summary>
+    /// Adds n 2d vectors component-wise.
+    /// </summary>
+    /// <param name="r">Result (2 * n floats)</param>
+    /// <param name="a">Vectors one</param>
+    /// <param name="b">Vectors two</param>
+    /// <param name="n">Number of vectors</param>
+    P_TARGET_AVX512 inline void vec2_add_array(float* r, const float* a, const float* b, size_t n)
+    {
+        size_t i = 0;
+        for (; i + 16 <= n * 2; i += 16)
+        {
+            _mm512_storeu_ps(r + i, _mm512_add_ps(_mm512_loadu_ps(a + i), _mm512_loadu_ps(b + i)));
+        }
+        if (i < n * 2)
+        {
+            const __mmask16 k = Internal::tail_mask(n * 2 - i);
+            _mm512_mask_storeu_ps(r + i, k, _mm512_add_ps(_mm512_maskz_loadu_ps(k, a + i), _mm512_maskz_loadu_ps(k, b + i)));
+        }
+    }
+
+    /// <summary>
+    /// Multiplies n 2d vectors component-wise.
+    /// </summary>
+    /// <param name="r">Result (2 * n floats)</param>
+    /// <param name="a">Vectors one</param>
+    /// <param name="b">Vectors two</param>
+    /// <param name="n">Number of vectors</param>
+    P_TARGET_AVX512 inline void vec2_mul_array(float* r, const float* a, const float* b, size_t n)
+    {
+        size_t i = 0;
+        for (; i + 16 <= n * 2; i += 16)
+        {
+            _mm512_storeu_ps(r + i, _mm512_mul_ps(_mm512_loadu_ps(a + i), _mm512_loadu_ps(b + i)));
+        }
+        if (i < n * 2)
+        {
+            const __mmask16 k = Internal::tail_mask(n * 2 - i);
+            _mm512_mask_storeu_ps(r + i, k, _mm512_mul_ps(_mm512_maskz_loadu_ps(k, a + i), _mm512_maskz_loadu_ps(k, b + i)));
+        }
+    }
+
+    /// <summary>
+    /// Interpolates n pairs of 2d vectors with (1 - t) * a + t * b. t is not clamped.
+    /// </summary>
+    /// <param name="r">Result (2 * n floats)</param>
+    /// <param name="a">Start vectors (t = 0)</param>
+    /// <param name="b">Destination vectors (t = 1)</param>
+    /// <param name="n">Number of vectors</param>
+    /// <param name="t">Interpolation value</param>
+    P_TARGET_AVX512 inline void vec2_lerp_array(float* r, const float* a, const float* b, size_t n, float t)
+    {
+        const __m512 vt = _mm512_set1_ps(t);
+        const __m512 vt1 = _mm512_set1_ps(1.0f - t);
+
+        for (size_t i = 0; i < n * 2; i += 16)
+        {
+            const __mmask16 k = Internal::tail_mask((n * 2 - i < 16) ? n * 2 - i : 16);
+            __m512 res = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(k, a + i), vt1, _mm512_mul_ps(_mm512_maskz_loadu_ps(k, b + i), vt));
+            _mm512_mask_storeu_ps(r + i, k, res);
+        }
+    }
+
+    /// <summary>
+    /// Normalizes n 2d vectors. Vectors shorter than minLength are set to zero, like Normalize does. r may alias v.
+    /// </summary>
+    /// <param name="r">Normalized vectors (2 * n floats)</param>
+    /// <param name="v">Vectors</param>
+    /// <param name="n">Number of vectors</param>
+    /// <param name="minLength">Smallest length, that is normalized</param>
+    P_TARGET_AVX512 inline void vec2_normalize_array(float* r, const float* v, size_t n, float minLength)
+    {
+        const __m512 minLen2 = _mm512_set1_ps(minLength * minLength);
+
+        for (size_t i = 0; i < n * 2; i += 16)
+        {
+            const __mmask16 k = Internal::tail_mask((n * 2 - i < 16) ? n * 2 - i : 16);
+
+            __m512 x = _mm512_maskz_loadu_ps(k, v + i);
+            __m512 sq = _mm512_mul_ps(x, x);
+            __m512 l = _mm512_add_ps(sq, _mm512_permute_ps(sq, _MM_SHUFFLE(2, 3, 0, 1)));
+
+            // Too short vectors are set to zero.
+            __mmask16 keep = _mm512_cmp_ps_mask(l, minLen2, _CMP_GE_OQ);
+            _mm512_mask_storeu_ps(r + i, k, _mm512_maskz_div_ps(keep, x, _mm512_sqrt_ps(l)));
+        }
+    }
+
+    // =========== //
+    //   Culling   //
+    // =========== //
+
+    // Planes are stored as (a, b, c, d) like TPlane (ax + by + cz = d). The side, the normal points to, is inside.
+    // Objects are records of stride floats. r holds one bit per object in (n + 31) / 32 words. A set bit means visible.
+
+    namespace Internal
+    {
+        // Loads count (up to 16) records of stride floats as x = (v0.x, ..., v15.x), y, z and w. Missing records are 0.
+        P_TARGET_AVX512 inline void vec4x16_load_strided(const float* v, size_t stride, size_t count, __m512& x, __m512& y, __m512& z, __m512& w)
+        {
+            __m512 r[4];
+
+            // Lane k of register j holds record 4 * k + j.
+            for (size_t j = 0; j < 4; ++j)
+            {
+                __m128 l[4];
+                for (size_t k = 0; k < 4; ++k)
+                {
+                    l[k] = (k * 4 + j < count) ? _mm_loadu_ps(v + (k * 4 + j) * stride) : _mm_setzero_ps();
+                }
+
+                r[j] = _mm512_insertf32x4(_mm512_insertf32x4(_mm512_insertf32x4(_mm512_castps128_ps512(l[0]), l[1], 1), l[2], 2), l[3], 3);
+            }
+
+            vec4x16_transpose(r[0], r[1], r[2], r[3]);
+
+            x = r[0];
+            y = r[1];
+            z = r[2];
+            w = r[3];
+        }
+
+        // Gets a * x + b * y + c * z - d of plane p for sixteen points.
+        P_TARGET_AVX512 inline __m512 plane_distance16(const float* p, __m512 x, __m512 y, __m512 z)
+        {
+            return _mm512_fmadd_ps(_mm512_set1_ps(p[2]), z, _mm512_fmadd_ps(_mm512_set1_ps(p[1]), y, _mm512_fmsub_ps(_mm512_set1_ps(p[0]), x, _mm512_set1_ps(p[3]))));
+        }
+    }
+
+    /// <summary>
+    /// Tests n spheres against a set of planes. A sphere is visible, if it is not entirely behind any plane. Sixteen spheres are tested at once.
+    /// </summary>
+    /// <param name="r">Visibility mask ((n + 31) / 32 words)</param>
+    /// <param name="p">Planes (4 * planeCount floats)</param>
+    /// <param name="planeCount">Number of planes</param>
+    /// <param name="c">Center of the first sphere (xyz)</param>
+    /// <param name="radius">Radius of the first sphere</param>
+    /// <param name="stride">Distance between two spheres in floats (at least 4)</param>
+    /// <param name="n">Number of spheres</param>
+    P_TARGET_AVX512 inline void cull_sphere_array(uint32_t* r, const float* p, size_t planeCount, const float* c, const float* radius, size_t stride, size_t n)
+    {
+        for (size_t w = 0; w < (n + 31) / 32; ++w)
+        {
+            r[w] = 0;
+        }
+
+        const __m512i index = _mm512_mullo_epi32(_mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15), _mm512_set1_epi32((int)stride));
+
+        for (size_t i = 0; i < n; i += 16)
+        {
+            const size_t count = (n - i < 16) ? n - i : 16;
+            const __mmask16 valid = Internal::tail_mask(count);
+
+            const float* s = c + i * stride;
+            const float* sr = radius + i * stride;
+
+            __m512 x, y, z, w;
+            Internal::vec4x16_load_strided(s, stride, count, x, y, z, w);
+
+            // Radius in w of the center, like TVector4 spheres, saves the gather.
+            if (sr != s + 3)
+            {
+                w = _mm512_mask_i32gather_ps(_mm512_setzero_ps(), valid, index, sr, 4);
+            }
+            const __m512 nr = _mm512_sub_ps(_mm512_setzero_ps(), w);
+
+            __mmask16 out = 0;
+            for (size_t k = 0; k < planeCount && out != 0xFFFF; ++k)
+            {
+                out |= _mm512_cmp_ps_mask(Internal::plane_distance16(p + k * 4, x, y, z), nr, _CMP_LT_OQ);
+            }
+
+            r[i >> 5] |= (uint32_t)(~out & valid) << (i & 31);
+        }
+    }
+
+    /// <summary>
+    /// Tests n axis aligned boxes against a set of planes. A box is visible, if it is not entirely behind any plane. Sixteen boxes are tested at once.
+    /// </summary>
+    /// <param name="r">Visibility mask ((n + 31) / 32 words)</param>
+    /// <param name="p">Planes (4 * planeCount floats)</param>
+    /// <param name="planeCount">Number of planes</param>
+    /// <param name="mn">Minimum corner of the first box (xyz)</param>
+    /// <param name="mx">Maximum corner of the first box (xyz)</param>
+    /// <param name="stride">Distance between two boxes in floats (at least 4)</param>
+    /// <param name="n">Number of boxes</param>
+    P_TARGET_AVX512 inline void cull_aabb_array(uint32_t* r, const float* p, size_t planeCount, const float* mn, const float* mx, size_t stride, size_t n)
+    {
+        for (size_t w = 0; w < (n + 31) / 32; ++w)
+        {
+            r[w] = 0;
+        }
+
+        const __m512 half = _mm512_set1_ps(0.5f);
+
+        for (size_t i = 0; i < n; i += 16)
+        {
+            const size_t count = (n - i < 16) ? n - i : 16;
+
+            __m512 x0, y0, z0, w0;
+            __m512 x1, y1, z1, w1;
+            Internal::vec4x16_load_strided(mn + i * stride, stride, count, x0, y0, z0, w0);
+            Internal::vec4x16_load_strided(mx + i * stride, stride, count, x1, y1, z1, w1);
+
+            // Center and half extent.
+            const __m512 cx = _mm512_mul_ps(_mm512_add_ps(x1, x0), half);
+            const __m512 cy = _mm512_mul_ps(_mm512_add_ps(y1, y0), half);
+            const __m512 cz = _mm512_mul_ps(_mm512_add_ps(z1, z0), half);
+            const __m512 ex = _mm512_mul_ps(_mm512_sub_ps(x1, x0), half);
+            const __m512 ey = _mm512_mul_ps(_mm512_sub_ps(y1, y0), half);
+            const __m512 ez = _mm512_mul_ps(_mm512_sub_ps(z1, z0), half);
+
+            __mmask16 out = 0;
+            for (size_t k = 0; k < planeCount && out != 0xFFFF; ++k)
+            {
+                const float* pl = p + k * 4;
+
+                // Projected half extent on the normal: |a| * ex + |b| * ey + |c| * ez.
+                __m512 e = _mm512_mul_ps(_mm512_abs_ps(_mm512_set1_ps(pl[0])), ex);
+                e = _mm512_fmadd_ps(_mm512_abs_ps(_mm512_set1_ps(pl[1])), ey, e);
+                e = _mm512_fmadd_ps(_mm512_abs_ps(_mm512_set1_ps(pl[2])), ez, e);
+
+                out |= _mm512_cmp_ps_mask(_mm512_add_ps(Internal::plane_distance16(pl, cx, cy, cz), e), _mm512_setzero_ps(), _CMP_LT_OQ);
+            }
+
+            r[i >> 5] |= (uint32_t)(~out & Internal::tail_mask(count)) << (i & 31);
+        }
+    }
+
+    // ==================== //
+    //   Quaternion array   //
+    // ==================== //
+
+    /// <summary>
+    /// Interpolates n pairs of unit quaternions spherically. Takes the shortest path. r may alias a or b. Sixteen quaternions are interpolated at once.
+    /// </summary>
+    /// <param name="r">Result (4 * n floats)</param>
+    /// <param name="a">Start rotations</param>
+    /// <param name="b">Destination rotations</param>
+    /// <param name="n">Number of quaternions</param>
+    /// <param name="t">Interpolation value between 0 and 1</param>
+    P_TARGET_AVX512 inline void quat_slerp_array(float* r, const float* a, const float* b, size_t n, float t)
+    {
+        float ct[FPU::QuatSlerpTerms];
+        float cd[FPU::QuatSlerpTerms];
+        FPU::quat_slerp_coefficients(ct, t);
+        FPU::quat_slerp_coefficients(cd, 1.0f - t);
+
+        const __m512 one = _mm512_set1_ps(1.0f);
+        const __m512 ts = _mm512_set1_ps(t);
+        const __m512 ds = _mm512_set1_ps(1.0f - t);
+
+        for (size_t i = 0; i < n; i += 16)
+        {
+            const size_t count = (n - i < 16) ? n - i : 16;
+
+            __m512 ax, ay, az, aw;
+            __m512 bx, by, bz, bw;
+            Internal::vec4x16_load_soa(a + i * 4, count, ax, ay, az, aw);
+            Internal::vec4x16_load_soa(b + i * 4, count, bx, by, bz, bw);
+
+            __m512 d = _mm512_fmadd_ps(aw, bw, _mm512_fmadd_ps(az, bz, _mm512_fmadd_ps(ay, by, _mm512_mul_ps(ax, bx))));
+            __m512 xm1 = _mm512_sub_ps(_mm512_abs_ps(d), one);
+
+            __m512 wt = one;
+            __m512 wd = one;
+            for (size_t k = FPU::QuatSlerpTerms; k-- > 0;)
+            {
+                wt = _mm512_fmadd_ps(_mm512_mul_ps(_mm512_set1_ps(ct[k]), xm1), wt, one);
+                wd = _mm512_fmadd_ps(_mm512_mul_ps(_mm512_set1_ps(cd[k]), xm1), wd, one);
+            }
+
+            // Negative dot products flip b, for the shortest path.
+            wt = _mm512_mul_ps(wt, ts);
+            wt = _mm512_mask_sub_ps(wt, _mm512_cmp_ps_mask(d, _mm512_setzero_ps(), _CMP_LT_OQ), _mm512_setzero_ps(), wt);
+            wd = _mm512_mul_ps(wd, ds);
+
+            Internal::vec4x16_store_aos(r + i * 4, count,
+                                        _mm512_fmadd_ps(bx, wt, _mm512_mul_ps(ax, wd)),
+                                        _mm512_fmadd_ps(by, wt, _mm512_mul_ps(ay, wd)),
+                                        _mm512_fmadd_ps(bz, wt, _mm512_mul_ps(az, wd)),
+                                        _mm512_fmadd_ps(bw, wt, _mm512_mul_ps(aw, wd)));
+        }
+    }
+
+    // ============ //
+    //   Skinning   //
+    // ============ //
+
+    // Sixteen vertices per iteration. Bone indices and the components of the bone dual quaternions are gathered, one register per component.
+
+    /// <summary>
+    /// Skins n vertices with blended dual quaternions (DLB). Positions and normals may be skinned in place. See FPU::dq_skin_array for the layout.
+    /// </summary>
+    /// <param name="rp">Skinned positions (planar, pitch floats per component)</param>
+    /// <param name="rn">Skinned normals, or nullptr</param>
+    /// <param name="p">Bind pose positions</param>
+    /// <param name="nrm">Bind pose normals, or nullptr</param>
+    /// <param name="bones">Bone indices (FPU::SkinInfluences per vertex)</param>
+    /// <param name="weights">Bone weights (FPU::SkinInfluences per vertex)</param>
+    /// <param name="dq">Unit dual quaternions of the bones (8 floats per bone)</param>
+    /// <param name="n">Number of vertices</param>
+    /// <param name="pitch">Distance between the x, y and z arrays in floats (at least n)</param>
+    P_TARGET_AVX512 inline void dq_skin_array(float* rp, float* rn, const float* p, const float* nrm, const uint32_t* bones, const float* weights, const float* dq, size_t n, size_t pitch)
+    {
+        static_assert(FPU::SkinInfluences == 4, "dq_skin_array: Weights are loaded as xyzw vectors.");
+
+        const __m512 zero = _mm512_setzero_ps();
+        const __m512 two = _mm512_set1_ps(2.0f);
+        const __m512i vertex = _mm512_setr_epi32(0, 4, 8, 12, 16, 20, 24, 28, 32, 36, 40, 44, 48, 52, 56, 60);
+
+        for (size_t i = 0; i < n; i += 16)
+        {
+            const size_t count = (n - i < 16) ? n - i : 16;
+            const __mmask16 m = Internal::tail_mask(count);
+
+            __m512 w[4];
+            Internal::vec4x16_load_soa(weights + i * 4, count, w[0], w[1], w[2], w[3]);
+
+            // The first bone is kept unweighted for the sign tests.
+            __m512 f[4];
+            __m512 q[8];
+
+            for (size_t k = 0; k < 4; ++k)
+            {
+                __m512i b = _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), m, vertex, bones + i * 4 + k, 4);
+                b = _mm512_slli_epi32(b, 3);
+
+                __m512 c[8];
+                for (size_t j = 0; j < 8; ++j)
+                {
+                    c[j] = _mm512_mask_i32gather_ps(zero, m, b, dq + j, 4);
+                }
+
+                __m512 wk = w[k];
+
+                if (k == 0)
+                {
+                    f[0] = c[0]; f[1] = c[1]; f[2] = c[2]; f[3] = c[3];
+
+                    for (size_t j = 0; j < 8; ++j)
+                    {
+                        q[j] = _mm512_mul_ps(c[j], wk);
+                    }
+                    continue;
+                }
+
+                // Negates the weight, where the real part is opposite to the first bone.
+                __m512 dot = _mm512_fmadd_ps(f[3], c[3], _mm512_fmadd_ps(f[2], c[2], _mm512_fmadd_ps(f[1], c[1], _mm512_mul_ps(f[0], c[0]))));
+                wk = _mm512_mask_sub_ps(wk, _mm512_cmp_ps_mask(dot, zero, _CMP_LT_OQ), zero, wk);
+
+                for (size_t j = 0; j < 8; ++j)
+                {
+                    q[j] = _mm512_fmadd_ps(c[j], wk, q[j]);
+                }
+            }
+
+            __m512 l = _mm512_fmadd_ps(q[3], q[3], _mm512_fmadd_ps(q[2], q[2], _mm512_fmadd_ps(q[1], q[1], _mm512_mul_ps(q[0], q[0]))));
+            __m512 invLength = _mm512_div_ps(_mm512_set1_ps(1.0f), _mm512_sqrt_ps(l));
+
+            for (size_t j = 0; j < 8; ++j)
+            {
+                q[j] = _mm512_mul_ps(q[j], invLength);
+            }
+
+            // Translation: 2 * (rw * dv - dw * rv + rv x dv)
+            __m512 tx = _mm512_mul_ps(two, _mm512_add_ps(_mm512_fmsub_ps(q[3], q[4], _mm512_mul_ps(q[7], q[0])), _mm512_fmsub_ps(q[1], q[6], _mm512_mul_ps(q[2], q[5]))));
+            __m512 ty = _mm512_mul_ps(two, _mm512_add_ps(_mm512_fmsub_ps(q[3], q[5], _mm512_mul_ps(q[7], q[1])), _mm512_fmsub_ps(q[2], q[4], _mm512_mul_ps(q[0], q[6]))));
+            __m512 tz = _mm512_mul_ps(two, _mm512_add_ps(_mm512_fmsub_ps(q[3], q[6], _mm512_mul_ps(q[7], q[2])), _mm512_fmsub_ps(q[0], q[5], _mm512_mul_ps(q[1], q[4]))));
+
+            // Rotation: v + 2 * rv x (rv x v + rw * v)
+            __m512 vx = _mm512_maskz_loadu_ps(m, p + i);
+            __m512 vy = _mm512_maskz_loadu_ps(m, p + pitch + i);
+            __m512 vz = _mm512_maskz_loadu_ps(m, p + 2 * pitch + i);
+
+            __m512 cx = _mm512_fmadd_ps(q[3], vx, _mm512_fmsub_ps(q[1], vz, _mm512_mul_ps(q[2], vy)));
+            __m512 cy = _mm512_fmadd_ps(q[3], vy, _mm512_fmsub_ps(q[2], vx, _mm512_mul_ps(q[0], vz)));
+            __m512 cz = _mm512_fmadd_ps(q[3], vz, _mm512_fmsub_ps(q[0], vy, _mm512_mul_ps(q[1], vx)));
+
+            _mm512_mask_storeu_ps(rp + i,             m, _mm512_add_ps(_mm512_fmadd_ps(two, _mm512_fmsub_ps(q[1], cz, _mm512_mul_ps(q[2], cy)), vx), tx));
+            _mm512_mask_storeu_ps(rp + pitch + i,     m, _mm512_add_ps(_mm512_fmadd_ps(two, _mm512_fmsub_ps(q[2], cx, _mm512_mul_ps(q[0], cz)), vy), ty));
+            _mm512_mask_storeu_ps(rp + 2 * pitch + i, m, _mm512_add_ps(_mm512_fmadd_ps(two, _mm512_fmsub_ps(q[0], cy, _mm512_mul_ps(q[1], cx)), vz), tz));
+
+            if (nrm != nullptr)
+            {
+                vx = _mm512_maskz_loadu_ps(m, nrm + i);
+                vy = _mm512_maskz_loadu_ps(m, nrm + pitch + i);
+                vz = _mm512_maskz_loadu_ps(m, nrm + 2 * pitch + i);
+
+                cx = _mm512_fmadd_ps(q[3], vx, _mm512_fmsub_ps(q[1], vz, _mm512_mul_ps(q[2], vy)));
+                cy = _mm512_fmadd_ps(q[3], vy, _mm512_fmsub_ps(q[2], vx, _mm512_mul_ps(q[0], vz)));
+                cz = _mm512_fmadd_ps(q[3], vz, _mm512_fmsub_ps(q[0], vy, _mm512_mul_ps(q[1], vx)));
+
+                _mm512_mask_storeu_ps(rn + i,             m, _mm512_fmadd_ps(two, _mm512_fmsub_ps(q[1], cz, _mm512_mul_ps(q[2], cy)), vx));
+                _mm512_mask_storeu_ps(rn + pitch + i,     m, _mm512_fmadd_ps(two, _mm512_fmsub_ps(q[2], cx, _mm512_mul_ps(q[0], cz)), vy));
+                _mm512_mask_storeu_ps(rn + 2 * pitch + i, m, _mm512_fmadd_ps(two, _mm512_fmsub_ps(q[0], cy, _mm512_mul_ps(q[1], cx)), vz));
+            }
+        }
+    }
+
+    namespace Internal
+    {
+        // Sixteen vertices per iteration, like FMA::Internal::lbs_skin_array. Remaining vertices are masked.
+        template<size_t CS>
+        P_TARGET_AVX512 inline void lbs_skin_array(float* rp, float* rn, const float* p, const float* nrm, const uint32_t* bones, const float* weights, const float* m, size_t n, size_t pitch)
+        {
+            static_assert(FPU::SkinInfluences == 4, "lbs_skin_array: Weights are loaded as xyzw vectors.");
+
+            const __m512 zero = _mm512_setzero_ps();
+            const __m512 one = _mm512_set1_ps(1.0f);
+            const __m512i matrixStride = _mm512_set1_epi32((int)(CS * 4));
+
+            for (size_t i = 0; i < n; i += 16)
+            {
+                const size_t count = (n - i < 16) ? n - i : 16;
+                const __mmask16 mask = tail_mask(count);
+
+                __m512 w[4];
+                __m512 b[4];
+                vec4x16_load_soa(weights + i * 4, count, w[0], w[1], w[2], w[3]);
+                vec4x16_load_soa(reinterpret_cast<const float*>(bones + i * 4), count, b[0], b[1], b[2], b[3]);
+
+                // Blended matrix without the last row, a[c * 3 + r] = m(r, c).
+                __m512 a[12];
+                for (size_t e = 0; e < 12; ++e)
+                {
+                    a[e] = zero;
+                }
+
+                for (size_t k = 0; k < 4; ++k)
+                {
+                    const __m512i base = _mm512_mullo_epi32(_mm512_castps_si512(b[k]), matrixStride);
+
+                    for (size_t c = 0; c < 4; ++c)
+                    {
+                        a[c * 3]     = _mm512_fmadd_ps(_mm512_mask_i32gather_ps(zero, mask, base, m + c * CS,     4), w[k], a[c * 3]);
+                        a[c * 3 + 1] = _mm512_fmadd_ps(_mm512_mask_i32gather_ps(zero, mask, base, m + c * CS + 1, 4), w[k], a[c * 3 + 1]);
+                        a[c * 3 + 2] = _mm512_fmadd_ps(_mm512_mask_i32gather_ps(zero, mask, base, m + c * CS + 2, 4), w[k], a[c * 3 + 2]);
+                    }
+                }
+
+                __m512 vx = _mm512_maskz_loadu_ps(mask, p + i);
+                __m512 vy = _mm512_maskz_loadu_ps(mask, p + pitch + i);
+                __m512 vz = _mm512_maskz_loadu_ps(mask, p + 2 * pitch + i);
+
+                _mm512_mask_storeu_ps(rp + i,             mask, _mm512_fmadd_ps(a[0], vx, _mm512_fmadd_ps(a[3], vy, _mm512_fmadd_ps(a[6], vz, a[9]))));
+                _mm512_mask_storeu_ps(rp + pitch + i,     mask, _mm512_fmadd_ps(a[1], vx, _mm512_fmadd_ps(a[4], vy, _mm512_fmadd_ps(a[7], vz, a[10]))));
+                _mm512_mask_storeu_ps(rp + 2 * pitch + i, mask, _mm512_fmadd_ps(a[2], vx, _mm512_fmadd_ps(a[5], vy, _mm512_fmadd_ps(a[8], vz, a[11]))));
+
+                if (nrm != nullptr)
+                {
+                    vx = _mm512_maskz_loadu_ps(mask, nrm + i);
+                    vy = _mm512_maskz_loadu_ps(mask, nrm + pitch + i);
+                    vz = _mm512_maskz_loadu_ps(mask, nrm + 2 * pitch + i);
+
+                    __m512 x = _mm512_fmadd_ps(a[0], vx, _mm512_fmadd_ps(a[3], vy, _mm512_mul_ps(a[6], vz)));
+                    __m512 y = _mm512_fmadd_ps(a[1], vx, _mm512_fmadd_ps(a[4], vy, _mm512_mul_ps(a[7], vz)));
+                    __m512 z = _mm512_fmadd_ps(a[2], vx, _mm512_fmadd_ps(a[5], vy, _mm512_mul_ps(a[8], vz)));
+
+                    __m512 l = _mm512_fmadd_ps(x, x, _mm512_fmadd_ps(y, y, _mm512_mul_ps(z, z)));
+                    __m512 s = _mm512_mask_div_ps(one, _mm512_cmp_ps_mask(l, zero, _CMP_GT_OQ), one, _mm512_sqrt_ps(l));
+
+                    _mm512_mask_storeu_ps(rn + i,             mask, _mm512_mul_ps(x, s));
+                    _mm512_mask_storeu_ps(rn + pitch + i,     mask, _mm512_mul_ps(y, s));
+                    _mm512_mask_storeu_ps(rn + 2 * pitch + i, mask, _mm512_mul_ps(z, s));
+                }
+            }
+        }
+    }
+
+    /// <summary>
+    /// Skins n vertices with linearly blended bone matrices. Positions and normals may be skinned in place. See FPU::lbs_skin_array for the layout.
+    /// </summary>
+    /// <param name="rp">Skinned positions (planar, pitch floats per component)</param>
+    /// <param name="rn">Skinned normals, or nullptr</param>
+    /// <param name="p">Bind pose positions</param>
+    /// <param name="nrm">Bind pose normals, or nullptr</param>
+    /// <param name="bones">Bone indices (FPU::SkinInfluences per vertex)</param>
+    /// <param name="weights">Bone weights (FPU::SkinInfluences per vertex)</param>
+    /// <param name="m">Bone matrices (4 * columnStride floats per bone)</param>
+    /// <param name="columnStride">Floats per matrix column (3 or 4)</param>
+    /// <param name="n">Number of vertices</param>
+    /// <param name="pitch">Distance between the x, y and z arrays in floats (at least n)</param>
+    P_TARGET_AVX512 inline void lbs_skin_array(float* rp, float* rn, const float* p, const float* nrm, const uint32_t* bones, const float* weights, const float* m, size_t columnStride, size_t n, size_t pitch)
+    {
+        if (columnStride == 4)
+        {
+            Internal::lbs_skin_array<4>(rp, rn, p, nrm, bones, weights, m, n, pitch);
+        }
+        else
+        {
+            Internal::lbs_skin_array<3>(rp, rn, p, nrm, bones, weights, m, n, pitch);
+        }
+    }
+}
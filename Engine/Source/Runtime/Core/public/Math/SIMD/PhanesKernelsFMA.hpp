@@ -0,0 +1,611 @@
+#pragma once
+
+// FMA3 kernels on raw memory. Multiply-add chains of the SSE / AVX kernels are fused, which saves an instruction and a rounding step each.
+//
+// Matrices are 16 floats in column-major order. Requires AVX2 and FMA3.
+
+#include <cstddef>
+#include <cstdint>
+#include <immintrin.h>
+
+#include "Core/public/Math/SIMD/Platform.h"
+#include "Core/public/Math/SIMD/PhanesKernelsSSE.hpp"
+#include "Core/public/Math/SIMD/PhanesKernelsAVX.hpp"
+
+
+namespace Phanes::Core::Math::SIMD::FMA
+{
+    namespace Internal
+    {
+        // Computes one block of 2x2 sub-determinants used by the cofactor expansion.
+        // From: GLM: https://github.com/g-truc/glm/blob/master/glm/simd/matrix.h (MIT License)
+        template<int P, int Q>
+        P_TARGET_FMA inline __m128 mat4_sub_factor(__m128 c1, __m128 c2, __m128 c3)
+        {
+            __m128 Swp0a = _mm_shuffle_ps(c3, c2, _MM_SHUFFLE(P, P, P, P));
+            __m128 Swp0b = _mm_shuffle_ps(c3, c2, _MM_SHUFFLE(Q, Q, Q, Q));
+
+            __m128 Swp00 = _mm_shuffle_ps(c2, c1, _MM_SHUFFLE(Q, Q, Q, Q));
+            __m128 Swp01 = _mm_shuffle_ps(Swp0a, Swp0a, _MM_SHUFFLE(2, 0, 0, 0));
+            __m128 Swp02 = _mm_shuffle_ps(Swp0b, Swp0b, _MM_SHUFFLE(2, 0, 0, 0));
+            __m128 Swp03 = _mm_shuffle_ps(c2, c1, _MM_SHUFFLE(P, P, P, P));
+
+            return _mm_fmsub_ps(Swp00, Swp01, _mm_mul_ps(Swp02, Swp03));
+        }
+
+        // Computes the adjugate of the matrix stored in c. Returns the determinant in all lanes.
+        // Same expansion as SSE::Internal::mat4_adjugate.
+        P_TARGET_FMA inline __m128 mat4_adjugate(const __m128 c[4], __m128 inv[4])
+        {
+            __m128 Fac0 = mat4_sub_factor<3, 2>(c[1], c[2], c[3]);
+            __m128 Fac1 = mat4_sub_factor<3, 1>(c[1], c[2], c[3]);
+            __m128 Fac2 = mat4_sub_factor<2, 1>(c[1], c[2], c[3]);
+            __m128 Fac3 = mat4_sub_factor<3, 0>(c[1], c[2], c[3]);
+            __m128 Fac4 = mat4_sub_factor<2, 0>(c[1], c[2], c[3]);
+            __m128 Fac5 = mat4_sub_factor<1, 0>(c[1], c[2], c[3]);
+
+            __m128 SignA = _mm_set_ps(1.0f, -1.0f, 1.0f, -1.0f);
+            __m128 SignB = _mm_set_ps(-1.0f, 1.0f, -1.0f, 1.0f);
+
+            __m128 Temp0 = _mm_shuffle_ps(c[1], c[0], _MM_SHUFFLE(0, 0, 0, 0));
+            __m128 Vec0 = _mm_shuffle_ps(Temp0, Temp0, _MM_SHUFFLE(2, 2, 2, 0));
+
+            __m128 Temp1 = _mm_shuffle_ps(c[1], c[0], _MM_SHUFFLE(1, 1, 1, 1));
+            __m128 Vec1 = _mm_shuffle_ps(Temp1, Temp1, _MM_SHUFFLE(2, 2, 2, 0));
+
+            __m128 Temp2 = _mm_shuffle_ps(c[1], c[0], _MM_SHUFFLE(2, 2, 2, 2));
+            __m128 Vec2 = _mm_shuffle_ps(Temp2, Temp2, _MM_SHUFFLE(2, 2, 2, 0));
+
+            __m128 Temp3 = _mm_shuffle_ps(c[1], c[0], _MM_SHUFFLE(3, 3, 3, 3));
+            __m128 Vec3 = _mm_shuffle_ps(Temp3, Temp3, _MM_SHUFFLE(2, 2, 2, 0));
+
+            // col0 = +(Vec1 * Fac0 - Vec2 * Fac1 + Vec3 * Fac2)
+            inv[0] = _mm_mul_ps(SignB, _mm_fmadd_ps(Vec3, Fac2, _mm_fnmadd_ps(Vec2, Fac1, _mm_mul_ps(Vec1, Fac0))));
+
+            // col1 = -(Vec0 * Fac0 - Vec2 * Fac3 + Vec3 * Fac4)
+            inv[1] = _mm_mul_ps(SignA, _mm_fmadd_ps(Vec3, Fac4, _mm_fnmadd_ps(Vec2, Fac3, _mm_mul_ps(Vec0, Fac0))));
+
+            // col2 = +(Vec0 * Fac1 - Vec1 * Fac3 + Vec3 * Fac5)
+            inv[2] = _mm_mul_ps(SignB, _mm_fmadd_ps(Vec3, Fac5, _mm_fnmadd_ps(Vec1, Fac3, _mm_mul_ps(Vec0, Fac1))));
+
+            // col3 = -(Vec0 * Fac2 - Vec1 * Fac4 + Vec2 * Fac5)
+            inv[3] = _mm_mul_ps(SignA, _mm_fmadd_ps(Vec2, Fac5, _mm_fnmadd_ps(Vec1, Fac4, _mm_mul_ps(Vec0, Fac2))));
+
+            __m128 Row0 = _mm_shuffle_ps(inv[0], inv[1], _MM_SHUFFLE(0, 0, 0, 0));
+            __m128 Row1 = _mm_shuffle_ps(inv[2], inv[3], _MM_SHUFFLE(0, 0, 0, 0));
+            __m128 Row2 = _mm_shuffle_ps(Row0, Row1, _MM_SHUFFLE(2, 0, 2, 0));
+
+            return _mm_dp_ps(c[0], Row2, 0xFF);
+        }
+
+        /// <summary>
+        /// Multiplies the matrix, with its columns duplicated into both lanes, with two columns (one per lane).
+        /// </summary>
+        /// <param name="a0">Column 0 in both lanes</param>
+        /// <param name="a1">Column 1 in both lanes</param>
+        /// <param name="a2">Column 2 in both lanes</param>
+        /// <param name="a3">Column 3 in both lanes</param>
+        /// <param name="b">Two columns</param>
+        /// <returns>Two product columns</returns>
+        P_TARGET_FMA inline __m256 mat4_mul_col2(__m256 a0, __m256 a1, __m256 a2, __m256 a3, __m256 b)
+        {
+            __m256 s01 = _mm256_fmadd_ps(a1, _mm256_permute_ps(b, _MM_SHUFFLE(1, 1, 1, 1)), _mm256_mul_ps(a0, _mm256_permute_ps(b, _MM_SHUFFLE(0, 0, 0, 0))));
+            __m256 s23 = _mm256_fmadd_ps(a3, _mm256_permute_ps(b, _MM_SHUFFLE(3, 3, 3, 3)), _mm256_mul_ps(a2, _mm256_permute_ps(b, _MM_SHUFFLE(2, 2, 2, 2))));
+
+            return _mm256_add_ps(s01, s23);
+        }
+
+        // Transforms one vector with the matrix columns c0 - c3.
+        template<SSE::Internal::ETransformMode M>
+        P_TARGET_FMA inline __m128 mat4_transform(__m128 c0, __m128 c1, __m128 c2, __m128 c3, __m128 v)
+        {
+            __m128 s = _mm_fmadd_ps(c1, _mm_permute_ps(v, _MM_SHUFFLE(1, 1, 1, 1)), _mm_mul_ps(c0, _mm_permute_ps(v, _MM_SHUFFLE(0, 0, 0, 0))));
+
+            if constexpr (M == SSE::Internal::ETransformMode::Vector)
+            {
+                return _mm_add_ps(s, _mm_fmadd_ps(c3, _mm_permute_ps(v, _MM_SHUFFLE(3, 3, 3, 3)), _mm_mul_ps(c2, _mm_permute_ps(v, _MM_SHUFFLE(2, 2, 2, 2)))));
+            }
+            else if constexpr (M == SSE::Internal::ETransformMode::Point)
+            {
+                return _mm_add_ps(s, _mm_fmadd_ps(c2, _mm_permute_ps(v, _MM_SHUFFLE(2, 2, 2, 2)), c3));
+            }
+            else
+            {
+                return _mm_fmadd_ps(c2, _mm_permute_ps(v, _MM_SHUFFLE(2, 2, 2, 2)), s);
+            }
+        }
+
+        // Transforms two vectors (one per lane) with the matrix columns c0 - c3, duplicated into both lanes.
+        template<SSE::Internal::ETransformMode M>
+        P_TARGET_FMA inline __m256 mat4_transform2(__m256 c0, __m256 c1, __m256 c2, __m256 c3, __m256 v)
+        {
+            __m256 s = _mm256_fmadd_ps(c1, _mm256_permute_ps(v, _MM_SHUFFLE(1, 1, 1, 1)), _mm256_mul_ps(c0, _mm256_permute_ps(v, _MM_SHUFFLE(0, 0, 0, 0))));
+
+            if constexpr (M == SSE::Internal::ETransformMode::Vector)
+            {
+                return _mm256_add_ps(s, _mm256_fmadd_ps(c3, _mm256_permute_ps(v, _MM_SHUFFLE(3, 3, 3, 3)), _mm256_mul_ps(c2, _mm256_permute_ps(v, _MM_SHUFFLE(2, 2, 2, 2)))));
+            }
+            else if constexpr (M == SSE::Internal::ETransformMode::Point)
+            {
+                return _mm256_add_ps(s, _mm256_fmadd_ps(c2, _mm256_permute_ps(v, _MM_SHUFFLE(2, 2, 2, 2)), c3));
+            }
+            else
+            {
+                return _mm256_fmadd_ps(c2, _mm256_permute_ps(v, _MM_SHUFFLE(2, 2, 2, 2)), s);
+            }
+        }
+
+        // Same structure as AVX::Internal::mat4_transform_array.
+        template<SSE::Internal::ETransformMode M>
+        P_TARGET_FMA inline void mat4_transform_array(float* r, const float* m, const float* v, size_t n, bool stream)
+        {
+            stream = stream && (reinterpret_cast<uintptr_t>(r) & 15) == 0;
+
+            const __m256 c0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(m));
+            const __m256 c1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(m + 4));
+            const __m256 c2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(m + 8));
+            const __m256 c3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(m + 12));
+
+            size_t i = 0;
+
+            // Non-temporal ymm stores need 32 byte aligned memory, one vector is peeled off otherwise.
+            if (stream && (reinterpret_cast<uintptr_t>(r) & 31) != 0 && n > 0)
+            {
+                __m128 t = mat4_transform<M>(_mm256_castps256_ps128(c0), _mm256_castps256_ps128(c1), _mm256_castps256_ps128(c2), _mm256_castps256_ps128(c3), _mm_loadu_ps(v));
+                _mm_stream_ps(r, t);
+                i = 1;
+            }
+
+            // Four vectors fill one cache line.
+            for (; i + 4 <= n; i += 4)
+            {
+                _mm_prefetch(reinterpret_cast<const char*>(v + i * 4 + SSE::Internal::TransformPrefetchDistance), _MM_HINT_T0);
+
+                __m256 t0 = mat4_transform2<M>(c0, c1, c2, c3, _mm256_loadu_ps(v + i * 4));
+                __m256 t1 = mat4_transform2<M>(c0, c1, c2, c3, _mm256_loadu_ps(v + i * 4 + 8));
+
+                if (stream)
+                {
+                    _mm256_stream_ps(r + i * 4,     t0);
+                    _mm256_stream_ps(r + i * 4 + 8, t1);
+                }
+                else
+                {
+                    _mm256_storeu_ps(r + i * 4,     t0);
+                    _mm256_storeu_ps(r + i * 4 + 8, t1);
+                }
+            }
+
+            for (; i < n; ++i)
+            {
+                __m128 t = mat4_transform<M>(_mm256_castps256_ps128(c0), _mm256_castps256_ps128(c1), _mm256_castps256_ps128(c2), _mm256_castps256_ps128(c3), _mm_loadu_ps(v + i * 4));
+
+                if (stream)
+                {
+                    _mm_stream_ps(r + i * 4, t);
+                }
+                else
+                {
+                    _mm_storeu_ps(r + i * 4, t);
+                }
+            }
+
+            if (stream)
+            {
+                _mm_sfence();
+            }
+        }
+    }
+
+
+    // =========== //
+    //   Matrix4   //
+    // =========== //
+
+    /// <summary>
+    /// Gets the determinant of a 4x4 matrix.
+    /// </summary>
+    /// <param name="m">Matrix</param>
+    /// <returns>Determinant</returns>
+    P_TARGET_FMA inline float mat4_det(const float* m)
+    {
+        __m128 c[4] = { _mm_loadu_ps(m), _mm_loadu_ps(m + 4), _mm_loadu_ps(m + 8), _mm_loadu_ps(m + 12) };
+        __m128 inv[4];
+
+        return _mm_cvtss_f32(Internal::mat4_adjugate(c, inv));
+    }
+
+    /// <summary>
+    /// Inverts a 4x4 matrix. r may alias m.
+    /// </summary>
+    /// <param name="r">Inverted matrix</param>
+    /// <param name="m">Matrix</param>
+    /// <returns>False, if the matrix is singular. r is left untouched.</returns>
+    P_TARGET_FMA inline bool mat4_inv(float* r, const float* m)
+    {
+        __m128 c[4] = { _mm_loadu_ps(m), _mm_loadu_ps(m + 4), _mm_loadu_ps(m + 8), _mm_loadu_ps(m + 12) };
+        __m128 inv[4];
+
+        __m128 Det0 = Internal::mat4_adjugate(c, inv);
+
+        if (_mm_cvtss_f32(Det0) == 0.0f)
+        {
+            return false;
+        }
+
+        __m128 Rcp0 = _mm_div_ps(_mm_set1_ps(1.0f), Det0);
+
+        _mm_storeu_ps(r,      _mm_mul_ps(inv[0], Rcp0));
+        _mm_storeu_ps(r + 4,  _mm_mul_ps(inv[1], Rcp0));
+        _mm_storeu_ps(r + 8,  _mm_mul_ps(inv[2], Rcp0));
+        _mm_storeu_ps(r + 12, _mm_mul_ps(inv[3], Rcp0));
+
+        return true;
+    }
+
+    /// <summary>
+    /// Multiplies two 4x4 matrices (a * b). Two columns of the product are computed per ymm register. r may alias a or b.
+    /// </summary>
+    /// <param name="r">Product</param>
+    /// <param name="a">Matrix one</param>
+    /// <param name="b">Matrix two</param>
+    P_TARGET_FMA inline void mat4_mul(float* r, const float* a, const float* b)
+    {
+        __m256 a0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(a));
+        __m256 a1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(a + 4));
+        __m256 a2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(a + 8));
+        __m256 a3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(a + 12));
+
+        __m256 c01 = Internal::mat4_mul_col2(a0, a1, a2, a3, _mm256_loadu_ps(b));
+        __m256 c23 = Internal::mat4_mul_col2(a0, a1, a2, a3, _mm256_loadu_ps(b + 8));
+
+        _mm256_storeu_ps(r,     c01);
+        _mm256_storeu_ps(r + 8, c23);
+    }
+
+    /// <summary>
+    /// Transforms a vector with a 4x4 matrix (m * v). r may alias v.
+    /// </summary>
+    /// <param name="r">Transformed vector</param>
+    /// <param name="m">Matrix</param>
+    /// <param name="v">Vector</param>
+    P_TARGET_FMA inline void mat4_mul_vec(float* r, const float* m, const float* v)
+    {
+        __m128 vc = _mm_loadu_ps(v);
+
+        __m128 s01 = _mm_fmadd_ps(_mm_loadu_ps(m + 4),  _mm_permute_ps(vc, _MM_SHUFFLE(1, 1, 1, 1)), _mm_mul_ps(_mm_loadu_ps(m), _mm_permute_ps(vc, _MM_SHUFFLE(0, 0, 0, 0))));
+        __m128 s23 = _mm_fmadd_ps(_mm_loadu_ps(m + 12), _mm_permute_ps(vc, _MM_SHUFFLE(3, 3, 3, 3)), _mm_mul_ps(_mm_loadu_ps(m + 8), _mm_permute_ps(vc, _MM_SHUFFLE(2, 2, 2, 2))));
+
+        _mm_storeu_ps(r, _mm_add_ps(s01, s23));
+    }
+
+    /// <summary>
+    /// Multiplies n pairs of 4x4 matrices (a[i] * b[i]). Two products are computed at once, with one matrix per lane.
+    /// </summary>
+    /// <param name="r">Products (16 * n floats)</param>
+    /// <param name="a">Matrices one</param>
+    /// <param name="b">Matrices two</param>
+    /// <param name="n">Number of matrices</param>
+    P_TARGET_FMA inline void mat4_mul_array(float* r, const float* a, const float* b, size_t n)
+    {
+        size_t i = 0;
+
+        for (; i + 2 <= n; i += 2)
+        {
+            const float* a_0 = a + i * 16;
+            const float* a_1 = a_0 + 16;
+            const float* b_0 = b + i * 16;
+            const float* b_1 = b_0 + 16;
+
+            // Lane 0 holds matrix i, lane 1 matrix i + 1.
+            __m256 a0 = _mm256_loadu2_m128(a_1,      a_0);
+            __m256 a1 = _mm256_loadu2_m128(a_1 + 4,  a_0 + 4);
+            __m256 a2 = _mm256_loadu2_m128(a_1 + 8,  a_0 + 8);
+            __m256 a3 = _mm256_loadu2_m128(a_1 + 12, a_0 + 12);
+
+            float* r_0 = r + i * 16;
+            float* r_1 = r_0 + 16;
+
+            for (int c = 0; c < 4; ++c)
+            {
+                __m256 p = Internal::mat4_mul_col2(a0, a1, a2, a3, _mm256_loadu2_m128(b_1 + c * 4, b_0 + c * 4));
+                _mm256_storeu2_m128(r_1 + c * 4, r_0 + c * 4, p);
+            }
+        }
+
+        if (i < n)
+        {
+            mat4_mul(r + i * 16, a + i * 16, b + i * 16);
+        }
+    }
+
+    /// <summary>
+    /// Transforms n vectors with a 4x4 matrix (m * v[i]). r may alias v.
+    /// </summary>
+    /// <param name="r">Transformed vectors (4 * n floats)</param>
+    /// <param name="m">Matrix</param>
+    /// <param name="v">Vectors</param>
+    /// <param name="n">Number of vectors</param>
+    /// <param name="stream">Write r with non-temporal stores, if r is 16 byte aligned</param>
+    P_TARGET_FMA inline void mat4_transform_array(float* r, const float* m, const float* v, size_t n, bool stream)
+    {
+        Internal::mat4_transform_array<SSE::Internal::ETransformMode::Vector>(r, m, v, n, stream);
+    }
+
+    /// <summary>
+    /// Transforms n points with a 4x4 matrix (m * (x, y, z, 1)). w of the input is ignored. r may alias v.
+    /// </summary>
+    /// <param name="r">Transformed points (4 * n floats)</param>
+    /// <param name="m">Matrix</param>
+    /// <param name="v">Points</param>
+    /// <param name="n">Number of points</param>
+    /// <param name="stream">Write r with non-temporal stores, if r is 16 byte aligned</param>
+    P_TARGET_FMA inline void mat4_transform_point_array(float* r, const float* m, const float* v, size_t n, bool stream)
+    {
+        Internal::mat4_transform_array<SSE::Internal::ETransformMode::Point>(r, m, v, n, stream);
+    }
+
+    /// <summary>
+    /// Transforms n directions with a 4x4 matrix (m * (x, y, z, 0)). w of the input is ignored. r may alias v.
+    /// </summary>
+    /// <param name="r">Transformed directions (4 * n floats)</param>
+    /// <param name="m">Matrix</param>
+    /// <param name="v">Directions</param>
+    /// <param name="n">Number of directions</param>
+    /// <param name="stream">Write r with non-temporal stores, if r is 16 byte aligned</param>
+    P_TARGET_FMA inline void mat4_transform_dir_array(float* r, const float* m, const float* v, size_t n, bool stream)
+    {
+        Internal::mat4_transform_array<SSE::Internal::ETransformMode::Direction>(r, m, v, n, stream);
+    }
+
+    // ============ //
+    //   Skinning   //
+    // ============ //
+
+    namespace Internal
+    {
+        // Eight vertices per iteration. Weights and bone indices are transposed from the interleaved arrays, the matrix elements are gathered.
+        template<size_t CS>
+        P_TARGET_FMA inline void lbs_skin_array(float* rp, float* rn, const float* p, const float* nrm, const uint32_t* bones, const float* weights, const float* m, size_t n, size_t pitch)
+        {
+            static_assert(FPU::SkinInfluences == 4, "lbs_skin_array: Weights are loaded as xyzw vectors.");
+
+            const __m256 zero = _mm256_setzero_ps();
+            const __m256 one = _mm256_set1_ps(1.0f);
+            const __m256i matrixStride = _mm256_set1_epi32((int)(CS * 4));
+
+            size_t i = 0;
+
+            for (; i + 8 <= n; i += 8)
+            {
+                __m256 w[4];
+                __m256 b[4];
+                AVX::Internal::vec4x8_load_soa(weights + i * 4, w[0], w[1], w[2], w[3]);
+                AVX::Internal::vec4x8_load_soa(reinterpret_cast<const float*>(bones + i * 4), b[0], b[1], b[2], b[3]);
+
+                // Blended matrix without the last row, a[c * 3 + r] = m(r, c).
+                __m256 a[12];
+                for (size_t e = 0; e < 12; ++e)
+                {
+                    a[e] = zero;
+                }
+
+                for (size_t k = 0; k < 4; ++k)
+                {
+                    const __m256i base = _mm256_mullo_epi32(_mm256_castps_si256(b[k]), matrixStride);
+
+                    for (size_t c = 0; c < 4; ++c)
+                    {
+                        a[c * 3]     = _mm256_fmadd_ps(_mm256_i32gather_ps(m + c * CS,     base, 4), w[k], a[c * 3]);
+                        a[c * 3 + 1] = _mm256_fmadd_ps(_mm256_i32gather_ps(m + c * CS + 1, base, 4), w[k], a[c * 3 + 1]);
+                        a[c * 3 + 2] = _mm256_fmadd_ps(_mm256_i32gather_ps(m + c * CS + 2, base, 4), w[k], a[c * 3 + 2]);
+                    }
+                }
+
+                __m256 vx = _mm256_loadu_ps(p + i);
+                __m256 vy = _mm256_loadu_ps(p + pitch + i);
+                __m256 vz = _mm256_loadu_ps(p + 2 * pitch + i);
+
+                _mm256_storeu_ps(rp + i,             _mm256_fmadd_ps(a[0], vx, _mm256_fmadd_ps(a[3], vy, _mm256_fmadd_ps(a[6], vz, a[9]))));
+                _mm256_storeu_ps(rp + pitch + i,     _mm256_fmadd_ps(a[1], vx, _mm256_fmadd_ps(a[4], vy, _mm256_fmadd_ps(a[7], vz, a[10]))));
+                _mm256_storeu_ps(rp + 2 * pitch + i, _mm256_fmadd_ps(a[2], vx, _mm256_fmadd_ps(a[5], vy, _mm256_fmadd_ps(a[8], vz, a[11]))));
+
+                if (nrm != nullptr)
+                {
+                    vx = _mm256_loadu_ps(nrm + i);
+                    vy = _mm256_loadu_ps(nrm + pitch + i);
+                    vz = _mm256_loadu_ps(nrm + 2 * pitch + i);
+
+                    __m256 x = _mm256_fmadd_ps(a[0], vx, _mm256_fmadd_ps(a[3], vy, _mm256_mul_ps(a[6], vz)));
+                    __m256 y = _mm256_fmadd_ps(a[1], vx, _mm256_fmadd_ps(a[4], vy, _mm256_mul_ps(a[7], vz)));
+                    __m256 z = _mm256_fmadd_ps(a[2], vx, _mm256_fmadd_ps(a[5], vy, _mm256_mul_ps(a[8], vz)));
+
+                    __m256 l = _mm256_fmadd_ps(x, x, _mm256_fmadd_ps(y, y, _mm256_mul_ps(z, z)));
+                    __m256 s = _mm256_blendv_ps(one, _mm256_div_ps(one, _mm256_sqrt_ps(l)), _mm256_cmp_ps(l, zero, _CMP_GT_OQ));
+
+                    _mm256_storeu_ps(rn + i,             _mm256_mul_ps(x, s));
+                    _mm256_storeu_ps(rn + pitch + i,     _mm256_mul_ps(y, s));
+                    _mm256_storeu_ps(rn + 2 * pitch + i, _mm256_mul_ps(z, s));
+                }
+            }
+
+            if (i < n)
+            {
+                SSE::Internal::lbs_skin_array<CS>(rp + i, (rn != nullptr) ? rn + i : nullptr, p + i, (nrm != nullptr) ? nrm + i : nullptr, bones + i * 4, weights + i * 4, m, n - i, pitch);
+            }
+        }
+    }
+
+    /// <summary>
+    /// Skins n vertices with linearly blended bone matrices. Positions and normals may be skinned in place. See FPU::lbs_skin_array for the layout.
+    /// </summary>
+    /// <param name="rp">Skinned positions (planar, pitch floats per component)</param>
+    /// <param name="rn">Skinned normals, or nullptr</param>
+    /// <param name="p">Bind pose positions</param>
+    /// <param name="nrm">Bind pose normals, or nullptr</param>
+    /// <param name="bones">Bone indices (FPU::SkinInfluences per vertex)</param>
+    /// <param name="weights">Bone weights (FPU::SkinInfluences per vertex)</param>
+    /// <param name="m">Bone matrices (4 * columnStride floats per bone)</param>
+    /// <param name="columnStride">Floats per matrix column (3 or 4)</param>
+    /// <param name="n">Number of vertices</param>
+    /// <param name="pitch">Distance between the x, y and z arrays in floats (at least n)</param>
+    P_TARGET_FMA inline void lbs_skin_array(float* rp, float* rn, const float* p, const float* nrm, const uint32_t* bones, const float* weights, const float* m, size_t columnStride, size_t n, size_t pitch)
+    {
+        if (columnStride == 4)
+        {
+            Internal::lbs_skin_array<4>(rp, rn, p, nrm, bones, weights, m, n, pitch);
+        }
+        else
+        {
+            Internal::lbs_skin_array<3>(rp, rn, p, nrm, bones, weights, m, n, pitch);
+        }
+    }
+
+    // =================== //
+    //   Vector3 packing   //
+    // =================== //
+
+    // Eight vectors per iteration, the integer packing needs AVX2. Quantization stays with the SSE kernels, which are bound by memory.
+
+    /// <summary>
+    /// Encodes n unit vectors as 2x16 bit octahedral coordinates. See FPU::vec3_encode_oct_array.
+    /// </summary>
+    /// <param name="r">Encoded vectors</param>
+    /// <param name="v">Unit vectors (4 * n floats)</param>
+    /// <param name="n">Number of vectors</param>
+    P_TARGET_FMA inline void vec3_encode_oct_array(uint32_t* r, const float* v, size_t n)
+    {
+        const __m256 signMask = _mm256_set1_ps(-0.0f);
+        const __m256 zero = _mm256_setzero_ps();
+        const __m256 one = _mm256_set1_ps(1.0f);
+        const __m256 minusOne = _mm256_set1_ps(-1.0f);
+        const __m256 snormScale = _mm256_set1_ps(32767.0f);
+        const __m256i lowMask = _mm256_set1_epi32(0xFFFF);
+
+        size_t i = 0;
+
+        for (; i + 8 <= n; i += 8)
+        {
+            __m256 x, y, z, w;
+            AVX::Internal::vec4x8_load_soa(v + i * 4, x, y, z, w);
+
+            const __m256 l1 = _mm256_add_ps(_mm256_add_ps(_mm256_andnot_ps(signMask, x), _mm256_andnot_ps(signMask, y)), _mm256_andnot_ps(signMask, z));
+            const __m256 s = _mm256_and_ps(_mm256_div_ps(one, l1), _mm256_cmp_ps(l1, zero, _CMP_GT_OQ));
+
+            __m256 px = _mm256_mul_ps(x, s);
+            __m256 py = _mm256_mul_ps(y, s);
+
+            const __m256 fx = _mm256_mul_ps(_mm256_sub_ps(one, _mm256_andnot_ps(signMask, py)), _mm256_or_ps(one, _mm256_and_ps(px, signMask)));
+            const __m256 fy = _mm256_mul_ps(_mm256_sub_ps(one, _mm256_andnot_ps(signMask, px)), _mm256_or_ps(one, _mm256_and_ps(py, signMask)));
+
+            const __m256 lower = _mm256_cmp_ps(z, zero, _CMP_LT_OQ);
+            px = _mm256_blendv_ps(px, fx, lower);
+            py = _mm256_blendv_ps(py, fy, lower);
+
+            const __m256i qx = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_min_ps(_mm256_max_ps(px, minusOne), one), snormScale));
+            const __m256i qy = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_min_ps(_mm256_max_ps(py, minusOne), one), snormScale));
+
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(r + i), _mm256_or_si256(_mm256_and_si256(qx, lowMask), _mm256_slli_epi32(qy, 16)));
+        }
+
+        SSE::vec3_encode_oct_array(r + i, v + i * 4, n - i);
+    }
+
+    /// <summary>
+    /// Decodes n 2x16 bit octahedral coordinates to unit vectors. w of the result is 0.
+    /// </summary>
+    /// <param name="r">Unit vectors (4 * n floats)</param>
+    /// <param name="v">Encoded vectors</param>
+    /// <param name="n">Number of vectors</param>
+    P_TARGET_FMA inline void vec3_decode_oct_array(float* r, const uint32_t* v, size_t n)
+    {
+        const __m256 signMask = _mm256_set1_ps(-0.0f);
+        const __m256 zero = _mm256_setzero_ps();
+        const __m256 one = _mm256_set1_ps(1.0f);
+        const __m256 minusOne = _mm256_set1_ps(-1.0f);
+        const __m256 snormScale = _mm256_set1_ps(1.0f / 32767.0f);
+
+        size_t i = 0;
+
+        for (; i + 8 <= n; i += 8)
+        {
+            const __m256i q = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(v + i));
+
+            __m256 x = _mm256_max_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_srai_epi32(_mm256_slli_epi32(q, 16), 16)), snormScale), minusOne);
+            __m256 y = _mm256_max_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_srai_epi32(q, 16)), snormScale), minusOne);
+            __m256 z = _mm256_sub_ps(_mm256_sub_ps(one, _mm256_andnot_ps(signMask, x)), _mm256_andnot_ps(signMask, y));
+
+            const __m256 t = _mm256_max_ps(_mm256_xor_ps(z, signMask), zero);
+            x = _mm256_sub_ps(x, _mm256_or_ps(t, _mm256_and_ps(x, signMask)));
+            y = _mm256_sub_ps(y, _mm256_or_ps(t, _mm256_and_ps(y, signMask)));
+
+            const __m256 l = _mm256_sqrt_ps(_mm256_fmadd_ps(x, x, _mm256_fmadd_ps(y, y, _mm256_mul_ps(z, z))));
+
+            AVX::Internal::vec4x8_store_aos(r + i * 4, _mm256_div_ps(x, l), _mm256_div_ps(y, l), _mm256_div_ps(z, l), zero);
+        }
+
+        SSE::vec3_decode_oct_array(r + i * 4, v + i, n - i);
+    }
+
+    /// <summary>
+    /// Encodes n vectors as snorm 10:10:10:2. Components are clamped between -1 and 1.
+    /// </summary>
+    /// <param name="r">Encoded vectors</param>
+    /// <param name="v">Vectors (4 * n floats)</param>
+    /// <param name="n">Number of vectors</param>
+    P_TARGET_FMA inline void vec3_encode_1010102_array(uint32_t* r, const float* v, size_t n)
+    {
+        const __m256 one = _mm256_set1_ps(1.0f);
+        const __m256 minusOne = _mm256_set1_ps(-1.0f);
+        const __m256 snormScale = _mm256_set1_ps(511.0f);
+        const __m256i fieldMask = _mm256_set1_epi32(0x3FF);
+
+        size_t i = 0;
+
+        for (; i + 8 <= n; i += 8)
+        {
+            __m256 x, y, z, w;
+            AVX::Internal::vec4x8_load_soa(v + i * 4, x, y, z, w);
+
+            const __m256i qx = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_min_ps(_mm256_max_ps(x, minusOne), one), snormScale));
+            const __m256i qy = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_min_ps(_mm256_max_ps(y, minusOne), one), snormScale));
+            const __m256i qz = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_min_ps(_mm256_max_ps(z, minusOne), one), snormScale));
+            const __m256i qw = _mm256_cvtps_epi32(_mm256_min_ps(_mm256_max_ps(w, minusOne), one));
+
+            const __m256i xy = _mm256_or_si256(_mm256_and_si256(qx, fieldMask), _mm256_slli_epi32(_mm256_and_si256(qy, fieldMask), 10));
+            const __m256i zw = _mm256_or_si256(_mm256_slli_epi32(_mm256_and_si256(qz, fieldMask), 20), _mm256_slli_epi32(qw, 30));
+
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(r + i), _mm256_or_si256(xy, zw));
+        }
+
+        SSE::vec3_encode_1010102_array(r + i, v + i * 4, n - i);
+    }
+
+    /// <summary>
+    /// Decodes n snorm 10:10:10:2 vectors.
+    /// </summary>
+    /// <param name="r">Vectors (4 * n floats)</param>
+    /// <param name="v">Encoded vectors</param>
+    /// <param name="n">Number of vectors</param>
+    P_TARGET_FMA inline void vec3_decode_1010102_array(float* r, const uint32_t* v, size_t n)
+    {
+        const __m256 minusOne = _mm256_set1_ps(-1.0f);
+        const __m256 snormScale = _mm256_set1_ps(1.0f / 511.0f);
+
+        size_t i = 0;
+
+        for (; i + 8 <= n; i += 8)
+        {
+            const __m256i q = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(v + i));
+
+            const __m256 x = _mm256_max_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_srai_epi32(_mm256_slli_epi32(q, 22), 22)), snormScale), minusOne);
+            const __m256 y = _mm256_max_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_srai_epi32(_mm256_slli_epi32(q, 12), 22)), snormScale), minusOne);
+            const __m256 z = _mm256_max_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_srai_epi32(_mm256_slli_epi32(q, 2), 22)), snormScale), minusOne);
+            const __m256 w = _mm256_max_ps(_mm256_cvtepi32_ps(_mm256_srai_epi32(q, 30)), minusOne);
+
+            AVX::Internal::vec4x8_store_aos(r + i * 4, x, y, z, w);
+        }
+
+        SSE::vec3_decode_1010102_array(r + i * 4, v + i, n - i);
+    }
+}
@@ -0,0 +1,1328 @@
+#pragma once
+
+// Scalar kernels on raw memory. Used as fallback by the dispatcher, if the CPU does not support SSE4.2.
+//
+// Matrices are 16 scalars in column-major order. The matrix kernels are templates, as they also serve as the scalar TMatrix4 implementation.
+// 3x3 matrices are 12 scalars, as each column is padded to xyzw like TVector3. w is written as 0.
+// Vector arrays are tightly packed xyzw.
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cmath>
+
+
+namespace Phanes::Core::Math::SIMD::FPU
+{
+    // =========== //
+    //   Matrix4   //
+    // =========== //
+
+    /// <summary>
+    /// Gets the determinant of a 4x4 matrix.
+    /// </summary>
+    /// <param name="m">Matrix</param>
+    /// <returns>Determinant</returns>
+    template<typename T>
+    inline T mat4_det(const T* m)
+    {
+        const T s0 = m[0] * m[5] - m[1] * m[4];
+        const T s1 = m[0] * m[9] - m[1] * m[8];
+        const T s2 = m[0] * m[13] - m[1] * m[12];
+        const T s3 = m[4] * m[9] - m[5] * m[8];
+        const T s4 = m[4] * m[13] - m[5] * m[12];
+        const T s5 = m[8] * m[13] - m[9] * m[12];
+
+        const T c5 = m[10] * m[15] - m[11] * m[14];
+        const T c4 = m[6] * m[15] - m[7] * m[14];
+        const T c3 = m[6] * m[11] - m[7] * m[10];
+        const T c2 = m[2] * m[15] - m[3] * m[14];
+        const T c1 = m[2] * m[11] - m[3] * m[10];
+        const T c0 = m[2] * m[7] - m[3] * m[6];
+
+        return s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+    }
+
+    /// <summary>
+    /// Inverts a 4x4 matrix. r may alias m.
+    /// </summary>
+    /// <param name="r">Inverted matrix</param>
+    /// <param name="m">Matrix</param>
+    /// <returns>False, if the matrix is singular. r is left untouched.</returns>
+    template<typename T>
+    inline bool mat4_inv(T* r, const T* m)
+    {
+        const T s0 = m[0] * m[5] - m[1] * m[4];
+        const T s1 = m[0] * m[9] - m[1] * m[8];
+        const T s2 = m[0] * m[13] - m[1] * m[12];
+        const T s3 = m[4] * m[9] - m[5] * m[8];
+        const T s4 = m[4] * m[13] - m[5] * m[12];
+        const T s5 = m[8] * m[13] - m[9] * m[12];
+
+        const T c5 = m[10] * m[15] - m[11] * m[14];
+        const T c4 = m[6] * m[15] - m[7] * m[14];
+        const T c3 = m[6] * m[11] - m[7] * m[10];
+        const T c2 = m[2] * m[15] - m[3] * m[14];
+        const T c1 = m[2] * m[11] - m[3] * m[10];
+        const T c0 = m[2] * m[7] - m[3] * m[6];
+
+        const T det = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+
+        if (det == (T)0.0)
+        {
+            return false;
+        }
+
+        const T _1_det = (T)1.0 / det;
+
+        T t[16];
+
+        t[0]  = ( m[5] * c5 - m[9] * c4 + m[13] * c3) * _1_det;
+        t[1]  = (-m[1] * c5 + m[9] * c2 - m[13] * c1) * _1_det;
+        t[2]  = ( m[1] * c4 - m[5] * c2 + m[13] * c0) * _1_det;
+        t[3]  = (-m[1] * c3 + m[5] * c1 - m[9] * c0) * _1_det;
+
+        t[4]  = (-m[4] * c5 + m[8] * c4 - m[12] * c3) * _1_det;
+        t[5]  = ( m[0] * c5 - m[8] * c2 + m[12] * c1) * _1_det;
+        t[6]  = (-m[0] * c4 + m[4] * c2 - m[12] * c0) * _1_det;
+        t[7]  = ( m[0] * c3 - m[4] * c1 + m[8] * c0) * _1_det;
+
+        t[8]  = ( m[7] * s5 - m[11] * s4 + m[15] * s3) * _1_det;
+        t[9]  = (-m[3] * s5 + m[11] * s2 - m[15] * s1) * _1_det;
+        t[10] = ( m[3] * s4 - m[7] * s2 + m[15] * s0) * _1_det;
+        t[11] = (-m[3] * s3 + m[7] * s1 - m[11] * s0) * _1_det;
+
+        t[12] = (-m[6] * s5 + m[10] * s4 - m[14] * s3) * _1_det;
+        t[13] = ( m[2] * s5 - m[10] * s2 + m[14] * s1) * _1_det;
+        t[14] = (-m[2] * s4 + m[6] * s2 - m[14] * s0) * _1_det;
+        t[15] = ( m[2] * s3 - m[6] * s1 + m[10] * s0) * _1_det;
+
+        for (int i = 0; i < 16; ++i)
+        {
+            r[i] = t[i];
+        }
+
+        return true;
+    }
+
+    /// <summary>
+    /// Transposes a 4x4 matrix. r may alias m.
+    /// </summary>
+    /// <param name="r">Transposed matrix</param>
+    /// <param name="m">Matrix</param>
+    template<typename T>
+    inline void mat4_transpose(T* r, const T* m)
+    {
+        T t[16];
+
+        for (int c = 0; c < 4; ++c)
+        {
+            for (int i = 0; i < 4; ++i)
+            {
+                t[c * 4 + i] = m[i * 4 + c];
+            }
+        }
+
+        for (int i = 0; i < 16; ++i)
+        {
+            r[i] = t[i];
+        }
+    }
+
+
+    /// <summary>
+    /// Multiplies two 4x4 matrices (a * b). r may alias a or b.
+    /// </summary>
+    /// <param name="r">Product</param>
+    /// <param name="a">Matrix one</param>
+    /// <param name="b">Matrix two</param>
+    template<typename T>
+    inline void mat4_mul(T* r, const T* a, const T* b)
+    {
+        T t[16];
+
+        // Column c of the product is a * b.c
+        for (int c = 0; c < 4; ++c)
+        {
+            for (int i = 0; i < 4; ++i)
+            {
+                t[c * 4 + i] = a[i] * b[c * 4] + a[4 + i] * b[c * 4 + 1] + a[8 + i] * b[c * 4 + 2] + a[12 + i] * b[c * 4 + 3];
+            }
+        }
+
+        for (int i = 0; i < 16; ++i)
+        {
+            r[i] = t[i];
+        }
+    }
+
+    /// <summary>
+    /// Transforms a vector with a 4x4 matrix (m * v). r may alias v.
+    /// </summary>
+    /// <param name="r">Transformed vector</param>
+    /// <param name="m">Matrix</param>
+    /// <param name="v">Vector</param>
+    template<typename T>
+    inline void mat4_mul_vec(T* r, const T* m, const T* v)
+    {
+        T t[4];
+
+        for (int i = 0; i < 4; ++i)
+        {
+            t[i] = m[i] * v[0] + m[4 + i] * v[1] + m[8 + i] * v[2] + m[12 + i] * v[3];
+        }
+
+        for (int i = 0; i < 4; ++i)
+        {
+            r[i] = t[i];
+        }
+    }
+
+    /// <summary>
+    /// Multiplies n pairs of 4x4 matrices (a[i] * b[i]).
+    /// </summary>
+    /// <param name="r">Products (16 * n floats)</param>
+    /// <param name="a">Matrices one</param>
+    /// <param name="b">Matrices two</param>
+    /// <param name="n">Number of matrices</param>
+    inline void mat4_mul_array(float* r, const float* a, const float* b, size_t n)
+    {
+        for (size_t i = 0; i < n; ++i)
+        {
+            mat4_mul(r + i * 16, a + i * 16, b + i * 16);
+        }
+    }
+
+    /// <summary>
+    /// Transforms n vectors with a 4x4 matrix (m * v[i]). r may alias v.
+    /// </summary>
+    /// <param name="r">Transformed vectors (4 * n floats)</param>
+    /// <param name="m">Matrix</param>
+    /// <param name="v">Vectors</param>
+    /// <param name="n">Number of vectors</param>
+    /// <param name="stream">Unused, there are no non-temporal scalar stores</param>
+    inline void mat4_transform_array(float* r, const float* m, const float* v, size_t n, bool /*stream*/)
+    {
+        for (size_t i = 0; i < n; ++i)
+        {
+            mat4_mul_vec(r + i * 4, m, v + i * 4);
+        }
+    }
+
+    /// <summary>
+    /// Transforms n points with a 4x4 matrix (m * (x, y, z, 1)). w of the input is ignored. r may alias v.
+    /// </summary>
+    /// <param name="r">Transformed points (4 * n floats)</param>
+    /// <param name="m">Matrix</param>
+    /// <param name="v">Points</param>
+    /// <param name="n">Number of points</param>
+    /// <param name="stream">Unused, there are no non-temporal scalar stores</param>
+    inline void mat4_transform_point_array(float* r, const float* m, const float* v, size_t n, bool /*stream*/)
+    {
+        for (size_t i = 0; i < n; ++i)
+        {
+            const float p[4] = { v[i * 4], v[i * 4 + 1], v[i * 4 + 2], 1.0f };
+            mat4_mul_vec(r + i * 4, m, p);
+        }
+    }
+
+    /// <summary>
+    /// Transforms n directions with a 4x4 matrix (m * (x, y, z, 0)). w of the input is ignored. r may alias v.
+    /// </summary>
+    /// <param name="r">Transformed directions (4 * n floats)</param>
+    /// <param name="m">Matrix</param>
+    /// <param name="v">Directions</param>
+    /// <param name="n">Number of directions</param>
+    /// <param name="stream">Unused, there are no non-temporal scalar stores</param>
+    inline void mat4_transform_dir_array(float* r, const float* m, const float* v, size_t n, bool /*stream*/)
+    {
+        for (size_t i = 0; i < n; ++i)
+        {
+            const float d[4] = { v[i * 4], v[i * 4 + 1], v[i * 4 + 2], 0.0f };
+            mat4_mul_vec(r + i * 4, m, d);
+        }
+    }
+
+    // =========== //
+    //   Matrix3   //
+    // =========== //
+
+    /// <summary>
+    /// Gets the determinant of a 3x3 matrix as dot(c0, cross(c1, c2)).
+    /// </summary>
+    /// <param name="m">Matrix</param>
+    /// <returns>Determinant</returns>
+    template<typename T>
+    inline T mat3_det(const T* m)
+    {
+        return m[0] * (m[5] * m[10] - m[6] * m[9])
+             + m[1] * (m[6] * m[8]  - m[4] * m[10])
+             + m[2] * (m[4] * m[9]  - m[5] * m[8]);
+    }
+
+    /// <summary>
+    /// Inverts a 3x3 matrix. The rows of the inverse are the cross products of the columns, divided by the determinant. r may alias m.
+    /// </summary>
+    /// <param name="r">Inverted matrix</param>
+    /// <param name="m">Matrix</param>
+    /// <returns>False, if the matrix is singular. r is left untouched.</returns>
+    template<typename T>
+    inline bool mat3_inv(T* r, const T* m)
+    {
+        // r0 = c1 x c2, r1 = c2 x c0, r2 = c0 x c1
+        const T r0[3] = { m[5] * m[10] - m[6] * m[9], m[6] * m[8] - m[4] * m[10], m[4] * m[9] - m[5] * m[8] };
+        const T r1[3] = { m[9] * m[2]  - m[10] * m[1], m[10] * m[0] - m[8] * m[2], m[8] * m[1] - m[9] * m[0] };
+        const T r2[3] = { m[1] * m[6]  - m[2] * m[5], m[2] * m[4] - m[0] * m[6], m[0] * m[5] - m[1] * m[4] };
+
+        const T det = m[0] * r0[0] + m[1] * r0[1] + m[2] * r0[2];
+
+        if (det == (T)0.0)
+        {
+            return false;
+        }
+
+        const T _1_det = (T)1.0 / det;
+
+        for (int c = 0; c < 3; ++c)
+        {
+            r[c * 4 + 0] = r0[c] * _1_det;
+            r[c * 4 + 1] = r1[c] * _1_det;
+            r[c * 4 + 2] = r2[c] * _1_det;
+            r[c * 4 + 3] = (T)0.0;
+        }
+
+        return true;
+    }
+
+    /// <summary>
+    /// Multiplies two 3x3 matrices (a * b). r may alias a or b.
+    /// </summary>
+    /// <param name="r">Product</param>
+    /// <param name="a">Matrix one</param>
+    /// <param name="b">Matrix two</param>
+    template<typename T>
+    inline void mat3_mul(T* r, const T* a, const T* b)
+    {
+        T t[12];
+
+        for (int c = 0; c < 3; ++c)
+        {
+            for (int i = 0; i < 3; ++i)
+            {
+                t[c * 4 + i] = a[i] * b[c * 4] + a[4 + i] * b[c * 4 + 1] + a[8 + i] * b[c * 4 + 2];
+            }
+            t[c * 4 + 3] = (T)0.0;
+        }
+
+        for (int i = 0; i < 12; ++i)
+        {
+            r[i] = t[i];
+        }
+    }
+
+    /// <summary>
+    /// Transforms a 3d vector by a 3x3 matrix (m * v). r may alias v.
+    /// </summary>
+    /// <param name="r">Transformed vector (xyzw)</param>
+    /// <param name="m">Matrix</param>
+    /// <param name="v">Vector (xyzw)</param>
+    template<typename T>
+    inline void mat3_mul_vec(T* r, const T* m, const T* v)
+    {
+        const T x = v[0], y = v[1], z = v[2];
+
+        r[0] = m[0] * x + m[4] * y + m[8] * z;
+        r[1] = m[1] * x + m[5] * y + m[9] * z;
+        r[2] = m[2] * x + m[6] * y + m[10] * z;
+        r[3] = (T)0.0;
+    }
+
+
+    // ================= //
+    //   Vector4 array   //
+    // ================= //
+
+    /// <summary>
+    /// Adds n vectors component-wise.
+    /// </summary>
+    /// <param name="r">Result (4 * n floats)</param>
+    /// <param name="a">Vectors one</param>
+    /// <param name="b">Vectors two</param>
+    /// <param name="n">Number of vectors</param>
+    inline void vec4_add_array(float* r, const float* a, const float* b, size_t n)
+    {
+        for (size_t i = 0; i < n * 4; ++i)
+        {
+            r[i] = a[i] + b[i];
+        }
+    }
+
+    /// <summary>
+    /// Subtracts n vectors component-wise.
+    /// </summary>
+    /// <param name="r">Result (4 * n floats)</param>
+    /// <param name="a">Vectors one</param>
+    /// <param name="b">Vectors two</param>
+    /// <param name="n">Number of vectors</param>
+    inline void vec4_sub_array(float* r, const float* a, const float* b, size_t n)
+    {
+        for (size_t i = 0; i < n * 4; ++i)
+        {
+            r[i] = a[i] - b[i];
+        }
+    }
+
+    /// <summary>
+    /// Multiplies n vectors component-wise.
+    /// </summary>
+    /// <param name="r">Result (4 * n floats)</param>
+    /// <param name="a">Vectors one</param>
+    /// <param name="b">Vectors two</param>
+    /// <param name="n">Number of vectors</param>
+    inline void vec4_mul_array(float* r, const float* a, const float* b, size_t n)
+    {
+        for (size_t i = 0; i < n * 4; ++i)
+        {
+            r[i] = a[i] * b[i];
+        }
+    }
+
+    /// <summary>
+    /// Divides n vectors component-wise.
+    /// </summary>
+    /// <param name="r">Result (4 * n floats)</param>
+    /// <param name="a">Vectors one</param>
+    /// <param name="b">Vectors two</param>
+    /// <param name="n">Number of vectors</param>
+    inline void vec4_div_array(float* r, const float* a, const float* b, size_t n)
+    {
+        for (size_t i = 0; i < n * 4; ++i)
+        {
+            r[i] = a[i] / b[i];
+        }
+    }
+
+    /// <summary>
+    /// Gets the dot products of n vector pairs.
+    /// </summary>
+    /// <param name="r">Dot products (n floats)</param>
+    /// <param name="a">Vectors one</param>
+    /// <param name="b">Vectors two</param>
+    /// <param name="n">Number of vectors</param>
+    inline void vec4_dot_array(float* r, const float* a, const float* b, size_t n)
+    {
+        for (size_t i = 0; i < n; ++i)
+        {
+            const float* v1 = a + i * 4;
+            const float* v2 = b + i * 4;
+            r[i] = v1[0] * v2[0] + v1[1] * v2[1] + v1[2] * v2[2] + v1[3] * v2[3];
+        }
+    }
+
+    /// <summary>
+    /// Compares n vector pairs. Two vectors are equal, if all components differ by less than threshold.
+    /// </summary>
+    /// <param name="r">Results (n bools)</param>
+    /// <param name="a">Vectors one</param>
+    /// <param name="b">Vectors two</param>
+    /// <param name="n">Number of vectors</param>
+    /// <param name="threshold">Allowed difference per component</param>
+    inline void vec4_eq_array(bool* r, const float* a, const float* b, size_t n, float threshold)
+    {
+        for (size_t i = 0; i < n; ++i)
+        {
+            const float* v1 = a + i * 4;
+            const float* v2 = b + i * 4;
+
+            bool eq = true;
+            for (int c = 0; c < 4; ++c)
+            {
+                const float d = v1[c] - v2[c];
+                eq = eq && (d < threshold && -d < threshold);
+            }
+            r[i] = eq;
+        }
+    }
+
+    /// <summary>
+    /// Normalizes n vectors. Vectors shorter than minLength are set to zero, like Normalize does. r may alias v.
+    /// </summary>
+    /// <param name="r">Normalized vectors (4 * n floats)</param>
+    /// <param name="v">Vectors</param>
+    /// <param name="n">Number of vectors</param>
+    /// <param name="minLength">Smallest length, that is normalized</param>
+    inline void vec4_normalize_array(float* r, const float* v, size_t n, float minLength)
+    {
+        for (size_t i = 0; i < n; ++i)
+        {
+            const float* x = v + i * 4;
+            const float len = std::sqrt(x[0] * x[0] + x[1] * x[1] + x[2] * x[2] + x[3] * x[3]);
+
+            for (int c = 0; c < 4; ++c)
+            {
+                r[i * 4 + c] = (len < minLength) ? 0.0f : x[c] / len;
+            }
+        }
+    }
+
+    /// <summary>
+    /// Normalizes n vectors with the reciprocal square root estimate. The scalar version is always exact.
+    /// </summary>
+    /// <param name="r">Normalized vectors (4 * n floats)</param>
+    /// <param name="v">Vectors</param>
+    /// <param name="n">Number of vectors</param>
+    /// <param name="minLength">Smallest length, that is normalized</param>
+    /// <param name="refine">Refine the estimate with a Newton-Raphson step</param>
+    inline void vec4_normalize_est_array(float* r, const float* v, size_t n, float minLength, bool /*refine*/)
+    {
+        vec4_normalize_array(r, v, n, minLength);
+    }
+
+    /// <summary>
+    /// Gets the length of n vectors.
+    /// </summary>
+    /// <param name="r">Lengths (n floats)</param>
+    /// <param name="v">Vectors</param>
+    /// <param name="n">Number of vectors</param>
+    inline void vec4_magnitude_array(float* r, const float* v, size_t n)
+    {
+        for (size_t i = 0; i < n; ++i)
+        {
+            const float* x = v + i * 4;
+            r[i] = std::sqrt(x[0] * x[0] + x[1] * x[1] + x[2] * x[2] + x[3] * x[3]);
+        }
+    }
+
+    /// <summary>
+    /// Interpolates n vector pairs linearly (a + t * (b - a)). r may alias a or b.
+    /// </summary>
+    /// <param name="r">Result (4 * n floats)</param>
+    /// <param name="a">Start vectors</param>
+    /// <param name="b">Destination vectors</param>
+    /// <param name="n">Number of vectors</param>
+    /// <param name="t">Interpolation value</param>
+    inline void vec4_lerp_array(float* r, const float* a, const float* b, size_t n, float t)
+    {
+        for (size_t i = 0; i < n * 4; ++i)
+        {
+            r[i] = a[i] + t * (b[i] - a[i]);
+        }
+    }
+
+    /// <summary>
+    /// Gets the component-wise minimum of n vectors.
+    /// </summary>
+    /// <param name="r">Minimum (4 floats)</param>
+    /// <param name="v">Vectors</param>
+    /// <param name="n">Number of vectors (at least 1)</param>
+    inline void vec4_min_reduce(float* r, const float* v, size_t n)
+    {
+        float m[4] = { v[0], v[1], v[2], v[3] };
+
+        for (size_t i = 1; i < n; ++i)
+        {
+            for (int c = 0; c < 4; ++c)
+            {
+                m[c] = (v[i * 4 + c] < m[c]) ? v[i * 4 + c] : m[c];
+            }
+        }
+
+        for (int c = 0; c < 4; ++c)
+        {
+            r[c] = m[c];
+        }
+    }
+
+    /// <summary>
+    /// Gets the component-wise maximum of n vectors.
+    /// </summary>
+    /// <param name="r">Maximum (4 floats)</param>
+    /// <param name="v">Vectors</param>
+    /// <param name="n">Number of vectors (at least 1)</param>
+    inline void vec4_max_reduce(float* r, const float* v, size_t n)
+    {
+        float m[4] = { v[0], v[1], v[2], v[3] };
+
+        for (size_t i = 1; i < n; ++i)
+        {
+            for (int c = 0; c < 4; ++c)
+            {
+                m[c] = (v[i * 4 + c] > m[c]) ? v[i * 4 + c] : m[c];
+            }
+        }
+
+        for (int c = 0; c < 4; ++c)
+        {
+            r[c] = m[c];
+        }
+    }
+
+    // ================= //
+    //   Vector3 array   //
+    // ================= //
+
+    /// <summary>
+    /// Gets the dot product of n 3d vector pairs. w is ignored.
+    /// </summary>
+    /// <param name="r">Dot products (n floats)</param>
+    /// <param name="a">Vectors one</param>
+    /// <param name="b">Vectors two</param>
+    /// <param name="n">Number of vectors</param>
+    inline void vec3_dot_array(float* r, const float* a, const float* b, size_t n)
+    {
+        for (size_t i = 0; i < n; ++i)
+        {
+            r[i] = a[i * 4] * b[i * 4] + a[i * 4 + 1] * b[i * 4 + 1] + a[i * 4 + 2] * b[i * 4 + 2];
+        }
+    }
+
+    /// <summary>
+    /// Gets the cross product of n 3d vector pairs. w of the result is 0. r may alias a or b.
+    /// </summary>
+    /// <param name="r">Cross products (4 * n floats)</param>
+    /// <param name="a">Vectors one</param>
+    /// <param name="b">Vectors two</param>
+    /// <param name="n">Number of vectors</param>
+    inline void vec3_cross_array(float* r, const float* a, const float* b, size_t n)
+    {
+        for (size_t i = 0; i < n; ++i)
+        {
+            const float* x = a + i * 4;
+            const float* y = b + i * 4;
+
+            float c0 = x[1] * y[2] - x[2] * y[1];
+            float c1 = x[2] * y[0] - x[0] * y[2];
+            float c2 = x[0] * y[1] - x[1] * y[0];
+
+            r[i * 4]     = c0;
+            r[i * 4 + 1] = c1;
+            r[i * 4 + 2] = c2;
+            r[i * 4 + 3] = 0.0f;
+        }
+    }
+
+    /// <summary>
+    /// Gets the length of n 3d vectors. w is ignored.
+    /// </summary>
+    /// <param name="r">Lengths (n floats)</param>
+    /// <param name="v">Vectors</param>
+    /// <param name="n">Number of vectors</param>
+    inline void vec3_magnitude_array(float* r, const float* v, size_t n)
+    {
+        for (size_t i = 0; i < n; ++i)
+        {
+            const float* x = v + i * 4;
+            r[i] = std::sqrt(x[0] * x[0] + x[1] * x[1] + x[2] * x[2]);
+        }
+    }
+
+    /// <summary>
+    /// Normalizes n 3d vectors. Vectors shorter than minLength are set to zero, like Normalize does. w of the result is 0. r may alias v.
+    /// </summary>
+    /// <param name="r">Normalized vectors (4 * n floats)</param>
+    /// <param name="v">Vectors</param>
+    /// <param name="n">Number of vectors</param>
+    /// <param name="minLength">Smallest length, that is normalized</param>
+    inline void vec3_normalize_array(float* r, const float* v, size_t n, float minLength)
+    {
+        for (size_t i = 0; i < n; ++i)
+        {
+            const float* x = v + i * 4;
+            const float len = std::sqrt(x[0] * x[0] + x[1] * x[1] + x[2] * x[2]);
+
+            for (int c = 0; c < 3; ++c)
+            {
+                r[i * 4 + c] = (len < minLength) ? 0.0f : x[c] / len;
+            }
+            r[i * 4 + 3] = 0.0f;
+        }
+    }
+
+    /// <summary>
+    /// Normalizes n 3d vectors with the reciprocal square root estimate. The scalar version is always exact.
+    /// </summary>
+    /// <param name="r">Normalized vectors (4 * n floats)</param>
+    /// <param name="v">Vectors</param>
+    /// <param name="n">Number of vectors</param>
+    /// <param name="minLength">Smallest length, that is normalized</param>
+    /// <param name="refine">Refine the estimate with a Newton-Raphson step</param>
+    inline void vec3_normalize_est_array(float* r, const float* v, size_t n, float minLength, bool /*refine*/)
+    {
+        vec3_normalize_array(r, v, n, minLength);
+    }
+
+    // ================= //
+    //   Vector2 array   //
+    // ================= //
+
+    /// <summary>
+    /// Adds n 2d vectors component-wise.
+    /// </summary>
+    /// <param name="r">Result (2 * n floats)</param>
+    /// <param name="a">Vectors one</param>
+    /// <param name="b">Vectors two</param>
+    /// <param name="n">Number of vectors</param>
+    inline void vec2_add_array(float* r, const float* a, const float* b, size_t n)
+    {
+        for (size_t i = 0; i < n * 2; ++i)
+        {
+            r[i] = a[i] + b[i];
+        }
+    }
+
+    /// <summary>
+    /// Multiplies n 2d vectors component-wise.
+    /// </summary>
+    /// <param name="r">Result (2 * n floats)</param>
+    /// <param name="a">Vectors one</param>
+    /// <param name="b">Vectors two</param>
+    /// <param name="n">Number of vectors</param>
+    inline void vec2_mul_array(float* r, const float* a, const float* b, size_t n)
+    {
+        for (size_t i = 0; i < n * 2; ++i)
+        {
+            r[i] = a[i] * b[i];
+        }
+    }
+
+    /// <summary>
+    /// Interpolates n pairs of 2d vectors with (1 - t) * a + t * b. t is not clamped.
+    /// </summary>
+    /// <param name="r">Result (2 * n floats)</param>
+    /// <param name="a">Start vectors (t = 0)</param>
+    /// <param name="b">Destination vectors (t = 1)</param>
+    /// <param name="n">Number of vectors</param>
+    /// <param name="t">Interpolation value</param>
+    inline void vec2_lerp_array(float* r, const float* a, const float* b, size_t n, float t)
+    {
+        for (size_t i = 0; i < n * 2; ++i)
+        {
+            r[i] = (1.0f - t) * a[i] + t * b[i];
+        }
+    }
+
+    /// <summary>
+    /// Normalizes n 2d vectors. Vectors shorter than minLength are set to zero, like Normalize does. r may alias v.
+    /// </summary>
+    /// <param name="r">Normalized vectors (2 * n floats)</param>
+    /// <param name="v">Vectors</param>
+    /// <param name="n">Number of vectors</param>
+    /// <param name="minLength">Smallest length, that is normalized</param>
+    inline void vec2_normalize_array(float* r, const float* v, size_t n, float minLength)
+    {
+        for (size_t i = 0; i < n * 2; i += 2)
+        {
+            const float len = std::sqrt(v[i] * v[i] + v[i + 1] * v[i + 1]);
+
+            if (len < minLength)
+            {
+                r[i] = 0.0f;
+                r[i + 1] = 0.0f;
+            }
+            else
+            {
+                r[i] = v[i] / len;
+                r[i + 1] = v[i + 1] / len;
+            }
+        }
+    }
+
+    // =========== //
+    //   Culling   //
+    // =========== //
+
+    // Planes are stored as (a, b, c, d) like TPlane (ax + by + cz = d). The side, the normal points to, is inside.
+    // Objects are records of stride floats. r holds one bit per object in (n + 31) / 32 words. A set bit means visible.
+
+    /// <summary>
+    /// Tests n spheres against a set of planes. A sphere is visible, if it is not entirely behind any plane.
+    /// </summary>
+    /// <param name="r">Visibility mask ((n + 31) / 32 words)</param>
+    /// <param name="p">Planes (4 * planeCount floats)</param>
+    /// <param name="planeCount">Number of planes</param>
+    /// <param name="c">Center of the first sphere (xyz)</param>
+    /// <param name="radius">Radius of the first sphere</param>
+    /// <param name="stride">Distance between two spheres in floats (at least 4)</param>
+    /// <param name="n">Number of spheres</param>
+    inline void cull_sphere_array(uint32_t* r, const float* p, size_t planeCount, const float* c, const float* radius, size_t stride, size_t n)
+    {
+        for (size_t w = 0; w < (n + 31) / 32; ++w)
+        {
+            r[w] = 0;
+        }
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            const float* s = c + i * stride;
+            const float nr = -radius[i * stride];
+
+            bool out = false;
+            for (size_t k = 0; k < planeCount && !out; ++k)
+            {
+                const float* pl = p + k * 4;
+                out = (pl[0] * s[0] + pl[1] * s[1] + pl[2] * s[2] - pl[3]) < nr;
+            }
+
+            r[i >> 5] |= (uint32_t)!out << (i & 31);
+        }
+    }
+
+    /// <summary>
+    /// Tests n axis aligned boxes against a set of planes. A box is visible, if it is not entirely behind any plane.
+    /// </summary>
+    /// <param name="r">Visibility mask ((n + 31) / 32 words)</param>
+    /// <param name="p">Planes (4 * planeCount floats)</param>
+    /// <param name="planeCount">Number of planes</param>
+    /// <param name="mn">Minimum corner of the first box (xyz)</param>
+    /// <param name="mx">Maximum corner of the first box (xyz)</param>
+    /// <param name="stride">Distance between two boxes in floats (at least 4)</param>
+    /// <param name="n">Number of boxes</param>
+    inline void cull_aabb_array(uint32_t* r, const float* p, size_t planeCount, const float* mn, const float* mx, size_t stride, size_t n)
+    {
+        for (size_t w = 0; w < (n + 31) / 32; ++w)
+        {
+            r[w] = 0;
+        }
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            const float* b0 = mn + i * stride;
+            const float* b1 = mx + i * stride;
+
+            bool out = false;
+            for (size_t k = 0; k < planeCount && !out; ++k)
+            {
+                const float* pl = p + k * 4;
+
+                // Corner furthest along the normal.
+                const float x = (pl[0] >= 0.0f) ? b1[0] : b0[0];
+                const float y = (pl[1] >= 0.0f) ? b1[1] : b0[1];
+                const float z = (pl[2] >= 0.0f) ? b1[2] : b0[2];
+
+                out = (pl[0] * x + pl[1] * y + pl[2] * z - pl[3]) < 0.0f;
+            }
+
+            r[i >> 5] |= (uint32_t)!out << (i & 31);
+        }
+    }
+
+    // ==================== //
+    //   Quaternion array   //
+    // ==================== //
+
+    // Quaternions are stored as xyzw like TQuaternion.
+    //
+    // The slerp weights sin(t * a) / sin(a) are evaluated with the polynomial of Eberly, "A Fast and Accurate Algorithm for Computing SLERP":
+    // t * (1 + b1 * (1 + b2 * (... (1 + mu * b16)))), with b_i = (t^2 / (i * (2i + 1)) - i / (2i + 1)) * (cos(a) - 1).
+    // It has neither trigonometric functions nor divisions and branches, so all lanes run the same code. Error is below 4e-8 for t in [0, 1].
+
+    /// <summary>
+    /// Number of terms of the slerp polynomial.
+    /// </summary>
+    constexpr size_t QuatSlerpTerms = 16;
+
+    /// <summary>
+    /// Computes the per call coefficients (t^2 / (i * (2i + 1)) - i / (2i + 1)) of the slerp polynomial. The last one is scaled by mu.
+    /// </summary>
+    /// <param name="c">Coefficients (QuatSlerpTerms floats)</param>
+    /// <param name="t">Interpolation value</param>
+    inline void quat_slerp_coefficients(float* c, float t)
+    {
+        for (size_t i = 1; i <= QuatSlerpTerms; ++i)
+        {
+            const float u = 1.0f / (float)(i * (2 * i + 1));
+            const float v = (float)i / (float)(2 * i + 1);
+
+            c[i - 1] = u * t * t - v;
+        }
+
+        // Corrects the truncation error of the series.
+        c[QuatSlerpTerms - 1] *= 1.91666802f;
+    }
+
+    /// <summary>
+    /// Interpolates n pairs of unit quaternions spherically. Takes the shortest path. r may alias a or b.
+    /// </summary>
+    /// <param name="r">Result (4 * n floats)</param>
+    /// <param name="a">Start rotations</param>
+    /// <param name="b">Destination rotations</param>
+    /// <param name="n">Number of quaternions</param>
+    /// <param name="t">Interpolation value between 0 and 1</param>
+    inline void quat_slerp_array(float* r, const float* a, const float* b, size_t n, float t)
+    {
+        float ct[QuatSlerpTerms];
+        float cd[QuatSlerpTerms];
+        quat_slerp_coefficients(ct, t);
+        quat_slerp_coefficients(cd, 1.0f - t);
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            const float* x = a + i * 4;
+            const float* y = b + i * 4;
+
+            const float d = x[0] * y[0] + x[1] * y[1] + x[2] * y[2] + x[3] * y[3];
+            const float xm1 = ((d < 0.0f) ? -d : d) - 1.0f;
+
+            float wt = 1.0f;
+            float wd = 1.0f;
+            for (size_t k = QuatSlerpTerms; k-- > 0;)
+            {
+                wt = 1.0f + ct[k] * xm1 * wt;
+                wd = 1.0f + cd[k] * xm1 * wd;
+            }
+
+            wt *= (d < 0.0f) ? -t : t;
+            wd *= 1.0f - t;
+
+            const float q0 = x[0] * wd + y[0] * wt;
+            const float q1 = x[1] * wd + y[1] * wt;
+            const float q2 = x[2] * wd + y[2] * wt;
+            const float q3 = x[3] * wd + y[3] * wt;
+
+            r[i * 4]     = q0;
+            r[i * 4 + 1] = q1;
+            r[i * 4 + 2] = q2;
+            r[i * 4 + 3] = q3;
+        }
+    }
+
+
+    // ============ //
+    //   Skinning   //
+    // ============ //
+
+    // Vertex streams are planar structure of arrays: x, y and z of vertex i are at v[i], v[pitch + i] and v[2 * pitch + i].
+    // Every vertex has SkinInfluences influences, stored interleaved as bones[i * SkinInfluences + k] and weights[i * SkinInfluences + k].
+    // Unused influences have weight 0 and any valid bone index. The weights of a vertex should sum to 1.
+    // Dual quaternions are 8 floats: real xyzw, dual xyzw.
+
+    constexpr size_t SkinInfluences = 4;
+
+    /// <summary>
+    /// Skins n vertices with blended dual quaternions (DLB). Positions and normals may be skinned in place.
+    /// </summary>
+    /// <param name="rp">Skinned positions (planar, pitch floats per component)</param>
+    /// <param name="rn">Skinned normals, or nullptr</param>
+    /// <param name="p">Bind pose positions</param>
+    /// <param name="nrm">Bind pose normals, or nullptr</param>
+    /// <param name="bones">Bone indices (SkinInfluences per vertex)</param>
+    /// <param name="weights">Bone weights (SkinInfluences per vertex)</param>
+    /// <param name="dq">Unit dual quaternions of the bones (8 floats per bone)</param>
+    /// <param name="n">Number of vertices</param>
+    /// <param name="pitch">Distance between the x, y and z arrays in floats (at least n)</param>
+    inline void dq_skin_array(float* rp, float* rn, const float* p, const float* nrm, const uint32_t* bones, const float* weights, const float* dq, size_t n, size_t pitch)
+    {
+        for (size_t i = 0; i < n; ++i)
+        {
+            const uint32_t* b = bones + i * SkinInfluences;
+            const float* w = weights + i * SkinInfluences;
+            const float* q0 = dq + (size_t)b[0] * 8;
+
+            float q[8];
+            for (size_t c = 0; c < 8; ++c)
+            {
+                q[c] = q0[c] * w[0];
+            }
+
+            for (size_t k = 1; k < SkinInfluences; ++k)
+            {
+                const float* qk = dq + (size_t)b[k] * 8;
+
+                // q and -q are the same transform. Take the one closer to the first bone, so the blend does not cancel out.
+                const float wk = (q0[0] * qk[0] + q0[1] * qk[1] + q0[2] * qk[2] + q0[3] * qk[3] < 0.0f) ? -w[k] : w[k];
+
+                for (size_t c = 0; c < 8; ++c)
+                {
+                    q[c] += qk[c] * wk;
+                }
+            }
+
+            const float invLength = 1.0f / std::sqrt(q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3]);
+            for (size_t c = 0; c < 8; ++c)
+            {
+                q[c] *= invLength;
+            }
+
+            // Translation: 2 * (rw * dv - dw * rv + rv x dv)
+            const float tx = 2.0f * (q[3] * q[4] - q[7] * q[0] + q[1] * q[6] - q[2] * q[5]);
+            const float ty = 2.0f * (q[3] * q[5] - q[7] * q[1] + q[2] * q[4] - q[0] * q[6]);
+            const float tz = 2.0f * (q[3] * q[6] - q[7] * q[2] + q[0] * q[5] - q[1] * q[4]);
+
+            // Rotation: v + 2 * rv x (rv x v + rw * v)
+            const float px = p[i], py = p[pitch + i], pz = p[2 * pitch + i];
+            float cx = q[1] * pz - q[2] * py + q[3] * px;
+            float cy = q[2] * px - q[0] * pz + q[3] * py;
+            float cz = q[0] * py - q[1] * px + q[3] * pz;
+
+            rp[i]             = px + 2.0f * (q[1] * cz - q[2] * cy) + tx;
+            rp[pitch + i]     = py + 2.0f * (q[2] * cx - q[0] * cz) + ty;
+            rp[2 * pitch + i] = pz + 2.0f * (q[0] * cy - q[1] * cx) + tz;
+
+            if (nrm != nullptr)
+            {
+                const float nx = nrm[i], ny = nrm[pitch + i], nz = nrm[2 * pitch + i];
+                cx = q[1] * nz - q[2] * ny + q[3] * nx;
+                cy = q[2] * nx - q[0] * nz + q[3] * ny;
+                cz = q[0] * ny - q[1] * nx + q[3] * nz;
+
+                rn[i]             = nx + 2.0f * (q[1] * cz - q[2] * cy);
+                rn[pitch + i]     = ny + 2.0f * (q[2] * cx - q[0] * cz);
+                rn[2 * pitch + i] = nz + 2.0f * (q[0] * cy - q[1] * cx);
+            }
+        }
+    }
+
+    // Bone matrices of linear blend skinning are affine and column-major with 4 columns of columnStride floats each:
+    // 4 for TMatrix4 (the last row is ignored), 3 for 3x4 matrices without the last row. Normals are transformed by the upper 3x3 part and renormalized,
+    // which is exact for rotations and uniform scale.
+
+    /// <summary>
+    /// Skins n vertices with linearly blended bone matrices. Positions and normals may be skinned in place.
+    /// </summary>
+    /// <param name="rp">Skinned positions (planar, pitch floats per component)</param>
+    /// <param name="rn">Skinned normals, or nullptr</param>
+    /// <param name="p">Bind pose positions</param>
+    /// <param name="nrm">Bind pose normals, or nullptr</param>
+    /// <param name="bones">Bone indices (SkinInfluences per vertex)</param>
+    /// <param name="weights">Bone weights (SkinInfluences per vertex)</param>
+    /// <param name="m">Bone matrices (4 * columnStride floats per bone)</param>
+    /// <param name="columnStride">Floats per matrix column (3 or 4)</param>
+    /// <param name="n">Number of vertices</param>
+    /// <param name="pitch">Distance between the x, y and z arrays in floats (at least n)</param>
+    inline void lbs_skin_array(float* rp, float* rn, const float* p, const float* nrm, const uint32_t* bones, const float* weights, const float* m, size_t columnStride, size_t n, size_t pitch)
+    {
+        for (size_t i = 0; i < n; ++i)
+        {
+            // Blended matrix without the last row, a[c * 3 + r] = m(r, c).
+            float a[12] = {};
+
+            for (size_t k = 0; k < SkinInfluences; ++k)
+            {
+                const float w = weights[i * SkinInfluences + k];
+                if (w == 0.0f)
+                {
+                    continue;
+                }
+
+                const float* mk = m + (size_t)bones[i * SkinInfluences + k] * columnStride * 4;
+                for (size_t c = 0; c < 4; ++c)
+                {
+                    a[c * 3]     += mk[c * columnStride] * w;
+                    a[c * 3 + 1] += mk[c * columnStride + 1] * w;
+                    a[c * 3 + 2] += mk[c * columnStride + 2] * w;
+                }
+            }
+
+            const float px = p[i], py = p[pitch + i], pz = p[2 * pitch + i];
+
+            rp[i]             = a[0] * px + a[3] * py + a[6] * pz + a[9];
+            rp[pitch + i]     = a[1] * px + a[4] * py + a[7] * pz + a[10];
+            rp[2 * pitch + i] = a[2] * px + a[5] * py + a[8] * pz + a[11];
+
+            if (nrm != nullptr)
+            {
+                const float nx = nrm[i], ny = nrm[pitch + i], nz = nrm[2 * pitch + i];
+
+                const float x = a[0] * nx + a[3] * ny + a[6] * nz;
+                const float y = a[1] * nx + a[4] * ny + a[7] * nz;
+                const float z = a[2] * nx + a[5] * ny + a[8] * nz;
+
+                const float l = x * x + y * y + z * z;
+                const float s = (l > 0.0f) ? 1.0f / std::sqrt(l) : 1.0f;
+
+                rn[i]             = x * s;
+                rn[pitch + i]     = y * s;
+                rn[2 * pitch + i] = z * s;
+            }
+        }
+    }
+
+    // ================== //
+    //   Half precision   //
+    // ================== //
+
+    // Halves are IEEE 754 binary16 bit patterns. Conversions round to nearest even and keep infinities and denormals.
+    // NaNs are quieted and keep the upper payload bits, like the F16C instructions.
+
+    /// <summary>
+    /// Converts a float to half precision.
+    /// </summary>
+    /// <param name="f">Float</param>
+    /// <returns>Half bits</returns>
+    inline uint16_t float_to_half(float f)
+    {
+        constexpr uint32_t infinity = 255u << 23;
+        constexpr uint32_t halfOverflow = (127u + 16u) << 23;
+        constexpr uint32_t halfNormalMin = (127u - 14u) << 23;
+
+        // Adding 0.5 aligns the mantissa of half denormals to the lowest bits, rounding by the FPU.
+        constexpr uint32_t denormMagic = ((127u - 15u) + (23u - 10u) + 1u) << 23;
+
+        uint32_t u = std::bit_cast<uint32_t>(f);
+        const uint32_t sign = u & 0x80000000u;
+        u ^= sign;
+
+        uint32_t h;
+        if (u >= halfOverflow)
+        {
+            h = (u > infinity) ? (0x7E00u | ((u >> 13) & 0x3FFu)) : 0x7C00u;
+        }
+        else if (u < halfNormalMin)
+        {
+            h = std::bit_cast<uint32_t>(std::bit_cast<float>(u) + std::bit_cast<float>(denormMagic)) - denormMagic;
+        }
+        else
+        {
+            const uint32_t mantissaOdd = (u >> 13) & 1u;
+
+            // Rebias the exponent and round to nearest even.
+            u += ((15u - 127u) << 23) + 0xFFFu + mantissaOdd;
+            h = u >> 13;
+        }
+
+        return (uint16_t)(h | (sign >> 16));
+    }
+
+    /// <summary>
+    /// Converts half precision to a float. Exact.
+    /// </summary>
+    /// <param name="h">Half bits</param>
+    /// <returns>Float</returns>
+    inline float half_to_float(uint16_t h)
+    {
+        constexpr uint32_t exponentMask = 0x7C00u << 13;
+        constexpr float denormMagic = std::bit_cast<float>(113u << 23);
+
+        uint32_t u = (uint32_t)(h & 0x7FFFu) << 13;
+        const uint32_t exponent = u & exponentMask;
+
+        u += (127u - 15u) << 23;
+
+        if (exponent == exponentMask)
+        {
+            // Infinity or NaN
+            u += (128u - 16u) << 23;
+            u |= (u & 0x007FFFFFu) ? 0x00400000u : 0u;
+        }
+        else if (exponent == 0)
+        {
+            // Zero or denormal
+            u = std::bit_cast<uint32_t>(std::bit_cast<float>(u + (1u << 23)) - denormMagic);
+        }
+
+        return std::bit_cast<float>(u | ((uint32_t)(h & 0x8000u) << 16));
+    }
+
+    /// <summary>
+    /// Converts n floats to half precision.
+    /// </summary>
+    /// <param name="r">Halves</param>
+    /// <param name="v">Floats</param>
+    /// <param name="n">Number of scalars</param>
+    inline void float_to_half_array(uint16_t* r, const float* v, size_t n)
+    {
+        for (size_t i = 0; i < n; ++i)
+        {
+            r[i] = float_to_half(v[i]);
+        }
+    }
+
+    /// <summary>
+    /// Converts n halves to floats.
+    /// </summary>
+    /// <param name="r">Floats</param>
+    /// <param name="v">Halves</param>
+    /// <param name="n">Number of scalars</param>
+    inline void half_to_float_array(float* r, const uint16_t* v, size_t n)
+    {
+        for (size_t i = 0; i < n; ++i)
+        {
+            r[i] = half_to_float(v[i]);
+        }
+    }
+
+    /// <summary>
+    /// Converts n xyzw vectors to tightly packed xyz halves. w is dropped.
+    /// </summary>
+    /// <param name="r">Halves (3 * n)</param>
+    /// <param name="v">Vectors (4 * n floats)</param>
+    /// <param name="n">Number of vectors</param>
+    inline void vec3_float_to_half_array(uint16_t* r, const float* v, size_t n)
+    {
+        for (size_t i = 0; i < n; ++i)
+        {
+            r[i * 3]     = float_to_half(v[i * 4]);
+            r[i * 3 + 1] = float_to_half(v[i * 4 + 1]);
+            r[i * 3 + 2] = float_to_half(v[i * 4 + 2]);
+        }
+    }
+
+    /// <summary>
+    /// Converts n tightly packed xyz halves to xyzw vectors. w is written as 0.
+    /// </summary>
+    /// <param name="r">Vectors (4 * n floats)</param>
+    /// <param name="v">Halves (3 * n)</param>
+    /// <param name="n">Number of vectors</param>
+    inline void vec3_half_to_float_array(float* r, const uint16_t* v, size_t n)
+    {
+        for (size_t i = 0; i < n; ++i)
+        {
+            r[i * 4]     = half_to_float(v[i * 3]);
+            r[i * 4 + 1] = half_to_float(v[i * 3 + 1]);
+            r[i * 4 + 2] = half_to_float(v[i * 3 + 2]);
+            r[i * 4 + 3] = 0.0f;
+        }
+    }
+
+    // =================== //
+    //   Vector3 packing   //
+    // =================== //
+
+    // 3d vectors are xyzw like TVector3. Rounding is to nearest even, like the SIMD conversions.
+    //
+    // Octahedral: The unit vector is projected onto the octahedron |x| + |y| + |z| = 1, the lower half folded over the upper half and x, y stored as snorm16
+    // (x in the low 16 bits). Decoded vectors are renormalized. A zero vector decodes to +z.
+    // 10:10:10:2: x, y, z as snorm10 from bit 0, 10 and 20, w as snorm2 (-1, 0 or 1) from bit 30, e.g. the handedness of a tangent.
+    // Quantized: x, y, z as unorm16 of (v - offset) * scale, tightly packed. Decoded as q * scale + offset with the inverse scale.
+
+    /// <summary>
+    /// Encodes n unit vectors as 2x16 bit octahedral coordinates.
+    /// </summary>
+    /// <param name="r">Encoded vectors</param>
+    /// <param name="v">Unit vectors (4 * n floats)</param>
+    /// <param name="n">Number of vectors</param>
+    inline void vec3_encode_oct_array(uint32_t* r, const float* v, size_t n)
+    {
+        for (size_t i = 0; i < n; ++i)
+        {
+            const float x = v[i * 4], y = v[i * 4 + 1], z = v[i * 4 + 2];
+
+            const float l1 = std::fabs(x) + std::fabs(y) + std::fabs(z);
+            const float s = (l1 > 0.0f) ? 1.0f / l1 : 0.0f;
+
+            float px = x * s;
+            float py = y * s;
+
+            if (z < 0.0f)
+            {
+                const float fx = (1.0f - std::fabs(py)) * std::copysign(1.0f, px);
+                py = (1.0f - std::fabs(px)) * std::copysign(1.0f, py);
+                px = fx;
+            }
+
+            const int32_t qx = (int32_t)std::nearbyint(std::fmin(std::fmax(px, -1.0f), 1.0f) * 32767.0f);
+            const int32_t qy = (int32_t)std::nearbyint(std::fmin(std::fmax(py, -1.0f), 1.0f) * 32767.0f);
+
+            r[i] = ((uint32_t)qx & 0xFFFFu) | ((uint32_t)qy << 16);
+        }
+    }
+
+    /// <summary>
+    /// Decodes n 2x16 bit octahedral coordinates to unit vectors. w of the result is 0.
+    /// </summary>
+    /// <param name="r">Unit vectors (4 * n floats)</param>
+    /// <param name="v">Encoded vectors</param>
+    /// <param name="n">Number of vectors</param>
+    inline void vec3_decode_oct_array(float* r, const uint32_t* v, size_t n)
+    {
+        for (size_t i = 0; i < n; ++i)
+        {
+            float x = std::fmax((float)(int16_t)(v[i] & 0xFFFFu) * (1.0f / 32767.0f), -1.0f);
+            float y = std::fmax((float)(int16_t)(v[i] >> 16) * (1.0f / 32767.0f), -1.0f);
+            const float z = 1.0f - std::fabs(x) - std::fabs(y);
+
+            // Unfold the lower half.
+            const float t = std::fmax(-z, 0.0f);
+            x -= std::copysign(t, x);
+            y -= std::copysign(t, y);
+
+            const float l = std::sqrt(x * x + y * y + z * z);
+
+            r[i * 4]     = x / l;
+            r[i * 4 + 1] = y / l;
+            r[i * 4 + 2] = z / l;
+            r[i * 4 + 3] = 0.0f;
+        }
+    }
+
+    /// <summary>
+    /// Encodes n vectors as snorm 10:10:10:2. Components are clamped between -1 and 1.
+    /// </summary>
+    /// <param name="r">Encoded vectors</param>
+    /// <param name="v">Vectors (4 * n floats)</param>
+    /// <param name="n">Number of vectors</param>
+    inline void vec3_encode_1010102_array(uint32_t* r, const float* v, size_t n)
+    {
+        for (size_t i = 0; i < n; ++i)
+        {
+            const int32_t x = (int32_t)std::nearbyint(std::fmin(std::fmax(v[i * 4], -1.0f), 1.0f) * 511.0f);
+            const int32_t y = (int32_t)std::nearbyint(std::fmin(std::fmax(v[i * 4 + 1], -1.0f), 1.0f) * 511.0f);
+            const int32_t z = (int32_t)std::nearbyint(std::fmin(std::fmax(v[i * 4 + 2], -1.0f), 1.0f) * 511.0f);
+            const int32_t w = (int32_t)std::nearbyint(std::fmin(std::fmax(v[i * 4 + 3], -1.0f), 1.0f));
+
+            r[i] = ((uint32_t)x & 0x3FFu) | (((uint32_t)y & 0x3FFu) << 10) | (((uint32_t)z & 0x3FFu) << 20) | ((uint32_t)w << 30);
+        }
+    }
+
+    /// <summary>
+    /// Decodes n snorm 10:10:10:2 vectors.
+    /// </summary>
+    /// <param name="r">Vectors (4 * n floats)</param>
+    /// <param name="v">Encoded vectors</param>
+    /// <param name="n">Number of vectors</param>
+    inline void vec3_decode_1010102_array(float* r, const uint32_t* v, size_t n)
+    {
+        for (size_t i = 0; i < n; ++i)
+        {
+            // Shift each field to the top, then back with sign extension.
+            const int32_t x = (int32_t)(v[i] << 22) >> 22;
+            const int32_t y = (int32_t)(v[i] << 12) >> 22;
+            const int32_t z = (int32_t)(v[i] << 2) >> 22;
+            const int32_t w = (int32_t)v[i] >> 30;
+
+            r[i * 4]     = std::fmax((float)x * (1.0f / 511.0f), -1.0f);
+            r[i * 4 + 1] = std::fmax((float)y * (1.0f / 511.0f), -1.0f);
+            r[i * 4 + 2] = std::fmax((float)z * (1.0f / 511.0f), -1.0f);
+            r[i * 4 + 3] = std::fmax((float)w, -1.0f);
+        }
+    }
+
+    /// <summary>
+    /// Quantizes n vectors to 3x16 bit unorm. Components outside of the range are clamped.
+    /// </summary>
+    /// <param name="r">Quantized vectors (3 * n)</param>
+    /// <param name="v">Vectors (4 * n floats)</param>
+    /// <param name="offset">Vector mapped to 0 (3 floats)</param>
+    /// <param name="scale">Scale per axis (3 floats)</param>
+    /// <param name="n">Number of vectors</param>
+    inline void vec3_quantize_array(uint16_t* r, const float* v, const float* offset, const float* scale, size_t n)
+    {
+        for (size_t i = 0; i < n; ++i)
+        {
+            for (size_t k = 0; k < 3; ++k)
+            {
+                const float q = std::fmin(std::fmax((v[i * 4 + k] - offset[k]) * scale[k], 0.0f), 65535.0f);
+                r[i * 3 + k] = (uint16_t)std::nearbyint(q);
+            }
+        }
+    }
+
+    /// <summary>
+    /// Dequantizes n 3x16 bit unorm vectors. w of the result is 0.
+    /// </summary>
+    /// <param name="r">Vectors (4 * n floats)</param>
+    /// <param name="v">Quantized vectors (3 * n)</param>
+    /// <param name="offset">Vector mapped to 0 (3 floats)</param>
+    /// <param name="scale">Scale per axis (3 floats)</param>
+    /// <param name="n">Number of vectors</param>
+    inline void vec3_dequantize_array(float* r, const uint16_t* v, const float* offset, const float* scale, size_t n)
+    {
+        for (size_t i = 0; i < n; ++i)
+        {
+            r[i * 4]     = (float)v[i * 3] * scale[0] + offset[0];
+            r[i * 4 + 1] = (float)v[i * 3 + 1] * scale[1] + offset[1];
+            r[i * 4 + 2] = (float)v[i * 3 + 2] * scale[2] + offset[2];
+            r[i * 4 + 3] = 0.0f;
+        }
+    }
+}
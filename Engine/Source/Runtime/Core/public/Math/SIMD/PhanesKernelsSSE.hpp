@@ -0,0 +1,1718 @@
+#pragma once
+
+// SSE4.2 kernels on raw memory. These are shared by the TMatrix4 / TVector4 specializations and the runtime dispatcher.
+//
+// Matrices are 16 floats in column-major order. Vector arrays are tightly packed xyzw.
+// 2d vector arrays are tightly packed xy, two vectors are processed per register (x0 y0 x1 y1).
+
+#include <cstddef>
+#include <cstdint>
+#include <nmmintrin.h>
+
+#include "Core/public/Math/SIMD/Platform.h"
+#include "Core/public/Math/SIMD/PhanesKernelsFPU.hpp"
+
+
+namespace Phanes::Core::Math::SIMD::SSE
+{
+    namespace Internal
+    {
+        // Computes one block of 2x2 sub-determinants used by the cofactor expansion.
+        // From: GLM: https://github.com/g-truc/glm/blob/master/glm/simd/matrix.h (MIT License)
+        template<int P, int Q>
+        P_TARGET_SSE inline __m128 mat4_sub_factor(__m128 c1, __m128 c2, __m128 c3)
+        {
+            __m128 Swp0a = _mm_shuffle_ps(c3, c2, _MM_SHUFFLE(P, P, P, P));
+            __m128 Swp0b = _mm_shuffle_ps(c3, c2, _MM_SHUFFLE(Q, Q, Q, Q));
+
+            __m128 Swp00 = _mm_shuffle_ps(c2, c1, _MM_SHUFFLE(Q, Q, Q, Q));
+            __m128 Swp01 = _mm_shuffle_ps(Swp0a, Swp0a, _MM_SHUFFLE(2, 0, 0, 0));
+            __m128 Swp02 = _mm_shuffle_ps(Swp0b, Swp0b, _MM_SHUFFLE(2, 0, 0, 0));
+            __m128 Swp03 = _mm_shuffle_ps(c2, c1, _MM_SHUFFLE(P, P, P, P));
+
+            return _mm_sub_ps(_mm_mul_ps(Swp00, Swp01), _mm_mul_ps(Swp02, Swp03));
+        }
+
+        // Computes the adjugate of the matrix stored in c. Returns the determinant in all lanes.
+        // From: GLM: https://github.com/g-truc/glm/blob/master/glm/simd/matrix.h (MIT License)
+        P_TARGET_SSE inline __m128 mat4_adjugate(const __m128 c[4], __m128 inv[4])
+        {
+            //	valType SubFactor00 = m[2][2] * m[3][3] - m[3][2] * m[2][3];
+            //	valType SubFactor06 = m[1][2] * m[3][3] - m[3][2] * m[1][3];
+            //	valType SubFactor13 = m[1][2] * m[2][3] - m[2][2] * m[1][3];
+            __m128 Fac0 = mat4_sub_factor<3, 2>(c[1], c[2], c[3]);
+
+            //	valType SubFactor01 = m[2][1] * m[3][3] - m[3][1] * m[2][3];
+            //	valType SubFactor07 = m[1][1] * m[3][3] - m[3][1] * m[1][3];
+            //	valType SubFactor14 = m[1][1] * m[2][3] - m[2][1] * m[1][3];
+            __m128 Fac1 = mat4_sub_factor<3, 1>(c[1], c[2], c[3]);
+
+            //	valType SubFactor02 = m[2][1] * m[3][2] - m[3][1] * m[2][2];
+            //	valType SubFactor08 = m[1][1] * m[3][2] - m[3][1] * m[1][2];
+            //	valType SubFactor15 = m[1][1] * m[2][2] - m[2][1] * m[1][2];
+            __m128 Fac2 = mat4_sub_factor<2, 1>(c[1], c[2], c[3]);
+
+            //	valType SubFactor03 = m[2][0] * m[3][3] - m[3][0] * m[2][3];
+            //	valType SubFactor09 = m[1][0] * m[3][3] - m[3][0] * m[1][3];
+            //	valType SubFactor16 = m[1][0] * m[2][3] - m[2][0] * m[1][3];
+            __m128 Fac3 = mat4_sub_factor<3, 0>(c[1], c[2], c[3]);
+
+            //	valType SubFactor04 = m[2][0] * m[3][2] - m[3][0] * m[2][2];
+            //	valType SubFactor10 = m[1][0] * m[3][2] - m[3][0] * m[1][2];
+            //	valType SubFactor17 = m[1][0] * m[2][2] - m[2][0] * m[1][2];
+            __m128 Fac4 = mat4_sub_factor<2, 0>(c[1], c[2], c[3]);
+
+            //	valType SubFactor05 = m[2][0] * m[3][1] - m[3][0] * m[2][1];
+            //	valType SubFactor12 = m[1][0] * m[3][1] - m[3][0] * m[1][1];
+            //	valType SubFactor18 = m[1][0] * m[2][1] - m[2][0] * m[1][1];
+            __m128 Fac5 = mat4_sub_factor<1, 0>(c[1], c[2], c[3]);
+
+            __m128 SignA = _mm_set_ps(1.0f, -1.0f, 1.0f, -1.0f);
+            __m128 SignB = _mm_set_ps(-1.0f, 1.0f, -1.0f, 1.0f);
+
+            // m[1][0], m[0][0], m[0][0], m[0][0]
+            __m128 Temp0 = _mm_shuffle_ps(c[1], c[0], _MM_SHUFFLE(0, 0, 0, 0));
+            __m128 Vec0 = _mm_shuffle_ps(Temp0, Temp0, _MM_SHUFFLE(2, 2, 2, 0));
+
+            // m[1][1], m[0][1], m[0][1], m[0][1]
+            __m128 Temp1 = _mm_shuffle_ps(c[1], c[0], _MM_SHUFFLE(1, 1, 1, 1));
+            __m128 Vec1 = _mm_shuffle_ps(Temp1, Temp1, _MM_SHUFFLE(2, 2, 2, 0));
+
+            // m[1][2], m[0][2], m[0][2], m[0][2]
+            __m128 Temp2 = _mm_shuffle_ps(c[1], c[0], _MM_SHUFFLE(2, 2, 2, 2));
+            __m128 Vec2 = _mm_shuffle_ps(Temp2, Temp2, _MM_SHUFFLE(2, 2, 2, 0));
+
+            // m[1][3], m[0][3], m[0][3], m[0][3]
+            __m128 Temp3 = _mm_shuffle_ps(c[1], c[0], _MM_SHUFFLE(3, 3, 3, 3));
+            __m128 Vec3 = _mm_shuffle_ps(Temp3, Temp3, _MM_SHUFFLE(2, 2, 2, 0));
+
+            // col0
+            // + (Vec1[0] * Fac0[0] - Vec2[0] * Fac1[0] + Vec3[0] * Fac2[0]), ...
+            inv[0] = _mm_mul_ps(SignB, _mm_add_ps(_mm_sub_ps(_mm_mul_ps(Vec1, Fac0), _mm_mul_ps(Vec2, Fac1)), _mm_mul_ps(Vec3, Fac2)));
+
+            // col1
+            // - (Vec0[0] * Fac0[0] - Vec2[0] * Fac3[0] + Vec3[0] * Fac4[0]), ...
+            inv[1] = _mm_mul_ps(SignA, _mm_add_ps(_mm_sub_ps(_mm_mul_ps(Vec0, Fac0), _mm_mul_ps(Vec2, Fac3)), _mm_mul_ps(Vec3, Fac4)));
+
+            // col2
+            // + (Vec0[0] * Fac1[0] - Vec1[0] * Fac3[0] + Vec3[0] * Fac5[0]), ...
+            inv[2] = _mm_mul_ps(SignB, _mm_add_ps(_mm_sub_ps(_mm_mul_ps(Vec0, Fac1), _mm_mul_ps(Vec1, Fac3)), _mm_mul_ps(Vec3, Fac5)));
+
+            // col3
+            // - (Vec0[0] * Fac2[0] - Vec1[0] * Fac4[0] + Vec2[0] * Fac5[0]), ...
+            inv[3] = _mm_mul_ps(SignA, _mm_add_ps(_mm_sub_ps(_mm_mul_ps(Vec0, Fac2), _mm_mul_ps(Vec1, Fac4)), _mm_mul_ps(Vec2, Fac5)));
+
+            __m128 Row0 = _mm_shuffle_ps(inv[0], inv[1], _MM_SHUFFLE(0, 0, 0, 0));
+            __m128 Row1 = _mm_shuffle_ps(inv[2], inv[3], _MM_SHUFFLE(0, 0, 0, 0));
+            __m128 Row2 = _mm_shuffle_ps(Row0, Row1, _MM_SHUFFLE(2, 0, 2, 0));
+
+            //	valType Determinant = m[0][0] * Inverse[0][0]
+            //						+ m[0][1] * Inverse[1][0]
+            //						+ m[0][2] * Inverse[2][0]
+            //						+ m[0][3] * Inverse[3][0];
+            return _mm_dp_ps(c[0], Row2, 0xFF);
+        }
+
+        enum class ENormalizeMode
+        {
+            Approximate,
+            Refined,
+            Exact
+        };
+
+        // Gets 1 / sqrt(l) (or sqrt(l) for Exact, as the vectors are divided then).
+        template<ENormalizeMode M>
+        P_TARGET_SSE inline __m128 vec4_rsqrt(__m128 l)
+        {
+            if constexpr (M == ENormalizeMode::Exact)
+            {
+                return _mm_sqrt_ps(l);
+            }
+            else
+            {
+                __m128 rs = _mm_rsqrt_ps(l);
+
+                if constexpr (M == ENormalizeMode::Refined)
+                {
+                    // Newton-Raphson: r = r * (1.5 - 0.5 * l * r * r)
+                    __m128 hl = _mm_mul_ps(l, _mm_set1_ps(0.5f));
+                    rs = _mm_mul_ps(rs, _mm_sub_ps(_mm_set1_ps(1.5f), _mm_mul_ps(_mm_mul_ps(hl, rs), rs)));
+                }
+                return rs;
+            }
+        }
+
+        // Scales one vector by its broadcast (reciprocal) length. Vectors with a too short length are set to zero.
+        template<ENormalizeMode M>
+        P_TARGET_SSE inline __m128 vec4_scale_normalize(__m128 v, __m128 s, __m128 isShort)
+        {
+            __m128 r = (M == ENormalizeMode::Exact) ? _mm_div_ps(v, s) : _mm_mul_ps(v, s);
+            return _mm_andnot_ps(isShort, r);
+        }
+
+        template<ENormalizeMode M>
+        P_TARGET_SSE inline void vec4_normalize_array(float* r, const float* v, size_t n, float minLength)
+        {
+            const __m128 minLen2 = _mm_set1_ps(minLength * minLength);
+
+            size_t i = 0;
+
+            for (; i + 4 <= n; i += 4)
+            {
+                __m128 v0 = _mm_loadu_ps(v + i * 4);
+                __m128 v1 = _mm_loadu_ps(v + i * 4 + 4);
+                __m128 v2 = _mm_loadu_ps(v + i * 4 + 8);
+                __m128 v3 = _mm_loadu_ps(v + i * 4 + 12);
+
+                __m128 p0 = _mm_mul_ps(v0, v0);
+                __m128 p1 = _mm_mul_ps(v1, v1);
+                __m128 p2 = _mm_mul_ps(v2, v2);
+                __m128 p3 = _mm_mul_ps(v3, v3);
+
+                _MM_TRANSPOSE4_PS(p0, p1, p2, p3);
+
+                // Squared lengths of the four vectors
+                __m128 l = _mm_add_ps(_mm_add_ps(p0, p1), _mm_add_ps(p2, p3));
+
+                __m128 s = vec4_rsqrt<M>(l);
+                __m128 isShort = _mm_cmplt_ps(l, minLen2);
+
+                _mm_storeu_ps(r + i * 4,      vec4_scale_normalize<M>(v0, _mm_shuffle_ps(s, s, _MM_SHUFFLE(0, 0, 0, 0)), _mm_shuffle_ps(isShort, isShort, _MM_SHUFFLE(0, 0, 0, 0))));
+                _mm_storeu_ps(r + i * 4 + 4,  vec4_scale_normalize<M>(v1, _mm_shuffle_ps(s, s, _MM_SHUFFLE(1, 1, 1, 1)), _mm_shuffle_ps(isShort, isShort, _MM_SHUFFLE(1, 1, 1, 1))));
+                _mm_storeu_ps(r + i * 4 + 8,  vec4_scale_normalize<M>(v2, _mm_shuffle_ps(s, s, _MM_SHUFFLE(2, 2, 2, 2)), _mm_shuffle_ps(isShort, isShort, _MM_SHUFFLE(2, 2, 2, 2))));
+                _mm_storeu_ps(r + i * 4 + 12, vec4_scale_normalize<M>(v3, _mm_shuffle_ps(s, s, _MM_SHUFFLE(3, 3, 3, 3)), _mm_shuffle_ps(isShort, isShort, _MM_SHUFFLE(3, 3, 3, 3))));
+            }
+
+            for (; i < n; ++i)
+            {
+                __m128 x = _mm_loadu_ps(v + i * 4);
+                __m128 l = _mm_dp_ps(x, x, 0xFF);
+
+                _mm_storeu_ps(r + i * 4, vec4_scale_normalize<M>(x, vec4_rsqrt<M>(l), _mm_cmplt_ps(l, minLen2)));
+            }
+        }
+
+        // Gets the cross product of one 3d vector pair. w of the result is 0.
+        P_TARGET_SSE inline __m128 vec3_cross(__m128 a, __m128 b)
+        {
+            __m128 t = _mm_sub_ps(_mm_mul_ps(a, _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 0, 2, 1))), _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 0, 2, 1)), b));
+            return _mm_shuffle_ps(t, t, _MM_SHUFFLE(3, 0, 2, 1));
+        }
+
+        template<ENormalizeMode M>
+        P_TARGET_SSE inline void vec3_normalize_array(float* r, const float* v, size_t n, float minLength)
+        {
+            const __m128 minLen2 = _mm_set1_ps(minLength * minLength);
+
+            size_t i = 0;
+
+            for (; i + 4 <= n; i += 4)
+            {
+                __m128 x = _mm_loadu_ps(v + i * 4);
+                __m128 y = _mm_loadu_ps(v + i * 4 + 4);
+                __m128 z = _mm_loadu_ps(v + i * 4 + 8);
+                __m128 w = _mm_loadu_ps(v + i * 4 + 12);
+
+                _MM_TRANSPOSE4_PS(x, y, z, w);
+
+                // Squared lengths of the four vectors
+                __m128 l = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_mul_ps(z, z));
+
+                __m128 s = vec4_rsqrt<M>(l);
+                __m128 isShort = _mm_cmplt_ps(l, minLen2);
+
+                x = vec4_scale_normalize<M>(x, s, isShort);
+                y = vec4_scale_normalize<M>(y, s, isShort);
+                z = vec4_scale_normalize<M>(z, s, isShort);
+                w = _mm_setzero_ps();
+
+                _MM_TRANSPOSE4_PS(x, y, z, w);
+
+                _mm_storeu_ps(r + i * 4,      x);
+                _mm_storeu_ps(r + i * 4 + 4,  y);
+                _mm_storeu_ps(r + i * 4 + 8,  z);
+                _mm_storeu_ps(r + i * 4 + 12, w);
+            }
+
+            for (; i < n; ++i)
+            {
+                __m128 x = _mm_blend_ps(_mm_loadu_ps(v + i * 4), _mm_setzero_ps(), 0x8);
+                __m128 l = _mm_dp_ps(x, x, 0x7F);
+
+                _mm_storeu_ps(r + i * 4, vec4_scale_normalize<M>(x, vec4_rsqrt<M>(l), _mm_cmplt_ps(l, minLen2)));
+            }
+        }
+
+        // Source of w for the transform kernels.
+        enum class ETransformMode
+        {
+            Vector,     // w of the input vector
+            Point,      // w = 1
+            Direction   // w = 0
+        };
+
+        // Distance of the prefetches in the transform kernels in floats (four cache lines ahead).
+        constexpr size_t TransformPrefetchDistance = 64;
+
+        // Transforms one vector with the matrix columns c0 - c3.
+        template<ETransformMode M>
+        P_TARGET_SSE inline __m128 mat4_transform(__m128 c0, __m128 c1, __m128 c2, __m128 c3, __m128 v)
+        {
+            __m128 s01 = _mm_add_ps(_mm_mul_ps(c0, _mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 0, 0, 0))), _mm_mul_ps(c1, _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1))));
+            __m128 s2 = _mm_mul_ps(c2, _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2)));
+
+            if constexpr (M == ETransformMode::Vector)
+            {
+                return _mm_add_ps(s01, _mm_add_ps(s2, _mm_mul_ps(c3, _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3)))));
+            }
+            else if constexpr (M == ETransformMode::Point)
+            {
+                return _mm_add_ps(s01, _mm_add_ps(s2, c3));
+            }
+            else
+            {
+                return _mm_add_ps(s01, s2);
+            }
+        }
+
+        template<ETransformMode M>
+        P_TARGET_SSE inline void mat4_transform_array(float* r, const float* m, const float* v, size_t n, bool stream)
+        {
+            const __m128 c0 = _mm_loadu_ps(m);
+            const __m128 c1 = _mm_loadu_ps(m + 4);
+            const __m128 c2 = _mm_loadu_ps(m + 8);
+            const __m128 c3 = _mm_loadu_ps(m + 12);
+
+            // Non-temporal stores need 16 byte aligned memory.
+            stream = stream && (reinterpret_cast<uintptr_t>(r) & 15) == 0;
+
+            size_t i = 0;
+
+            // Four vectors fill one cache line.
+            for (; i + 4 <= n; i += 4)
+            {
+                _mm_prefetch(reinterpret_cast<const char*>(v + i * 4 + TransformPrefetchDistance), _MM_HINT_T0);
+
+                __m128 t0 = mat4_transform<M>(c0, c1, c2, c3, _mm_loadu_ps(v + i * 4));
+                __m128 t1 = mat4_transform<M>(c0, c1, c2, c3, _mm_loadu_ps(v + i * 4 + 4));
+                __m128 t2 = mat4_transform<M>(c0, c1, c2, c3, _mm_loadu_ps(v + i * 4 + 8));
+                __m128 t3 = mat4_transform<M>(c0, c1, c2, c3, _mm_loadu_ps(v + i * 4 + 12));
+
+                if (stream)
+                {
+                    _mm_stream_ps(r + i * 4,      t0);
+                    _mm_stream_ps(r + i * 4 + 4,  t1);
+                    _mm_stream_ps(r + i * 4 + 8,  t2);
+                    _mm_stream_ps(r + i * 4 + 12, t3);
+                }
+                else
+                {
+                    _mm_storeu_ps(r + i * 4,      t0);
+                    _mm_storeu_ps(r + i * 4 + 4,  t1);
+                    _mm_storeu_ps(r + i * 4 + 8,  t2);
+                    _mm_storeu_ps(r + i * 4 + 12, t3);
+                }
+            }
+
+            for (; i < n; ++i)
+            {
+                __m128 t = mat4_transform<M>(c0, c1, c2, c3, _mm_loadu_ps(v + i * 4));
+
+                if (stream)
+                {
+                    _mm_stream_ps(r + i * 4, t);
+                }
+                else
+                {
+                    _mm_storeu_ps(r + i * 4, t);
+                }
+            }
+
+            if (stream)
+            {
+                _mm_sfence();
+            }
+        }
+    }
+
+
+    // =========== //
+    //   Matrix4   //
+    // =========== //
+
+    /// <summary>
+    /// Gets the determinant of a 4x4 matrix.
+    /// </summary>
+    /// <param name="m">Matrix</param>
+    /// <returns>Determinant</returns>
+    P_TARGET_SSE inline float mat4_det(const float* m)
+    {
+        __m128 c[4] = { _mm_loadu_ps(m), _mm_loadu_ps(m + 4), _mm_loadu_ps(m + 8), _mm_loadu_ps(m + 12) };
+        __m128 inv[4];
+
+        return _mm_cvtss_f32(Internal::mat4_adjugate(c, inv));
+    }
+
+    /// <summary>
+    /// Inverts a 4x4 matrix. r may alias m.
+    /// </summary>
+    /// <param name="r">Inverted matrix</param>
+    /// <param name="m">Matrix</param>
+    /// <returns>False, if the matrix is singular. r is left untouched.</returns>
+    P_TARGET_SSE inline bool mat4_inv(float* r, const float* m)
+    {
+        __m128 c[4] = { _mm_loadu_ps(m), _mm_loadu_ps(m + 4), _mm_loadu_ps(m + 8), _mm_loadu_ps(m + 12) };
+        __m128 inv[4];
+
+        __m128 Det0 = Internal::mat4_adjugate(c, inv);
+
+        if (_mm_cvtss_f32(Det0) == 0.0f)
+        {
+            return false;
+        }
+
+        __m128 Rcp0 = _mm_div_ps(_mm_set1_ps(1.0f), Det0);
+
+        //	Inverse /= Determinant;
+        _mm_storeu_ps(r,      _mm_mul_ps(inv[0], Rcp0));
+        _mm_storeu_ps(r + 4,  _mm_mul_ps(inv[1], Rcp0));
+        _mm_storeu_ps(r + 8,  _mm_mul_ps(inv[2], Rcp0));
+        _mm_storeu_ps(r + 12, _mm_mul_ps(inv[3], Rcp0));
+
+        return true;
+    }
+
+    /// <summary>
+    /// Transposes a 4x4 matrix. r may alias m.
+    /// </summary>
+    /// <param name="r">Transposed matrix</param>
+    /// <param name="m">Matrix</param>
+    P_TARGET_SSE inline void mat4_transpose(float* r, const float* m)
+    {
+        __m128 c0 = _mm_loadu_ps(m);
+        __m128 c1 = _mm_loadu_ps(m + 4);
+        __m128 c2 = _mm_loadu_ps(m + 8);
+        __m128 c3 = _mm_loadu_ps(m + 12);
+
+        _MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+
+        _mm_storeu_ps(r,      c0);
+        _mm_storeu_ps(r + 4,  c1);
+        _mm_storeu_ps(r + 8,  c2);
+        _mm_storeu_ps(r + 12, c3);
+    }
+
+
+    /// <summary>
+    /// Multiplies two 4x4 matrices (a * b). Each column of b is broadcast component-wise and accumulated over the columns of a. r may alias a or b.
+    /// </summary>
+    /// <param name="r">Product</param>
+    /// <param name="a">Matrix one</param>
+    /// <param name="b">Matrix two</param>
+    P_TARGET_SSE inline void mat4_mul(float* r, const float* a, const float* b)
+    {
+        __m128 a0 = _mm_loadu_ps(a);
+        __m128 a1 = _mm_loadu_ps(a + 4);
+        __m128 a2 = _mm_loadu_ps(a + 8);
+        __m128 a3 = _mm_loadu_ps(a + 12);
+
+        __m128 c[4];
+
+        for (int i = 0; i < 4; ++i)
+        {
+            __m128 bc = _mm_loadu_ps(b + i * 4);
+
+            __m128 s0 = _mm_mul_ps(a0, _mm_shuffle_ps(bc, bc, _MM_SHUFFLE(0, 0, 0, 0)));
+            __m128 s1 = _mm_mul_ps(a1, _mm_shuffle_ps(bc, bc, _MM_SHUFFLE(1, 1, 1, 1)));
+            __m128 s2 = _mm_mul_ps(a2, _mm_shuffle_ps(bc, bc, _MM_SHUFFLE(2, 2, 2, 2)));
+            __m128 s3 = _mm_mul_ps(a3, _mm_shuffle_ps(bc, bc, _MM_SHUFFLE(3, 3, 3, 3)));
+
+            c[i] = _mm_add_ps(_mm_add_ps(s0, s1), _mm_add_ps(s2, s3));
+        }
+
+        _mm_storeu_ps(r,      c[0]);
+        _mm_storeu_ps(r + 4,  c[1]);
+        _mm_storeu_ps(r + 8,  c[2]);
+        _mm_storeu_ps(r + 12, c[3]);
+    }
+
+    /// <summary>
+    /// Transforms a vector with a 4x4 matrix (m * v). r may alias v.
+    /// </summary>
+    /// <param name="r">Transformed vector</param>
+    /// <param name="m">Matrix</param>
+    /// <param name="v">Vector</param>
+    P_TARGET_SSE inline void mat4_mul_vec(float* r, const float* m, const float* v)
+    {
+        __m128 vc = _mm_loadu_ps(v);
+
+        __m128 s0 = _mm_mul_ps(_mm_loadu_ps(m),      _mm_shuffle_ps(vc, vc, _MM_SHUFFLE(0, 0, 0, 0)));
+        __m128 s1 = _mm_mul_ps(_mm_loadu_ps(m + 4),  _mm_shuffle_ps(vc, vc, _MM_SHUFFLE(1, 1, 1, 1)));
+        __m128 s2 = _mm_mul_ps(_mm_loadu_ps(m + 8),  _mm_shuffle_ps(vc, vc, _MM_SHUFFLE(2, 2, 2, 2)));
+        __m128 s3 = _mm_mul_ps(_mm_loadu_ps(m + 12), _mm_shuffle_ps(vc, vc, _MM_SHUFFLE(3, 3, 3, 3)));
+
+        _mm_storeu_ps(r, _mm_add_ps(_mm_add_ps(s0, s1), _mm_add_ps(s2, s3)));
+    }
+
+    /// <summary>
+    /// Multiplies n pairs of 4x4 matrices (a[i] * b[i]).
+    /// </summary>
+    /// <param name="r">Products (16 * n floats)</param>
+    /// <param name="a">Matrices one</param>
+    /// <param name="b">Matrices two</param>
+    /// <param name="n">Number of matrices</param>
+    P_TARGET_SSE inline void mat4_mul_array(float* r, const float* a, const float* b, size_t n)
+    {
+        for (size_t i = 0; i < n; ++i)
+        {
+            mat4_mul(r + i * 16, a + i * 16, b + i * 16);
+        }
+    }
+
+    /// <summary>
+    /// Transforms n vectors with a 4x4 matrix (m * v[i]). r may alias v.
+    /// </summary>
+    /// <param name="r">Transformed vectors (4 * n floats)</param>
+    /// <param name="m">Matrix</param>
+    /// <param name="v">Vectors</param>
+    /// <param name="n">Number of vectors</param>
+    /// <param name="stream">Write r with non-temporal stores, if r is 16 byte aligned</param>
+    P_TARGET_SSE inline void mat4_transform_array(float* r, const float* m, const float* v, size_t n, bool stream)
+    {
+        Internal::mat4_transform_array<Internal::ETransformMode::Vector>(r, m, v, n, stream);
+    }
+
+    /// <summary>
+    /// Transforms n points with a 4x4 matrix (m * (x, y, z, 1)). w of the input is ignored. r may alias v.
+    /// </summary>
+    /// <param name="r">Transformed points (4 * n floats)</param>
+    /// <param name="m">Matrix</param>
+    /// <param name="v">Points</param>
+    /// <param name="n">Number of points</param>
+    /// <param name="stream">Write r with non-temporal stores, if r is 16 byte aligned</param>
+    P_TARGET_SSE inline void mat4_transform_point_array(float* r, const float* m, const float* v, size_t n, bool stream)
+    {
+        Internal::mat4_transform_array<Internal::ETransformMode::Point>(r, m, v, n, stream);
+    }
+
+    /// <summary>
+    /// Transforms n directions with a 4x4 matrix (m * (x, y, z, 0)). w of the input is ignored. r may alias v.
+    /// </summary>
+    /// <param name="r">Transformed directions (4 * n floats)</param>
+    /// <param name="m">Matrix</param>
+    /// <param name="v">Directions</param>
+    /// <param name="n">Number of directions</param>
+    /// <param name="stream">Write r with non-temporal stores, if r is 16 byte aligned</param>
+    P_TARGET_SSE inline void mat4_transform_dir_array(float* r, const float* m, const float* v, size_t n, bool stream)
+    {
+        Internal::mat4_transform_array<Internal::ETransformMode::Direction>(r, m, v, n, stream);
+    }
+
+    // ================= //
+    //   Vector4 array   //
+    // ================= //
+
+    /// <summary>
+    /// Adds n vectors component-wise.
+    /// </summary>
+    /// <param name="r">Result (4 * n floats)</param>
+    /// <param name="a">Vectors one</param>
+    /// <param name="b">Vectors two</param>
+    /// <param name="n">Number of vectors</param>
+    P_TARGET_SSE inline void vec4_add_array(float* r, const float* a, const float* b, size_t n)
+    {
+        for (size_t i = 0; i < n * 4; i += 4)
+        {
+            _mm_storeu_ps(r + i, _mm_add_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+        }
+    }
+
+    /// <summary>
+    /// Subtracts n vectors component-wise.
+    /// </summary>
+    /// <param name="r">Result (4 * n floats)</param>
+    /// <param name="a">Vectors one</param>
+    /// <param name="b">Vectors two</param>
+    /// <param name="n">Number of vectors</param>
+    P_TARGET_SSE inline void vec4_sub_array(float* r, const float* a, const float* b, size_t n)
+    {
+        for (size_t i = 0; i < n * 4; i += 4)
+        {
+            _mm_storeu_ps(r + i, _mm_sub_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+        }
+    }
+
+    /// <summary>
+    /// Multiplies n vectors component-wise.
+    /// </summary>
+    /// <param name="r">Result (4 * n floats)</param>
+    /// <param name="a">Vectors one</param>
+    /// <param name="b">Vectors two</param>
+    /// <param name="n">Number of vectors</param>
+    P_TARGET_SSE inline void vec4_mul_array(float* r, const float* a, const float* b, size_t n)
+    {
+        for (size_t i = 0; i < n * 4; i += 4)
+        {
+            _mm_storeu_ps(r + i, _mm_mul_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+        }
+    }
+
+    /// <summary>
+    /// Divides n vectors component-wise.
+    /// </summary>
+    /// <param name="r">Result (4 * n floats)</param>
+    /// <param name="a">Vectors one</param>
+    /// <param name="b">Vectors two</param>
+    /// <param name="n">Number of vectors</param>
+    P_TARGET_SSE inline void vec4_div_array(float* r, const float* a, const float* b, size_t n)
+    {
+        for (size_t i = 0; i < n * 4; i += 4)
+        {
+            _mm_storeu_ps(r + i, _mm_div_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+        }
+    }
+
+    /// <summary>
+    /// Gets the dot products of n vector pairs. Four products are transposed and summed at once.
+    /// </summary>
+    /// <param name="r">Dot products (n floats)</param>
+    /// <param name="a">Vectors one</param>
+    /// <param name="b">Vectors two</param>
+    /// <param name="n">Number of vectors</param>
+    P_TARGET_SSE inline void vec4_dot_array(float* r, const float* a, const float* b, size_t n)
+    {
+        size_t i = 0;
+
+        for (; i + 4 <= n; i += 4)
+        {
+            const float* v1 = a + i * 4;
+            const float* v2 = b + i * 4;
+
+            __m128 p0 = _mm_mul_ps(_mm_loadu_ps(v1),      _mm_loadu_ps(v2));
+            __m128 p1 = _mm_mul_ps(_mm_loadu_ps(v1 + 4),  _mm_loadu_ps(v2 + 4));
+            __m128 p2 = _mm_mul_ps(_mm_loadu_ps(v1 + 8),  _mm_loadu_ps(v2 + 8));
+            __m128 p3 = _mm_mul_ps(_mm_loadu_ps(v1 + 12), _mm_loadu_ps(v2 + 12));
+
+            _MM_TRANSPOSE4_PS(p0, p1, p2, p3);
+
+            _mm_storeu_ps(r + i, _mm_add_ps(_mm_add_ps(p0, p1), _mm_add_ps(p2, p3)));
+        }
+
+        for (; i < n; ++i)
+        {
+            r[i] = _mm_cvtss_f32(_mm_dp_ps(_mm_loadu_ps(a + i * 4), _mm_loadu_ps(b + i * 4), 0xF1));
+        }
+    }
+
+    /// <summary>
+    /// Compares n vector pairs. Two vectors are equal, if all components differ by less than threshold.
+    /// </summary>
+    /// <param name="r">Results (n bools)</param>
+    /// <param name="a">Vectors one</param>
+    /// <param name="b">Vectors two</param>
+    /// <param name="n">Number of vectors</param>
+    /// <param name="threshold">Allowed difference per component</param>
+    P_TARGET_SSE inline void vec4_eq_array(bool* r, const float* a, const float* b, size_t n, float threshold)
+    {
+        const __m128 absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+        const __m128 t = _mm_set1_ps(threshold);
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            __m128 d = _mm_and_ps(_mm_sub_ps(_mm_loadu_ps(a + i * 4), _mm_loadu_ps(b + i * 4)), absMask);
+            r[i] = _mm_movemask_ps(_mm_cmplt_ps(d, t)) == 0xF;
+        }
+    }
+
+    /// <summary>
+    /// Normalizes n vectors. Four lengths are computed at once. Vectors shorter than minLength are set to zero, like Normalize does. r may alias v.
+    /// </summary>
+    /// <param name="r">Normalized vectors (4 * n floats)</param>
+    /// <param name="v">Vectors</param>
+    /// <param name="n">Number of vectors</param>
+    /// <param name="minLength">Smallest length, that is normalized</param>
+    P_TARGET_SSE inline void vec4_normalize_array(float* r, const float* v, size_t n, float minLength)
+    {
+        Internal::vec4_normalize_array<Internal::ENormalizeMode::Exact>(r, v, n, minLength);
+    }
+
+    /// <summary>
+    /// Normalizes n vectors with the reciprocal square root estimate (12 bits). Vectors shorter than minLength are set to zero, like Normalize does. r may alias v.
+    /// </summary>
+    /// <param name="r">Normalized vectors (4 * n floats)</param>
+    /// <param name="v">Vectors</param>
+    /// <param name="n">Number of vectors</param>
+    /// <param name="minLength">Smallest length, that is normalized</param>
+    /// <param name="refine">Refine the estimate with a Newton-Raphson step</param>
+    P_TARGET_SSE inline void vec4_normalize_est_array(float* r, const float* v, size_t n, float minLength, bool refine)
+    {
+        if (refine)
+        {
+            Internal::vec4_normalize_array<Internal::ENormalizeMode::Refined>(r, v, n, minLength);
+        }
+        else
+        {
+            Internal::vec4_normalize_array<Internal::ENormalizeMode::Approximate>(r, v, n, minLength);
+        }
+    }
+
+    /// <summary>
+    /// Gets the length of n vectors. Four lengths are computed at once.
+    /// </summary>
+    /// <param name="r">Lengths (n floats)</param>
+    /// <param name="v">Vectors</param>
+    /// <param name="n">Number of vectors</param>
+    P_TARGET_SSE inline void vec4_magnitude_array(float* r, const float* v, size_t n)
+    {
+        size_t i = 0;
+
+        for (; i + 4 <= n; i += 4)
+        {
+            __m128 x = _mm_loadu_ps(v + i * 4);
+            __m128 y = _mm_loadu_ps(v + i * 4 + 4);
+            __m128 z = _mm_loadu_ps(v + i * 4 + 8);
+            __m128 w = _mm_loadu_ps(v + i * 4 + 12);
+
+            _MM_TRANSPOSE4_PS(x, y, z, w);
+
+            __m128 l = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_add_ps(_mm_mul_ps(z, z), _mm_mul_ps(w, w)));
+            _mm_storeu_ps(r + i, _mm_sqrt_ps(l));
+        }
+
+        for (; i < n; ++i)
+        {
+            __m128 x = _mm_loadu_ps(v + i * 4);
+            r[i] = _mm_cvtss_f32(_mm_sqrt_ss(_mm_dp_ps(x, x, 0xF1)));
+        }
+    }
+
+    /// <summary>
+    /// Interpolates n vector pairs linearly (a + t * (b - a)). r may alias a or b.
+    /// </summary>
+    /// <param name="r">Result (4 * n floats)</param>
+    /// <param name="a">Start vectors</param>
+    /// <param name="b">Destination vectors</param>
+    /// <param name="n">Number of vectors</param>
+    /// <param name="t">Interpolation value</param>
+    P_TARGET_SSE inline void vec4_lerp_array(float* r, const float* a, const float* b, size_t n, float t)
+    {
+        const __m128 ts = _mm_set1_ps(t);
+
+        for (size_t i = 0; i < n * 4; i += 4)
+        {
+            __m128 x = _mm_loadu_ps(a + i);
+            _mm_storeu_ps(r + i, _mm_add_ps(x, _mm_mul_ps(ts, _mm_sub_ps(_mm_loadu_ps(b + i), x))));
+        }
+    }
+
+    /// <summary>
+    /// Gets the component-wise minimum of n vectors.
+    /// </summary>
+    /// <param name="r">Minimum (4 floats)</param>
+    /// <param name="v">Vectors</param>
+    /// <param name="n">Number of vectors (at least 1)</param>
+    P_TARGET_SSE inline void vec4_min_reduce(float* r, const float* v, size_t n)
+    {
+        __m128 m0 = _mm_loadu_ps(v);
+        __m128 m1 = m0;
+
+        // Two accumulators, to not wait on the latency of the previous min.
+        size_t i = 1;
+        for (; i + 2 <= n; i += 2)
+        {
+            m0 = _mm_min_ps(m0, _mm_loadu_ps(v + i * 4));
+            m1 = _mm_min_ps(m1, _mm_loadu_ps(v + i * 4 + 4));
+        }
+        if (i < n)
+        {
+            m0 = _mm_min_ps(m0, _mm_loadu_ps(v + i * 4));
+        }
+
+        _mm_storeu_ps(r, _mm_min_ps(m0, m1));
+    }
+
+    /// <summary>
+    /// Gets the component-wise maximum of n vectors.
+    /// </summary>
+    /// <param name="r">Maximum (4 floats)</param>
+    /// <param name="v">Vectors</param>
+    /// <param name="n">Number of vectors (at least 1)</param>
+    P_TARGET_SSE inline void vec4_max_reduce(float* r, const float* v, size_t n)
+    {
+        __m128 m0 = _mm_loadu_ps(v);
+        __m128 m1 = m0;
+
+        size_t i = 1;
+        for (; i + 2 <= n; i += 2)
+        {
+            m0 = _mm_max_ps(m0, _mm_loadu_ps(v + i * 4));
+            m1 = _mm_max_ps(m1, _mm_loadu_ps(v + i * 4 + 4));
+        }
+        if (i < n)
+        {
+            m0 = _mm_max_ps(m0, _mm_loadu_ps(v + i * 4));
+        }
+
+        _mm_storeu_ps(r, _mm_max_ps(m0, m1));
+    }
+
+    // ================= //
+    //   Vector3 array   //
+    // ================= //
+
+    // 3d vectors are stored as xyzw like TVector3. The vectors are transposed to x, y and z registers in blocks of four.
+
+    /// <summary>
+    /// Gets the dot product of n 3d vector pairs. w is ignored.
+    /// </summary>
+    /// <param name="r">Dot products (n floats)</param>
+    /// <param name="a">Vectors one</param>
+    /// <param name="b">Vectors two</param>
+    /// <param name="n">Number of vectors</param>
+    P_TARGET_SSE inline void vec3_dot_array(float* r, const float* a, const float* b, size_t n)
+    {
+        size_t i = 0;
+
+        for (; i + 4 <= n; i += 4)
+        {
+            const float* v1 = a + i * 4;
+            const float* v2 = b + i * 4;
+
+            __m128 p0 = _mm_mul_ps(_mm_loadu_ps(v1),      _mm_loadu_ps(v2));
+            __m128 p1 = _mm_mul_ps(_mm_loadu_ps(v1 + 4),  _mm_loadu_ps(v2 + 4));
+            __m128 p2 = _mm_mul_ps(_mm_loadu_ps(v1 + 8),  _mm_loadu_ps(v2 + 8));
+            __m128 p3 = _mm_mul_ps(_mm_loadu_ps(v1 + 12), _mm_loadu_ps(v2 + 12));
+
+            _MM_TRANSPOSE4_PS(p0, p1, p2, p3);
+
+            _mm_storeu_ps(r + i, _mm_add_ps(_mm_add_ps(p0, p1), p2));
+        }
+
+        for (; i < n; ++i)
+        {
+            r[i] = _mm_cvtss_f32(_mm_dp_ps(_mm_loadu_ps(a + i * 4), _mm_loadu_ps(b + i * 4), 0x71));
+        }
+    }
+
+    /// <summary>
+    /// Gets the cross product of n 3d vector pairs. w of the result is 0. r may alias a or b.
+    /// </summary>
+    /// <param name="r">Cross products (4 * n floats)</param>
+    /// <param name="a">Vectors one</param>
+    /// <param name="b">Vectors two</param>
+    /// <param name="n">Number of vectors</param>
+    P_TARGET_SSE inline void vec3_cross_array(float* r, const float* a, const float* b, size_t n)
+    {
+        size_t i = 0;
+
+        for (; i + 4 <= n; i += 4)
+        {
+            __m128 ax = _mm_loadu_ps(a + i * 4);
+            __m128 ay = _mm_loadu_ps(a + i * 4 + 4);
+            __m128 az = _mm_loadu_ps(a + i * 4 + 8);
+            __m128 aw = _mm_loadu_ps(a + i * 4 + 12);
+
+            __m128 bx = _mm_loadu_ps(b + i * 4);
+            __m128 by = _mm_loadu_ps(b + i * 4 + 4);
+            __m128 bz = _mm_loadu_ps(b + i * 4 + 8);
+            __m128 bw = _mm_loadu_ps(b + i * 4 + 12);
+
+            _MM_TRANSPOSE4_PS(ax, ay, az, aw);
+            _MM_TRANSPOSE4_PS(bx, by, bz, bw);
+
+            __m128 cx = _mm_sub_ps(_mm_mul_ps(ay, bz), _mm_mul_ps(az, by));
+            __m128 cy = _mm_sub_ps(_mm_mul_ps(az, bx), _mm_mul_ps(ax, bz));
+            __m128 cz = _mm_sub_ps(_mm_mul_ps(ax, by), _mm_mul_ps(ay, bx));
+            __m128 cw = _mm_setzero_ps();
+
+            _MM_TRANSPOSE4_PS(cx, cy, cz, cw);
+
+            _mm_storeu_ps(r + i * 4,      cx);
+            _mm_storeu_ps(r + i * 4 + 4,  cy);
+            _mm_storeu_ps(r + i * 4 + 8,  cz);
+            _mm_storeu_ps(r + i * 4 + 12, cw);
+        }
+
+        for (; i < n; ++i)
+        {
+            _mm_storeu_ps(r + i * 4, Internal::vec3_cross(_mm_loadu_ps(a + i * 4), _mm_loadu_ps(b + i * 4)));
+        }
+    }
+
+    /// <summary>
+    /// Gets the length of n 3d vectors. w is ignored.
+    /// </summary>
+    /// <param name="r">Lengths (n floats)</param>
+    /// <param name="v">Vectors</param>
+    /// <param name="n">Number of vectors</param>
+    P_TARGET_SSE inline void vec3_magnitude_array(float* r, const float* v, size_t n)
+    {
+        size_t i = 0;
+
+        for (; i + 4 <= n; i += 4)
+        {
+            __m128 x = _mm_loadu_ps(v + i * 4);
+            __m128 y = _mm_loadu_ps(v + i * 4 + 4);
+            __m128 z = _mm_loadu_ps(v + i * 4 + 8);
+            __m128 w = _mm_loadu_ps(v + i * 4 + 12);
+
+            _MM_TRANSPOSE4_PS(x, y, z, w);
+
+            __m128 l = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_mul_ps(z, z));
+            _mm_storeu_ps(r + i, _mm_sqrt_ps(l));
+        }
+
+        for (; i < n; ++i)
+        {
+            __m128 x = _mm_loadu_ps(v + i * 4);
+            r[i] = _mm_cvtss_f32(_mm_sqrt_ss(_mm_dp_ps(x, x, 0x71)));
+        }
+    }
+
+    /// <summary>
+    /// Normalizes n 3d vectors. Four lengths are computed at once. Vectors shorter than minLength are set to zero, like Normalize does. w of the result is 0. r may alias v.
+    /// </summary>
+    /// <param name="r">Normalized vectors (4 * n floats)</param>
+    /// <param name="v">Vectors</param>
+    /// <param name="n">Number of vectors</param>
+    /// <param name="minLength">Smallest length, that is normalized</param>
+    P_TARGET_SSE inline void vec3_normalize_array(float* r, const float* v, size_t n, float minLength)
+    {
+        Internal::vec3_normalize_array<Internal::ENormalizeMode::Exact>(r, v, n, minLength);
+    }
+
+    /// <summary>
+    /// Normalizes n 3d vectors with the reciprocal square root estimate (12 bits). Vectors shorter than minLength are set to zero, like Normalize does. w of the result is 0. r may alias v.
+    /// </summary>
+    /// <param name="r">Normalized vectors (4 * n floats)</param>
+    /// <param name="v">Vectors</param>
+    /// <param name="n">Number of vectors</param>
+    /// <param name="minLength">Smallest length, that is normalized</param>
+    /// <param name="refine">Refine the estimate with a Newton-Raphson step</param>
+    P_TARGET_SSE inline void vec3_normalize_est_array(float* r, const float* v, size_t n, float minLength, bool refine)
+    {
+        if (refine)
+        {
+            Internal::vec3_normalize_array<Internal::ENormalizeMode::Refined>(r, v, n, minLength);
+        }
+        else
+        {
+            Internal::vec3_normalize_array<Internal::ENormalizeMode::Approximate>(r, v, n, minLength);
+        }
+    }
+
+    // ================= //
+    //   Vector2 array   //
+    // ================= //
+
+    namespace Internal
+    {
+        // Loads one 2d vector into the lower half. The upper half is zero.
+        P_TARGET_SSE inline __m128 vec2_load1(const float* v)
+        {
+            return _mm_castsi128_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(v)));
+        }
+
+        // Stores the lower half.
+        P_TARGET_SSE inline void vec2_store1(float* r, __m128 v)
+        {
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(r), _mm_castps_si128(v));
+        }
+
+        P_TARGET_SSE inline __m128 vec2x2_lerp(__m128 a, __m128 b, __m128 t, __m128 t1)
+        {
+            return _mm_add_ps(_mm_mul_ps(a, t1), _mm_mul_ps(b, t));
+        }
+
+        P_TARGET_SSE inline __m128 vec2x2_normalize(__m128 v, __m128 minLen2)
+        {
+            __m128 sq = _mm_mul_ps(v, v);
+            __m128 l = _mm_add_ps(sq, _mm_shuffle_ps(sq, sq, _MM_SHUFFLE(2, 3, 0, 1)));     // l0 l0 l1 l1
+
+            // Too short vectors are set to zero.
+            return _mm_andnot_ps(_mm_cmplt_ps(l, minLen2), _mm_div_ps(v, _mm_sqrt_ps(l)));
+        }
+    }
+
+    /// <summary>
+    /// Adds n 2d vectors component-wise.
+    /// </summary>
+    /// <param name="r">Result (2 * n floats)</param>
+    /// <param name="a">Vectors one</param>
+    /// <param name="b">Vectors two</param>
+    /// <param name="n">Number of vectors</param>
+    P_TARGET_SSE inline void vec2_add_array(float* r, const float* a, const float* b, size_t n)
+    {
+        size_t i = 0;
+        for (; i + 4 <= n * 2; i += 4)
+        {
+            _mm_storeu_ps(r + i, _mm_add_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+        }
+        if (i < n * 2)
+        {
+            Internal::vec2_store1(r + i, _mm_add_ps(Internal::vec2_load1(a + i), Internal::vec2_load1(b + i)));
+        }
+    }
+
+    /// <summary>
+    /// Multiplies n 2d vectors component-wise.
+    /// </summary>
+    /// <param name="r">Result (2 * n floats)</param>
+    /// <param name="a">Vectors one</param>
+    /// <param name="b">Vectors two</param>
+    /// <param name="n">Number of vectors</param>
+    P_TARGET_SSE inline void vec2_mul_array(float* r, const float* a, const float* b, size_t n)
+    {
+        size_t i = 0;
+        for (; i + 4 <= n * 2; i += 4)
+        {
+            _mm_storeu_ps(r + i, _mm_mul_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+        }
+        if (i < n * 2)
+        {
+            Internal::vec2_store1(r + i, _mm_mul_ps(Internal::vec2_load1(a + i), Internal::vec2_load1(b + i)));
+        }
+    }
+
+    /// <summary>
+    /// Interpolates n pairs of 2d vectors with (1 - t) * a + t * b. t is not clamped.
+    /// </summary>
+    /// <param name="r">Result (2 * n floats)</param>
+    /// <param name="a">Start vectors (t = 0)</param>
+    /// <param name="b">Destination vectors (t = 1)</param>
+    /// <param name="n">Number of vectors</param>
+    /// <param name="t">Interpolation value</param>
+    P_TARGET_SSE inline void vec2_lerp_array(float* r, const float* a, const float* b, size_t n, float t)
+    {
+        const __m128 vt = _mm_set1_ps(t);
+        const __m128 vt1 = _mm_set1_ps(1.0f - t);
+
+        size_t i = 0;
+        for (; i + 4 <= n * 2; i += 4)
+        {
+            _mm_storeu_ps(r + i, Internal::vec2x2_lerp(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i), vt, vt1));
+        }
+        if (i < n * 2)
+        {
+            Internal::vec2_store1(r + i, Internal::vec2x2_lerp(Internal::vec2_load1(a + i), Internal::vec2_load1(b + i), vt, vt1));
+        }
+    }
+
+    /// <summary>
+    /// Normalizes n 2d vectors. Vectors shorter than minLength are set to zero, like Normalize does. r may alias v.
+    /// </summary>
+    /// <param name="r">Normalized vectors (2 * n floats)</param>
+    /// <param name="v">Vectors</param>
+    /// <param name="n">Number of vectors</param>
+    /// <param name="minLength">Smallest length, that is normalized</param>
+    P_TARGET_SSE inline void vec2_normalize_array(float* r, const float* v, size_t n, float minLength)
+    {
+        const __m128 minLen2 = _mm_set1_ps(minLength * minLength);
+
+        size_t i = 0;
+        for (; i + 4 <= n * 2; i += 4)
+        {
+            _mm_storeu_ps(r + i, Internal::vec2x2_normalize(_mm_loadu_ps(v + i), minLen2));
+        }
+        if (i < n * 2)
+        {
+            Internal::vec2_store1(r + i, Internal::vec2x2_normalize(Internal::vec2_load1(v + i), minLen2));
+        }
+    }
+
+    // =========== //
+    //   Culling   //
+    // =========== //
+
+    // Planes are stored as (a, b, c, d) like TPlane (ax + by + cz = d). The side, the normal points to, is inside.
+    // Objects are records of stride floats. r holds one bit per object in (n + 31) / 32 words. A set bit means visible.
+
+    namespace Internal
+    {
+        // Loads count (up to 4) records of stride floats as x = (v0.x, ..., v3.x), y, z and w. Missing records are 0.
+        P_TARGET_SSE inline void vec4x4_load_strided(const float* v, size_t stride, size_t count, __m128& x, __m128& y, __m128& z, __m128& w)
+        {
+            if (count >= 4)
+            {
+                x = _mm_loadu_ps(v);
+                y = _mm_loadu_ps(v + stride);
+                z = _mm_loadu_ps(v + stride * 2);
+                w = _mm_loadu_ps(v + stride * 3);
+            }
+            else
+            {
+                x = _mm_loadu_ps(v);
+                y = (count > 1) ? _mm_loadu_ps(v + stride) : _mm_setzero_ps();
+                z = (count > 2) ? _mm_loadu_ps(v + stride * 2) : _mm_setzero_ps();
+                w = _mm_setzero_ps();
+            }
+
+            _MM_TRANSPOSE4_PS(x, y, z, w);
+        }
+
+        // Loads one float of count (up to 4) records of stride floats. Missing records are 0.
+        P_TARGET_SSE inline __m128 float4_load_strided(const float* v, size_t stride, size_t count)
+        {
+            return _mm_setr_ps(v[0],
+                               (count > 1) ? v[stride] : 0.0f,
+                               (count > 2) ? v[stride * 2] : 0.0f,
+                               (count > 3) ? v[stride * 3] : 0.0f);
+        }
+
+        // Gets a * x + b * y + c * z - d of plane p for four points.
+        P_TARGET_SSE inline __m128 plane_distance4(const float* p, __m128 x, __m128 y, __m128 z)
+        {
+            __m128 d = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(p[0]), x), _mm_mul_ps(_mm_set1_ps(p[1]), y));
+            d = _mm_add_ps(d, _mm_mul_ps(_mm_set1_ps(p[2]), z));
+
+            return _mm_sub_ps(d, _mm_set1_ps(p[3]));
+        }
+
+        /// <summary>
+        /// Gets the visibility bits of count (up to 4) spheres.
+        /// </summary>
+        /// <returns>Bit i is set, if sphere i is visible. Bits of missing spheres are 0.</returns>
+        P_TARGET_SSE inline uint32_t cull_sphere4(const float* p, size_t planeCount, const float* c, const float* radius, size_t stride, size_t count)
+        {
+            __m128 x, y, z, w;
+            vec4x4_load_strided(c, stride, count, x, y, z, w);
+
+            // Radius in w of the center, like TVector4 spheres, saves the extra loads.
+            const __m128 nr = _mm_sub_ps(_mm_setzero_ps(), (radius == c + 3) ? w : float4_load_strided(radius, stride, count));
+
+            __m128 out = _mm_setzero_ps();
+            for (size_t k = 0; k < planeCount; ++k)
+            {
+                out = _mm_or_ps(out, _mm_cmplt_ps(plane_distance4(p + k * 4, x, y, z), nr));
+
+                if (_mm_movemask_ps(out) == 0xF)
+                {
+                    break;
+                }
+            }
+
+            const uint32_t valid = (count >= 4) ? 0xFu : (1u << count) - 1u;
+            return (uint32_t)~_mm_movemask_ps(out) & valid;
+        }
+
+        /// <summary>
+        /// Gets the visibility bits of count (up to 4) axis aligned boxes.
+        /// </summary>
+        /// <returns>Bit i is set, if box i is visible. Bits of missing boxes are 0.</returns>
+        P_TARGET_SSE inline uint32_t cull_aabb4(const float* p, size_t planeCount, const float* mn, const float* mx, size_t stride, size_t count)
+        {
+            __m128 x0, y0, z0, w0;
+            __m128 x1, y1, z1, w1;
+            vec4x4_load_strided(mn, stride, count, x0, y0, z0, w0);
+            vec4x4_load_strided(mx, stride, count, x1, y1, z1, w1);
+
+            const __m128 half = _mm_set1_ps(0.5f);
+
+            // Center and half extent.
+            const __m128 cx = _mm_mul_ps(_mm_add_ps(x1, x0), half);
+            const __m128 cy = _mm_mul_ps(_mm_add_ps(y1, y0), half);
+            const __m128 cz = _mm_mul_ps(_mm_add_ps(z1, z0), half);
+            const __m128 ex = _mm_mul_ps(_mm_sub_ps(x1, x0), half);
+            const __m128 ey = _mm_mul_ps(_mm_sub_ps(y1, y0), half);
+            const __m128 ez = _mm_mul_ps(_mm_sub_ps(z1, z0), half);
+
+            const __m128 absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+
+            __m128 out = _mm_setzero_ps();
+            for (size_t k = 0; k < planeCount; ++k)
+            {
+                const float* pl = p + k * 4;
+
+                // Projected half extent on the normal: |a| * ex + |b| * ey + |c| * ez.
+                __m128 e = _mm_add_ps(_mm_mul_ps(_mm_and_ps(_mm_set1_ps(pl[0]), absMask), ex), _mm_mul_ps(_mm_and_ps(_mm_set1_ps(pl[1]), absMask), ey));
+                e = _mm_add_ps(e, _mm_mul_ps(_mm_and_ps(_mm_set1_ps(pl[2]), absMask), ez));
+
+                out = _mm_or_ps(out, _mm_cmplt_ps(_mm_add_ps(plane_distance4(pl, cx, cy, cz), e), _mm_setzero_ps()));
+
+                if (_mm_movemask_ps(out) == 0xF)
+                {
+                    break;
+                }
+            }
+
+            const uint32_t valid = (count >= 4) ? 0xFu : (1u << count) - 1u;
+            return (uint32_t)~_mm_movemask_ps(out) & valid;
+        }
+    }
+
+    /// <summary>
+    /// Tests n spheres against a set of planes. A sphere is visible, if it is not entirely behind any plane. Four spheres are tested at once.
+    /// </summary>
+    /// <param name="r">Visibility mask ((n + 31) / 32 words)</param>
+    /// <param name="p">Planes (4 * planeCount floats)</param>
+    /// <param name="planeCount">Number of planes</param>
+    /// <param name="c">Center of the first sphere (xyz)</param>
+    /// <param name="radius">Radius of the first sphere</param>
+    /// <param name="stride">Distance between two spheres in floats (at least 4)</param>
+    /// <param name="n">Number of spheres</param>
+    P_TARGET_SSE inline void cull_sphere_array(uint32_t* r, const float* p, size_t planeCount, const float* c, const float* radius, size_t stride, size_t n)
+    {
+        for (size_t w = 0; w < (n + 31) / 32; ++w)
+        {
+            r[w] = 0;
+        }
+
+        for (size_t i = 0; i < n; i += 4)
+        {
+            r[i >> 5] |= Internal::cull_sphere4(p, planeCount, c + i * stride, radius + i * stride, stride, n - i) << (i & 31);
+        }
+    }
+
+    /// <summary>
+    /// Tests n axis aligned boxes against a set of planes. A box is visible, if it is not entirely behind any plane. Four boxes are tested at once.
+    /// </summary>
+    /// <param name="r">Visibility mask ((n + 31) / 32 words)</param>
+    /// <param name="p">Planes (4 * planeCount floats)</param>
+    /// <param name="planeCount">Number of planes</param>
+    /// <param name="mn">Minimum corner of the first box (xyz)</param>
+    /// <param name="mx">Maximum corner of the first box (xyz)</param>
+    /// <param name="stride">Distance between two boxes in floats (at least 4)</param>
+    /// <param name="n">Number of boxes</param>
+    P_TARGET_SSE inline void cull_aabb_array(uint32_t* r, const float* p, size_t planeCount, const float* mn, const float* mx, size_t stride, size_t n)
+    {
+        for (size_t w = 0; w < (n + 31) / 32; ++w)
+        {
+            r[w] = 0;
+        }
+
+        for (size_t i = 0; i < n; i += 4)
+        {
+            r[i >> 5] |= Internal::cull_aabb4(p, planeCount, mn + i * stride, mx + i * stride, stride, n - i) << (i & 31);
+        }
+    }
+
+    // ==================== //
+    //   Quaternion array   //
+    // ==================== //
+
+    // Weights are evaluated with the polynomial of FPU::quat_slerp_coefficients, four quaternions per register.
+
+    /// <summary>
+    /// Interpolates n pairs of unit quaternions spherically. Takes the shortest path. r may alias a or b.
+    /// </summary>
+    /// <param name="r">Result (4 * n floats)</param>
+    /// <param name="a">Start rotations</param>
+    /// <param name="b">Destination rotations</param>
+    /// <param name="n">Number of quaternions</param>
+    /// <param name="t">Interpolation value between 0 and 1</param>
+    P_TARGET_SSE inline void quat_slerp_array(float* r, const float* a, const float* b, size_t n, float t)
+    {
+        float ct[FPU::QuatSlerpTerms];
+        float cd[FPU::QuatSlerpTerms];
+        FPU::quat_slerp_coefficients(ct, t);
+        FPU::quat_slerp_coefficients(cd, 1.0f - t);
+
+        const __m128 one = _mm_set1_ps(1.0f);
+        const __m128 sign = _mm_set1_ps(-0.0f);
+
+        size_t i = 0;
+
+        for (; i + 4 <= n; i += 4)
+        {
+            __m128 ax = _mm_loadu_ps(a + i * 4);
+            __m128 ay = _mm_loadu_ps(a + i * 4 + 4);
+            __m128 az = _mm_loadu_ps(a + i * 4 + 8);
+            __m128 aw = _mm_loadu_ps(a + i * 4 + 12);
+
+            __m128 bx = _mm_loadu_ps(b + i * 4);
+            __m128 by = _mm_loadu_ps(b + i * 4 + 4);
+            __m128 bz = _mm_loadu_ps(b + i * 4 + 8);
+            __m128 bw = _mm_loadu_ps(b + i * 4 + 12);
+
+            _MM_TRANSPOSE4_PS(ax, ay, az, aw);
+            _MM_TRANSPOSE4_PS(bx, by, bz, bw);
+
+            __m128 d = _mm_add_ps(_mm_add_ps(_mm_mul_ps(ax, bx), _mm_mul_ps(ay, by)), _mm_add_ps(_mm_mul_ps(az, bz), _mm_mul_ps(aw, bw)));
+            __m128 xm1 = _mm_sub_ps(_mm_andnot_ps(sign, d), one);
+
+            __m128 wt = one;
+            __m128 wd = one;
+            for (size_t k = FPU::QuatSlerpTerms; k-- > 0;)
+            {
+                wt = _mm_add_ps(one, _mm_mul_ps(_mm_mul_ps(_mm_set1_ps(ct[k]), xm1), wt));
+                wd = _mm_add_ps(one, _mm_mul_ps(_mm_mul_ps(_mm_set1_ps(cd[k]), xm1), wd));
+            }
+
+            // Negative dot products flip b, for the shortest path.
+            wt = _mm_xor_ps(_mm_mul_ps(wt, _mm_set1_ps(t)), _mm_and_ps(d, sign));
+            wd = _mm_mul_ps(wd, _mm_set1_ps(1.0f - t));
+
+            __m128 rx = _mm_add_ps(_mm_mul_ps(ax, wd), _mm_mul_ps(bx, wt));
+            __m128 ry = _mm_add_ps(_mm_mul_ps(ay, wd), _mm_mul_ps(by, wt));
+            __m128 rz = _mm_add_ps(_mm_mul_ps(az, wd), _mm_mul_ps(bz, wt));
+            __m128 rw = _mm_add_ps(_mm_mul_ps(aw, wd), _mm_mul_ps(bw, wt));
+
+            _MM_TRANSPOSE4_PS(rx, ry, rz, rw);
+
+            _mm_storeu_ps(r + i * 4,      rx);
+            _mm_storeu_ps(r + i * 4 + 4,  ry);
+            _mm_storeu_ps(r + i * 4 + 8,  rz);
+            _mm_storeu_ps(r + i * 4 + 12, rw);
+        }
+
+        FPU::quat_slerp_array(r + i * 4, a + i * 4, b + i * 4, n - i, t);
+    }
+
+    // ============ //
+    //   Skinning   //
+    // ============ //
+
+    // Four vertices per iteration. The dual quaternions of one influence are loaded per vertex and transposed, so the blend works on one component per register.
+
+    /// <summary>
+    /// Skins n vertices with blended dual quaternions (DLB). Positions and normals may be skinned in place. See FPU::dq_skin_array for the layout.
+    /// </summary>
+    /// <param name="rp">Skinned positions (planar, pitch floats per component)</param>
+    /// <param name="rn">Skinned normals, or nullptr</param>
+    /// <param name="p">Bind pose positions</param>
+    /// <param name="nrm">Bind pose normals, or nullptr</param>
+    /// <param name="bones">Bone indices (FPU::SkinInfluences per vertex)</param>
+    /// <param name="weights">Bone weights (FPU::SkinInfluences per vertex)</param>
+    /// <param name="dq">Unit dual quaternions of the bones (8 floats per bone)</param>
+    /// <param name="n">Number of vertices</param>
+    /// <param name="pitch">Distance between the x, y and z arrays in floats (at least n)</param>
+    P_TARGET_SSE inline void dq_skin_array(float* rp, float* rn, const float* p, const float* nrm, const uint32_t* bones, const float* weights, const float* dq, size_t n, size_t pitch)
+    {
+        static_assert(FPU::SkinInfluences == 4, "dq_skin_array: Weights are transposed as 4x4 blocks.");
+
+        const __m128 sign = _mm_set1_ps(-0.0f);
+        const __m128 two = _mm_set1_ps(2.0f);
+
+        size_t i = 0;
+
+        for (; i + 4 <= n; i += 4)
+        {
+            __m128 w[4] = { _mm_loadu_ps(weights + i * 4), _mm_loadu_ps(weights + i * 4 + 4), _mm_loadu_ps(weights + i * 4 + 8), _mm_loadu_ps(weights + i * 4 + 12) };
+            _MM_TRANSPOSE4_PS(w[0], w[1], w[2], w[3]);
+
+            __m128 q[8];
+            __m128 f[4];
+
+            for (size_t k = 0; k < 4; ++k)
+            {
+                const uint32_t* b = bones + i * 4 + k;
+
+                __m128 r0 = _mm_loadu_ps(dq + (size_t)b[0] * 8);
+                __m128 r1 = _mm_loadu_ps(dq + (size_t)b[4] * 8);
+                __m128 r2 = _mm_loadu_ps(dq + (size_t)b[8] * 8);
+                __m128 r3 = _mm_loadu_ps(dq + (size_t)b[12] * 8);
+
+                __m128 d0 = _mm_loadu_ps(dq + (size_t)b[0] * 8 + 4);
+                __m128 d1 = _mm_loadu_ps(dq + (size_t)b[4] * 8 + 4);
+                __m128 d2 = _mm_loadu_ps(dq + (size_t)b[8] * 8 + 4);
+                __m128 d3 = _mm_loadu_ps(dq + (size_t)b[12] * 8 + 4);
+
+                _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+                _MM_TRANSPOSE4_PS(d0, d1, d2, d3);
+
+                __m128 wk = w[k];
+
+                if (k == 0)
+                {
+                    f[0] = r0; f[1] = r1; f[2] = r2; f[3] = r3;
+
+                    q[0] = _mm_mul_ps(r0, wk); q[1] = _mm_mul_ps(r1, wk); q[2] = _mm_mul_ps(r2, wk); q[3] = _mm_mul_ps(r3, wk);
+                    q[4] = _mm_mul_ps(d0, wk); q[5] = _mm_mul_ps(d1, wk); q[6] = _mm_mul_ps(d2, wk); q[7] = _mm_mul_ps(d3, wk);
+                    continue;
+                }
+
+                // Negates the weight, where the real part is opposite to the first bone.
+                __m128 dot = _mm_add_ps(_mm_add_ps(_mm_mul_ps(f[0], r0), _mm_mul_ps(f[1], r1)), _mm_add_ps(_mm_mul_ps(f[2], r2), _mm_mul_ps(f[3], r3)));
+                wk = _mm_xor_ps(wk, _mm_and_ps(dot, sign));
+
+                q[0] = _mm_add_ps(q[0], _mm_mul_ps(r0, wk)); q[1] = _mm_add_ps(q[1], _mm_mul_ps(r1, wk));
+                q[2] = _mm_add_ps(q[2], _mm_mul_ps(r2, wk)); q[3] = _mm_add_ps(q[3], _mm_mul_ps(r3, wk));
+                q[4] = _mm_add_ps(q[4], _mm_mul_ps(d0, wk)); q[5] = _mm_add_ps(q[5], _mm_mul_ps(d1, wk));
+                q[6] = _mm_add_ps(q[6], _mm_mul_ps(d2, wk)); q[7] = _mm_add_ps(q[7], _mm_mul_ps(d3, wk));
+            }
+
+            __m128 l = _mm_add_ps(_mm_add_ps(_mm_mul_ps(q[0], q[0]), _mm_mul_ps(q[1], q[1])), _mm_add_ps(_mm_mul_ps(q[2], q[2]), _mm_mul_ps(q[3], q[3])));
+            __m128 invLength = _mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(l));
+
+            for (size_t c = 0; c < 8; ++c)
+            {
+                q[c] = _mm_mul_ps(q[c], invLength);
+            }
+
+            // Translation: 2 * (rw * dv - dw * rv + rv x dv)
+            __m128 tx = _mm_mul_ps(two, _mm_add_ps(_mm_sub_ps(_mm_mul_ps(q[3], q[4]), _mm_mul_ps(q[7], q[0])), _mm_sub_ps(_mm_mul_ps(q[1], q[6]), _mm_mul_ps(q[2], q[5]))));
+            __m128 ty = _mm_mul_ps(two, _mm_add_ps(_mm_sub_ps(_mm_mul_ps(q[3], q[5]), _mm_mul_ps(q[7], q[1])), _mm_sub_ps(_mm_mul_ps(q[2], q[4]), _mm_mul_ps(q[0], q[6]))));
+            __m128 tz = _mm_mul_ps(two, _mm_add_ps(_mm_sub_ps(_mm_mul_ps(q[3], q[6]), _mm_mul_ps(q[7], q[2])), _mm_sub_ps(_mm_mul_ps(q[0], q[5]), _mm_mul_ps(q[1], q[4]))));
+
+            // Rotation: v + 2 * rv x (rv x v + rw * v)
+            __m128 vx = _mm_loadu_ps(p + i);
+            __m128 vy = _mm_loadu_ps(p + pitch + i);
+            __m128 vz = _mm_loadu_ps(p + 2 * pitch + i);
+
+            __m128 cx = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(q[1], vz), _mm_mul_ps(q[2], vy)), _mm_mul_ps(q[3], vx));
+            __m128 cy = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(q[2], vx), _mm_mul_ps(q[0], vz)), _mm_mul_ps(q[3], vy));
+            __m128 cz = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(q[0], vy), _mm_mul_ps(q[1], vx)), _mm_mul_ps(q[3], vz));
+
+            _mm_storeu_ps(rp + i,             _mm_add_ps(_mm_add_ps(vx, _mm_mul_ps(two, _mm_sub_ps(_mm_mul_ps(q[1], cz), _mm_mul_ps(q[2], cy)))), tx));
+            _mm_storeu_ps(rp + pitch + i,     _mm_add_ps(_mm_add_ps(vy, _mm_mul_ps(two, _mm_sub_ps(_mm_mul_ps(q[2], cx), _mm_mul_ps(q[0], cz)))), ty));
+            _mm_storeu_ps(rp + 2 * pitch + i, _mm_add_ps(_mm_add_ps(vz, _mm_mul_ps(two, _mm_sub_ps(_mm_mul_ps(q[0], cy), _mm_mul_ps(q[1], cx)))), tz));
+
+            if (nrm != nullptr)
+            {
+                vx = _mm_loadu_ps(nrm + i);
+                vy = _mm_loadu_ps(nrm + pitch + i);
+                vz = _mm_loadu_ps(nrm + 2 * pitch + i);
+
+                cx = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(q[1], vz), _mm_mul_ps(q[2], vy)), _mm_mul_ps(q[3], vx));
+                cy = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(q[2], vx), _mm_mul_ps(q[0], vz)), _mm_mul_ps(q[3], vy));
+                cz = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(q[0], vy), _mm_mul_ps(q[1], vx)), _mm_mul_ps(q[3], vz));
+
+                _mm_storeu_ps(rn + i,             _mm_add_ps(vx, _mm_mul_ps(two, _mm_sub_ps(_mm_mul_ps(q[1], cz), _mm_mul_ps(q[2], cy)))));
+                _mm_storeu_ps(rn + pitch + i,     _mm_add_ps(vy, _mm_mul_ps(two, _mm_sub_ps(_mm_mul_ps(q[2], cx), _mm_mul_ps(q[0], cz)))));
+                _mm_storeu_ps(rn + 2 * pitch + i, _mm_add_ps(vz, _mm_mul_ps(two, _mm_sub_ps(_mm_mul_ps(q[0], cy), _mm_mul_ps(q[1], cx)))));
+            }
+        }
+
+        if (i < n)
+        {
+            FPU::dq_skin_array(rp + i, (rn != nullptr) ? rn + i : nullptr, p + i, (nrm != nullptr) ? nrm + i : nullptr, bones + i * 4, weights + i * 4, dq, n - i, pitch);
+        }
+    }
+
+    namespace Internal
+    {
+        // Blends the bone matrices of one vertex, one column per register. Columns of 3x4 matrices are loaded with 4 floats,
+        // the surplus lane reads the next column. The translation is loaded from the end of the matrix and shifted down.
+        template<size_t CS>
+        P_TARGET_SSE inline void lbs_skin_array(float* rp, float* rn, const float* p, const float* nrm, const uint32_t* bones, const float* weights, const float* m, size_t n, size_t pitch)
+        {
+            for (size_t i = 0; i < n; ++i)
+            {
+                __m128 c0 = _mm_setzero_ps();
+                __m128 c1 = _mm_setzero_ps();
+                __m128 c2 = _mm_setzero_ps();
+                __m128 c3 = _mm_setzero_ps();
+
+                for (size_t k = 0; k < FPU::SkinInfluences; ++k)
+                {
+                    const float* mk = m + (size_t)bones[i * FPU::SkinInfluences + k] * CS * 4;
+                    const __m128 w = _mm_set1_ps(weights[i * FPU::SkinInfluences + k]);
+
+                    __m128 t;
+                    if constexpr (CS == 4)
+                    {
+                        t = _mm_loadu_ps(mk + 12);
+                    }
+                    else
+                    {
+                        t = _mm_loadu_ps(mk + 8);
+                        t = _mm_shuffle_ps(t, t, _MM_SHUFFLE(3, 3, 2, 1));
+                    }
+
+                    c0 = _mm_add_ps(c0, _mm_mul_ps(_mm_loadu_ps(mk), w));
+                    c1 = _mm_add_ps(c1, _mm_mul_ps(_mm_loadu_ps(mk + CS), w));
+                    c2 = _mm_add_ps(c2, _mm_mul_ps(_mm_loadu_ps(mk + 2 * CS), w));
+                    c3 = _mm_add_ps(c3, _mm_mul_ps(t, w));
+                }
+
+                alignas(16) float r[4];
+
+                __m128 v = _mm_add_ps(_mm_add_ps(_mm_mul_ps(c0, _mm_set1_ps(p[i])), _mm_mul_ps(c1, _mm_set1_ps(p[pitch + i]))),
+                                      _mm_add_ps(_mm_mul_ps(c2, _mm_set1_ps(p[2 * pitch + i])), c3));
+                _mm_store_ps(r, v);
+
+                rp[i]             = r[0];
+                rp[pitch + i]     = r[1];
+                rp[2 * pitch + i] = r[2];
+
+                if (nrm != nullptr)
+                {
+                    v = _mm_add_ps(_mm_add_ps(_mm_mul_ps(c0, _mm_set1_ps(nrm[i])), _mm_mul_ps(c1, _mm_set1_ps(nrm[pitch + i]))), _mm_mul_ps(c2, _mm_set1_ps(nrm[2 * pitch + i])));
+
+                    __m128 l = _mm_dp_ps(v, v, 0x7F);
+                    __m128 s = _mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(l));
+                    s = _mm_blendv_ps(_mm_set1_ps(1.0f), s, _mm_cmpgt_ps(l, _mm_setzero_ps()));
+                    _mm_store_ps(r, _mm_mul_ps(v, s));
+
+                    rn[i]             = r[0];
+                    rn[pitch + i]     = r[1];
+                    rn[2 * pitch + i] = r[2];
+                }
+            }
+        }
+    }
+
+    /// <summary>
+    /// Skins n vertices with linearly blended bone matrices. Positions and normals may be skinned in place. See FPU::lbs_skin_array for the layout.
+    /// </summary>
+    /// <param name="rp">Skinned positions (planar, pitch floats per component)</param>
+    /// <param name="rn">Skinned normals, or nullptr</param>
+    /// <param name="p">Bind pose positions</param>
+    /// <param name="nrm">Bind pose normals, or nullptr</param>
+    /// <param name="bones">Bone indices (FPU::SkinInfluences per vertex)</param>
+    /// <param name="weights">Bone weights (FPU::SkinInfluences per vertex)</param>
+    /// <param name="m">Bone matrices (4 * columnStride floats per bone)</param>
+    /// <param name="columnStride">Floats per matrix column (3 or 4)</param>
+    /// <param name="n">Number of vertices</param>
+    /// <param name="pitch">Distance between the x, y and z arrays in floats (at least n)</param>
+    P_TARGET_SSE inline void lbs_skin_array(float* rp, float* rn, const float* p, const float* nrm, const uint32_t* bones, const float* weights, const float* m, size_t columnStride, size_t n, size_t pitch)
+    {
+        if (columnStride == 4)
+        {
+            Internal::lbs_skin_array<4>(rp, rn, p, nrm, bones, weights, m, n, pitch);
+        }
+        else
+        {
+            Internal::lbs_skin_array<3>(rp, rn, p, nrm, bones, weights, m, n, pitch);
+        }
+    }
+
+    // =================== //
+    //   Vector3 packing   //
+    // =================== //
+
+    // See FPU::vec3_encode_oct_array for the formats. The vectors are transposed in blocks of four, quantized vectors stay xyzw.
+
+    /// <summary>
+    /// Encodes n unit vectors as 2x16 bit octahedral coordinates.
+    /// </summary>
+    /// <param name="r">Encoded vectors</param>
+    /// <param name="v">Unit vectors (4 * n floats)</param>
+    /// <param name="n">Number of vectors</param>
+    P_TARGET_SSE inline void vec3_encode_oct_array(uint32_t* r, const float* v, size_t n)
+    {
+        const __m128 signMask = _mm_set1_ps(-0.0f);
+        const __m128 zero = _mm_setzero_ps();
+        const __m128 one = _mm_set1_ps(1.0f);
+        const __m128 minusOne = _mm_set1_ps(-1.0f);
+        const __m128 snormScale = _mm_set1_ps(32767.0f);
+        const __m128i lowMask = _mm_set1_epi32(0xFFFF);
+
+        size_t i = 0;
+
+        for (; i + 4 <= n; i += 4)
+        {
+            __m128 x = _mm_loadu_ps(v + i * 4);
+            __m128 y = _mm_loadu_ps(v + i * 4 + 4);
+            __m128 z = _mm_loadu_ps(v + i * 4 + 8);
+            __m128 w = _mm_loadu_ps(v + i * 4 + 12);
+
+            _MM_TRANSPOSE4_PS(x, y, z, w);
+
+            const __m128 l1 = _mm_add_ps(_mm_add_ps(_mm_andnot_ps(signMask, x), _mm_andnot_ps(signMask, y)), _mm_andnot_ps(signMask, z));
+            const __m128 s = _mm_and_ps(_mm_div_ps(one, l1), _mm_cmpgt_ps(l1, zero));
+
+            __m128 px = _mm_mul_ps(x, s);
+            __m128 py = _mm_mul_ps(y, s);
+
+            // Fold the lower half: (1 - |py|) * sign(px), (1 - |px|) * sign(py).
+            const __m128 fx = _mm_mul_ps(_mm_sub_ps(one, _mm_andnot_ps(signMask, py)), _mm_or_ps(one, _mm_and_ps(px, signMask)));
+            const __m128 fy = _mm_mul_ps(_mm_sub_ps(one, _mm_andnot_ps(signMask, px)), _mm_or_ps(one, _mm_and_ps(py, signMask)));
+
+            const __m128 lower = _mm_cmplt_ps(z, zero);
+            px = _mm_blendv_ps(px, fx, lower);
+            py = _mm_blendv_ps(py, fy, lower);
+
+            const __m128i qx = _mm_cvtps_epi32(_mm_mul_ps(_mm_min_ps(_mm_max_ps(px, minusOne), one), snormScale));
+            const __m128i qy = _mm_cvtps_epi32(_mm_mul_ps(_mm_min_ps(_mm_max_ps(py, minusOne), one), snormScale));
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(r + i), _mm_or_si128(_mm_and_si128(qx, lowMask), _mm_slli_epi32(qy, 16)));
+        }
+
+        FPU::vec3_encode_oct_array(r + i, v + i * 4, n - i);
+    }
+
+    /// <summary>
+    /// Decodes n 2x16 bit octahedral coordinates to unit vectors. w of the result is 0.
+    /// </summary>
+    /// <param name="r">Unit vectors (4 * n floats)</param>
+    /// <param name="v">Encoded vectors</param>
+    /// <param name="n">Number of vectors</param>
+    P_TARGET_SSE inline void vec3_decode_oct_array(float* r, const uint32_t* v, size_t n)
+    {
+        const __m128 signMask = _mm_set1_ps(-0.0f);
+        const __m128 zero = _mm_setzero_ps();
+        const __m128 one = _mm_set1_ps(1.0f);
+        const __m128 minusOne = _mm_set1_ps(-1.0f);
+        const __m128 snormScale = _mm_set1_ps(1.0f / 32767.0f);
+
+        size_t i = 0;
+
+        for (; i + 4 <= n; i += 4)
+        {
+            const __m128i q = _mm_loadu_si128(reinterpret_cast<const __m128i*>(v + i));
+
+            __m128 x = _mm_max_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_slli_epi32(q, 16), 16)), snormScale), minusOne);
+            __m128 y = _mm_max_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(q, 16)), snormScale), minusOne);
+            __m128 z = _mm_sub_ps(_mm_sub_ps(one, _mm_andnot_ps(signMask, x)), _mm_andnot_ps(signMask, y));
+
+            // Unfold the lower half.
+            const __m128 t = _mm_max_ps(_mm_xor_ps(z, signMask), zero);
+            x = _mm_sub_ps(x, _mm_or_ps(t, _mm_and_ps(x, signMask)));
+            y = _mm_sub_ps(y, _mm_or_ps(t, _mm_and_ps(y, signMask)));
+
+            const __m128 l = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_mul_ps(z, z)));
+
+            x = _mm_div_ps(x, l);
+            y = _mm_div_ps(y, l);
+            z = _mm_div_ps(z, l);
+            __m128 w = zero;
+
+            _MM_TRANSPOSE4_PS(x, y, z, w);
+
+            _mm_storeu_ps(r + i * 4,      x);
+            _mm_storeu_ps(r + i * 4 + 4,  y);
+            _mm_storeu_ps(r + i * 4 + 8,  z);
+            _mm_storeu_ps(r + i * 4 + 12, w);
+        }
+
+        FPU::vec3_decode_oct_array(r + i * 4, v + i, n - i);
+    }
+
+    /// <summary>
+    /// Encodes n vectors as snorm 10:10:10:2. Components are clamped between -1 and 1.
+    /// </summary>
+    /// <param name="r">Encoded vectors</param>
+    /// <param name="v">Vectors (4 * n floats)</param>
+    /// <param name="n">Number of vectors</param>
+    P_TARGET_SSE inline void vec3_encode_1010102_array(uint32_t* r, const float* v, size_t n)
+    {
+        const __m128 one = _mm_set1_ps(1.0f);
+        const __m128 minusOne = _mm_set1_ps(-1.0f);
+        const __m128 snormScale = _mm_set1_ps(511.0f);
+        const __m128i fieldMask = _mm_set1_epi32(0x3FF);
+
+        size_t i = 0;
+
+        for (; i + 4 <= n; i += 4)
+        {
+            __m128 x = _mm_loadu_ps(v + i * 4);
+            __m128 y = _mm_loadu_ps(v + i * 4 + 4);
+            __m128 z = _mm_loadu_ps(v + i * 4 + 8);
+            __m128 w = _mm_loadu_ps(v + i * 4 + 12);
+
+            _MM_TRANSPOSE4_PS(x, y, z, w);
+
+            const __m128i qx = _mm_cvtps_epi32(_mm_mul_ps(_mm_min_ps(_mm_max_ps(x, minusOne), one), snormScale));
+            const __m128i qy = _mm_cvtps_epi32(_mm_mul_ps(_mm_min_ps(_mm_max_ps(y, minusOne), one), snormScale));
+            const __m128i qz = _mm_cvtps_epi32(_mm_mul_ps(_mm_min_ps(_mm_max_ps(z, minusOne), one), snormScale));
+            const __m128i qw = _mm_cvtps_epi32(_mm_min_ps(_mm_max_ps(w, minusOne), one));
+
+            const __m128i xy = _mm_or_si128(_mm_and_si128(qx, fieldMask), _mm_slli_epi32(_mm_and_si128(qy, fieldMask), 10));
+            const __m128i zw = _mm_or_si128(_mm_slli_epi32(_mm_and_si128(qz, fieldMask), 20), _mm_slli_epi32(qw, 30));
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(r + i), _mm_or_si128(xy, zw));
+        }
+
+        FPU::vec3_encode_1010102_array(r + i, v + i * 4, n - i);
+    }
+
+    /// <summary>
+    /// Decodes n snorm 10:10:10:2 vectors.
+    /// </summary>
+    /// <param name="r">Vectors (4 * n floats)</param>
+    /// <param name="v">Encoded vectors</param>
+    /// <param name="n">Number of vectors</param>
+    P_TARGET_SSE inline void vec3_decode_1010102_array(float* r, const uint32_t* v, size_t n)
+    {
+        const __m128 minusOne = _mm_set1_ps(-1.0f);
+        const __m128 snormScale = _mm_set1_ps(1.0f / 511.0f);
+
+        size_t i = 0;
+
+        for (; i + 4 <= n; i += 4)
+        {
+            const __m128i q = _mm_loadu_si128(reinterpret_cast<const __m128i*>(v + i));
+
+            // Shift each field to the top, then back with sign extension.
+            __m128 x = _mm_max_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_slli_epi32(q, 22), 22)), snormScale), minusOne);
+            __m128 y = _mm_max_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_slli_epi32(q, 12), 22)), snormScale), minusOne);
+            __m128 z = _mm_max_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_slli_epi32(q, 2), 22)), snormScale), minusOne);
+            __m128 w = _mm_max_ps(_mm_cvtepi32_ps(_mm_srai_epi32(q, 30)), minusOne);
+
+            _MM_TRANSPOSE4_PS(x, y, z, w);
+
+            _mm_storeu_ps(r + i * 4,      x);
+            _mm_storeu_ps(r + i * 4 + 4,  y);
+            _mm_storeu_ps(r + i * 4 + 8,  z);
+            _mm_storeu_ps(r + i * 4 + 12, w);
+        }
+
+        FPU::vec3_decode_1010102_array(r + i * 4, v + i, n - i);
+    }
+
+    /// <summary>
+    /// Quantizes n vectors to 3x16 bit unorm. Components outside of the range are clamped.
+    /// </summary>
+    /// <param name="r">Quantized vectors (3 * n)</param>
+    /// <param name="v">Vectors (4 * n floats)</param>
+    /// <param name="offset">Vector mapped to 0 (3 floats)</param>
+    /// <param name="scale">Scale per axis (3 floats)</param>
+    /// <param name="n">Number of vectors</param>
+    P_TARGET_SSE inline void vec3_quantize_array(uint16_t* r, const float* v, const float* offset, const float* scale, size_t n)
+    {
+        // w is scaled by 0 and dropped by the shuffle.
+        const __m128 o = _mm_setr_ps(offset[0], offset[1], offset[2], 0.0f);
+        const __m128 s = _mm_setr_ps(scale[0], scale[1], scale[2], 0.0f);
+        const __m128 zero = _mm_setzero_ps();
+        const __m128 unormMax = _mm_set1_ps(65535.0f);
+
+        // xyzw xyzw -> xyz xyz, upper 4 bytes zero.
+        const __m128i pack = _mm_setr_epi8(0, 1, 2, 3, 4, 5, 8, 9, 10, 11, 12, 13, -1, -1, -1, -1);
+
+        size_t i = 0;
+
+        for (; i + 4 <= n; i += 4)
+        {
+            __m128i q[4];
+            for (size_t k = 0; k < 4; ++k)
+            {
+                const __m128 t = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(v + (i + k) * 4), o), s);
+                q[k] = _mm_cvtps_epi32(_mm_min_ps(_mm_max_ps(t, zero), unormMax));
+            }
+
+            const __m128i h0 = _mm_shuffle_epi8(_mm_packus_epi32(q[0], q[1]), pack);
+            const __m128i h1 = _mm_shuffle_epi8(_mm_packus_epi32(q[2], q[3]), pack);
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(r + i * 3), _mm_or_si128(h0, _mm_slli_si128(h1, 12)));
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(r + i * 3 + 8), _mm_srli_si128(h1, 4));
+        }
+
+        FPU::vec3_quantize_array(r + i * 3, v + i * 4, offset, scale, n - i);
+    }
+
+    /// <summary>
+    /// Dequantizes n 3x16 bit unorm vectors. w of the result is 0.
+    /// </summary>
+    /// <param name="r">Vectors (4 * n floats)</param>
+    /// <param name="v">Quantized vectors (3 * n)</param>
+    /// <param name="offset">Vector mapped to 0 (3 floats)</param>
+    /// <param name="scale">Scale per axis (3 floats)</param>
+    /// <param name="n">Number of vectors</param>
+    P_TARGET_SSE inline void vec3_dequantize_array(float* r, const uint16_t* v, const float* offset, const float* scale, size_t n)
+    {
+        const __m128 o = _mm_setr_ps(offset[0], offset[1], offset[2], 0.0f);
+        const __m128 s = _mm_setr_ps(scale[0], scale[1], scale[2], 0.0f);
+
+        // xyz xyz -> xyz0 xyz0
+        const __m128i unpack = _mm_setr_epi8(0, 1, 2, 3, 4, 5, -1, -1, 6, 7, 8, 9, 10, 11, -1, -1);
+
+        size_t i = 0;
+
+        for (; i + 4 <= n; i += 4)
+        {
+            const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(v + i * 3));
+            const __m128i b = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(v + i * 3 + 8));
+
+            const __m128i q01 = _mm_shuffle_epi8(a, unpack);
+            const __m128i q23 = _mm_shuffle_epi8(_mm_alignr_epi8(b, a, 12), unpack);
+
+            _mm_storeu_ps(r + i * 4,      _mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepu16_epi32(q01)), s), o));
+            _mm_storeu_ps(r + i * 4 + 4,  _mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepu16_epi32(_mm_srli_si128(q01, 8))), s), o));
+            _mm_storeu_ps(r + i * 4 + 8,  _mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepu16_epi32(q23)), s), o));
+            _mm_storeu_ps(r + i * 4 + 12, _mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepu16_epi32(_mm_srli_si128(q23, 8))), s), o));
+        }
+
+        FPU::vec3_dequantize_array(r + i * 4, v + i * 3, offset, scale, n - i);
+    }
+}
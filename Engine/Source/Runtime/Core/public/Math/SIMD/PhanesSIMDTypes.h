@@ -7,7 +7,9 @@
 #include "Core/public/Math/SIMD/Platform.h"
 #include "Core/public/Math/MathTypes.h"
 
-#if P_INTRINSICS == P_INTRINSICS_AVX2
+#if P_INTRINSICS == P_INTRINSICS_AVX512
+#   include <immintrin.h>
+#elif P_INTRINSICS == P_INTRINSICS_AVX2
 #   include <immintrin.h>
 #elif P_INTRINSICS == P_INTRINSICS_AVX
 #   include <immintrin.h>
@@ -153,15 +155,31 @@ namespace Phanes::Core::Math::SIMD
     {
         static const bool value = true && P_AVX2__;
     };
+
+
+    // AVX512
+
+    template<>
+    struct use_simd<float, 16, true>
+    {
+        static const bool value = true && P_AVX512__;
+    };
+
+    template<>
+    struct use_simd<double, 8, true>
+    {
+        static const bool value = true && P_AVX512__;
+    };
 }
 
 // Register aliases
 namespace Phanes::Core::Types
 {
 
-#if P_INTRINSICS >= 1
+#if P_INTRINSICS >= P_INTRINSICS_SSE && P_INTRINSICS != P_INTRINSICS_NEON
 
     typedef __m128      Vec4f32Reg;
+    typedef __m128      Vec2x2f32Reg;
     typedef __m128d     Vec2f64Reg;
 
     typedef __m128i     Vec4i32Reg;
@@ -173,18 +191,20 @@ namespace Phanes::Core::Types
 #elif P_INTRINSICS != P_INTRINSICS_NEON
 
     typedef struct alignas(16) Vec4f32Reg { float data[4]; }                        Vec4f32Reg;
+    typedef struct alignas(16) Vec2x2f32Reg { float data[4]; }                      Vec2x2f32Reg;
     typedef struct alignas(16) Vec2f64Reg { double data[2]; }                       Vec2f64Reg;
     typedef struct alignas(16) Vec4i32Reg { int data[4]; }                          Vec4i32Reg;
     typedef struct alignas(16) Vec2i64Reg { Phanes::Core::Types::int64 data[2]; }   Vec2i64Reg;
     typedef struct alignas(16) Vec4u32Reg { unsigned int data[4]; }                 Vec4u32Reg;
-    typedef struct alignas(16) Vec2u64Reg { Phanes::Core::Types::uint64 data[4]; }  Vec2u64Reg;
+    typedef struct alignas(16) Vec2u64Reg { Phanes::Core::Types::uint64 data[2]; }  Vec2u64Reg;
 
 #endif
 
 
-#if P_INTRINSICS >= 2
+#if P_INTRINSICS >= P_INTRINSICS_AVX && P_INTRINSICS != P_INTRINSICS_NEON
 
     typedef __m256      Vec4x2f32Reg;
+    typedef __m256      Vec2x4f32Reg;
     typedef __m256      Vec8f32Reg;
     typedef __m256d     Vec2x2f64Reg;
     typedef __m256d     Vec4f64Reg;
@@ -192,6 +212,7 @@ namespace Phanes::Core::Types
 #elif P_INTRINSICS != P_INTRINSICS_NEON
 
     typedef struct alignas(32) Vec4x2f32Reg { float data[8]; }  Vec4x2f32Reg;
+    typedef struct alignas(32) Vec2x4f32Reg { float data[8]; }  Vec2x4f32Reg;
     typedef struct alignas(32) Vec8f32Reg   { float data[8]; }  Vec8f32Reg;
     typedef struct alignas(32) Vec2x2f64Reg { double data[4]; } Vec2x2f64Reg;
     typedef struct alignas(32) Vec4f64Reg   { double data[4]; } Vec4f64Reg;
@@ -199,7 +220,7 @@ namespace Phanes::Core::Types
 #endif
 
 
-#if P_INTRINSICS == 3
+#if P_INTRINSICS == P_INTRINSICS_AVX2 || P_INTRINSICS == P_INTRINSICS_AVX512
 
     typedef __m256i     Vec4x2i32Reg;
     typedef __m256i     Vec8i32Reg;
@@ -223,6 +244,17 @@ namespace Phanes::Core::Types
     typedef struct alignas(32) Vec2x2u64Reg { Phanes::Core::Types::uint64 data[4]; } Vec2x2u64Reg;
     typedef struct alignas(32) Vec4u64Reg   { Phanes::Core::Types::uint64 data[4]; } Vec4u64Reg;
 
+#endif
+
+
+#if P_INTRINSICS == P_INTRINSICS_AVX512
+
+    typedef __m512      Vec2x8f32Reg;
+
+#elif P_INTRINSICS != P_INTRINSICS_NEON
+
+    typedef struct alignas(64) Vec2x8f32Reg { float data[16]; } Vec2x8f32Reg;
+
 #endif
 
     // NEON ...
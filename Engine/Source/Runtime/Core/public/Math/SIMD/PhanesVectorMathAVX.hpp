@@ -1,6 +1,869 @@
 #pragma once
 
-#include "PhanesVectorMathSSE.hpp" // Include previous 
+#include "PhanesVectorMathSSE.hpp" // Include previous
 
 #include <immintrin.h>
 
+
+// ========== //
+//   Common   //
+// ========== //
+
+namespace Phanes::Core::Math::SIMD
+{
+    /// <summary>
+    /// Adds all scalars of the vector.
+    /// </summary>
+    /// <param name="v">Vector</param>
+    /// <returns>Sum stored in v[0:63].</returns>
+    inline Phanes::Core::Types::Vec4f64Reg vec4_hadd(const Phanes::Core::Types::Vec4f64Reg v)
+    {
+        __m256d sum = _mm256_hadd_pd(v, v);
+        __m128d r = _mm_add_sd(_mm256_castpd256_pd128(sum), _mm256_extractf128_pd(sum, 1));
+        return _mm256_castpd128_pd256(r);
+    }
+
+    /// <summary>
+    /// Adds all scalars of the vector.
+    /// </summary>
+    /// <param name="v">Vector</param>
+    /// <returns>Sum of components.</returns>
+    inline double vec4_hadd_cvtf64(const Phanes::Core::Types::Vec4f64Reg v)
+    {
+        __m256d sum = _mm256_hadd_pd(v, v);
+        return _mm_cvtsd_f64(_mm_add_sd(_mm256_castpd256_pd128(sum), _mm256_extractf128_pd(sum, 1)));
+    }
+
+    /// <summary>
+    /// Gets the absolute value of each scalar in the vector.
+    /// </summary>
+    /// <param name="v">Vector</param>
+    /// <returns>Vector with all components positive.</returns>
+    inline Phanes::Core::Types::Vec4f64Reg vec4_abs(const Phanes::Core::Types::Vec4f64Reg v)
+    {
+        return _mm256_andnot_pd(_mm256_set1_pd(-0.0), v);
+    }
+
+    /// <summary>
+    /// Gets the dot product of the vectors.
+    /// </summary>
+    /// <param name="v1">Vector one</param>
+    /// <param name="v2">Vector two</param>
+    /// <returns>Dot product stored in v[0:63].</returns>
+    inline Phanes::Core::Types::Vec4f64Reg vec4_dot(const Phanes::Core::Types::Vec4f64Reg v1, const Phanes::Core::Types::Vec4f64Reg v2)
+    {
+        return vec4_hadd(_mm256_mul_pd(v1, v2));
+    }
+
+    /// <summary>
+    /// Gets the dot product of the vectors.
+    /// </summary>
+    /// <param name="v1">Vector one</param>
+    /// <param name="v2">Vector two</param>
+    /// <returns>Dot product</returns>
+    inline double vec4_dot_cvtf64(const Phanes::Core::Types::Vec4f64Reg v1, const Phanes::Core::Types::Vec4f64Reg v2)
+    {
+        return vec4_hadd_cvtf64(_mm256_mul_pd(v1, v2));
+    }
+
+    /// <summary>
+    /// Shuffles the vector to (y, z, x, x).
+    /// </summary>
+    /// <param name="v">Vector</param>
+    /// <returns>Shuffled vector</returns>
+    inline Phanes::Core::Types::Vec4f64Reg vec3_yzx(const Phanes::Core::Types::Vec4f64Reg v)
+    {
+        // AVX has no cross lane permute for doubles, so the lanes are swapped first.
+        __m256d swp = _mm256_permute2f128_pd(v, v, 0x01);   // z w x y
+        __m256d p0 = _mm256_permute_pd(v, 0b0101);          // y x w z
+        __m256d p1 = _mm256_permute_pd(swp, 0b0000);        // z z x x
+
+        return _mm256_blend_pd(p0, p1, 0b1110);             // y z x x
+    }
+
+    /// <summary>
+    /// Computes a * b + c. Fused into one instruction with P_FMA__.
+    /// </summary>
+    /// <param name="a">Factor one</param>
+    /// <param name="b">Factor two</param>
+    /// <param name="c">Addend</param>
+    /// <returns>a * b + c</returns>
+    inline Phanes::Core::Types::Vec4f64Reg vec4_fmadd(const Phanes::Core::Types::Vec4f64Reg a, const Phanes::Core::Types::Vec4f64Reg b, const Phanes::Core::Types::Vec4f64Reg c)
+    {
+#if P_FMA__
+        return _mm256_fmadd_pd(a, b, c);
+#else
+        return _mm256_add_pd(_mm256_mul_pd(a, b), c);
+#endif
+    }
+
+    /// <summary>
+    /// Computes a * b - c. Fused into one instruction with P_FMA__.
+    /// </summary>
+    /// <param name="a">Factor one</param>
+    /// <param name="b">Factor two</param>
+    /// <param name="c">Subtrahend</param>
+    /// <returns>a * b - c</returns>
+    inline Phanes::Core::Types::Vec4f64Reg vec4_fmsub(const Phanes::Core::Types::Vec4f64Reg a, const Phanes::Core::Types::Vec4f64Reg b, const Phanes::Core::Types::Vec4f64Reg c)
+    {
+#if P_FMA__
+        return _mm256_fmsub_pd(a, b, c);
+#else
+        return _mm256_sub_pd(_mm256_mul_pd(a, b), c);
+#endif
+    }
+
+    /// <summary>
+    /// Gets the cross product of the xyz components. w is set to 0.
+    /// </summary>
+    /// <param name="v1">Vector one</param>
+    /// <param name="v2">Vector two</param>
+    /// <returns>Cross product</returns>
+    inline Phanes::Core::Types::Vec4f64Reg vec3_cross_p(const Phanes::Core::Types::Vec4f64Reg v1, const Phanes::Core::Types::Vec4f64Reg v2)
+    {
+        // (v1 * v2.yzx - v1.yzx * v2).yzx
+        __m256d tmp = vec4_fmsub(v1, vec3_yzx(v2), _mm256_mul_pd(vec3_yzx(v1), v2));
+        return _mm256_blend_pd(vec3_yzx(tmp), _mm256_setzero_pd(), 0b1000);
+    }
+
+    /// <summary>
+    /// Compares the vectors component-wise with a tolerance.
+    /// </summary>
+    /// <param name="v1">Vector one</param>
+    /// <param name="v2">Vector two</param>
+    /// <param name="threshold">Allowed difference per component</param>
+    /// <returns>Bitmask with one bit per component, set if the components are equal.</returns>
+    inline int vec4_eq_mask(const Phanes::Core::Types::Vec4f64Reg v1, const Phanes::Core::Types::Vec4f64Reg v2, double threshold = P_FLT_INAC)
+    {
+        __m256d diff = vec4_abs(_mm256_sub_pd(v1, v2));
+#if P_AVX512__
+        return _mm256_cmp_pd_mask(diff, _mm256_set1_pd(threshold), _CMP_LT_OQ);
+#else
+        return _mm256_movemask_pd(_mm256_cmp_pd(diff, _mm256_set1_pd(threshold), _CMP_LT_OQ));
+#endif
+    }
+
+    /// <summary>
+    /// Compares the vectors component-wise.
+    /// </summary>
+    /// <param name="v1">Vector one</param>
+    /// <param name="v2">Vector two</param>
+    /// <returns>Bitmask with one bit per component, set if the component of v1 is less than the one of v2.</returns>
+    inline int vec4_lt_mask(const Phanes::Core::Types::Vec4f64Reg v1, const Phanes::Core::Types::Vec4f64Reg v2)
+    {
+#if P_AVX512__
+        return _mm256_cmp_pd_mask(v1, v2, _CMP_LT_OQ);
+#else
+        return _mm256_movemask_pd(_mm256_cmp_pd(v1, v2, _CMP_LT_OQ));
+#endif
+    }
+
+    /// <summary>
+    /// Gets the reciprocal of each component.
+    /// </summary>
+    /// <param name="v">Vector</param>
+    /// <param name="p">Precision. Estimates need AVX-512, otherwise the exact result is returned.</param>
+    /// <returns>1 / v</returns>
+    inline Phanes::Core::Types::Vec4f64Reg vec4_rcp(const Phanes::Core::Types::Vec4f64Reg v, Phanes::Core::Math::EPrecision p)
+    {
+#if P_AVX512__
+        if (p != Phanes::Core::Math::EPrecision::Exact)
+        {
+            __m256d r = _mm256_rcp14_pd(v);
+
+            if (p == Phanes::Core::Math::EPrecision::Refined)
+            {
+                // Newton-Raphson: r = r * (2 - v * r)
+                r = _mm256_mul_pd(r, _mm256_fnmadd_pd(v, r, _mm256_set1_pd(2.0)));
+            }
+            return r;
+        }
+#else
+        (void)p;
+#endif
+        return _mm256_div_pd(_mm256_set1_pd(1.0), v);
+    }
+
+    /// <summary>
+    /// Normalizes the vector. Vectors shorter than P_FLT_INAC are returned unchanged.
+    /// </summary>
+    /// <param name="v">Vector</param>
+    /// <param name="p">Precision. Estimates need AVX-512, otherwise the exact result is returned.</param>
+    /// <returns>Normalized vector</returns>
+    inline Phanes::Core::Types::Vec4f64Reg vec4_normalize(const Phanes::Core::Types::Vec4f64Reg v, Phanes::Core::Math::EPrecision p)
+    {
+        // Squared length in all components.
+        __m256d len2 = _mm256_hadd_pd(_mm256_mul_pd(v, v), _mm256_mul_pd(v, v));
+        len2 = _mm256_add_pd(len2, _mm256_permute2f128_pd(len2, len2, 0x01));
+
+        __m256d r;
+
+#if !P_AVX512__
+        (void)p;
+#endif
+
+#if P_AVX512__
+        if (p != Phanes::Core::Math::EPrecision::Exact)
+        {
+            __m256d rs = _mm256_rsqrt14_pd(len2);
+
+            if (p == Phanes::Core::Math::EPrecision::Refined)
+            {
+                // Newton-Raphson: r = r * (1.5 - 0.5 * v * r * r)
+                __m256d hl = _mm256_mul_pd(len2, _mm256_set1_pd(0.5));
+                rs = _mm256_mul_pd(rs, _mm256_fnmadd_pd(_mm256_mul_pd(hl, rs), rs, _mm256_set1_pd(1.5)));
+            }
+            r = _mm256_mul_pd(v, rs);
+        }
+        else
+#endif
+        {
+            r = _mm256_div_pd(v, _mm256_sqrt_pd(len2));
+        }
+
+        return _mm256_blendv_pd(v, r, _mm256_cmp_pd(len2, _mm256_set1_pd((double)P_FLT_INAC * P_FLT_INAC), _CMP_GE_OQ));
+    }
+}
+
+
+// ============ //
+//   TVector4   //
+// ============ //
+
+namespace Phanes::Core::Math::Detail
+{
+    template<>
+    struct construct_vec4<double, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TVector4<double, true>& v1, const TVector4<double, true>& v2)
+        {
+            v1.comp = v2.comp;
+        }
+
+
+        static FORCEINLINE void map(Phanes::Core::Math::TVector4<double, true>& v1, double s)
+        {
+            v1.comp = _mm256_set1_pd(s);
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TVector4<double, true>& v1, double x, double y, double z, double w)
+        {
+            v1.comp = _mm256_setr_pd(x, y, z, w);
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TVector4<double, true>& v1, const Phanes::Core::Math::TVector2<double, true>& v2, const Phanes::Core::Math::TVector2<double, true>& v3)
+        {
+            v1.comp = _mm256_set_m128d(v3.comp, v2.comp);
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TVector4<double, true>& v1, const double* s)
+        {
+            v1.comp = _mm256_loadu_pd(s);
+        }
+    };
+
+
+    template<>
+    struct compute_vec4_add<double, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TVector4<double, true>& r, const Phanes::Core::Math::TVector4<double, true>& v1, const Phanes::Core::Math::TVector4<double, true>& v2)
+        {
+            r.comp = _mm256_add_pd(v1.comp, v2.comp);
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TVector4<double, true>& r, const Phanes::Core::Math::TVector4<double, true>& v1, double s)
+        {
+            r.comp = _mm256_add_pd(v1.comp, _mm256_set1_pd(s));
+        }
+    };
+
+    template<>
+    struct compute_vec4_sub<double, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TVector4<double, true>& r, const Phanes::Core::Math::TVector4<double, true>& v1, const Phanes::Core::Math::TVector4<double, true>& v2)
+        {
+            r.comp = _mm256_sub_pd(v1.comp, v2.comp);
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TVector4<double, true>& r, const Phanes::Core::Math::TVector4<double, true>& v1, double s)
+        {
+            r.comp = _mm256_sub_pd(v1.comp, _mm256_set1_pd(s));
+        }
+    };
+
+    template<>
+    struct compute_vec4_mul<double, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TVector4<double, true>& r, const Phanes::Core::Math::TVector4<double, true>& v1, const Phanes::Core::Math::TVector4<double, true>& v2)
+        {
+            r.comp = _mm256_mul_pd(v1.comp, v2.comp);
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TVector4<double, true>& r, const Phanes::Core::Math::TVector4<double, true>& v1, double s)
+        {
+            r.comp = _mm256_mul_pd(v1.comp, _mm256_set1_pd(s));
+        }
+    };
+
+    template<>
+    struct compute_vec4_div<double, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TVector4<double, true>& r, const Phanes::Core::Math::TVector4<double, true>& v1, const Phanes::Core::Math::TVector4<double, true>& v2)
+        {
+            r.comp = _mm256_div_pd(v1.comp, v2.comp);
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TVector4<double, true>& r, const Phanes::Core::Math::TVector4<double, true>& v1, double s)
+        {
+            r.comp = _mm256_div_pd(v1.comp, _mm256_set1_pd(s));
+        }
+    };
+
+    template<>
+    struct compute_vec4_eq<double, true>
+    {
+        static FORCEINLINE bool map(const Phanes::Core::Math::TVector4<double, true>& v1, const Phanes::Core::Math::TVector4<double, true>& v2)
+        {
+            return Phanes::Core::Math::SIMD::vec4_eq_mask(v1.comp, v2.comp) == 0xF;
+        }
+    };
+
+    template<>
+    struct compute_vec4_ieq<double, true>
+    {
+        static FORCEINLINE bool map(const Phanes::Core::Math::TVector4<double, true>& v1, const Phanes::Core::Math::TVector4<double, true>& v2)
+        {
+            return Phanes::Core::Math::SIMD::vec4_eq_mask(v1.comp, v2.comp) != 0xF;
+        }
+    };
+
+    template<>
+    struct compute_vec4_eq_mask<double, true>
+    {
+        static FORCEINLINE int map(const Phanes::Core::Math::TVector4<double, true>& v1, const Phanes::Core::Math::TVector4<double, true>& v2, double threshold)
+        {
+            return Phanes::Core::Math::SIMD::vec4_eq_mask(v1.comp, v2.comp, threshold);
+        }
+    };
+
+    template<>
+    struct compute_vec4_lt_mask<double, true>
+    {
+        static FORCEINLINE int map(const Phanes::Core::Math::TVector4<double, true>& v1, const Phanes::Core::Math::TVector4<double, true>& v2)
+        {
+            return Phanes::Core::Math::SIMD::vec4_lt_mask(v1.comp, v2.comp);
+        }
+    };
+
+    template<>
+    struct compute_vec4_inc<double, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TVector4<double, true>& r, const Phanes::Core::Math::TVector4<double, true>& v1)
+        {
+            r.comp = _mm256_add_pd(v1.comp, _mm256_set1_pd(1.0));
+        }
+    };
+
+    template<>
+    struct compute_vec4_dec<double, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TVector4<double, true>& r, const Phanes::Core::Math::TVector4<double, true>& v1)
+        {
+            r.comp = _mm256_sub_pd(v1.comp, _mm256_set1_pd(1.0));
+        }
+    };
+
+    template<>
+    struct compute_vec4_dot<double, true>
+    {
+        static FORCEINLINE double map(const Phanes::Core::Math::TVector4<double, true>& v1, const Phanes::Core::Math::TVector4<double, true>& v2)
+        {
+            return Phanes::Core::Math::SIMD::vec4_dot_cvtf64(v1.comp, v2.comp);
+        }
+    };
+
+    template<>
+    struct compute_vec4_normalize<double, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TVector4<double, true>& r, const Phanes::Core::Math::TVector4<double, true>& v1, EPrecision p)
+        {
+            r.comp = Phanes::Core::Math::SIMD::vec4_normalize(v1.comp, p);
+        }
+    };
+
+    template<>
+    struct compute_vec4_rcp<double, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TVector4<double, true>& r, const Phanes::Core::Math::TVector4<double, true>& v1, EPrecision p)
+        {
+            r.comp = Phanes::Core::Math::SIMD::vec4_rcp(v1.comp, p);
+        }
+    };
+
+
+    // ============ //
+    //   TVector3   //
+    // ============ //
+
+
+    template<>
+    struct construct_vec3<double, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TVector3<double, true>& v1, const TVector3<double, true>& v2)
+        {
+            v1.comp = v2.comp;
+        }
+
+
+        static FORCEINLINE void map(Phanes::Core::Math::TVector3<double, true>& v1, double s)
+        {
+            v1.comp = _mm256_setr_pd(s, s, s, 0.0);
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TVector3<double, true>& v1, double x, double y, double z)
+        {
+            v1.comp = _mm256_setr_pd(x, y, z, 0.0);
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TVector3<double, true>& v1, const Phanes::Core::Math::TVector2<double, true>& v2, double s)
+        {
+            v1.comp = _mm256_set_m128d(_mm_setr_pd(s, 0.0), v2.comp);
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TVector3<double, true>& v1, const double* s)
+        {
+            v1.comp = _mm256_setr_pd(s[0], s[1], s[2], 0.0);
+        }
+    };
+
+
+    // Not derived from the 4D functors, which would change w (scalar addition and ++ set it to 1, division by a vector to NaN) and break DotP and Magnitude.
+
+    template<>
+    struct compute_vec3_add<double, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TVector3<double, true>& r, const Phanes::Core::Math::TVector3<double, true>& v1, const Phanes::Core::Math::TVector3<double, true>& v2)
+        {
+            r.comp = _mm256_add_pd(v1.comp, v2.comp);
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TVector3<double, true>& r, const Phanes::Core::Math::TVector3<double, true>& v1, double s)
+        {
+            r.comp = _mm256_add_pd(v1.comp, _mm256_setr_pd(s, s, s, 0.0));
+        }
+    };
+
+    template<>
+    struct compute_vec3_sub<double, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TVector3<double, true>& r, const Phanes::Core::Math::TVector3<double, true>& v1, const Phanes::Core::Math::TVector3<double, true>& v2)
+        {
+            r.comp = _mm256_sub_pd(v1.comp, v2.comp);
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TVector3<double, true>& r, const Phanes::Core::Math::TVector3<double, true>& v1, double s)
+        {
+            r.comp = _mm256_sub_pd(v1.comp, _mm256_setr_pd(s, s, s, 0.0));
+        }
+    };
+
+    template<>
+    struct compute_vec3_mul<double, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TVector3<double, true>& r, const Phanes::Core::Math::TVector3<double, true>& v1, const Phanes::Core::Math::TVector3<double, true>& v2)
+        {
+            r.comp = _mm256_mul_pd(v1.comp, v2.comp);
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TVector3<double, true>& r, const Phanes::Core::Math::TVector3<double, true>& v1, double s)
+        {
+            r.comp = _mm256_blend_pd(_mm256_mul_pd(v1.comp, _mm256_set1_pd(s)), _mm256_setzero_pd(), 0x8);
+        }
+    };
+
+    template<>
+    struct compute_vec3_div<double, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TVector3<double, true>& r, const Phanes::Core::Math::TVector3<double, true>& v1, const Phanes::Core::Math::TVector3<double, true>& v2)
+        {
+            r.comp = _mm256_blend_pd(_mm256_div_pd(v1.comp, v2.comp), _mm256_setzero_pd(), 0x8);
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TVector3<double, true>& r, const Phanes::Core::Math::TVector3<double, true>& v1, double s)
+        {
+            r.comp = _mm256_blend_pd(_mm256_div_pd(v1.comp, _mm256_set1_pd(s)), _mm256_setzero_pd(), 0x8);
+        }
+    };
+
+    template<>
+    struct compute_vec3_inc<double, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TVector3<double, true>& r, const Phanes::Core::Math::TVector3<double, true>& v1)
+        {
+            r.comp = _mm256_add_pd(v1.comp, _mm256_setr_pd(1.0, 1.0, 1.0, 0.0));
+        }
+    };
+
+    template<>
+    struct compute_vec3_dec<double, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TVector3<double, true>& r, const Phanes::Core::Math::TVector3<double, true>& v1)
+        {
+            r.comp = _mm256_sub_pd(v1.comp, _mm256_setr_pd(1.0, 1.0, 1.0, 0.0));
+        }
+    };
+
+    template<>
+    struct compute_vec3_eq<double, true>
+    {
+        static FORCEINLINE bool map(const Phanes::Core::Math::TVector3<double, true>& v1, const Phanes::Core::Math::TVector3<double, true>& v2)
+        {
+            return (Phanes::Core::Math::SIMD::vec4_eq_mask(v1.comp, v2.comp) & 0x7) == 0x7;
+        }
+    };
+
+    template<>
+    struct compute_vec3_ieq<double, true>
+    {
+        static FORCEINLINE bool map(const Phanes::Core::Math::TVector3<double, true>& v1, const Phanes::Core::Math::TVector3<double, true>& v2)
+        {
+            return (Phanes::Core::Math::SIMD::vec4_eq_mask(v1.comp, v2.comp) & 0x7) != 0x7;
+        }
+    };
+
+    template<>
+    struct compute_vec3_eq_mask<double, true>
+    {
+        static FORCEINLINE int map(const Phanes::Core::Math::TVector3<double, true>& v1, const Phanes::Core::Math::TVector3<double, true>& v2, double threshold)
+        {
+            return Phanes::Core::Math::SIMD::vec4_eq_mask(v1.comp, v2.comp, threshold) & 0x7;
+        }
+    };
+
+    template<>
+    struct compute_vec3_lt_mask<double, true>
+    {
+        static FORCEINLINE int map(const Phanes::Core::Math::TVector3<double, true>& v1, const Phanes::Core::Math::TVector3<double, true>& v2)
+        {
+            return Phanes::Core::Math::SIMD::vec4_lt_mask(v1.comp, v2.comp) & 0x7;
+        }
+    };
+
+    template<>
+    struct compute_vec3_cross_p<double, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TVector3<double, true>& r, const Phanes::Core::Math::TVector3<double, true>& v1, const Phanes::Core::Math::TVector3<double, true>& v2)
+        {
+            r.comp = Phanes::Core::Math::SIMD::vec3_cross_p(v1.comp, v2.comp);
+        }
+    };
+
+    // w stays 0, so the 4D normalization can be used.
+    template<> struct compute_vec3_normalize<double, true> : public compute_vec4_normalize<double, true> {};
+
+    template<>
+    struct compute_vec3_rcp<double, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TVector3<double, true>& r, const Phanes::Core::Math::TVector3<double, true>& v1, EPrecision p)
+        {
+            // 1 / w is infinite, so w is reset.
+            r.comp = _mm256_blend_pd(Phanes::Core::Math::SIMD::vec4_rcp(v1.comp, p), _mm256_setzero_pd(), 0x8);
+        }
+    };
+
+
+    // =========== //
+    //   Matrix3   //
+    // =========== //
+
+    template<>
+    struct compute_mat3_transpose<double, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TMatrix3<double, true>& r, const Phanes::Core::Math::TMatrix3<double, true>& m1)
+        {
+            __m256d t0 = _mm256_unpacklo_pd(m1.c0.comp, m1.c1.comp);            // c0x c1x | c0z c1z
+            __m256d t1 = _mm256_unpackhi_pd(m1.c0.comp, m1.c1.comp);            // c0y c1y | c0w c1w
+            __m256d t2 = _mm256_unpacklo_pd(m1.c2.comp, _mm256_setzero_pd());   // c2x 0   | c2z 0
+            __m256d t3 = _mm256_unpackhi_pd(m1.c2.comp, _mm256_setzero_pd());   // c2y 0   | c2w 0
+
+            r.c0.comp = _mm256_permute2f128_pd(t0, t2, 0x20);
+            r.c1.comp = _mm256_permute2f128_pd(t1, t3, 0x20);
+            r.c2.comp = _mm256_permute2f128_pd(t0, t2, 0x31);
+        }
+    };
+
+    template<>
+    struct compute_mat3_det<double, true>
+    {
+        static FORCEINLINE double map(const Phanes::Core::Math::TMatrix3<double, true>& m1)
+        {
+            // dot(c0, cross(c1, c2)), w of the cross product is 0.
+            return Phanes::Core::Math::SIMD::vec4_dot_cvtf64(m1.c0.comp, Phanes::Core::Math::SIMD::vec3_cross_p(m1.c1.comp, m1.c2.comp));
+        }
+    };
+
+    template<>
+    struct compute_mat3_inv<double, true>
+    {
+        static FORCEINLINE bool map(Phanes::Core::Math::TMatrix3<double, true>& r, const Phanes::Core::Math::TMatrix3<double, true>& m1)
+        {
+            // The rows of the adjugate are the cross products of the columns.
+            __m256d r0 = Phanes::Core::Math::SIMD::vec3_cross_p(m1.c1.comp, m1.c2.comp);
+            __m256d r1 = Phanes::Core::Math::SIMD::vec3_cross_p(m1.c2.comp, m1.c0.comp);
+            __m256d r2 = Phanes::Core::Math::SIMD::vec3_cross_p(m1.c0.comp, m1.c1.comp);
+
+            double det = Phanes::Core::Math::SIMD::vec4_dot_cvtf64(m1.c0.comp, r0);
+
+            if (det == 0.0)
+            {
+                return false;
+            }
+
+            __m256d _1_det = _mm256_set1_pd(1.0 / det);
+
+            // Transpose, the fourth row is 0.
+            __m256d t0 = _mm256_unpacklo_pd(r0, r1);                    // r0x r1x | r0z r1z
+            __m256d t1 = _mm256_unpackhi_pd(r0, r1);                    // r0y r1y | r0w r1w
+            __m256d t2 = _mm256_unpacklo_pd(r2, _mm256_setzero_pd());   // r2x 0   | r2z 0
+            __m256d t3 = _mm256_unpackhi_pd(r2, _mm256_setzero_pd());   // r2y 0   | r2w 0
+
+            r.c0.comp = _mm256_mul_pd(_mm256_permute2f128_pd(t0, t2, 0x20), _1_det);
+            r.c1.comp = _mm256_mul_pd(_mm256_permute2f128_pd(t1, t3, 0x20), _1_det);
+            r.c2.comp = _mm256_mul_pd(_mm256_permute2f128_pd(t0, t2, 0x31), _1_det);
+
+            return true;
+        }
+    };
+
+    template<>
+    struct compute_mat3_mul<double, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TMatrix3<double, true>& r, const Phanes::Core::Math::TMatrix3<double, true>& m1, const Phanes::Core::Math::TMatrix3<double, true>& m2)
+        {
+            const __m256d a0 = m1.c0.comp;
+            const __m256d a1 = m1.c1.comp;
+            const __m256d a2 = m1.c2.comp;
+
+            const __m256d b0 = m2.c0.comp;
+            const __m256d b1 = m2.c1.comp;
+            const __m256d b2 = m2.c2.comp;
+
+            r.c0.comp = mul_col(a0, a1, a2, b0);
+            r.c1.comp = mul_col(a0, a1, a2, b1);
+            r.c2.comp = mul_col(a0, a1, a2, b2);
+        }
+
+        // Broadcast each component of b and accumulate over the columns of a.
+        static FORCEINLINE __m256d mul_col(const __m256d a0, const __m256d a1, const __m256d a2, const __m256d b)
+        {
+            __m256d xy = _mm256_permute2f128_pd(b, b, 0x00);    // x y | x y
+            __m256d zw = _mm256_permute2f128_pd(b, b, 0x11);    // z w | z w
+
+            __m256d t = _mm256_mul_pd(a0, _mm256_permute_pd(xy, 0b0000));
+            t = Phanes::Core::Math::SIMD::vec4_fmadd(a1, _mm256_permute_pd(xy, 0b1111), t);
+            return Phanes::Core::Math::SIMD::vec4_fmadd(a2, _mm256_permute_pd(zw, 0b0000), t);
+        }
+    };
+
+    template<>
+    struct compute_mat3_mul_vec<double, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TVector3<double, true>& r, const Phanes::Core::Math::TMatrix3<double, true>& m1, const Phanes::Core::Math::TVector3<double, true>& v1)
+        {
+            r.comp = compute_mat3_mul<double, true>::mul_col(m1.c0.comp, m1.c1.comp, m1.c2.comp, v1.comp);
+        }
+    };
+
+    // =============== //
+    //   TQuaternion   //
+    // =============== //
+
+    template<>
+    struct construct_quat<double, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TQuaternion<double, true>& q1, const Phanes::Core::Math::TQuaternion<double, true>& q2)
+        {
+            q1.comp = q2.comp;
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TQuaternion<double, true>& q1, double x, double y, double z, double w)
+        {
+            q1.comp = _mm256_setr_pd(x, y, z, w);
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TQuaternion<double, true>& q1, const Phanes::Core::Math::TVector3<double, true>& v1, double w)
+        {
+            q1.comp = _mm256_blend_pd(v1.comp, _mm256_set1_pd(w), 0b1000);
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TQuaternion<double, true>& q1, const double* comp)
+        {
+            q1.comp = _mm256_loadu_pd(comp);
+        }
+    };
+
+
+    template<>
+    struct compute_quat_add<double, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TQuaternion<double, true>& r, const Phanes::Core::Math::TQuaternion<double, true>& q1, const Phanes::Core::Math::TQuaternion<double, true>& q2)
+        {
+            r.comp = _mm256_add_pd(q1.comp, q2.comp);
+        }
+    };
+
+
+    template<>
+    struct compute_quat_sub<double, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TQuaternion<double, true>& r, const Phanes::Core::Math::TQuaternion<double, true>& q1, const Phanes::Core::Math::TQuaternion<double, true>& q2)
+        {
+            r.comp = _mm256_sub_pd(q1.comp, q2.comp);
+        }
+    };
+
+
+    template<>
+    struct compute_quat_scale<double, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TQuaternion<double, true>& r, const Phanes::Core::Math::TQuaternion<double, true>& q1, double s)
+        {
+            r.comp = _mm256_mul_pd(q1.comp, _mm256_set1_pd(s));
+        }
+    };
+
+
+    template<>
+    struct compute_quat_mul<double, true>
+    {
+        // r = w1 * q2 + x1 * (w2, -z2, y2, -x2) + y1 * (z2, w2, -x2, -y2) + z1 * (-y2, x2, w2, -z2)
+        static FORCEINLINE void map(Phanes::Core::Math::TQuaternion<double, true>& r, const Phanes::Core::Math::TQuaternion<double, true>& q1, const Phanes::Core::Math::TQuaternion<double, true>& q2)
+        {
+            const __m256d a = q1.comp;
+            const __m256d b = q2.comp;
+
+            // AVX has no cross lane permute for doubles, so the lanes are swapped first.
+            const __m256d bzwxy = _mm256_permute2f128_pd(b, b, 0x01);
+            const __m256d axy = _mm256_permute2f128_pd(a, a, 0x00);
+            const __m256d azw = _mm256_permute2f128_pd(a, a, 0x11);
+
+            __m256d bx = _mm256_xor_pd(_mm256_permute_pd(bzwxy, 0b0101), _mm256_setr_pd(0.0, -0.0, 0.0, -0.0));
+            __m256d by = _mm256_xor_pd(bzwxy, _mm256_setr_pd(0.0, 0.0, -0.0, -0.0));
+            __m256d bz = _mm256_xor_pd(_mm256_permute_pd(b, 0b0101), _mm256_setr_pd(-0.0, 0.0, 0.0, -0.0));
+
+            __m256d s = _mm256_mul_pd(_mm256_permute_pd(azw, 0b1111), b);
+            s = Phanes::Core::Math::SIMD::vec4_fmadd(_mm256_permute_pd(axy, 0b0000), bx, s);
+            s = Phanes::Core::Math::SIMD::vec4_fmadd(_mm256_permute_pd(axy, 0b1111), by, s);
+
+            r.comp = Phanes::Core::Math::SIMD::vec4_fmadd(_mm256_permute_pd(azw, 0b0000), bz, s);
+        }
+    };
+
+
+    template<>
+    struct compute_quat_dot<double, true>
+    {
+        static FORCEINLINE double map(const Phanes::Core::Math::TQuaternion<double, true>& q1, const Phanes::Core::Math::TQuaternion<double, true>& q2)
+        {
+            return Phanes::Core::Math::SIMD::vec4_dot_cvtf64(q1.comp, q2.comp);
+        }
+    };
+
+
+    template<>
+    struct compute_quat_normalize<double, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TQuaternion<double, true>& r, const Phanes::Core::Math::TQuaternion<double, true>& q1, EPrecision p)
+        {
+            r.comp = Phanes::Core::Math::SIMD::vec4_normalize(q1.comp, p);
+        }
+    };
+
+
+    template<>
+    struct compute_quat_conjugate<double, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TQuaternion<double, true>& r, const Phanes::Core::Math::TQuaternion<double, true>& q1)
+        {
+            r.comp = _mm256_xor_pd(q1.comp, _mm256_setr_pd(-0.0, -0.0, -0.0, 0.0));
+        }
+    };
+
+
+    template<>
+    struct compute_quat_rotate<double, true>
+    {
+        // v' = v + w * t + u x t, with t = 2 * (u x v). vec3_cross_p sets w to 0.
+        static FORCEINLINE void map(Phanes::Core::Math::TVector3<double, true>& r, const Phanes::Core::Math::TQuaternion<double, true>& q1, const Phanes::Core::Math::TVector3<double, true>& v1)
+        {
+            const __m256d u = q1.comp;
+            const __m256d w = _mm256_permute_pd(_mm256_permute2f128_pd(u, u, 0x11), 0b1111);
+
+            __m256d t = Phanes::Core::Math::SIMD::vec3_cross_p(u, v1.comp);
+            t = _mm256_add_pd(t, t);
+
+            __m256d res = Phanes::Core::Math::SIMD::vec4_fmadd(w, t, v1.comp);
+            r.comp = _mm256_add_pd(res, Phanes::Core::Math::SIMD::vec3_cross_p(u, t));
+        }
+    };
+
+
+    template<>
+    struct compute_quat_eq<double, true>
+    {
+        static FORCEINLINE bool map(const Phanes::Core::Math::TQuaternion<double, true>& q1, const Phanes::Core::Math::TQuaternion<double, true>& q2, double threshold)
+        {
+            return Phanes::Core::Math::SIMD::vec4_eq_mask(q1.comp, q2.comp, threshold) == 0xF;
+        }
+    };
+
+    // ================= //
+    //   Vector packets  //
+    // ================= //
+
+    template<size_t N> requires (N % 4 == 0)
+    struct compute_vec4p_load<double, N>
+    {
+        static FORCEINLINE void map(double* x, double* y, double* z, double* w, const double* v)
+        {
+            for (size_t i = 0; i < N; i += 4)
+            {
+                __m256d r0 = _mm256_loadu_pd(v + i * 4);
+                __m256d r1 = _mm256_loadu_pd(v + i * 4 + 4);
+                __m256d r2 = _mm256_loadu_pd(v + i * 4 + 8);
+                __m256d r3 = _mm256_loadu_pd(v + i * 4 + 12);
+
+                __m256d t0 = _mm256_unpacklo_pd(r0, r1);        // x0 x1 | z0 z1
+                __m256d t1 = _mm256_unpackhi_pd(r0, r1);        // y0 y1 | w0 w1
+                __m256d t2 = _mm256_unpacklo_pd(r2, r3);        // x2 x3 | z2 z3
+                __m256d t3 = _mm256_unpackhi_pd(r2, r3);        // y2 y3 | w2 w3
+
+                _mm256_storeu_pd(x + i, _mm256_permute2f128_pd(t0, t2, 0x20));
+                _mm256_storeu_pd(y + i, _mm256_permute2f128_pd(t1, t3, 0x20));
+                _mm256_storeu_pd(z + i, _mm256_permute2f128_pd(t0, t2, 0x31));
+                _mm256_storeu_pd(w + i, _mm256_permute2f128_pd(t1, t3, 0x31));
+            }
+        }
+    };
+
+    template<size_t N> requires (N % 4 == 0)
+    struct compute_vec4p_store<double, N>
+    {
+        static FORCEINLINE void map(double* v, const double* x, const double* y, const double* z, const double* w)
+        {
+            for (size_t i = 0; i < N; i += 4)
+            {
+                // The 4x4 transpose is its own inverse.
+                __m256d t0 = _mm256_unpacklo_pd(_mm256_loadu_pd(x + i), _mm256_loadu_pd(y + i));
+                __m256d t1 = _mm256_unpackhi_pd(_mm256_loadu_pd(x + i), _mm256_loadu_pd(y + i));
+                __m256d t2 = _mm256_unpacklo_pd(_mm256_loadu_pd(z + i), _mm256_loadu_pd(w + i));
+                __m256d t3 = _mm256_unpackhi_pd(_mm256_loadu_pd(z + i), _mm256_loadu_pd(w + i));
+
+                _mm256_storeu_pd(v + i * 4, _mm256_permute2f128_pd(t0, t2, 0x20));
+                _mm256_storeu_pd(v + i * 4 + 4, _mm256_permute2f128_pd(t1, t3, 0x20));
+                _mm256_storeu_pd(v + i * 4 + 8, _mm256_permute2f128_pd(t0, t2, 0x31));
+                _mm256_storeu_pd(v + i * 4 + 12, _mm256_permute2f128_pd(t1, t3, 0x31));
+            }
+        }
+    };
+}
@@ -1,3 +1,443 @@
 #pragma once
 
-#include "PhanesVectorMathAVX.hpp" // Include previous
\ No newline at end of file
+#include "PhanesVectorMathAVX.hpp" // Include previous
+
+
+// ========== //
+//   Common   //
+// ========== //
+
+namespace Phanes::Core::Math::SIMD
+{
+    /// <summary>
+    /// Multiplies 64-bit integers and keeps the lower 64 bits of each product.
+    /// </summary>
+    /// <param name="v1">Vector one</param>
+    /// <param name="v2">Vector two</param>
+    /// <returns>Product</returns>
+    inline Phanes::Core::Types::Vec4i64Reg ivec4_mullo_epi64(const Phanes::Core::Types::Vec4i64Reg v1, const Phanes::Core::Types::Vec4i64Reg v2)
+    {
+        // lo(a) * lo(b) + ((hi(a) * lo(b) + lo(a) * hi(b)) << 32)
+        __m256i lo = _mm256_mul_epu32(v1, v2);
+        __m256i cross = _mm256_add_epi64(_mm256_mul_epu32(_mm256_srli_epi64(v1, 32), v2), _mm256_mul_epu32(v1, _mm256_srli_epi64(v2, 32)));
+
+        return _mm256_add_epi64(lo, _mm256_slli_epi64(cross, 32));
+    }
+
+    /// <summary>
+    /// Shifts each 64-bit component right (arithmetic) by the count in the same component of c. AVX2 has no arithmetic 64-bit shift, so the sign is shifted in manually.
+    /// </summary>
+    /// <param name="v">Vector</param>
+    /// <param name="c">Shift counts</param>
+    /// <returns>Shifted vector</returns>
+    inline Phanes::Core::Types::Vec4i64Reg ivec4_srav_epi64(const Phanes::Core::Types::Vec4i64Reg v, const Phanes::Core::Types::Vec4i64Reg c)
+    {
+        __m256i sign = _mm256_cmpgt_epi64(_mm256_setzero_si256(), v);
+        __m256i fill = _mm256_sllv_epi64(sign, _mm256_sub_epi64(_mm256_set1_epi64x(64), c));
+
+        // A count of 0 shifts the fill by 64, which yields 0.
+        return _mm256_or_si256(_mm256_srlv_epi64(v, c), fill);
+    }
+
+    /// <summary>
+    /// Compares 64-bit integers.
+    /// </summary>
+    /// <param name="v1">Vector one</param>
+    /// <param name="v2">Vector two</param>
+    /// <returns>Bitmask with one bit per component, set if the components are equal.</returns>
+    inline int ivec4_eq_mask_epi64(const Phanes::Core::Types::Vec4i64Reg v1, const Phanes::Core::Types::Vec4i64Reg v2)
+    {
+#if P_AVX512__
+        return _mm256_cmpeq_epi64_mask(v1, v2);
+#else
+        return _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(v1, v2)));
+#endif
+    }
+
+
+    // Two TIntVector4<int> (or eight int) per register.
+
+    /// <summary>
+    /// Loads eight integers (two TIntVector4) from unaligned memory.
+    /// </summary>
+    /// <param name="p">Integers</param>
+    /// <returns>Packet</returns>
+    inline Phanes::Core::Types::Vec4x2i32Reg ivec4x2_load(const int* p)
+    {
+        return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+    }
+
+    /// <summary>
+    /// Loads two TIntVector4 into one packet.
+    /// </summary>
+    /// <param name="v1">Lower vector</param>
+    /// <param name="v2">Upper vector</param>
+    /// <returns>Packet</returns>
+    inline Phanes::Core::Types::Vec4x2i32Reg ivec4x2_load(const Phanes::Core::Types::Vec4i32Reg v1, const Phanes::Core::Types::Vec4i32Reg v2)
+    {
+        return _mm256_set_m128i(v2, v1);
+    }
+
+    /// <summary>
+    /// Stores eight integers (two TIntVector4) to unaligned memory.
+    /// </summary>
+    /// <param name="p">Destination</param>
+    /// <param name="v">Packet</param>
+    inline void ivec4x2_store(int* p, const Phanes::Core::Types::Vec4x2i32Reg v)
+    {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v);
+    }
+
+    inline Phanes::Core::Types::Vec4x2i32Reg ivec4x2_add(const Phanes::Core::Types::Vec4x2i32Reg v1, const Phanes::Core::Types::Vec4x2i32Reg v2) { return _mm256_add_epi32(v1, v2); }
+    inline Phanes::Core::Types::Vec4x2i32Reg ivec4x2_sub(const Phanes::Core::Types::Vec4x2i32Reg v1, const Phanes::Core::Types::Vec4x2i32Reg v2) { return _mm256_sub_epi32(v1, v2); }
+    inline Phanes::Core::Types::Vec4x2i32Reg ivec4x2_mul(const Phanes::Core::Types::Vec4x2i32Reg v1, const Phanes::Core::Types::Vec4x2i32Reg v2) { return _mm256_mullo_epi32(v1, v2); }
+    inline Phanes::Core::Types::Vec4x2i32Reg ivec4x2_and(const Phanes::Core::Types::Vec4x2i32Reg v1, const Phanes::Core::Types::Vec4x2i32Reg v2) { return _mm256_and_si256(v1, v2); }
+    inline Phanes::Core::Types::Vec4x2i32Reg ivec4x2_or(const Phanes::Core::Types::Vec4x2i32Reg v1, const Phanes::Core::Types::Vec4x2i32Reg v2)  { return _mm256_or_si256(v1, v2); }
+    inline Phanes::Core::Types::Vec4x2i32Reg ivec4x2_xor(const Phanes::Core::Types::Vec4x2i32Reg v1, const Phanes::Core::Types::Vec4x2i32Reg v2) { return _mm256_xor_si256(v1, v2); }
+    inline Phanes::Core::Types::Vec4x2i32Reg ivec4x2_bnot(const Phanes::Core::Types::Vec4x2i32Reg v)                                             { return _mm256_xor_si256(v, _mm256_set1_epi32(-1)); }
+
+    // Per component shift counts.
+    inline Phanes::Core::Types::Vec4x2i32Reg ivec4x2_sllv(const Phanes::Core::Types::Vec4x2i32Reg v, const Phanes::Core::Types::Vec4x2i32Reg c) { return _mm256_sllv_epi32(v, c); }
+    inline Phanes::Core::Types::Vec4x2i32Reg ivec4x2_srav(const Phanes::Core::Types::Vec4x2i32Reg v, const Phanes::Core::Types::Vec4x2i32Reg c) { return _mm256_srav_epi32(v, c); }
+
+    // One shift count for all components.
+    inline Phanes::Core::Types::Vec4x2i32Reg ivec4x2_sll(const Phanes::Core::Types::Vec4x2i32Reg v, int s) { return _mm256_sll_epi32(v, _mm_cvtsi32_si128(s)); }
+    inline Phanes::Core::Types::Vec4x2i32Reg ivec4x2_sra(const Phanes::Core::Types::Vec4x2i32Reg v, int s) { return _mm256_sra_epi32(v, _mm_cvtsi32_si128(s)); }
+
+    /// <summary>
+    /// Compares both TIntVector4 in the packet.
+    /// </summary>
+    /// <param name="v1">Packet one</param>
+    /// <param name="v2">Packet two</param>
+    /// <returns>Bitmask with one bit per component, set if the components are equal. Bits 0-3 belong to the lower vector.</returns>
+    inline int ivec4x2_eq_mask(const Phanes::Core::Types::Vec4x2i32Reg v1, const Phanes::Core::Types::Vec4x2i32Reg v2)
+    {
+        return _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(v1, v2)));
+    }
+}
+
+
+// =============== //
+//   TIntVector4   //
+// =============== //
+
+namespace Phanes::Core::Math::Detail
+{
+    template<>
+    struct construct_ivec4<Phanes::Core::Types::int64, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& v1, const TIntVector4<Phanes::Core::Types::int64, true>& v2)
+        {
+            v1.comp = v2.comp;
+        }
+
+
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& v1, Phanes::Core::Types::int64 s)
+        {
+            v1.comp = _mm256_set1_epi64x(s);
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& v1, Phanes::Core::Types::int64 x, Phanes::Core::Types::int64 y, Phanes::Core::Types::int64 z, Phanes::Core::Types::int64 w)
+        {
+            v1.comp = _mm256_setr_epi64x(x, y, z, w);
+        }
+
+
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& v1, const Phanes::Core::Types::int64* comp)
+        {
+            v1.comp = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(comp));
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& r, const Phanes::Core::Math::TIntVector2<Phanes::Core::Types::int64, true>& v1, const Phanes::Core::Math::TIntVector2<Phanes::Core::Types::int64, true>& v2)
+        {
+            r.comp = _mm256_set_m128i(v2.comp, v1.comp);
+        }
+    };
+
+    template<>
+    struct compute_ivec4_add<Phanes::Core::Types::int64, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& r, const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& v1, const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& v2)
+        {
+            r.comp = _mm256_add_epi64(v1.comp, v2.comp);
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& r, const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& v1, Phanes::Core::Types::int64 s)
+        {
+            r.comp = _mm256_add_epi64(v1.comp, _mm256_set1_epi64x(s));
+        }
+    };
+
+    template<>
+    struct compute_ivec4_sub<Phanes::Core::Types::int64, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& r, const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& v1, const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& v2)
+        {
+            r.comp = _mm256_sub_epi64(v1.comp, v2.comp);
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& r, const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& v1, Phanes::Core::Types::int64 s)
+        {
+            r.comp = _mm256_sub_epi64(v1.comp, _mm256_set1_epi64x(s));
+        }
+    };
+
+    template<>
+    struct compute_ivec4_mul<Phanes::Core::Types::int64, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& r, const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& v1, const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& v2)
+        {
+            r.comp = Phanes::Core::Math::SIMD::ivec4_mullo_epi64(v1.comp, v2.comp);
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& r, const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& v1, Phanes::Core::Types::int64 s)
+        {
+            r.comp = Phanes::Core::Math::SIMD::ivec4_mullo_epi64(v1.comp, _mm256_set1_epi64x(s));
+        }
+    };
+
+    // There is no integer division in AVX2. The components are divided one by one.
+
+    template<>
+    struct compute_ivec4_div<Phanes::Core::Types::int64, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& r, const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& v1, const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& v2)
+        {
+            r.comp = _mm256_setr_epi64x(v1.x / v2.x, v1.y / v2.y, v1.z / v2.z, v1.w / v2.w);
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& r, const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& v1, Phanes::Core::Types::int64 s)
+        {
+            r.comp = _mm256_setr_epi64x(v1.x / s, v1.y / s, v1.z / s, v1.w / s);
+        }
+    };
+
+    template<>
+    struct compute_ivec4_mod<Phanes::Core::Types::int64, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& r, const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& v1, const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& v2)
+        {
+            r.comp = _mm256_setr_epi64x(v1.x % v2.x, v1.y % v2.y, v1.z % v2.z, v1.w % v2.w);
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& r, const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& v1, Phanes::Core::Types::int64 s)
+        {
+            r.comp = _mm256_setr_epi64x(v1.x % s, v1.y % s, v1.z % s, v1.w % s);
+        }
+    };
+
+    template<>
+    struct compute_ivec4_eq<Phanes::Core::Types::int64, true>
+    {
+        static FORCEINLINE bool map(const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& v1, const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& v2)
+        {
+            return Phanes::Core::Math::SIMD::ivec4_eq_mask_epi64(v1.comp, v2.comp) == 0xF;
+        }
+    };
+
+    template<>
+    struct compute_ivec4_ieq<Phanes::Core::Types::int64, true>
+    {
+        static FORCEINLINE bool map(const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& v1, const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& v2)
+        {
+            return Phanes::Core::Math::SIMD::ivec4_eq_mask_epi64(v1.comp, v2.comp) != 0xF;
+        }
+    };
+
+    template<>
+    struct compute_ivec4_inc<Phanes::Core::Types::int64, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& r, const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& v1)
+        {
+            r.comp = _mm256_add_epi64(v1.comp, _mm256_set1_epi64x(1));
+        }
+    };
+
+    template<>
+    struct compute_ivec4_dec<Phanes::Core::Types::int64, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& r, const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& v1)
+        {
+            r.comp = _mm256_sub_epi64(v1.comp, _mm256_set1_epi64x(1));
+        }
+    };
+
+    template<>
+    struct compute_ivec4_and<Phanes::Core::Types::int64, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& r, const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& v1, const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& v2)
+        {
+            r.comp = _mm256_and_si256(v1.comp, v2.comp);
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& r, const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& v1, Phanes::Core::Types::int64 s)
+        {
+            r.comp = _mm256_and_si256(v1.comp, _mm256_set1_epi64x(s));
+        }
+    };
+
+    template<>
+    struct compute_ivec4_or<Phanes::Core::Types::int64, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& r, const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& v1, const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& v2)
+        {
+            r.comp = _mm256_or_si256(v1.comp, v2.comp);
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& r, const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& v1, Phanes::Core::Types::int64 s)
+        {
+            r.comp = _mm256_or_si256(v1.comp, _mm256_set1_epi64x(s));
+        }
+    };
+
+    template<>
+    struct compute_ivec4_xor<Phanes::Core::Types::int64, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& r, const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& v1, const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& v2)
+        {
+            r.comp = _mm256_xor_si256(v1.comp, v2.comp);
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& r, const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& v1, Phanes::Core::Types::int64 s)
+        {
+            r.comp = _mm256_xor_si256(v1.comp, _mm256_set1_epi64x(s));
+        }
+    };
+
+    template<>
+    struct compute_ivec4_left_shift<Phanes::Core::Types::int64, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& r, const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& v1, const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& v2)
+        {
+            r.comp = _mm256_sllv_epi64(v1.comp, v2.comp);
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& r, const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& v1, Phanes::Core::Types::int64 s)
+        {
+            r.comp = _mm256_sll_epi64(v1.comp, _mm_cvtsi64_si128(s));
+        }
+    };
+
+    template<>
+    struct compute_ivec4_right_shift<Phanes::Core::Types::int64, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& r, const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& v1, const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& v2)
+        {
+            r.comp = Phanes::Core::Math::SIMD::ivec4_srav_epi64(v1.comp, v2.comp);
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& r, const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& v1, Phanes::Core::Types::int64 s)
+        {
+            r.comp = Phanes::Core::Math::SIMD::ivec4_srav_epi64(v1.comp, _mm256_set1_epi64x(s));
+        }
+    };
+
+    template<>
+    struct compute_ivec4_bnot<Phanes::Core::Types::int64, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& r, const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& v1)
+        {
+            r.comp = _mm256_xor_si256(v1.comp, _mm256_set1_epi64x(-1));
+        }
+    };
+
+
+    // =============== //
+    //   TIntVector3   //
+    // =============== //
+
+
+    template<>
+    struct construct_ivec3<Phanes::Core::Types::int64, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector3<Phanes::Core::Types::int64, true>& v1, const TIntVector3<Phanes::Core::Types::int64, true>& v2)
+        {
+            v1.comp = v2.comp;
+        }
+
+
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector3<Phanes::Core::Types::int64, true>& v1, Phanes::Core::Types::int64 s)
+        {
+            v1.comp = _mm256_setr_epi64x(s, s, s, 0);
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector3<Phanes::Core::Types::int64, true>& v1, Phanes::Core::Types::int64 x, Phanes::Core::Types::int64 y, Phanes::Core::Types::int64 z)
+        {
+            v1.comp = _mm256_setr_epi64x(x, y, z, 0);
+        }
+
+
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector3<Phanes::Core::Types::int64, true>& v1, const Phanes::Core::Types::int64* comp)
+        {
+            v1.comp = _mm256_setr_epi64x(comp[0], comp[1], comp[2], 0);
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector3<Phanes::Core::Types::int64, true>& r, const Phanes::Core::Math::TIntVector2<Phanes::Core::Types::int64, true>& v1, const Phanes::Core::Types::int64 s)
+        {
+            r.comp = _mm256_set_m128i(_mm_set_epi64x(0, s), v1.comp);
+        }
+    };
+
+
+    template<> struct compute_ivec3_add<Phanes::Core::Types::int64, true> : public compute_ivec4_add<Phanes::Core::Types::int64, true> {};
+    template<> struct compute_ivec3_sub<Phanes::Core::Types::int64, true> : public compute_ivec4_sub<Phanes::Core::Types::int64, true> {};
+    template<> struct compute_ivec3_mul<Phanes::Core::Types::int64, true> : public compute_ivec4_mul<Phanes::Core::Types::int64, true> {};
+    template<> struct compute_ivec3_inc<Phanes::Core::Types::int64, true> : public compute_ivec4_inc<Phanes::Core::Types::int64, true> {};
+    template<> struct compute_ivec3_dec<Phanes::Core::Types::int64, true> : public compute_ivec4_dec<Phanes::Core::Types::int64, true> {};
+
+
+    template<> struct compute_ivec3_and<Phanes::Core::Types::int64, true> :            public compute_ivec4_and<Phanes::Core::Types::int64, true> {};
+    template<> struct compute_ivec3_or<Phanes::Core::Types::int64, true> :             public compute_ivec4_or<Phanes::Core::Types::int64, true> {};
+    template<> struct compute_ivec3_xor<Phanes::Core::Types::int64, true> :            public compute_ivec4_xor<Phanes::Core::Types::int64, true> {};
+    template<> struct compute_ivec3_left_shift<Phanes::Core::Types::int64, true> :     public compute_ivec4_left_shift<Phanes::Core::Types::int64, true> {};
+    template<> struct compute_ivec3_right_shift<Phanes::Core::Types::int64, true> :    public compute_ivec4_right_shift<Phanes::Core::Types::int64, true> {};
+    template<> struct compute_ivec3_bnot<Phanes::Core::Types::int64, true> :           public compute_ivec4_bnot<Phanes::Core::Types::int64, true> {};
+
+    // w is skipped, as it is 0 and would divide by zero.
+    template<>
+    struct compute_ivec3_div<Phanes::Core::Types::int64, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector3<Phanes::Core::Types::int64, true>& r, const Phanes::Core::Math::TIntVector3<Phanes::Core::Types::int64, true>& v1, const Phanes::Core::Math::TIntVector3<Phanes::Core::Types::int64, true>& v2)
+        {
+            r.comp = _mm256_setr_epi64x(v1.x / v2.x, v1.y / v2.y, v1.z / v2.z, 0);
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector3<Phanes::Core::Types::int64, true>& r, const Phanes::Core::Math::TIntVector3<Phanes::Core::Types::int64, true>& v1, Phanes::Core::Types::int64 s)
+        {
+            r.comp = _mm256_setr_epi64x(v1.x / s, v1.y / s, v1.z / s, 0);
+        }
+    };
+
+    // w is skipped, as it is 0 and would divide by zero.
+    template<>
+    struct compute_ivec3_mod<Phanes::Core::Types::int64, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector3<Phanes::Core::Types::int64, true>& r, const Phanes::Core::Math::TIntVector3<Phanes::Core::Types::int64, true>& v1, const Phanes::Core::Math::TIntVector3<Phanes::Core::Types::int64, true>& v2)
+        {
+            r.comp = _mm256_setr_epi64x(v1.x % v2.x, v1.y % v2.y, v1.z % v2.z, 0);
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector3<Phanes::Core::Types::int64, true>& r, const Phanes::Core::Math::TIntVector3<Phanes::Core::Types::int64, true>& v1, Phanes::Core::Types::int64 s)
+        {
+            r.comp = _mm256_setr_epi64x(v1.x % s, v1.y % s, v1.z % s, 0);
+        }
+    };
+
+    template<>
+    struct compute_ivec3_eq<Phanes::Core::Types::int64, true>
+    {
+        static FORCEINLINE bool map(const Phanes::Core::Math::TIntVector3<Phanes::Core::Types::int64, true>& v1, const Phanes::Core::Math::TIntVector3<Phanes::Core::Types::int64, true>& v2)
+        {
+            return (Phanes::Core::Math::SIMD::ivec4_eq_mask_epi64(v1.comp, v2.comp) & 0x7) == 0x7;
+        }
+    };
+
+    template<>
+    struct compute_ivec3_ieq<Phanes::Core::Types::int64, true>
+    {
+        static FORCEINLINE bool map(const Phanes::Core::Math::TIntVector3<Phanes::Core::Types::int64, true>& v1, const Phanes::Core::Math::TIntVector3<Phanes::Core::Types::int64, true>& v2)
+        {
+            return (Phanes::Core::Math::SIMD::ivec4_eq_mask_epi64(v1.comp, v2.comp) & 0x7) != 0x7;
+        }
+    };
+}
@@ -0,0 +1,6 @@
+#pragma once
+
+#include "PhanesVectorMathAVX2.hpp" // Include previous
+
+
+// The AVX-512 tier has no vector specializations of its own. The 16-wide kernels are in PhanesKernelsAVX512.hpp.
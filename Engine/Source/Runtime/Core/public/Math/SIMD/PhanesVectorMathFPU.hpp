@@ -1,9 +1,35 @@
 #pragma once
 
+// Scalar backend, selected with P_INTRINSICS_FPU (e.g. through P_FORCE_FPU).
+//
+// Implements every Detail::compute_* functor for aligned (S = true) types with plain loops over the components,
+// which GCC and Clang can auto-vectorize. It serves as the reference to diff the SSE / AVX paths against.
+
 #include "Core/public/Math/SIMD/PhanesSIMDTypes.h"
+#include "Core/public/Math/SIMD/PhanesKernelsFPU.hpp"
+#include "Core/public/Math/Boilerplate.h"
 #include "Core/public/Math/MathCommon.hpp"
 
 
+#include "Core/public/Math/Vector2.hpp"
+#include "Core/public/Math/Vector3.hpp"
+#include "Core/public/Math/Vector4.hpp"
+
+#include "Core/public/Math/IntVector2.hpp"
+#include "Core/public/Math/IntVector3.hpp"
+#include "Core/public/Math/IntVector4.hpp"
+#include "Core/public/Math/IntDivisor.hpp"
+
+#include "Core/public/Math/Matrix3.hpp"
+#include "Core/public/Math/Matrix4.hpp"
+
+#include "Core/public/Math/Quaternion.hpp"
+
+
+// ========== //
+//   Common   //
+// ========== //
+
 namespace Phanes::Core::Math::SIMD
 {
     /// <summary>
@@ -11,10 +37,11 @@ namespace Phanes::Core::Math::SIMD
     /// </summary>
     /// <param name="v">Vector</param>
     /// <returns>Sum stored in v[0:31].</returns>
-    Phanes::Core::Types::Vec4f32Reg vec4_hadd(const Phanes::Core::Types::Vec4f32Reg v)
+    inline Phanes::Core::Types::Vec4f32Reg vec4_hadd(const Phanes::Core::Types::Vec4f32Reg v)
     {
-        Phanes::Core::Types::Vec4f32Reg r;
+        Phanes::Core::Types::Vec4f32Reg r = {};
         r.data[0] = v.data[0] + v.data[1] + v.data[2] + v.data[3];
+        return r;
     }
     
     /// <summary>
@@ -22,7 +49,7 @@ namespace Phanes::Core::Math::SIMD
     /// </summary>
     /// <param name="v">Vector</param>
     /// <returns>Sum of components.</returns>
-    float vec4_hadd_cvtf32(const Phanes::Core::Types::Vec4f32Reg v)
+    inline float vec4_hadd_cvtf32(const Phanes::Core::Types::Vec4f32Reg v)
     {
         return v.data[0] + v.data[1] + v.data[2] + v.data[3];
     }
@@ -32,43 +59,1778 @@ namespace Phanes::Core::Math::SIMD
     /// </summary>
     /// <param name="v">Vector</param>
     /// <returns>Vector with all components positive.</returns>
-    Phanes::Core::Types::Vec4f32Reg vec4_abs(const Phanes::Core::Types::Vec4f32Reg v)
+    inline Phanes::Core::Types::Vec4f32Reg vec4_abs(const Phanes::Core::Types::Vec4f32Reg v)
     {
         Phanes::Core::Types::Vec4f32Reg r;
 
-        r.data[0] = Abs(v.data[0]);
+        for (size_t i = 0; i < 4; ++i)
+        {
+            r.data[i] = Phanes::Core::Math::Abs(v.data[i]);
+        }
+        return r;
     }
     
     /// <summary>
-    /// Gets the dot product of the 
+    /// Gets the dot product of the vectors.
     /// </summary>
-    /// <param name="v1"></param>
-    /// <param name="v2"></param>
-    /// <returns></returns>
-    Phanes::Core::Types::Vec4f32Reg vec4_dot(const Phanes::Core::Types::Vec4f32Reg v1, const Phanes::Core::Types::Vec4f32Reg v2)
+    /// <param name="v1">Vector one</param>
+    /// <param name="v2">Vector two</param>
+    /// <returns>Dot product stored in v[0:31].</returns>
+    inline Phanes::Core::Types::Vec4f32Reg vec4_dot(const Phanes::Core::Types::Vec4f32Reg v1, const Phanes::Core::Types::Vec4f32Reg v2)
     {
-        Phanes::Core::Types::Vec4f32Reg r;
-        r.data[0] = v1.data[0] * v1.data[0] + v1.data[1] * v2.data[1] + v1.data[2] * v2.data[2] + v1.data[3] * v2.data[3];
+        Phanes::Core::Types::Vec4f32Reg r = {};
+        r.data[0] = v1.data[0] * v2.data[0] + v1.data[1] * v2.data[1] + v1.data[2] * v2.data[2] + v1.data[3] * v2.data[3];
 
         return r;
     }
     
     /// <summary>
-    /// Gets the dot product of the 
+    /// Gets the dot product of the vectors.
     /// </summary>
-    /// <param name="v1"></param>
-    /// <param name="v2"></param>
-    /// <returns></returns>
-    float vec4_dot_cvtf32(const Phanes::Core::Types::Vec4f32Reg v1, const Phanes::Core::Types::Vec4f32Reg v2)
+    /// <param name="v1">Vector one</param>
+    /// <param name="v2">Vector two</param>
+    /// <returns>Dot product</returns>
+    inline float vec4_dot_cvtf32(const Phanes::Core::Types::Vec4f32Reg v1, const Phanes::Core::Types::Vec4f32Reg v2)
     {
-        return v1.data[0] * v1.data[0] + v1.data[1] * v2.data[1] + v1.data[2] * v2.data[2] + v1.data[3] * v2.data[3];
+        return v1.data[0] * v2.data[0] + v1.data[1] * v2.data[1] + v1.data[2] * v2.data[2] + v1.data[3] * v2.data[3];
     }
 
-    Phanes::Core::Types::Vec2f64Reg vec2_eq(const Phanes::Core::Types::Vec2f64Reg v1, const Phanes::Core::Types::Vec2f64Reg v2)
+    /// <summary>
+    /// Compares the vectors with P_FLT_INAC tolerance.
+    /// </summary>
+    /// <param name="v1">Vector one</param>
+    /// <param name="v2">Vector two</param>
+    /// <returns>Per component mask. All bits set, if the components are equal.</returns>
+    inline Phanes::Core::Types::Vec2u64Reg vec2_eq(const Phanes::Core::Types::Vec2f64Reg v1, const Phanes::Core::Types::Vec2f64Reg v2)
     {
-        Phanes::Core::Types::Vec4f64Reg r;
+        Phanes::Core::Types::Vec2u64Reg r = {};
 
-        r.data[0] = (Phanes::Core::Math::Abs(v1.data[0] - v2.data[0]) < P_FLT_INAC) ? 0xFFFFFFFF : 0;
-        r.data[1] = (Phanes::Core::Math::Abs(v1.data[1] - v2.data[1]) < P_FLT_INAC) ? 0xFFFFFFFF : 0;
+        for (size_t i = 0; i < 2; ++i)
+        {
+            r.data[i] = (Phanes::Core::Math::Abs(v1.data[i] - v2.data[i]) < P_FLT_INAC) ? ~(Phanes::Core::Types::uint64)0 : 0;
+        }
+        return r;
     }
-}
\ No newline at end of file
+}
+
+
+namespace Phanes::Core::Math::Detail
+{
+    // Template classes have already been defined and are included through: Storage.h -> Vector4.hpp -> SIMDIntrinsics.h -> PhanesVectorMathFPU.hpp
+    //
+    // Vector3 / IntVector3 keep w at 0. Division and modulo skip w, so integer vectors do not divide by zero.
+
+    // ============ //
+    //   TVector4   //
+    // ============ //
+
+    template<RealType T>
+    struct construct_vec4<T, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TVector4<T, true>& v1, const TVector4<T, true>& v2)
+        {
+            for (size_t i = 0; i < 4; ++i)
+            {
+                v1.comp.data[i] = v2.comp.data[i];
+            }
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TVector4<T, true>& v1, T s)
+        {
+            for (size_t i = 0; i < 4; ++i)
+            {
+                v1.comp.data[i] = s;
+            }
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TVector4<T, true>& v1, T x, T y, T z, T w)
+        {
+            v1.x = x;
+            v1.y = y;
+            v1.z = z;
+            v1.w = w;
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TVector4<T, true>& v1, const T* comp)
+        {
+            for (size_t i = 0; i < 4; ++i)
+            {
+                v1.comp.data[i] = comp[i];
+            }
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TVector4<T, true>& v1, const Phanes::Core::Math::TVector2<T, true>& v2, const Phanes::Core::Math::TVector2<T, true>& v3)
+        {
+            v1.x = v2.x;
+            v1.y = v2.y;
+            v1.z = v3.x;
+            v1.w = v3.y;
+        }
+    };
+
+    template<RealType T>
+    struct compute_vec4_add<T, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TVector4<T, true>& r, const Phanes::Core::Math::TVector4<T, true>& v1, const Phanes::Core::Math::TVector4<T, true>& v2)
+        {
+            for (size_t i = 0; i < 4; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] + v2.comp.data[i];
+            }
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TVector4<T, true>& r, const Phanes::Core::Math::TVector4<T, true>& v1, T s)
+        {
+            for (size_t i = 0; i < 4; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] + s;
+            }
+        }
+    };
+
+    template<RealType T>
+    struct compute_vec4_sub<T, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TVector4<T, true>& r, const Phanes::Core::Math::TVector4<T, true>& v1, const Phanes::Core::Math::TVector4<T, true>& v2)
+        {
+            for (size_t i = 0; i < 4; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] - v2.comp.data[i];
+            }
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TVector4<T, true>& r, const Phanes::Core::Math::TVector4<T, true>& v1, T s)
+        {
+            for (size_t i = 0; i < 4; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] - s;
+            }
+        }
+    };
+
+    template<RealType T>
+    struct compute_vec4_mul<T, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TVector4<T, true>& r, const Phanes::Core::Math::TVector4<T, true>& v1, const Phanes::Core::Math::TVector4<T, true>& v2)
+        {
+            for (size_t i = 0; i < 4; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] * v2.comp.data[i];
+            }
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TVector4<T, true>& r, const Phanes::Core::Math::TVector4<T, true>& v1, T s)
+        {
+            for (size_t i = 0; i < 4; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] * s;
+            }
+        }
+    };
+
+    template<RealType T>
+    struct compute_vec4_div<T, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TVector4<T, true>& r, const Phanes::Core::Math::TVector4<T, true>& v1, const Phanes::Core::Math::TVector4<T, true>& v2)
+        {
+            for (size_t i = 0; i < 4; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] / v2.comp.data[i];
+            }
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TVector4<T, true>& r, const Phanes::Core::Math::TVector4<T, true>& v1, T s)
+        {
+            for (size_t i = 0; i < 4; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] / s;
+            }
+        }
+    };
+
+    template<RealType T>
+    struct compute_vec4_eq<T, true>
+    {
+        static FORCEINLINE bool map(const Phanes::Core::Math::TVector4<T, true>& v1, const Phanes::Core::Math::TVector4<T, true>& v2)
+        {
+            bool r = true;
+            for (size_t i = 0; i < 4; ++i)
+            {
+                r &= Phanes::Core::Math::Abs(v1.comp.data[i] - v2.comp.data[i]) < P_FLT_INAC;
+            }
+            return r;
+        }
+    };
+
+    template<RealType T>
+    struct compute_vec4_ieq<T, true>
+    {
+        static FORCEINLINE bool map(const Phanes::Core::Math::TVector4<T, true>& v1, const Phanes::Core::Math::TVector4<T, true>& v2)
+        {
+            return !compute_vec4_eq<T, true>::map(v1, v2);
+        }
+    };
+
+    template<RealType T>
+    struct compute_vec4_eq_mask<T, true>
+    {
+        static FORCEINLINE int map(const Phanes::Core::Math::TVector4<T, true>& v1, const Phanes::Core::Math::TVector4<T, true>& v2, T threshold)
+        {
+            int r = 0;
+            for (size_t i = 0; i < 4; ++i)
+            {
+                r |= (int)(Phanes::Core::Math::Abs(v1.comp.data[i] - v2.comp.data[i]) < threshold) << i;
+            }
+            return r;
+        }
+    };
+
+    template<RealType T>
+    struct compute_vec4_lt_mask<T, true>
+    {
+        static FORCEINLINE int map(const Phanes::Core::Math::TVector4<T, true>& v1, const Phanes::Core::Math::TVector4<T, true>& v2)
+        {
+            int r = 0;
+            for (size_t i = 0; i < 4; ++i)
+            {
+                r |= (int)(v1.comp.data[i] < v2.comp.data[i]) << i;
+            }
+            return r;
+        }
+    };
+
+    template<RealType T>
+    struct compute_vec4_inc<T, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TVector4<T, true>& r, const Phanes::Core::Math::TVector4<T, true>& v1)
+        {
+            for (size_t i = 0; i < 4; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] + (T)1;
+            }
+        }
+    };
+
+    template<RealType T>
+    struct compute_vec4_dec<T, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TVector4<T, true>& r, const Phanes::Core::Math::TVector4<T, true>& v1)
+        {
+            for (size_t i = 0; i < 4; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] - (T)1;
+            }
+        }
+    };
+
+    template<RealType T>
+    struct compute_vec4_dot<T, true>
+    {
+        static FORCEINLINE T map(const Phanes::Core::Math::TVector4<T, true>& v1, const Phanes::Core::Math::TVector4<T, true>& v2)
+        {
+            T r = (T)0;
+            for (size_t i = 0; i < 4; ++i)
+            {
+                r += v1.comp.data[i] * v2.comp.data[i];
+            }
+            return r;
+        }
+    };
+
+    template<RealType T>
+    struct compute_vec4_normalize<T, true>
+    {
+        // Scalar path is always exact.
+        static FORCEINLINE void map(Phanes::Core::Math::TVector4<T, true>& r, const Phanes::Core::Math::TVector4<T, true>& v1, EPrecision)
+        {
+            T vecNorm = sqrt(compute_vec4_dot<T, true>::map(v1, v1));
+            vecNorm = (vecNorm < P_FLT_INAC) ? (T)1.0 : vecNorm;
+
+            for (size_t i = 0; i < 4; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] / vecNorm;
+            }
+        }
+    };
+
+    template<RealType T>
+    struct compute_vec4_rcp<T, true>
+    {
+        // Scalar path is always exact.
+        static FORCEINLINE void map(Phanes::Core::Math::TVector4<T, true>& r, const Phanes::Core::Math::TVector4<T, true>& v1, EPrecision)
+        {
+            for (size_t i = 0; i < 4; ++i)
+            {
+                r.comp.data[i] = (T)1.0 / v1.comp.data[i];
+            }
+        }
+    };
+
+    // ============ //
+    //   TVector3   //
+    // ============ //
+
+    template<RealType T>
+    struct construct_vec3<T, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TVector3<T, true>& v1, const TVector3<T, true>& v2)
+        {
+            for (size_t i = 0; i < 4; ++i)
+            {
+                v1.comp.data[i] = v2.comp.data[i];
+            }
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TVector3<T, true>& v1, T s)
+        {
+            for (size_t i = 0; i < 3; ++i)
+            {
+                v1.comp.data[i] = s;
+            }
+            v1.w = (T)0.0;
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TVector3<T, true>& v1, T x, T y, T z)
+        {
+            v1.x = x;
+            v1.y = y;
+            v1.z = z;
+            v1.w = (T)0.0;
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TVector3<T, true>& v1, const T* comp)
+        {
+            for (size_t i = 0; i < 3; ++i)
+            {
+                v1.comp.data[i] = comp[i];
+            }
+            v1.w = (T)0.0;
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TVector3<T, true>& v1, const Phanes::Core::Math::TVector2<T, true>& v2, T s)
+        {
+            v1.x = v2.x;
+            v1.y = v2.y;
+            v1.z = s;
+            v1.w = (T)0.0;
+        }
+    };
+
+    template<RealType T>
+    struct compute_vec3_add<T, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TVector3<T, true>& r, const Phanes::Core::Math::TVector3<T, true>& v1, const Phanes::Core::Math::TVector3<T, true>& v2)
+        {
+            for (size_t i = 0; i < 4; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] + v2.comp.data[i];
+            }
+            r.w = (T)0;
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TVector3<T, true>& r, const Phanes::Core::Math::TVector3<T, true>& v1, T s)
+        {
+            for (size_t i = 0; i < 4; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] + s;
+            }
+            r.w = (T)0;
+        }
+    };
+
+    template<RealType T>
+    struct compute_vec3_sub<T, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TVector3<T, true>& r, const Phanes::Core::Math::TVector3<T, true>& v1, const Phanes::Core::Math::TVector3<T, true>& v2)
+        {
+            for (size_t i = 0; i < 4; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] - v2.comp.data[i];
+            }
+            r.w = (T)0;
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TVector3<T, true>& r, const Phanes::Core::Math::TVector3<T, true>& v1, T s)
+        {
+            for (size_t i = 0; i < 4; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] - s;
+            }
+            r.w = (T)0;
+        }
+    };
+
+    template<RealType T>
+    struct compute_vec3_mul<T, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TVector3<T, true>& r, const Phanes::Core::Math::TVector3<T, true>& v1, const Phanes::Core::Math::TVector3<T, true>& v2)
+        {
+            for (size_t i = 0; i < 4; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] * v2.comp.data[i];
+            }
+            r.w = (T)0;
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TVector3<T, true>& r, const Phanes::Core::Math::TVector3<T, true>& v1, T s)
+        {
+            for (size_t i = 0; i < 4; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] * s;
+            }
+            r.w = (T)0;
+        }
+    };
+
+    template<RealType T>
+    struct compute_vec3_div<T, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TVector3<T, true>& r, const Phanes::Core::Math::TVector3<T, true>& v1, const Phanes::Core::Math::TVector3<T, true>& v2)
+        {
+            for (size_t i = 0; i < 3; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] / v2.comp.data[i];
+            }
+            r.w = (T)0;
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TVector3<T, true>& r, const Phanes::Core::Math::TVector3<T, true>& v1, T s)
+        {
+            for (size_t i = 0; i < 3; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] / s;
+            }
+            r.w = (T)0;
+        }
+    };
+
+    template<RealType T>
+    struct compute_vec3_eq<T, true>
+    {
+        static FORCEINLINE bool map(const Phanes::Core::Math::TVector3<T, true>& v1, const Phanes::Core::Math::TVector3<T, true>& v2)
+        {
+            bool r = true;
+            for (size_t i = 0; i < 3; ++i)
+            {
+                r &= Phanes::Core::Math::Abs(v1.comp.data[i] - v2.comp.data[i]) < P_FLT_INAC;
+            }
+            return r;
+        }
+    };
+
+    template<RealType T>
+    struct compute_vec3_ieq<T, true>
+    {
+        static FORCEINLINE bool map(const Phanes::Core::Math::TVector3<T, true>& v1, const Phanes::Core::Math::TVector3<T, true>& v2)
+        {
+            return !compute_vec3_eq<T, true>::map(v1, v2);
+        }
+    };
+
+    template<RealType T>
+    struct compute_vec3_eq_mask<T, true>
+    {
+        static FORCEINLINE int map(const Phanes::Core::Math::TVector3<T, true>& v1, const Phanes::Core::Math::TVector3<T, true>& v2, T threshold)
+        {
+            int r = 0;
+            for (size_t i = 0; i < 3; ++i)
+            {
+                r |= (int)(Phanes::Core::Math::Abs(v1.comp.data[i] - v2.comp.data[i]) < threshold) << i;
+            }
+            return r;
+        }
+    };
+
+    template<RealType T>
+    struct compute_vec3_lt_mask<T, true>
+    {
+        static FORCEINLINE int map(const Phanes::Core::Math::TVector3<T, true>& v1, const Phanes::Core::Math::TVector3<T, true>& v2)
+        {
+            int r = 0;
+            for (size_t i = 0; i < 3; ++i)
+            {
+                r |= (int)(v1.comp.data[i] < v2.comp.data[i]) << i;
+            }
+            return r;
+        }
+    };
+
+    template<RealType T>
+    struct compute_vec3_inc<T, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TVector3<T, true>& r, const Phanes::Core::Math::TVector3<T, true>& v1)
+        {
+            for (size_t i = 0; i < 3; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] + (T)1;
+            }
+        }
+    };
+
+    template<RealType T>
+    struct compute_vec3_dec<T, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TVector3<T, true>& r, const Phanes::Core::Math::TVector3<T, true>& v1)
+        {
+            for (size_t i = 0; i < 3; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] - (T)1;
+            }
+        }
+    };
+
+    template<RealType T>
+    struct compute_vec3_cross_p<T, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TVector3<T, true>& r, const Phanes::Core::Math::TVector3<T, true>& v1, const Phanes::Core::Math::TVector3<T, true>& v2)
+        {
+            const T x = (v1.y * v2.z) - (v1.z * v2.y);
+            const T y = (v1.z * v2.x) - (v1.x * v2.z);
+            const T z = (v1.x * v2.y) - (v1.y * v2.x);
+
+            r.x = x;
+            r.y = y;
+            r.z = z;
+            r.w = (T)0.0;
+        }
+    };
+
+    // w stays 0, so the 4D normalization can be used.
+    template<RealType T> struct compute_vec3_normalize<T, true> : public compute_vec4_normalize<T, true> {};
+
+    template<RealType T>
+    struct compute_vec3_rcp<T, true>
+    {
+        // Scalar path is always exact.
+        static FORCEINLINE void map(Phanes::Core::Math::TVector3<T, true>& r, const Phanes::Core::Math::TVector3<T, true>& v1, EPrecision)
+        {
+            for (size_t i = 0; i < 3; ++i)
+            {
+                r.comp.data[i] = (T)1.0 / v1.comp.data[i];
+            }
+            r.comp.data[3] = (T)0.0;
+        }
+    };
+
+    // ============ //
+    //   TVector2   //
+    // ============ //
+
+    template<RealType T>
+    struct construct_vec2<T, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TVector2<T, true>& v1, const TVector2<T, true>& v2)
+        {
+            for (size_t i = 0; i < 2; ++i)
+            {
+                v1.comp.data[i] = v2.comp.data[i];
+            }
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TVector2<T, true>& v1, T s)
+        {
+            for (size_t i = 0; i < 2; ++i)
+            {
+                v1.comp.data[i] = s;
+            }
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TVector2<T, true>& v1, T x, T y)
+        {
+            v1.x = x;
+            v1.y = y;
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TVector2<T, true>& v1, const T* comp)
+        {
+            for (size_t i = 0; i < 2; ++i)
+            {
+                v1.comp.data[i] = comp[i];
+            }
+        }
+    };
+
+    template<RealType T>
+    struct compute_vec2_add<T, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TVector2<T, true>& r, const Phanes::Core::Math::TVector2<T, true>& v1, const Phanes::Core::Math::TVector2<T, true>& v2)
+        {
+            for (size_t i = 0; i < 2; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] + v2.comp.data[i];
+            }
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TVector2<T, true>& r, const Phanes::Core::Math::TVector2<T, true>& v1, T s)
+        {
+            for (size_t i = 0; i < 2; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] + s;
+            }
+        }
+    };
+
+    template<RealType T>
+    struct compute_vec2_sub<T, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TVector2<T, true>& r, const Phanes::Core::Math::TVector2<T, true>& v1, const Phanes::Core::Math::TVector2<T, true>& v2)
+        {
+            for (size_t i = 0; i < 2; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] - v2.comp.data[i];
+            }
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TVector2<T, true>& r, const Phanes::Core::Math::TVector2<T, true>& v1, T s)
+        {
+            for (size_t i = 0; i < 2; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] - s;
+            }
+        }
+    };
+
+    template<RealType T>
+    struct compute_vec2_mul<T, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TVector2<T, true>& r, const Phanes::Core::Math::TVector2<T, true>& v1, const Phanes::Core::Math::TVector2<T, true>& v2)
+        {
+            for (size_t i = 0; i < 2; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] * v2.comp.data[i];
+            }
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TVector2<T, true>& r, const Phanes::Core::Math::TVector2<T, true>& v1, T s)
+        {
+            for (size_t i = 0; i < 2; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] * s;
+            }
+        }
+    };
+
+    template<RealType T>
+    struct compute_vec2_div<T, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TVector2<T, true>& r, const Phanes::Core::Math::TVector2<T, true>& v1, const Phanes::Core::Math::TVector2<T, true>& v2)
+        {
+            for (size_t i = 0; i < 2; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] / v2.comp.data[i];
+            }
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TVector2<T, true>& r, const Phanes::Core::Math::TVector2<T, true>& v1, T s)
+        {
+            for (size_t i = 0; i < 2; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] / s;
+            }
+        }
+    };
+
+    template<RealType T>
+    struct compute_vec2_inc<T, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TVector2<T, true>& r, const Phanes::Core::Math::TVector2<T, true>& v1)
+        {
+            for (size_t i = 0; i < 2; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] + (T)1;
+            }
+        }
+    };
+
+    template<RealType T>
+    struct compute_vec2_dec<T, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TVector2<T, true>& r, const Phanes::Core::Math::TVector2<T, true>& v1)
+        {
+            for (size_t i = 0; i < 2; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] - (T)1;
+            }
+        }
+    };
+
+    // =============== //
+    //   TIntVector4   //
+    // =============== //
+
+    template<IntType T>
+    struct construct_ivec4<T, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<T, true>& v1, const TIntVector4<T, true>& v2)
+        {
+            for (size_t i = 0; i < 4; ++i)
+            {
+                v1.comp.data[i] = v2.comp.data[i];
+            }
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<T, true>& v1, T s)
+        {
+            for (size_t i = 0; i < 4; ++i)
+            {
+                v1.comp.data[i] = s;
+            }
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<T, true>& v1, T x, T y, T z, T w)
+        {
+            v1.x = x;
+            v1.y = y;
+            v1.z = z;
+            v1.w = w;
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<T, true>& v1, const T* comp)
+        {
+            for (size_t i = 0; i < 4; ++i)
+            {
+                v1.comp.data[i] = comp[i];
+            }
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<T, true>& v1, const Phanes::Core::Math::TIntVector2<T, true>& v2, const Phanes::Core::Math::TIntVector2<T, true>& v3)
+        {
+            v1.x = v2.x;
+            v1.y = v2.y;
+            v1.z = v3.x;
+            v1.w = v3.y;
+        }
+    };
+
+    template<IntType T>
+    struct compute_ivec4_add<T, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<T, true>& r, const Phanes::Core::Math::TIntVector4<T, true>& v1, const Phanes::Core::Math::TIntVector4<T, true>& v2)
+        {
+            for (size_t i = 0; i < 4; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] + v2.comp.data[i];
+            }
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<T, true>& r, const Phanes::Core::Math::TIntVector4<T, true>& v1, T s)
+        {
+            for (size_t i = 0; i < 4; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] + s;
+            }
+        }
+    };
+
+    template<IntType T>
+    struct compute_ivec4_sub<T, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<T, true>& r, const Phanes::Core::Math::TIntVector4<T, true>& v1, const Phanes::Core::Math::TIntVector4<T, true>& v2)
+        {
+            for (size_t i = 0; i < 4; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] - v2.comp.data[i];
+            }
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<T, true>& r, const Phanes::Core::Math::TIntVector4<T, true>& v1, T s)
+        {
+            for (size_t i = 0; i < 4; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] - s;
+            }
+        }
+    };
+
+    template<IntType T>
+    struct compute_ivec4_mul<T, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<T, true>& r, const Phanes::Core::Math::TIntVector4<T, true>& v1, const Phanes::Core::Math::TIntVector4<T, true>& v2)
+        {
+            for (size_t i = 0; i < 4; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] * v2.comp.data[i];
+            }
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<T, true>& r, const Phanes::Core::Math::TIntVector4<T, true>& v1, T s)
+        {
+            for (size_t i = 0; i < 4; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] * s;
+            }
+        }
+    };
+
+    template<IntType T>
+    struct compute_ivec4_div<T, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<T, true>& r, const Phanes::Core::Math::TIntVector4<T, true>& v1, const Phanes::Core::Math::TIntVector4<T, true>& v2)
+        {
+            for (size_t i = 0; i < 4; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] / v2.comp.data[i];
+            }
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<T, true>& r, const Phanes::Core::Math::TIntVector4<T, true>& v1, T s)
+        {
+            for (size_t i = 0; i < 4; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] / s;
+            }
+        }
+    };
+
+    template<IntType T>
+    struct compute_ivec4_mod<T, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<T, true>& r, const Phanes::Core::Math::TIntVector4<T, true>& v1, const Phanes::Core::Math::TIntVector4<T, true>& v2)
+        {
+            for (size_t i = 0; i < 4; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] % v2.comp.data[i];
+            }
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<T, true>& r, const Phanes::Core::Math::TIntVector4<T, true>& v1, T s)
+        {
+            for (size_t i = 0; i < 4; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] % s;
+            }
+        }
+    };
+
+    template<>
+    struct compute_ivec4_div_magic<int, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<int, true>& r, const Phanes::Core::Math::TIntVector4<int, true>& v1, const Phanes::Core::Math::IntDivisor& d)
+        {
+            for (size_t i = 0; i < 4; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] / d;
+            }
+        }
+    };
+
+    template<IntType T>
+    struct compute_ivec4_eq<T, true>
+    {
+        static FORCEINLINE bool map(const Phanes::Core::Math::TIntVector4<T, true>& v1, const Phanes::Core::Math::TIntVector4<T, true>& v2)
+        {
+            bool r = true;
+            for (size_t i = 0; i < 4; ++i)
+            {
+                r &= v1.comp.data[i] == v2.comp.data[i];
+            }
+            return r;
+        }
+    };
+
+    template<IntType T>
+    struct compute_ivec4_ieq<T, true>
+    {
+        static FORCEINLINE bool map(const Phanes::Core::Math::TIntVector4<T, true>& v1, const Phanes::Core::Math::TIntVector4<T, true>& v2)
+        {
+            return !compute_ivec4_eq<T, true>::map(v1, v2);
+        }
+    };
+
+    template<IntType T>
+    struct compute_ivec4_inc<T, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<T, true>& r, const Phanes::Core::Math::TIntVector4<T, true>& v1)
+        {
+            for (size_t i = 0; i < 4; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] + (T)1;
+            }
+        }
+    };
+
+    template<IntType T>
+    struct compute_ivec4_dec<T, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<T, true>& r, const Phanes::Core::Math::TIntVector4<T, true>& v1)
+        {
+            for (size_t i = 0; i < 4; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] - (T)1;
+            }
+        }
+    };
+
+    template<IntType T>
+    struct compute_ivec4_and<T, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<T, true>& r, const Phanes::Core::Math::TIntVector4<T, true>& v1, const Phanes::Core::Math::TIntVector4<T, true>& v2)
+        {
+            for (size_t i = 0; i < 4; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] & v2.comp.data[i];
+            }
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<T, true>& r, const Phanes::Core::Math::TIntVector4<T, true>& v1, T s)
+        {
+            for (size_t i = 0; i < 4; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] & s;
+            }
+        }
+    };
+
+    template<IntType T>
+    struct compute_ivec4_or<T, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<T, true>& r, const Phanes::Core::Math::TIntVector4<T, true>& v1, const Phanes::Core::Math::TIntVector4<T, true>& v2)
+        {
+            for (size_t i = 0; i < 4; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] | v2.comp.data[i];
+            }
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<T, true>& r, const Phanes::Core::Math::TIntVector4<T, true>& v1, T s)
+        {
+            for (size_t i = 0; i < 4; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] | s;
+            }
+        }
+    };
+
+    template<IntType T>
+    struct compute_ivec4_xor<T, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<T, true>& r, const Phanes::Core::Math::TIntVector4<T, true>& v1, const Phanes::Core::Math::TIntVector4<T, true>& v2)
+        {
+            for (size_t i = 0; i < 4; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] ^ v2.comp.data[i];
+            }
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<T, true>& r, const Phanes::Core::Math::TIntVector4<T, true>& v1, T s)
+        {
+            for (size_t i = 0; i < 4; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] ^ s;
+            }
+        }
+    };
+
+    template<IntType T>
+    struct compute_ivec4_left_shift<T, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<T, true>& r, const Phanes::Core::Math::TIntVector4<T, true>& v1, const Phanes::Core::Math::TIntVector4<T, true>& v2)
+        {
+            for (size_t i = 0; i < 4; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] << v2.comp.data[i];
+            }
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<T, true>& r, const Phanes::Core::Math::TIntVector4<T, true>& v1, T s)
+        {
+            for (size_t i = 0; i < 4; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] << s;
+            }
+        }
+    };
+
+    template<IntType T>
+    struct compute_ivec4_right_shift<T, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<T, true>& r, const Phanes::Core::Math::TIntVector4<T, true>& v1, const Phanes::Core::Math::TIntVector4<T, true>& v2)
+        {
+            for (size_t i = 0; i < 4; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] >> v2.comp.data[i];
+            }
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<T, true>& r, const Phanes::Core::Math::TIntVector4<T, true>& v1, T s)
+        {
+            for (size_t i = 0; i < 4; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] >> s;
+            }
+        }
+    };
+
+    template<IntType T>
+    struct compute_ivec4_bnot<T, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<T, true>& r, const Phanes::Core::Math::TIntVector4<T, true>& v1)
+        {
+            for (size_t i = 0; i < 4; ++i)
+            {
+                r.comp.data[i] = ~v1.comp.data[i];
+            }
+        }
+    };
+
+    // =============== //
+    //   TIntVector3   //
+    // =============== //
+
+    template<IntType T>
+    struct construct_ivec3<T, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector3<T, true>& v1, const TIntVector3<T, true>& v2)
+        {
+            for (size_t i = 0; i < 4; ++i)
+            {
+                v1.comp.data[i] = v2.comp.data[i];
+            }
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector3<T, true>& v1, T s)
+        {
+            for (size_t i = 0; i < 3; ++i)
+            {
+                v1.comp.data[i] = s;
+            }
+            v1.w = (T)0;
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector3<T, true>& v1, T x, T y, T z)
+        {
+            v1.x = x;
+            v1.y = y;
+            v1.z = z;
+            v1.w = (T)0;
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector3<T, true>& v1, const T* comp)
+        {
+            for (size_t i = 0; i < 3; ++i)
+            {
+                v1.comp.data[i] = comp[i];
+            }
+            v1.w = (T)0;
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector3<T, true>& v1, const Phanes::Core::Math::TIntVector2<T, true>& v2, const T s)
+        {
+            v1.x = v2.x;
+            v1.y = v2.y;
+            v1.z = s;
+            v1.w = (T)0;
+        }
+    };
+
+    template<IntType T>
+    struct compute_ivec3_add<T, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector3<T, true>& r, const Phanes::Core::Math::TIntVector3<T, true>& v1, const Phanes::Core::Math::TIntVector3<T, true>& v2)
+        {
+            for (size_t i = 0; i < 4; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] + v2.comp.data[i];
+            }
+            r.w = (T)0;
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector3<T, true>& r, const Phanes::Core::Math::TIntVector3<T, true>& v1, T s)
+        {
+            for (size_t i = 0; i < 4; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] + s;
+            }
+            r.w = (T)0;
+        }
+    };
+
+    template<IntType T>
+    struct compute_ivec3_sub<T, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector3<T, true>& r, const Phanes::Core::Math::TIntVector3<T, true>& v1, const Phanes::Core::Math::TIntVector3<T, true>& v2)
+        {
+            for (size_t i = 0; i < 4; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] - v2.comp.data[i];
+            }
+            r.w = (T)0;
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector3<T, true>& r, const Phanes::Core::Math::TIntVector3<T, true>& v1, T s)
+        {
+            for (size_t i = 0; i < 4; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] - s;
+            }
+            r.w = (T)0;
+        }
+    };
+
+    template<IntType T>
+    struct compute_ivec3_mul<T, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector3<T, true>& r, const Phanes::Core::Math::TIntVector3<T, true>& v1, const Phanes::Core::Math::TIntVector3<T, true>& v2)
+        {
+            for (size_t i = 0; i < 4; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] * v2.comp.data[i];
+            }
+            r.w = (T)0;
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector3<T, true>& r, const Phanes::Core::Math::TIntVector3<T, true>& v1, T s)
+        {
+            for (size_t i = 0; i < 4; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] * s;
+            }
+            r.w = (T)0;
+        }
+    };
+
+    template<IntType T>
+    struct compute_ivec3_div<T, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector3<T, true>& r, const Phanes::Core::Math::TIntVector3<T, true>& v1, const Phanes::Core::Math::TIntVector3<T, true>& v2)
+        {
+            for (size_t i = 0; i < 3; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] / v2.comp.data[i];
+            }
+            r.w = (T)0;
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector3<T, true>& r, const Phanes::Core::Math::TIntVector3<T, true>& v1, T s)
+        {
+            for (size_t i = 0; i < 3; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] / s;
+            }
+            r.w = (T)0;
+        }
+    };
+
+    template<IntType T>
+    struct compute_ivec3_mod<T, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector3<T, true>& r, const Phanes::Core::Math::TIntVector3<T, true>& v1, const Phanes::Core::Math::TIntVector3<T, true>& v2)
+        {
+            for (size_t i = 0; i < 3; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] % v2.comp.data[i];
+            }
+            r.w = (T)0;
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector3<T, true>& r, const Phanes::Core::Math::TIntVector3<T, true>& v1, T s)
+        {
+            for (size_t i = 0; i < 3; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] % s;
+            }
+            r.w = (T)0;
+        }
+    };
+
+    template<>
+    struct compute_ivec3_div_magic<int, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector3<int, true>& r, const Phanes::Core::Math::TIntVector3<int, true>& v1, const Phanes::Core::Math::IntDivisor& d)
+        {
+            for (size_t i = 0; i < 3; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] / d;
+            }
+            r.w = 0;
+        }
+    };
+
+    template<IntType T>
+    struct compute_ivec3_eq<T, true>
+    {
+        static FORCEINLINE bool map(const Phanes::Core::Math::TIntVector3<T, true>& v1, const Phanes::Core::Math::TIntVector3<T, true>& v2)
+        {
+            bool r = true;
+            for (size_t i = 0; i < 3; ++i)
+            {
+                r &= v1.comp.data[i] == v2.comp.data[i];
+            }
+            return r;
+        }
+    };
+
+    template<IntType T>
+    struct compute_ivec3_ieq<T, true>
+    {
+        static FORCEINLINE bool map(const Phanes::Core::Math::TIntVector3<T, true>& v1, const Phanes::Core::Math::TIntVector3<T, true>& v2)
+        {
+            return !compute_ivec3_eq<T, true>::map(v1, v2);
+        }
+    };
+
+    template<IntType T>
+    struct compute_ivec3_inc<T, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector3<T, true>& r, const Phanes::Core::Math::TIntVector3<T, true>& v1)
+        {
+            for (size_t i = 0; i < 3; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] + (T)1;
+            }
+        }
+    };
+
+    template<IntType T>
+    struct compute_ivec3_dec<T, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector3<T, true>& r, const Phanes::Core::Math::TIntVector3<T, true>& v1)
+        {
+            for (size_t i = 0; i < 3; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] - (T)1;
+            }
+        }
+    };
+
+    template<IntType T>
+    struct compute_ivec3_and<T, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector3<T, true>& r, const Phanes::Core::Math::TIntVector3<T, true>& v1, const Phanes::Core::Math::TIntVector3<T, true>& v2)
+        {
+            for (size_t i = 0; i < 3; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] & v2.comp.data[i];
+            }
+            r.w = (T)0;
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector3<T, true>& r, const Phanes::Core::Math::TIntVector3<T, true>& v1, T s)
+        {
+            for (size_t i = 0; i < 3; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] & s;
+            }
+            r.w = (T)0;
+        }
+    };
+
+    template<IntType T>
+    struct compute_ivec3_or<T, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector3<T, true>& r, const Phanes::Core::Math::TIntVector3<T, true>& v1, const Phanes::Core::Math::TIntVector3<T, true>& v2)
+        {
+            for (size_t i = 0; i < 3; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] | v2.comp.data[i];
+            }
+            r.w = (T)0;
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector3<T, true>& r, const Phanes::Core::Math::TIntVector3<T, true>& v1, T s)
+        {
+            for (size_t i = 0; i < 3; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] | s;
+            }
+            r.w = (T)0;
+        }
+    };
+
+    template<IntType T>
+    struct compute_ivec3_xor<T, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector3<T, true>& r, const Phanes::Core::Math::TIntVector3<T, true>& v1, const Phanes::Core::Math::TIntVector3<T, true>& v2)
+        {
+            for (size_t i = 0; i < 3; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] ^ v2.comp.data[i];
+            }
+            r.w = (T)0;
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector3<T, true>& r, const Phanes::Core::Math::TIntVector3<T, true>& v1, T s)
+        {
+            for (size_t i = 0; i < 3; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] ^ s;
+            }
+            r.w = (T)0;
+        }
+    };
+
+    template<IntType T>
+    struct compute_ivec3_left_shift<T, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector3<T, true>& r, const Phanes::Core::Math::TIntVector3<T, true>& v1, const Phanes::Core::Math::TIntVector3<T, true>& v2)
+        {
+            for (size_t i = 0; i < 3; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] << v2.comp.data[i];
+            }
+            r.w = (T)0;
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector3<T, true>& r, const Phanes::Core::Math::TIntVector3<T, true>& v1, T s)
+        {
+            for (size_t i = 0; i < 3; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] << s;
+            }
+            r.w = (T)0;
+        }
+    };
+
+    template<IntType T>
+    struct compute_ivec3_right_shift<T, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector3<T, true>& r, const Phanes::Core::Math::TIntVector3<T, true>& v1, const Phanes::Core::Math::TIntVector3<T, true>& v2)
+        {
+            for (size_t i = 0; i < 3; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] >> v2.comp.data[i];
+            }
+            r.w = (T)0;
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector3<T, true>& r, const Phanes::Core::Math::TIntVector3<T, true>& v1, T s)
+        {
+            for (size_t i = 0; i < 3; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] >> s;
+            }
+            r.w = (T)0;
+        }
+    };
+
+    template<IntType T>
+    struct compute_ivec3_bnot<T, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector3<T, true>& r, const Phanes::Core::Math::TIntVector3<T, true>& v1)
+        {
+            for (size_t i = 0; i < 3; ++i)
+            {
+                r.comp.data[i] = ~v1.comp.data[i];
+            }
+            r.w = (T)0;
+        }
+    };
+
+    // =============== //
+    //   TIntVector2   //
+    // =============== //
+
+    template<IntType T>
+    struct construct_ivec2<T, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector2<T, true>& v1, const TIntVector2<T, true>& v2)
+        {
+            for (size_t i = 0; i < 2; ++i)
+            {
+                v1.comp.data[i] = v2.comp.data[i];
+            }
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector2<T, true>& v1, T s)
+        {
+            for (size_t i = 0; i < 2; ++i)
+            {
+                v1.comp.data[i] = s;
+            }
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector2<T, true>& v1, T x, T y)
+        {
+            v1.x = x;
+            v1.y = y;
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector2<T, true>& v1, const T* comp)
+        {
+            for (size_t i = 0; i < 2; ++i)
+            {
+                v1.comp.data[i] = comp[i];
+            }
+        }
+    };
+
+    template<IntType T>
+    struct compute_ivec2_add<T, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector2<T, true>& r, const Phanes::Core::Math::TIntVector2<T, true>& v1, const Phanes::Core::Math::TIntVector2<T, true>& v2)
+        {
+            for (size_t i = 0; i < 2; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] + v2.comp.data[i];
+            }
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector2<T, true>& r, const Phanes::Core::Math::TIntVector2<T, true>& v1, T s)
+        {
+            for (size_t i = 0; i < 2; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] + s;
+            }
+        }
+    };
+
+    template<IntType T>
+    struct compute_ivec2_sub<T, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector2<T, true>& r, const Phanes::Core::Math::TIntVector2<T, true>& v1, const Phanes::Core::Math::TIntVector2<T, true>& v2)
+        {
+            for (size_t i = 0; i < 2; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] - v2.comp.data[i];
+            }
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector2<T, true>& r, const Phanes::Core::Math::TIntVector2<T, true>& v1, T s)
+        {
+            for (size_t i = 0; i < 2; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] - s;
+            }
+        }
+    };
+
+    template<IntType T>
+    struct compute_ivec2_mul<T, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector2<T, true>& r, const Phanes::Core::Math::TIntVector2<T, true>& v1, const Phanes::Core::Math::TIntVector2<T, true>& v2)
+        {
+            for (size_t i = 0; i < 2; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] * v2.comp.data[i];
+            }
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector2<T, true>& r, const Phanes::Core::Math::TIntVector2<T, true>& v1, T s)
+        {
+            for (size_t i = 0; i < 2; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] * s;
+            }
+        }
+    };
+
+    template<IntType T>
+    struct compute_ivec2_div<T, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector2<T, true>& r, const Phanes::Core::Math::TIntVector2<T, true>& v1, const Phanes::Core::Math::TIntVector2<T, true>& v2)
+        {
+            for (size_t i = 0; i < 2; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] / v2.comp.data[i];
+            }
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector2<T, true>& r, const Phanes::Core::Math::TIntVector2<T, true>& v1, T s)
+        {
+            for (size_t i = 0; i < 2; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] / s;
+            }
+        }
+    };
+
+    template<IntType T>
+    struct compute_ivec2_mod<T, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector2<T, true>& r, const Phanes::Core::Math::TIntVector2<T, true>& v1, const Phanes::Core::Math::TIntVector2<T, true>& v2)
+        {
+            for (size_t i = 0; i < 2; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] % v2.comp.data[i];
+            }
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector2<T, true>& r, const Phanes::Core::Math::TIntVector2<T, true>& v1, T s)
+        {
+            for (size_t i = 0; i < 2; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] % s;
+            }
+        }
+    };
+
+    template<IntType T>
+    struct compute_ivec2_eq<T, true>
+    {
+        static FORCEINLINE bool map(const Phanes::Core::Math::TIntVector2<T, true>& v1, const Phanes::Core::Math::TIntVector2<T, true>& v2)
+        {
+            bool r = true;
+            for (size_t i = 0; i < 2; ++i)
+            {
+                r &= v1.comp.data[i] == v2.comp.data[i];
+            }
+            return r;
+        }
+    };
+
+    template<IntType T>
+    struct compute_ivec2_ieq<T, true>
+    {
+        static FORCEINLINE bool map(const Phanes::Core::Math::TIntVector2<T, true>& v1, const Phanes::Core::Math::TIntVector2<T, true>& v2)
+        {
+            return !compute_ivec2_eq<T, true>::map(v1, v2);
+        }
+    };
+
+    template<IntType T>
+    struct compute_ivec2_inc<T, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector2<T, true>& r, const Phanes::Core::Math::TIntVector2<T, true>& v1)
+        {
+            for (size_t i = 0; i < 2; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] + (T)1;
+            }
+        }
+    };
+
+    template<IntType T>
+    struct compute_ivec2_dec<T, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector2<T, true>& r, const Phanes::Core::Math::TIntVector2<T, true>& v1)
+        {
+            for (size_t i = 0; i < 2; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] - (T)1;
+            }
+        }
+    };
+
+    template<IntType T>
+    struct compute_ivec2_and<T, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector2<T, true>& r, const Phanes::Core::Math::TIntVector2<T, true>& v1, const Phanes::Core::Math::TIntVector2<T, true>& v2)
+        {
+            for (size_t i = 0; i < 2; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] & v2.comp.data[i];
+            }
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector2<T, true>& r, const Phanes::Core::Math::TIntVector2<T, true>& v1, T s)
+        {
+            for (size_t i = 0; i < 2; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] & s;
+            }
+        }
+    };
+
+    template<IntType T>
+    struct compute_ivec2_or<T, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector2<T, true>& r, const Phanes::Core::Math::TIntVector2<T, true>& v1, const Phanes::Core::Math::TIntVector2<T, true>& v2)
+        {
+            for (size_t i = 0; i < 2; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] | v2.comp.data[i];
+            }
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector2<T, true>& r, const Phanes::Core::Math::TIntVector2<T, true>& v1, T s)
+        {
+            for (size_t i = 0; i < 2; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] | s;
+            }
+        }
+    };
+
+    template<IntType T>
+    struct compute_ivec2_xor<T, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector2<T, true>& r, const Phanes::Core::Math::TIntVector2<T, true>& v1, const Phanes::Core::Math::TIntVector2<T, true>& v2)
+        {
+            for (size_t i = 0; i < 2; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] ^ v2.comp.data[i];
+            }
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector2<T, true>& r, const Phanes::Core::Math::TIntVector2<T, true>& v1, T s)
+        {
+            for (size_t i = 0; i < 2; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] ^ s;
+            }
+        }
+    };
+
+    template<IntType T>
+    struct compute_ivec2_left_shift<T, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector2<T, true>& r, const Phanes::Core::Math::TIntVector2<T, true>& v1, const Phanes::Core::Math::TIntVector2<T, true>& v2)
+        {
+            for (size_t i = 0; i < 2; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] << v2.comp.data[i];
+            }
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector2<T, true>& r, const Phanes::Core::Math::TIntVector2<T, true>& v1, T s)
+        {
+            for (size_t i = 0; i < 2; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] << s;
+            }
+        }
+    };
+
+    template<IntType T>
+    struct compute_ivec2_right_shift<T, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector2<T, true>& r, const Phanes::Core::Math::TIntVector2<T, true>& v1, const Phanes::Core::Math::TIntVector2<T, true>& v2)
+        {
+            for (size_t i = 0; i < 2; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] >> v2.comp.data[i];
+            }
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector2<T, true>& r, const Phanes::Core::Math::TIntVector2<T, true>& v1, T s)
+        {
+            for (size_t i = 0; i < 2; ++i)
+            {
+                r.comp.data[i] = v1.comp.data[i] >> s;
+            }
+        }
+    };
+
+    template<IntType T>
+    struct compute_ivec2_bnot<T, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector2<T, true>& r, const Phanes::Core::Math::TIntVector2<T, true>& v1)
+        {
+            for (size_t i = 0; i < 2; ++i)
+            {
+                r.comp.data[i] = ~v1.comp.data[i];
+            }
+        }
+    };
+
+    // ============ //
+    //   TMatrix4   //
+    // ============ //
+
+    template<RealType T>
+    struct compute_mat4_det<T, true>
+    {
+        static FORCEINLINE T map(const Phanes::Core::Math::TMatrix4<T, true>& m)
+        {
+            return Phanes::Core::Math::SIMD::FPU::mat4_det(&m.data[0][0]);
+        }
+    };
+
+    template<RealType T>
+    struct compute_mat4_inv<T, true>
+    {
+        static FORCEINLINE bool map(Phanes::Core::Math::TMatrix4<T, true>& r, const Phanes::Core::Math::TMatrix4<T, true>& m)
+        {
+            return Phanes::Core::Math::SIMD::FPU::mat4_inv(&r.data[0][0], &m.data[0][0]);
+        }
+    };
+
+    template<RealType T>
+    struct compute_mat4_transpose<T, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TMatrix4<T, true>& r, const Phanes::Core::Math::TMatrix4<T, true>& m)
+        {
+            Phanes::Core::Math::SIMD::FPU::mat4_transpose(&r.data[0][0], &m.data[0][0]);
+        }
+    };
+
+    template<RealType T>
+    struct compute_mat4_mul<T, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TMatrix4<T, true>& r, const Phanes::Core::Math::TMatrix4<T, true>& m1, const Phanes::Core::Math::TMatrix4<T, true>& m2)
+        {
+            Phanes::Core::Math::SIMD::FPU::mat4_mul(&r.data[0][0], &m1.data[0][0], &m2.data[0][0]);
+        }
+    };
+
+    template<RealType T>
+    struct compute_mat4_mul_vec<T, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TVector4<T, true>& r, const Phanes::Core::Math::TMatrix4<T, true>& m, const Phanes::Core::Math::TVector4<T, true>& v)
+        {
+            Phanes::Core::Math::SIMD::FPU::mat4_mul_vec(&r.x, &m.data[0][0], &v.x);
+        }
+    };
+
+    // ============ //
+    //   TMatrix3   //
+    // ============ //
+
+    template<RealType T>
+    struct compute_mat3_transpose<T, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TMatrix3<T, true>& r, const Phanes::Core::Math::TMatrix3<T, true>& m)
+        {
+            const TVector3<T, true> c0 = m.c0;
+            const TVector3<T, true> c1 = m.c1;
+            const TVector3<T, true> c2 = m.c2;
+
+            r.c0 = TVector3<T, true>(c0.x, c1.x, c2.x);
+            r.c1 = TVector3<T, true>(c0.y, c1.y, c2.y);
+            r.c2 = TVector3<T, true>(c0.z, c1.z, c2.z);
+        }
+    };
+
+    template<RealType T>
+    struct compute_mat3_det<T, true>
+    {
+        static FORCEINLINE T map(const Phanes::Core::Math::TMatrix3<T, true>& m)
+        {
+            return Phanes::Core::Math::SIMD::FPU::mat3_det(&m.data[0][0]);
+        }
+    };
+
+    template<RealType T>
+    struct compute_mat3_inv<T, true>
+    {
+        static FORCEINLINE bool map(Phanes::Core::Math::TMatrix3<T, true>& r, const Phanes::Core::Math::TMatrix3<T, true>& m)
+        {
+            return Phanes::Core::Math::SIMD::FPU::mat3_inv(&r.data[0][0], &m.data[0][0]);
+        }
+    };
+
+    template<RealType T>
+    struct compute_mat3_mul<T, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TMatrix3<T, true>& r, const Phanes::Core::Math::TMatrix3<T, true>& m1, const Phanes::Core::Math::TMatrix3<T, true>& m2)
+        {
+            Phanes::Core::Math::SIMD::FPU::mat3_mul(&r.data[0][0], &m1.data[0][0], &m2.data[0][0]);
+        }
+    };
+
+    template<RealType T>
+    struct compute_mat3_mul_vec<T, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TVector3<T, true>& r, const Phanes::Core::Math::TMatrix3<T, true>& m, const Phanes::Core::Math::TVector3<T, true>& v)
+        {
+            Phanes::Core::Math::SIMD::FPU::mat3_mul_vec(&r.x, &m.data[0][0], &v.x);
+        }
+    };
+
+    // =============== //
+    //   TQuaternion   //
+    // =============== //
+
+    // The scalar maps are templates over S and serve aligned quaternions as well.
+
+    template<RealType T> struct construct_quat<T, true> : public construct_quat<T, false> {};
+    template<RealType T> struct compute_quat_add<T, true> : public compute_quat_add<T, false> {};
+    template<RealType T> struct compute_quat_sub<T, true> : public compute_quat_sub<T, false> {};
+    template<RealType T> struct compute_quat_scale<T, true> : public compute_quat_scale<T, false> {};
+    template<RealType T> struct compute_quat_mul<T, true> : public compute_quat_mul<T, false> {};
+    template<RealType T> struct compute_quat_dot<T, true> : public compute_quat_dot<T, false> {};
+    template<RealType T> struct compute_quat_normalize<T, true> : public compute_quat_normalize<T, false> {};
+    template<RealType T> struct compute_quat_conjugate<T, true> : public compute_quat_conjugate<T, false> {};
+    template<RealType T> struct compute_quat_rotate<T, true> : public compute_quat_rotate<T, false> {};
+    template<RealType T> struct compute_quat_eq<T, true> : public compute_quat_eq<T, false> {};
+}
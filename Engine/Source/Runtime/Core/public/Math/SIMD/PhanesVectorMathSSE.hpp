@@ -3,6 +3,8 @@
 #include <nmmintrin.h> 
 
 #include "Core/public/Math/SIMD/PhanesSIMDTypes.h"
+#include "Core/public/Math/SIMD/PhanesKernelsSSE.hpp"
+#include "Core/public/Math/SIMD/Dispatch.h"
 #include "Core/public/Math/Boilerplate.h"
 #include "Core/public/Math/MathCommon.hpp"
 
@@ -14,10 +16,15 @@
 #include "Core/public/Math/IntVector2.hpp"
 #include "Core/public/Math/IntVector3.hpp"
 #include "Core/public/Math/IntVector4.hpp"
+#include "Core/public/Math/IntDivisor.hpp"
 
 #include "Core/public/Math/Matrix3.hpp"
 #include "Core/public/Math/Matrix4.hpp"
 
+#include "Core/public/Math/Quaternion.hpp"
+
+#include "Core/public/Math/Detail/VectorPacketDecl.inl"
+
 
 // ========== //
 //   Common   //
@@ -25,16 +32,61 @@
 
 namespace Phanes::Core::Math::SIMD
 {
+    /// <summary>
+    /// Computes a * b + c. Fused into one instruction with P_FMA__.
+    /// </summary>
+    /// <param name="a">Factor one</param>
+    /// <param name="b">Factor two</param>
+    /// <param name="c">Addend</param>
+    /// <returns>a * b + c</returns>
+    inline Phanes::Core::Types::Vec4f32Reg vec4_fmadd(const Phanes::Core::Types::Vec4f32Reg a, const Phanes::Core::Types::Vec4f32Reg b, const Phanes::Core::Types::Vec4f32Reg c)
+    {
+#if P_FMA__
+        return _mm_fmadd_ps(a, b, c);
+#else
+        return _mm_add_ps(_mm_mul_ps(a, b), c);
+#endif
+    }
+
+    /// <summary>
+    /// Computes a * b - c. Fused into one instruction with P_FMA__.
+    /// </summary>
+    /// <param name="a">Factor one</param>
+    /// <param name="b">Factor two</param>
+    /// <param name="c">Subtrahend</param>
+    /// <returns>a * b - c</returns>
+    inline Phanes::Core::Types::Vec4f32Reg vec4_fmsub(const Phanes::Core::Types::Vec4f32Reg a, const Phanes::Core::Types::Vec4f32Reg b, const Phanes::Core::Types::Vec4f32Reg c)
+    {
+#if P_FMA__
+        return _mm_fmsub_ps(a, b, c);
+#else
+        return _mm_sub_ps(_mm_mul_ps(a, b), c);
+#endif
+    }
+
+    /// <summary>
+    /// Computes c - a * b. Fused into one instruction with P_FMA__.
+    /// </summary>
+    /// <param name="a">Factor one</param>
+    /// <param name="b">Factor two</param>
+    /// <param name="c">Minuend</param>
+    /// <returns>c - a * b</returns>
+    inline Phanes::Core::Types::Vec4f32Reg vec4_fnmadd(const Phanes::Core::Types::Vec4f32Reg a, const Phanes::Core::Types::Vec4f32Reg b, const Phanes::Core::Types::Vec4f32Reg c)
+    {
+#if P_FMA__
+        return _mm_fnmadd_ps(a, b, c);
+#else
+        return _mm_sub_ps(c, _mm_mul_ps(a, b));
+#endif
+    }
+
     Phanes::Core::Types::Vec4f32Reg vec4_cross_p(const Phanes::Core::Types::Vec4f32Reg v1, const Phanes::Core::Types::Vec4f32Reg v2)
     {
         __m128 tmp0 = _mm_shuffle_ps(v1, v1, _MM_SHUFFLE(3, 0, 2, 1));
         __m128 tmp1 = _mm_shuffle_ps(v2, v2, _MM_SHUFFLE(3, 1, 0, 2));
         __m128 tmp2 = _mm_shuffle_ps(v1, v1, _MM_SHUFFLE(3, 1, 0, 2));
         __m128 tmp3 = _mm_shuffle_ps(v2, v2, _MM_SHUFFLE(3, 0, 2, 1));
-        return _mm_sub_ps(
-            _mm_mul_ps(tmp0, tmp1),
-            _mm_mul_ps(tmp2, tmp3)
-        );
+        return vec4_fmsub(tmp0, tmp1, _mm_mul_ps(tmp2, tmp3));
     }
 
 
@@ -98,10 +150,266 @@ namespace Phanes::Core::Math::SIMD
         return vec4_hadd_cvtf32(_mm_mul_ps(v1, v2));
     }
 
+    /// <summary>
+    /// Gets the reciprocal of each component.
+    /// </summary>
+    /// <param name="v">Vector</param>
+    /// <param name="p">Precision. The estimates are not refined correctly for 0 and infinity.</param>
+    /// <returns>1 / v</returns>
+    inline Phanes::Core::Types::Vec4f32Reg vec4_rcp(const Phanes::Core::Types::Vec4f32Reg v, Phanes::Core::Math::EPrecision p)
+    {
+        switch (p)
+        {
+        case Phanes::Core::Math::EPrecision::Approximate:
+            return _mm_rcp_ps(v);
+
+        case Phanes::Core::Math::EPrecision::Refined:
+        {
+            // Newton-Raphson: r = r * (2 - v * r)
+            __m128 r = _mm_rcp_ps(v);
+            return _mm_mul_ps(r, vec4_fnmadd(v, r, _mm_set1_ps(2.0f)));
+        }
+
+        default:
+            return _mm_div_ps(_mm_set1_ps(1.0f), v);
+        }
+    }
+
+    /// <summary>
+    /// Gets the reciprocal square root of each component.
+    /// </summary>
+    /// <param name="v">Vector</param>
+    /// <param name="p">Precision. The estimates are not refined correctly for 0 and infinity.</param>
+    /// <returns>1 / sqrt(v)</returns>
+    inline Phanes::Core::Types::Vec4f32Reg vec4_rsqrt(const Phanes::Core::Types::Vec4f32Reg v, Phanes::Core::Math::EPrecision p)
+    {
+        switch (p)
+        {
+        case Phanes::Core::Math::EPrecision::Approximate:
+            return _mm_rsqrt_ps(v);
+
+        case Phanes::Core::Math::EPrecision::Refined:
+        {
+            // Newton-Raphson: r = r * (1.5 - 0.5 * v * r * r)
+            __m128 r = _mm_rsqrt_ps(v);
+            __m128 hv = _mm_mul_ps(v, _mm_set1_ps(0.5f));
+            return _mm_mul_ps(r, vec4_fnmadd(_mm_mul_ps(hv, r), r, _mm_set1_ps(1.5f)));
+        }
+
+        default:
+            return _mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(v));
+        }
+    }
+
+    /// <summary>
+    /// Normalizes the vector. Vectors shorter than P_FLT_INAC are returned unchanged.
+    /// </summary>
+    /// <param name="v">Vector</param>
+    /// <param name="p">Precision</param>
+    /// <returns>Normalized vector</returns>
+    inline Phanes::Core::Types::Vec4f32Reg vec4_normalize(const Phanes::Core::Types::Vec4f32Reg v, Phanes::Core::Math::EPrecision p)
+    {
+        __m128 len2 = _mm_dp_ps(v, v, 0xFF);
+
+        __m128 r = (p == Phanes::Core::Math::EPrecision::Exact) ? _mm_div_ps(v, _mm_sqrt_ps(len2)) : _mm_mul_ps(v, vec4_rsqrt(len2, p));
+
+        return _mm_blendv_ps(v, r, _mm_cmpge_ps(len2, _mm_set1_ps(P_FLT_INAC * P_FLT_INAC)));
+    }
+
+    /// <summary>
+    /// Compares the vectors component-wise with a tolerance.
+    /// </summary>
+    /// <param name="v1">Vector one</param>
+    /// <param name="v2">Vector two</param>
+    /// <param name="threshold">Allowed difference per component</param>
+    /// <returns>Bitmask with one bit per component, set if the components are equal.</returns>
+    inline int vec4_eq_mask(const Phanes::Core::Types::Vec4f32Reg v1, const Phanes::Core::Types::Vec4f32Reg v2, float threshold = P_FLT_INAC)
+    {
+        __m128 diff = _mm_andnot_ps(_mm_set1_ps(-0.0f), _mm_sub_ps(v1, v2));
+
+        return _mm_movemask_ps(_mm_cmplt_ps(diff, _mm_set1_ps(threshold)));
+    }
+
+    /// <summary>
+    /// Compares the integer vectors component-wise.
+    /// </summary>
+    /// <param name="v1">Vector one</param>
+    /// <param name="v2">Vector two</param>
+    /// <returns>Bitmask with one bit per component, set if the components are equal.</returns>
+    inline int ivec4_eq_mask(const Phanes::Core::Types::Vec4i32Reg v1, const Phanes::Core::Types::Vec4i32Reg v2)
+    {
+        return _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(v1, v2)));
+    }
+
     Phanes::Core::Types::Vec2f64Reg vec2_eq(const Phanes::Core::Types::Vec2f64Reg v1, const Phanes::Core::Types::Vec2f64Reg v2)
     {
         return _mm_cmpeq_pd(v1, v2);
     }
+
+    /// <summary>
+    /// Shifts each component left by the count in the same component of c.
+    /// </summary>
+    /// <param name="v">Vector</param>
+    /// <param name="c">Shift counts</param>
+    /// <returns>Shifted vector</returns>
+    inline Phanes::Core::Types::Vec4i32Reg ivec4_sllv(const Phanes::Core::Types::Vec4i32Reg v, const Phanes::Core::Types::Vec4i32Reg c)
+    {
+#if P_AVX2__
+        return _mm_sllv_epi32(v, c);
+#else
+        __m128i r0 = _mm_sll_epi32(v, _mm_cvtsi32_si128(_mm_extract_epi32(c, 0)));
+        __m128i r1 = _mm_sll_epi32(v, _mm_cvtsi32_si128(_mm_extract_epi32(c, 1)));
+        __m128i r2 = _mm_sll_epi32(v, _mm_cvtsi32_si128(_mm_extract_epi32(c, 2)));
+        __m128i r3 = _mm_sll_epi32(v, _mm_cvtsi32_si128(_mm_extract_epi32(c, 3)));
+
+        return _mm_blend_epi16(_mm_blend_epi16(r0, r1, 0x0C), _mm_blend_epi16(r2, r3, 0xC0), 0xF0);
+#endif
+    }
+
+    /// <summary>
+    /// Shifts each component right (arithmetic) by the count in the same component of c.
+    /// </summary>
+    /// <param name="v">Vector</param>
+    /// <param name="c">Shift counts</param>
+    /// <returns>Shifted vector</returns>
+    inline Phanes::Core::Types::Vec4i32Reg ivec4_srav(const Phanes::Core::Types::Vec4i32Reg v, const Phanes::Core::Types::Vec4i32Reg c)
+    {
+#if P_AVX2__
+        return _mm_srav_epi32(v, c);
+#else
+        __m128i r0 = _mm_sra_epi32(v, _mm_cvtsi32_si128(_mm_extract_epi32(c, 0)));
+        __m128i r1 = _mm_sra_epi32(v, _mm_cvtsi32_si128(_mm_extract_epi32(c, 1)));
+        __m128i r2 = _mm_sra_epi32(v, _mm_cvtsi32_si128(_mm_extract_epi32(c, 2)));
+        __m128i r3 = _mm_sra_epi32(v, _mm_cvtsi32_si128(_mm_extract_epi32(c, 3)));
+
+        return _mm_blend_epi16(_mm_blend_epi16(r0, r1, 0x0C), _mm_blend_epi16(r2, r3, 0xC0), 0xF0);
+#endif
+    }
+
+    /// <summary>
+    /// Divides each component by the same component of b. The quotient is truncated toward zero.
+    /// </summary>
+    /// <remarks>If all magnitudes are smaller than 2^23, the division is done exactly in single precision, else in double precision.</remarks>
+    /// <param name="a">Dividends</param>
+    /// <param name="b">Divisors</param>
+    /// <returns>Quotients</returns>
+    inline Phanes::Core::Types::Vec4i32Reg ivec4_div(const Phanes::Core::Types::Vec4i32Reg a, const Phanes::Core::Types::Vec4i32Reg b)
+    {
+        __m128i mag = _mm_or_si128(_mm_abs_epi32(a), _mm_abs_epi32(b));
+
+        if (_mm_testz_si128(mag, _mm_set1_epi32((int)0xFF800000)))
+        {
+            return _mm_cvttps_epi32(_mm_div_ps(_mm_cvtepi32_ps(a), _mm_cvtepi32_ps(b)));
+        }
+
+#if P_AVX__
+        return _mm256_cvttpd_epi32(_mm256_div_pd(_mm256_cvtepi32_pd(a), _mm256_cvtepi32_pd(b)));
+#else
+        __m128i lo = _mm_cvttpd_epi32(_mm_div_pd(_mm_cvtepi32_pd(a), _mm_cvtepi32_pd(b)));
+        __m128i hi = _mm_cvttpd_epi32(_mm_div_pd(_mm_cvtepi32_pd(_mm_unpackhi_epi64(a, a)), _mm_cvtepi32_pd(_mm_unpackhi_epi64(b, b))));
+
+        return _mm_unpacklo_epi64(lo, hi);
+#endif
+    }
+
+    /// <summary>
+    /// Gets the remainder of dividing each component by the same component of b. The sign follows the dividend.
+    /// </summary>
+    /// <param name="a">Dividends</param>
+    /// <param name="b">Divisors</param>
+    /// <returns>Remainders</returns>
+    inline Phanes::Core::Types::Vec4i32Reg ivec4_mod(const Phanes::Core::Types::Vec4i32Reg a, const Phanes::Core::Types::Vec4i32Reg b)
+    {
+        return _mm_sub_epi32(a, _mm_mullo_epi32(ivec4_div(a, b), b));
+    }
+
+    /// <summary>
+    /// Gets the upper 32 bits of the signed 64-bit product of each component pair.
+    /// </summary>
+    /// <param name="a">Vector one</param>
+    /// <param name="b">Vector two</param>
+    /// <returns>High halves of the products</returns>
+    inline Phanes::Core::Types::Vec4i32Reg ivec4_mulhi(const Phanes::Core::Types::Vec4i32Reg a, const Phanes::Core::Types::Vec4i32Reg b)
+    {
+        __m128i even = _mm_mul_epi32(a, b);
+        __m128i odd = _mm_mul_epi32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+
+        return _mm_blend_epi16(_mm_srli_epi64(even, 32), odd, 0xCC);
+    }
+
+    /// <summary>
+    /// Divides each component by a precomputed divisor. The quotient is truncated toward zero.
+    /// </summary>
+    /// <param name="a">Dividends</param>
+    /// <param name="d">Divisor</param>
+    /// <returns>Quotients</returns>
+    inline Phanes::Core::Types::Vec4i32Reg ivec4_div(const Phanes::Core::Types::Vec4i32Reg a, const Phanes::Core::Math::IntDivisor& d)
+    {
+        if (d.magic == 0)
+        {
+            return _mm_sign_epi32(a, _mm_set1_epi32(d.divisor));
+        }
+
+        __m128i q = ivec4_mulhi(a, _mm_set1_epi32(d.magic));
+        q = _mm_add_epi32(q, _mm_sign_epi32(a, _mm_set1_epi32(d.correction)));
+        q = _mm_sra_epi32(q, _mm_cvtsi32_si128(d.shift));
+
+        return _mm_add_epi32(q, _mm_srli_epi32(q, 31));
+    }
+
+    /// <summary>
+    /// Shifts each 64-bit component left by the count in the same component of c.
+    /// </summary>
+    /// <param name="v">Vector</param>
+    /// <param name="c">Shift counts</param>
+    /// <returns>Shifted vector</returns>
+    inline Phanes::Core::Types::Vec2i64Reg ivec2_sllv(const Phanes::Core::Types::Vec2i64Reg v, const Phanes::Core::Types::Vec2i64Reg c)
+    {
+#if P_AVX2__
+        return _mm_sllv_epi64(v, c);
+#else
+        __m128i r0 = _mm_sll_epi64(v, c);
+        __m128i r1 = _mm_sll_epi64(v, _mm_unpackhi_epi64(c, c));
+
+        return _mm_blend_epi16(r0, r1, 0xF0);
+#endif
+    }
+
+    /// <summary>
+    /// Shifts each 64-bit component right (arithmetic) by one count. SSE has no arithmetic 64-bit shift, so the sign is shifted in manually.
+    /// </summary>
+    /// <param name="v">Vector</param>
+    /// <param name="c">Shift count in c[0:63]</param>
+    /// <returns>Shifted vector</returns>
+    inline Phanes::Core::Types::Vec2i64Reg ivec2_sra(const Phanes::Core::Types::Vec2i64Reg v, const Phanes::Core::Types::Vec2i64Reg c)
+    {
+        __m128i sign = _mm_cmpgt_epi64(_mm_setzero_si128(), v);
+        __m128i fill = _mm_sll_epi64(sign, _mm_sub_epi64(_mm_cvtsi32_si128(64), c));
+
+        // A count of 0 shifts the fill by 64, which yields 0.
+        return _mm_or_si128(_mm_srl_epi64(v, c), fill);
+    }
+
+    /// <summary>
+    /// Shifts each 64-bit component right (arithmetic) by the count in the same component of c.
+    /// </summary>
+    /// <param name="v">Vector</param>
+    /// <param name="c">Shift counts</param>
+    /// <returns>Shifted vector</returns>
+    inline Phanes::Core::Types::Vec2i64Reg ivec2_srav(const Phanes::Core::Types::Vec2i64Reg v, const Phanes::Core::Types::Vec2i64Reg c)
+    {
+#if P_AVX2__
+        __m128i sign = _mm_cmpgt_epi64(_mm_setzero_si128(), v);
+        __m128i fill = _mm_sllv_epi64(sign, _mm_sub_epi64(_mm_set1_epi64x(64), c));
+
+        return _mm_or_si128(_mm_srlv_epi64(v, c), fill);
+#else
+        __m128i r0 = ivec2_sra(v, c);
+        __m128i r1 = ivec2_sra(v, _mm_unpackhi_epi64(c, c));
+
+        return _mm_blend_epi16(r0, r1, 0xF0);
+#endif
+    }
 }
 
 
@@ -223,6 +531,69 @@ namespace Phanes::Core::Math::Detail
         }
     };
 
+    template<>
+    struct compute_vec4_dot<float, true>
+    {
+        static FORCEINLINE float map(const Phanes::Core::Math::TVector4<float, true>& v1, const Phanes::Core::Math::TVector4<float, true>& v2)
+        {
+            return Phanes::Core::Math::SIMD::vec4_dot_cvtf32(v1.comp, v2.comp);
+        }
+    };
+
+    template<>
+    struct compute_vec4_normalize<float, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TVector4<float, true>& r, const Phanes::Core::Math::TVector4<float, true>& v1, EPrecision p)
+        {
+            r.comp = Phanes::Core::Math::SIMD::vec4_normalize(v1.comp, p);
+        }
+    };
+
+    template<>
+    struct compute_vec4_rcp<float, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TVector4<float, true>& r, const Phanes::Core::Math::TVector4<float, true>& v1, EPrecision p)
+        {
+            r.comp = Phanes::Core::Math::SIMD::vec4_rcp(v1.comp, p);
+        }
+    };
+
+    template<>
+    struct compute_vec4_eq<float, true>
+    {
+        static FORCEINLINE bool map(const Phanes::Core::Math::TVector4<float, true>& v1, const Phanes::Core::Math::TVector4<float, true>& v2)
+        {
+            return Phanes::Core::Math::SIMD::vec4_eq_mask(v1.comp, v2.comp) == 0xF;
+        }
+    };
+
+    template<>
+    struct compute_vec4_ieq<float, true>
+    {
+        static FORCEINLINE bool map(const Phanes::Core::Math::TVector4<float, true>& v1, const Phanes::Core::Math::TVector4<float, true>& v2)
+        {
+            return Phanes::Core::Math::SIMD::vec4_eq_mask(v1.comp, v2.comp) != 0xF;
+        }
+    };
+
+    template<>
+    struct compute_vec4_eq_mask<float, true>
+    {
+        static FORCEINLINE int map(const Phanes::Core::Math::TVector4<float, true>& v1, const Phanes::Core::Math::TVector4<float, true>& v2, float threshold)
+        {
+            return Phanes::Core::Math::SIMD::vec4_eq_mask(v1.comp, v2.comp, threshold);
+        }
+    };
+
+    template<>
+    struct compute_vec4_lt_mask<float, true>
+    {
+        static FORCEINLINE int map(const Phanes::Core::Math::TVector4<float, true>& v1, const Phanes::Core::Math::TVector4<float, true>& v2)
+        {
+            return _mm_movemask_ps(_mm_cmplt_ps(v1.comp, v2.comp));
+        }
+    };
+
 
     // ============ //
     //   TVector3   //
@@ -261,12 +632,81 @@ namespace Phanes::Core::Math::Detail
     };
 
 
-    template<> struct compute_vec3_add<float, true> : public compute_vec4_add<float, true> {};
-    template<> struct compute_vec3_sub<float, true> : public compute_vec4_sub<float, true> {};
-    template<> struct compute_vec3_mul<float, true> : public compute_vec4_mul<float, true> {};
-    template<> struct compute_vec3_div<float, true> : public compute_vec4_div<float, true> {};
-    template<> struct compute_vec3_inc<float, true> : public compute_vec4_inc<float, true> {};
-    template<> struct compute_vec3_dec<float, true> : public compute_vec4_dec<float, true> {};
+    // Not derived from the 4D functors, which would change w (scalar addition and ++ set it to 1, division by a vector to NaN) and break DotP and Magnitude.
+
+    template<>
+    struct compute_vec3_add<float, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TVector3<float, true>& r, const Phanes::Core::Math::TVector3<float, true>& v1, const Phanes::Core::Math::TVector3<float, true>& v2)
+        {
+            r.comp = _mm_add_ps(v1.comp, v2.comp);
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TVector3<float, true>& r, const Phanes::Core::Math::TVector3<float, true>& v1, float s)
+        {
+            r.comp = _mm_add_ps(v1.comp, _mm_setr_ps(s, s, s, 0.0f));
+        }
+    };
+
+    template<>
+    struct compute_vec3_sub<float, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TVector3<float, true>& r, const Phanes::Core::Math::TVector3<float, true>& v1, const Phanes::Core::Math::TVector3<float, true>& v2)
+        {
+            r.comp = _mm_sub_ps(v1.comp, v2.comp);
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TVector3<float, true>& r, const Phanes::Core::Math::TVector3<float, true>& v1, float s)
+        {
+            r.comp = _mm_sub_ps(v1.comp, _mm_setr_ps(s, s, s, 0.0f));
+        }
+    };
+
+    template<>
+    struct compute_vec3_mul<float, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TVector3<float, true>& r, const Phanes::Core::Math::TVector3<float, true>& v1, const Phanes::Core::Math::TVector3<float, true>& v2)
+        {
+            r.comp = _mm_mul_ps(v1.comp, v2.comp);
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TVector3<float, true>& r, const Phanes::Core::Math::TVector3<float, true>& v1, float s)
+        {
+            r.comp = _mm_blend_ps(_mm_mul_ps(v1.comp, _mm_set_ps1(s)), _mm_setzero_ps(), 0x8);
+        }
+    };
+
+    template<>
+    struct compute_vec3_div<float, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TVector3<float, true>& r, const Phanes::Core::Math::TVector3<float, true>& v1, const Phanes::Core::Math::TVector3<float, true>& v2)
+        {
+            r.comp = _mm_blend_ps(_mm_div_ps(v1.comp, v2.comp), _mm_setzero_ps(), 0x8);
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TVector3<float, true>& r, const Phanes::Core::Math::TVector3<float, true>& v1, float s)
+        {
+            r.comp = _mm_blend_ps(_mm_div_ps(v1.comp, _mm_set_ps1(s)), _mm_setzero_ps(), 0x8);
+        }
+    };
+
+    template<>
+    struct compute_vec3_inc<float, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TVector3<float, true>& r, const Phanes::Core::Math::TVector3<float, true>& v1)
+        {
+            r.comp = _mm_add_ps(v1.comp, _mm_setr_ps(1.0f, 1.0f, 1.0f, 0.0f));
+        }
+    };
+
+    template<>
+    struct compute_vec3_dec<float, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TVector3<float, true>& r, const Phanes::Core::Math::TVector3<float, true>& v1)
+        {
+            r.comp = _mm_sub_ps(v1.comp, _mm_setr_ps(1.0f, 1.0f, 1.0f, 0.0f));
+        }
+    };
 
     template<>
     struct compute_vec3_cross_p<float, true>
@@ -277,6 +717,55 @@ namespace Phanes::Core::Math::Detail
         }
     };
 
+    // w stays 0, so the 4D normalization can be used.
+    template<> struct compute_vec3_normalize<float, true> : public compute_vec4_normalize<float, true> {};
+
+    template<>
+    struct compute_vec3_rcp<float, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TVector3<float, true>& r, const Phanes::Core::Math::TVector3<float, true>& v1, EPrecision p)
+        {
+            // 1 / w is infinite, so w is reset.
+            r.comp = _mm_blend_ps(Phanes::Core::Math::SIMD::vec4_rcp(v1.comp, p), _mm_setzero_ps(), 0x8);
+        }
+    };
+
+    template<>
+    struct compute_vec3_eq<float, true>
+    {
+        static FORCEINLINE bool map(const Phanes::Core::Math::TVector3<float, true>& v1, const Phanes::Core::Math::TVector3<float, true>& v2)
+        {
+            return (Phanes::Core::Math::SIMD::vec4_eq_mask(v1.comp, v2.comp) & 0x7) == 0x7;
+        }
+    };
+
+    template<>
+    struct compute_vec3_ieq<float, true>
+    {
+        static FORCEINLINE bool map(const Phanes::Core::Math::TVector3<float, true>& v1, const Phanes::Core::Math::TVector3<float, true>& v2)
+        {
+            return (Phanes::Core::Math::SIMD::vec4_eq_mask(v1.comp, v2.comp) & 0x7) != 0x7;
+        }
+    };
+
+    template<>
+    struct compute_vec3_eq_mask<float, true>
+    {
+        static FORCEINLINE int map(const Phanes::Core::Math::TVector3<float, true>& v1, const Phanes::Core::Math::TVector3<float, true>& v2, float threshold)
+        {
+            return Phanes::Core::Math::SIMD::vec4_eq_mask(v1.comp, v2.comp, threshold) & 0x7;
+        }
+    };
+
+    template<>
+    struct compute_vec3_lt_mask<float, true>
+    {
+        static FORCEINLINE int map(const Phanes::Core::Math::TVector3<float, true>& v1, const Phanes::Core::Math::TVector3<float, true>& v2)
+        {
+            return _mm_movemask_ps(_mm_cmplt_ps(v1.comp, v2.comp)) & 0x7;
+        }
+    };
+
     // ============ //
     //   TVector2   //
     // ============ //
@@ -453,12 +942,67 @@ namespace Phanes::Core::Math::Detail
     {
         static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<int, true>& r, const Phanes::Core::Math::TIntVector4<int, true>& v1, const Phanes::Core::Math::TIntVector4<int, true>& v2)
         {
-            r.comp = _mm_mul_epi32(v1.comp, v2.comp);
+            r.comp = _mm_mullo_epi32(v1.comp, v2.comp);
         }
 
         static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<int, true>& r, const Phanes::Core::Math::TIntVector4<int, true>& v1, int s)
         {
-            r.comp = _mm_mul_epi32(v1.comp, _mm_set1_epi32(s));
+            r.comp = _mm_mullo_epi32(v1.comp, _mm_set1_epi32(s));
+        }
+    };
+
+    template<>
+    struct compute_ivec4_div<int, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<int, true>& r, const Phanes::Core::Math::TIntVector4<int, true>& v1, const Phanes::Core::Math::TIntVector4<int, true>& v2)
+        {
+            r.comp = Phanes::Core::Math::SIMD::ivec4_div(v1.comp, v2.comp);
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<int, true>& r, const Phanes::Core::Math::TIntVector4<int, true>& v1, int s)
+        {
+            r.comp = Phanes::Core::Math::SIMD::ivec4_div(v1.comp, _mm_set1_epi32(s));
+        }
+    };
+
+    template<>
+    struct compute_ivec4_mod<int, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<int, true>& r, const Phanes::Core::Math::TIntVector4<int, true>& v1, const Phanes::Core::Math::TIntVector4<int, true>& v2)
+        {
+            r.comp = Phanes::Core::Math::SIMD::ivec4_mod(v1.comp, v2.comp);
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<int, true>& r, const Phanes::Core::Math::TIntVector4<int, true>& v1, int s)
+        {
+            r.comp = Phanes::Core::Math::SIMD::ivec4_mod(v1.comp, _mm_set1_epi32(s));
+        }
+    };
+
+    template<>
+    struct compute_ivec4_div_magic<int, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<int, true>& r, const Phanes::Core::Math::TIntVector4<int, true>& v1, const Phanes::Core::Math::IntDivisor& d)
+        {
+            r.comp = Phanes::Core::Math::SIMD::ivec4_div(v1.comp, d);
+        }
+    };
+
+    template<>
+    struct compute_ivec4_eq<int, true>
+    {
+        static FORCEINLINE bool map(const Phanes::Core::Math::TIntVector4<int, true>& v1, const Phanes::Core::Math::TIntVector4<int, true>& v2)
+        {
+            return Phanes::Core::Math::SIMD::ivec4_eq_mask(v1.comp, v2.comp) == 0xF;
+        }
+    };
+
+    template<>
+    struct compute_ivec4_ieq<int, true>
+    {
+        static FORCEINLINE bool map(const Phanes::Core::Math::TIntVector4<int, true>& v1, const Phanes::Core::Math::TIntVector4<int, true>& v2)
+        {
+            return Phanes::Core::Math::SIMD::ivec4_eq_mask(v1.comp, v2.comp) != 0xF;
         }
     };
 
@@ -527,12 +1071,12 @@ namespace Phanes::Core::Math::Detail
     {
         static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<int, true>& r, const Phanes::Core::Math::TIntVector4<int, true>& v1, const Phanes::Core::Math::TIntVector4<int, true>& v2)
         {
-            r.comp = _mm_sll_epi32(v1.comp, v2.comp);
+            r.comp = Phanes::Core::Math::SIMD::ivec4_sllv(v1.comp, v2.comp);
         }
 
         static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<int, true>& r, const Phanes::Core::Math::TIntVector4<int, true>& v1, int s)
         {
-            r.comp = _mm_sll_epi32(v1.comp, _mm_set1_epi32(s));
+            r.comp = _mm_sll_epi32(v1.comp, _mm_cvtsi32_si128(s));
         }
     };
 
@@ -541,12 +1085,12 @@ namespace Phanes::Core::Math::Detail
     {
         static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<int, true>& r, const Phanes::Core::Math::TIntVector4<int, true>& v1, const Phanes::Core::Math::TIntVector4<int, true>& v2)
         {
-            r.comp = _mm_srl_epi32(v1.comp, v2.comp);
+            r.comp = Phanes::Core::Math::SIMD::ivec4_srav(v1.comp, v2.comp);
         }
 
         static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<int, true>& r, const Phanes::Core::Math::TIntVector4<int, true>& v1, int s)
         {
-            r.comp = _mm_srl_epi32(v1.comp, _mm_set1_epi32(s));
+            r.comp = _mm_sra_epi32(v1.comp, _mm_cvtsi32_si128(s));
         }
     };
 
@@ -591,7 +1135,6 @@ namespace Phanes::Core::Math::Detail
     template<> struct compute_ivec3_add<int, true> : public compute_ivec4_add<int, true> {};
     template<> struct compute_ivec3_sub<int, true> : public compute_ivec4_sub<int, true> {};
     template<> struct compute_ivec3_mul<int, true> : public compute_ivec4_mul<int, true> {};
-    template<> struct compute_ivec3_div<int, true> : public compute_ivec4_div<int, true> {};
     template<> struct compute_ivec3_inc<int, true> : public compute_ivec4_inc<int, true> {};
     template<> struct compute_ivec3_dec<int, true> : public compute_ivec4_dec<int, true> {};
 
@@ -602,6 +1145,61 @@ namespace Phanes::Core::Math::Detail
     template<> struct compute_ivec3_left_shift<int, true> :     public compute_ivec4_left_shift<int, true> {};
     template<> struct compute_ivec3_right_shift<int, true> :    public compute_ivec4_right_shift<int, true> {};
 
+    template<>
+    struct compute_ivec3_div<int, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector3<int, true>& r, const Phanes::Core::Math::TIntVector3<int, true>& v1, const Phanes::Core::Math::TIntVector3<int, true>& v2)
+        {
+            r.comp = _mm_blend_epi16(Phanes::Core::Math::SIMD::ivec4_div(v1.comp, v2.comp), _mm_setzero_si128(), 0xC0);
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector3<int, true>& r, const Phanes::Core::Math::TIntVector3<int, true>& v1, int s)
+        {
+            r.comp = _mm_blend_epi16(Phanes::Core::Math::SIMD::ivec4_div(v1.comp, _mm_set1_epi32(s)), _mm_setzero_si128(), 0xC0);
+        }
+    };
+
+    template<>
+    struct compute_ivec3_mod<int, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector3<int, true>& r, const Phanes::Core::Math::TIntVector3<int, true>& v1, const Phanes::Core::Math::TIntVector3<int, true>& v2)
+        {
+            r.comp = _mm_blend_epi16(Phanes::Core::Math::SIMD::ivec4_mod(v1.comp, v2.comp), _mm_setzero_si128(), 0xC0);
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector3<int, true>& r, const Phanes::Core::Math::TIntVector3<int, true>& v1, int s)
+        {
+            r.comp = _mm_blend_epi16(Phanes::Core::Math::SIMD::ivec4_mod(v1.comp, _mm_set1_epi32(s)), _mm_setzero_si128(), 0xC0);
+        }
+    };
+
+    template<>
+    struct compute_ivec3_div_magic<int, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TIntVector3<int, true>& r, const Phanes::Core::Math::TIntVector3<int, true>& v1, const Phanes::Core::Math::IntDivisor& d)
+        {
+            r.comp = _mm_blend_epi16(Phanes::Core::Math::SIMD::ivec4_div(v1.comp, d), _mm_setzero_si128(), 0xC0);
+        }
+    };
+
+    template<>
+    struct compute_ivec3_eq<int, true>
+    {
+        static FORCEINLINE bool map(const Phanes::Core::Math::TIntVector3<int, true>& v1, const Phanes::Core::Math::TIntVector3<int, true>& v2)
+        {
+            return (Phanes::Core::Math::SIMD::ivec4_eq_mask(v1.comp, v2.comp) & 0x7) == 0x7;
+        }
+    };
+
+    template<>
+    struct compute_ivec3_ieq<int, true>
+    {
+        static FORCEINLINE bool map(const Phanes::Core::Math::TIntVector3<int, true>& v1, const Phanes::Core::Math::TIntVector3<int, true>& v2)
+        {
+            return (Phanes::Core::Math::SIMD::ivec4_eq_mask(v1.comp, v2.comp) & 0x7) != 0x7;
+        }
+    };
+
 
     // =============== //
     //   TIntVector2   //
@@ -726,12 +1324,12 @@ namespace Phanes::Core::Math::Detail
     {
         static FORCEINLINE void map(Phanes::Core::Math::TIntVector2<Phanes::Core::Types::int64, true>& r, const Phanes::Core::Math::TIntVector2<Phanes::Core::Types::int64, true>& v1, const Phanes::Core::Math::TIntVector2<Phanes::Core::Types::int64, true>& v2)
         {
-            r.comp = _mm_sll_epi64(v1.comp, v2.comp);
+            r.comp = Phanes::Core::Math::SIMD::ivec2_sllv(v1.comp, v2.comp);
         }
 
         static FORCEINLINE void map(Phanes::Core::Math::TIntVector2<Phanes::Core::Types::int64, true>& r, const Phanes::Core::Math::TIntVector2<Phanes::Core::Types::int64, true>& v1, Phanes::Core::Types::int64 s)
         {
-            r.comp = _mm_sll_epi64(v1.comp, _mm_set1_epi64x(s));
+            r.comp = _mm_sll_epi64(v1.comp, _mm_cvtsi64_si128(s));
         }
     };
 
@@ -740,12 +1338,12 @@ namespace Phanes::Core::Math::Detail
     {
         static FORCEINLINE void map(Phanes::Core::Math::TIntVector2<Phanes::Core::Types::int64, true>& r, const Phanes::Core::Math::TIntVector2<Phanes::Core::Types::int64, true>& v1, const Phanes::Core::Math::TIntVector2<Phanes::Core::Types::int64, true>& v2)
         {
-            r.comp = _mm_srl_epi64(v1.comp, v2.comp);
+            r.comp = Phanes::Core::Math::SIMD::ivec2_srav(v1.comp, v2.comp);
         }
 
         static FORCEINLINE void map(Phanes::Core::Math::TIntVector2<Phanes::Core::Types::int64, true>& r, const Phanes::Core::Math::TIntVector2<Phanes::Core::Types::int64, true>& v1, Phanes::Core::Types::int64 s)
         {
-            r.comp = _mm_srl_epi64(v1.comp, _mm_set1_epi64x(s));
+            r.comp = Phanes::Core::Math::SIMD::ivec2_sra(v1.comp, _mm_cvtsi64_si128(s));
         }
     };
 
@@ -770,6 +1368,82 @@ namespace Phanes::Core::Math::Detail
         }
     };
 
+    template<>
+    struct compute_mat3_det<float, true>
+    {
+        static FORCEINLINE float map(const Phanes::Core::Math::TMatrix3<float, true>& m1)
+        {
+            // dot(c0, cross(c1, c2))
+            return _mm_cvtss_f32(_mm_dp_ps(m1.c0.data, Phanes::Core::Math::SIMD::vec4_cross_p(m1.c1.data, m1.c2.data), 0x71));
+        }
+    };
+
+    template<>
+    struct compute_mat3_inv<float, true>
+    {
+        static FORCEINLINE bool map(Phanes::Core::Math::TMatrix3<float, true>& r, const Phanes::Core::Math::TMatrix3<float, true>& m1)
+        {
+            // The rows of the adjugate are the cross products of the columns.
+            __m128 r0 = Phanes::Core::Math::SIMD::vec4_cross_p(m1.c1.data, m1.c2.data);
+            __m128 r1 = Phanes::Core::Math::SIMD::vec4_cross_p(m1.c2.data, m1.c0.data);
+            __m128 r2 = Phanes::Core::Math::SIMD::vec4_cross_p(m1.c0.data, m1.c1.data);
+            __m128 r3 = _mm_setzero_ps();
+
+            __m128 det = _mm_dp_ps(m1.c0.data, r0, 0x7F);
+
+            if (_mm_cvtss_f32(det) == 0.0f)
+            {
+                return false;
+            }
+
+            __m128 _1_det = _mm_div_ps(_mm_set1_ps(1.0f), det);
+
+            _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+            r.c0.data = _mm_mul_ps(r0, _1_det);
+            r.c1.data = _mm_mul_ps(r1, _1_det);
+            r.c2.data = _mm_mul_ps(r2, _1_det);
+
+            return true;
+        }
+    };
+
+    template<>
+    struct compute_mat3_mul<float, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TMatrix3<float, true>& r, const Phanes::Core::Math::TMatrix3<float, true>& m1, const Phanes::Core::Math::TMatrix3<float, true>& m2)
+        {
+            const __m128 a0 = m1.c0.data;
+            const __m128 a1 = m1.c1.data;
+            const __m128 a2 = m1.c2.data;
+
+            const __m128 b0 = m2.c0.data;
+            const __m128 b1 = m2.c1.data;
+            const __m128 b2 = m2.c2.data;
+
+            r.c0.data = mul_col(a0, a1, a2, b0);
+            r.c1.data = mul_col(a0, a1, a2, b1);
+            r.c2.data = mul_col(a0, a1, a2, b2);
+        }
+
+        // Broadcast each component of b and accumulate over the columns of a.
+        static FORCEINLINE __m128 mul_col(const __m128 a0, const __m128 a1, const __m128 a2, const __m128 b)
+        {
+            __m128 t = _mm_mul_ps(a0, _mm_shuffle_ps(b, b, _MM_SHUFFLE(0, 0, 0, 0)));
+            t = Phanes::Core::Math::SIMD::vec4_fmadd(a1, _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 1, 1, 1)), t);
+            return Phanes::Core::Math::SIMD::vec4_fmadd(a2, _mm_shuffle_ps(b, b, _MM_SHUFFLE(2, 2, 2, 2)), t);
+        }
+    };
+
+    template<>
+    struct compute_mat3_mul_vec<float, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TVector3<float, true>& r, const Phanes::Core::Math::TMatrix3<float, true>& m1, const Phanes::Core::Math::TVector3<float, true>& v1)
+        {
+            r.data = compute_mat3_mul<float, true>::mul_col(m1.c0.data, m1.c1.data, m1.c2.data, v1.data);
+        }
+    };
+
     // =========== //
     //   Matrix4   //
     // =========== // 
@@ -777,447 +1451,265 @@ namespace Phanes::Core::Math::Detail
     template<>
     struct compute_mat4_det<float, true>
     {
-
-        // From: GLM: https://github.com/g-truc/glm/blob/master/glm/simd/matrix.h (MIT License)
         static FORCEINLINE float map(const TMatrix4<float, true>& m1)
         {
-            __m128 Fac0;
-            {
-                //	valType SubFactor00 = m[2][2] * m[3][3] - m[3][2] * m[2][3];
-                //	valType SubFactor00 = m[2][2] * m[3][3] - m[3][2] * m[2][3];
-                //	valType SubFactor06 = m[1][2] * m[3][3] - m[3][2] * m[1][3];
-                //	valType SubFactor13 = m[1][2] * m[2][3] - m[2][2] * m[1][3];
-
-                __m128 Swp0a = _mm_shuffle_ps(m1.c3.data, m1.c2.data, _MM_SHUFFLE(3, 3, 3, 3));
-                __m128 Swp0b = _mm_shuffle_ps(m1.c3.data, m1.c2.data, _MM_SHUFFLE(2, 2, 2, 2));
-
-                __m128 Swp00 = _mm_shuffle_ps(m1.c2.data, m1.c1.data, _MM_SHUFFLE(2, 2, 2, 2));
-                __m128 Swp01 = _mm_shuffle_ps(Swp0a, Swp0a, _MM_SHUFFLE(2, 0, 0, 0));
-                __m128 Swp02 = _mm_shuffle_ps(Swp0b, Swp0b, _MM_SHUFFLE(2, 0, 0, 0));
-                __m128 Swp03 = _mm_shuffle_ps(m1.c2.data, m1.c1.data, _MM_SHUFFLE(3, 3, 3, 3));
-
-                __m128 Mul00 = _mm_mul_ps(Swp00, Swp01);
-                __m128 Mul01 = _mm_mul_ps(Swp02, Swp03);
-                Fac0 = _mm_sub_ps(Mul00, Mul01);
-            }
+#if P_DISPATCH__
+            return Phanes::Core::Math::SIMD::GetDispatchTable().mat4_det(&m1.data[0][0]);
+#elif P_FMA__
+            return Phanes::Core::Math::SIMD::FMA::mat4_det(&m1.data[0][0]);
+#else
+            return Phanes::Core::Math::SIMD::SSE::mat4_det(&m1.data[0][0]);
+#endif
+        }
+    };
 
-            __m128 Fac1;
-            {
-                //	valType SubFactor01 = m[2][1] * m[3][3] - m[3][1] * m[2][3];
-                //	valType SubFactor01 = m[2][1] * m[3][3] - m[3][1] * m[2][3];
-                //	valType SubFactor07 = m[1][1] * m[3][3] - m[3][1] * m[1][3];
-                //	valType SubFactor14 = m[1][1] * m[2][3] - m[2][1] * m[1][3];
-
-                __m128 Swp0a = _mm_shuffle_ps(m1.c3.data, m1.c2.data, _MM_SHUFFLE(3, 3, 3, 3));
-                __m128 Swp0b = _mm_shuffle_ps(m1.c3.data, m1.c2.data, _MM_SHUFFLE(1, 1, 1, 1));
-
-                __m128 Swp00 = _mm_shuffle_ps(m1.c2.data, m1.c1.data, _MM_SHUFFLE(1, 1, 1, 1));
-                __m128 Swp01 = _mm_shuffle_ps(Swp0a, Swp0a, _MM_SHUFFLE(2, 0, 0, 0));
-                __m128 Swp02 = _mm_shuffle_ps(Swp0b, Swp0b, _MM_SHUFFLE(2, 0, 0, 0));
-                __m128 Swp03 = _mm_shuffle_ps(m1.c2.data, m1.c1.data, _MM_SHUFFLE(3, 3, 3, 3));
-
-                __m128 Mul00 = _mm_mul_ps(Swp00, Swp01);
-                __m128 Mul01 = _mm_mul_ps(Swp02, Swp03);
-                Fac1 = _mm_sub_ps(Mul00, Mul01);
-            }
 
+    template<>
+    struct compute_mat4_inv<float, true>
+    {
+        static FORCEINLINE bool map(Phanes::Core::Math::TMatrix4<float, true>& r, const Phanes::Core::Math::TMatrix4<float, true>& m1)
+        {
+#if P_DISPATCH__
+            return Phanes::Core::Math::SIMD::GetDispatchTable().mat4_inv(&r.data[0][0], &m1.data[0][0]);
+#elif P_FMA__
+            return Phanes::Core::Math::SIMD::FMA::mat4_inv(&r.data[0][0], &m1.data[0][0]);
+#else
+            return Phanes::Core::Math::SIMD::SSE::mat4_inv(&r.data[0][0], &m1.data[0][0]);
+#endif
+        }
+    };
 
-            __m128 Fac2;
-            {
-                //	valType SubFactor02 = m[2][1] * m[3][2] - m[3][1] * m[2][2];
-                //	valType SubFactor02 = m[2][1] * m[3][2] - m[3][1] * m[2][2];
-                //	valType SubFactor08 = m[1][1] * m[3][2] - m[3][1] * m[1][2];
-                //	valType SubFactor15 = m[1][1] * m[2][2] - m[2][1] * m[1][2];
-
-                __m128 Swp0a = _mm_shuffle_ps(m1.c3.data, m1.c2.data, _MM_SHUFFLE(2, 2, 2, 2));
-                __m128 Swp0b = _mm_shuffle_ps(m1.c3.data, m1.c2.data, _MM_SHUFFLE(1, 1, 1, 1));
-
-                __m128 Swp00 = _mm_shuffle_ps(m1.c2.data, m1.c1.data, _MM_SHUFFLE(1, 1, 1, 1));
-                __m128 Swp01 = _mm_shuffle_ps(Swp0a, Swp0a, _MM_SHUFFLE(2, 0, 0, 0));
-                __m128 Swp02 = _mm_shuffle_ps(Swp0b, Swp0b, _MM_SHUFFLE(2, 0, 0, 0));
-                __m128 Swp03 = _mm_shuffle_ps(m1.c2.data, m1.c1.data, _MM_SHUFFLE(2, 2, 2, 2));
-
-                __m128 Mul00 = _mm_mul_ps(Swp00, Swp01);
-                __m128 Mul01 = _mm_mul_ps(Swp02, Swp03);
-                Fac2 = _mm_sub_ps(Mul00, Mul01);
-            }
 
-            __m128 Fac3;
-            {
-                //	valType SubFactor03 = m[2][0] * m[3][3] - m[3][0] * m[2][3];
-                //	valType SubFactor03 = m[2][0] * m[3][3] - m[3][0] * m[2][3];
-                //	valType SubFactor09 = m[1][0] * m[3][3] - m[3][0] * m[1][3];
-                //	valType SubFactor16 = m[1][0] * m[2][3] - m[2][0] * m[1][3];
-
-                __m128 Swp0a = _mm_shuffle_ps(m1.c3.data, m1.c2.data, _MM_SHUFFLE(3, 3, 3, 3));
-                __m128 Swp0b = _mm_shuffle_ps(m1.c3.data, m1.c2.data, _MM_SHUFFLE(0, 0, 0, 0));
-
-                __m128 Swp00 = _mm_shuffle_ps(m1.c2.data, m1.c1.data, _MM_SHUFFLE(0, 0, 0, 0));
-                __m128 Swp01 = _mm_shuffle_ps(Swp0a, Swp0a, _MM_SHUFFLE(2, 0, 0, 0));
-                __m128 Swp02 = _mm_shuffle_ps(Swp0b, Swp0b, _MM_SHUFFLE(2, 0, 0, 0));
-                __m128 Swp03 = _mm_shuffle_ps(m1.c2.data, m1.c1.data, _MM_SHUFFLE(3, 3, 3, 3));
-
-                __m128 Mul00 = _mm_mul_ps(Swp00, Swp01);
-                __m128 Mul01 = _mm_mul_ps(Swp02, Swp03);
-                Fac3 = _mm_sub_ps(Mul00, Mul01);
-            }
+    template<>
+    struct compute_mat4_transpose<float, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TMatrix4<float, true>& r, const Phanes::Core::Math::TMatrix4<float, true>& m1)
+        {
+#if P_DISPATCH__
+            Phanes::Core::Math::SIMD::GetDispatchTable().mat4_transpose(&r.data[0][0], &m1.data[0][0]);
+#else
+            Phanes::Core::Math::SIMD::SSE::mat4_transpose(&r.data[0][0], &m1.data[0][0]);
+#endif
+        }
+    };
 
-            __m128 Fac4;
-            {
-                //	valType SubFactor04 = m[2][0] * m[3][2] - m[3][0] * m[2][2];
-                //	valType SubFactor04 = m[2][0] * m[3][2] - m[3][0] * m[2][2];
-                //	valType SubFactor10 = m[1][0] * m[3][2] - m[3][0] * m[1][2];
-                //	valType SubFactor17 = m[1][0] * m[2][2] - m[2][0] * m[1][2];
-
-                __m128 Swp0a = _mm_shuffle_ps(m1.c3.data, m1.c2.data, _MM_SHUFFLE(2, 2, 2, 2));
-                __m128 Swp0b = _mm_shuffle_ps(m1.c3.data, m1.c2.data, _MM_SHUFFLE(0, 0, 0, 0));
-
-                __m128 Swp00 = _mm_shuffle_ps(m1.c2.data, m1.c1.data, _MM_SHUFFLE(0, 0, 0, 0));
-                __m128 Swp01 = _mm_shuffle_ps(Swp0a, Swp0a, _MM_SHUFFLE(2, 0, 0, 0));
-                __m128 Swp02 = _mm_shuffle_ps(Swp0b, Swp0b, _MM_SHUFFLE(2, 0, 0, 0));
-                __m128 Swp03 = _mm_shuffle_ps(m1.c2.data, m1.c1.data, _MM_SHUFFLE(2, 2, 2, 2));
-
-                __m128 Mul00 = _mm_mul_ps(Swp00, Swp01);
-                __m128 Mul01 = _mm_mul_ps(Swp02, Swp03);
-                Fac4 = _mm_sub_ps(Mul00, Mul01);
-            }
 
-            __m128 Fac5;
-            {
-                //	valType SubFactor05 = m[2][0] * m[3][1] - m[3][0] * m[2][1];
-                //	valType SubFactor05 = m[2][0] * m[3][1] - m[3][0] * m[2][1];
-                //	valType SubFactor12 = m[1][0] * m[3][1] - m[3][0] * m[1][1];
-                //	valType SubFactor18 = m[1][0] * m[2][1] - m[2][0] * m[1][1];
-
-                __m128 Swp0a = _mm_shuffle_ps(m1.c3.data, m1.c2.data, _MM_SHUFFLE(1, 1, 1, 1));
-                __m128 Swp0b = _mm_shuffle_ps(m1.c3.data, m1.c2.data, _MM_SHUFFLE(0, 0, 0, 0));
-
-                __m128 Swp00 = _mm_shuffle_ps(m1.c2.data, m1.c1.data, _MM_SHUFFLE(0, 0, 0, 0));
-                __m128 Swp01 = _mm_shuffle_ps(Swp0a, Swp0a, _MM_SHUFFLE(2, 0, 0, 0));
-                __m128 Swp02 = _mm_shuffle_ps(Swp0b, Swp0b, _MM_SHUFFLE(2, 0, 0, 0));
-                __m128 Swp03 = _mm_shuffle_ps(m1.c2.data, m1.c1.data, _MM_SHUFFLE(1, 1, 1, 1));
-
-                __m128 Mul00 = _mm_mul_ps(Swp00, Swp01);
-                __m128 Mul01 = _mm_mul_ps(Swp02, Swp03);
-                Fac5 = _mm_sub_ps(Mul00, Mul01);
-            }
+    template<>
+    struct compute_mat4_mul<float, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TMatrix4<float, true>& r, const Phanes::Core::Math::TMatrix4<float, true>& m1, const Phanes::Core::Math::TMatrix4<float, true>& m2)
+        {
+#if P_DISPATCH__
+            Phanes::Core::Math::SIMD::GetDispatchTable().mat4_mul(&r.data[0][0], &m1.data[0][0], &m2.data[0][0]);
+#elif P_FMA__
+            Phanes::Core::Math::SIMD::FMA::mat4_mul(&r.data[0][0], &m1.data[0][0], &m2.data[0][0]);
+#elif P_AVX__
+            Phanes::Core::Math::SIMD::AVX::mat4_mul(&r.data[0][0], &m1.data[0][0], &m2.data[0][0]);
+#else
+            Phanes::Core::Math::SIMD::SSE::mat4_mul(&r.data[0][0], &m1.data[0][0], &m2.data[0][0]);
+#endif
+        }
+    };
 
-            __m128 SignA = _mm_set_ps(1.0f, -1.0f, 1.0f, -1.0f);
-            __m128 SignB = _mm_set_ps(-1.0f, 1.0f, -1.0f, 1.0f);
-
-            // m[1][0]
-            // m[0][0]
-            // m[0][0]
-            // m[0][0]
-            __m128 Temp0 = _mm_shuffle_ps(m1.c1.data, m1.c0.data, _MM_SHUFFLE(0, 0, 0, 0));
-            __m128 Vec0 = _mm_shuffle_ps(Temp0, Temp0, _MM_SHUFFLE(2, 2, 2, 0));
-
-            // m[1][1]
-            // m[0][1]
-            // m[0][1]
-            // m[0][1]
-            __m128 Temp1 = _mm_shuffle_ps(m1.c1.data, m1.c0.data, _MM_SHUFFLE(1, 1, 1, 1));
-            __m128 Vec1 = _mm_shuffle_ps(Temp1, Temp1, _MM_SHUFFLE(2, 2, 2, 0));
-
-            // m[1][2]
-            // m[0][2]
-            // m[0][2]
-            // m[0][2]
-            __m128 Temp2 = _mm_shuffle_ps(m1.c1.data, m1.c0.data, _MM_SHUFFLE(2, 2, 2, 2));
-            __m128 Vec2 = _mm_shuffle_ps(Temp2, Temp2, _MM_SHUFFLE(2, 2, 2, 0));
-
-            // m[1][3]
-            // m[0][3]
-            // m[0][3]
-            // m[0][3]
-            __m128 Temp3 = _mm_shuffle_ps(m1.c1.data, m1.c0.data, _MM_SHUFFLE(3, 3, 3, 3));
-            __m128 Vec3 = _mm_shuffle_ps(Temp3, Temp3, _MM_SHUFFLE(2, 2, 2, 0));
-
-            // col0
-            // + (Vec1[0] * Fac0[0] - Vec2[0] * Fac1[0] + Vec3[0] * Fac2[0]),
-            // - (Vec1[1] * Fac0[1] - Vec2[1] * Fac1[1] + Vec3[1] * Fac2[1]),
-            // + (Vec1[2] * Fac0[2] - Vec2[2] * Fac1[2] + Vec3[2] * Fac2[2]),
-            // - (Vec1[3] * Fac0[3] - Vec2[3] * Fac1[3] + Vec3[3] * Fac2[3]),
-            __m128 Mul00 = _mm_mul_ps(Vec1, Fac0);
-            __m128 Mul01 = _mm_mul_ps(Vec2, Fac1);
-            __m128 Mul02 = _mm_mul_ps(Vec3, Fac2);
-            __m128 Sub00 = _mm_sub_ps(Mul00, Mul01);
-            __m128 Add00 = _mm_add_ps(Sub00, Mul02);
-            __m128 Inv0 = _mm_mul_ps(SignB, Add00);
-
-            // col1
-            // - (Vec0[0] * Fac0[0] - Vec2[0] * Fac3[0] + Vec3[0] * Fac4[0]),
-            // + (Vec0[0] * Fac0[1] - Vec2[1] * Fac3[1] + Vec3[1] * Fac4[1]),
-            // - (Vec0[0] * Fac0[2] - Vec2[2] * Fac3[2] + Vec3[2] * Fac4[2]),
-            // + (Vec0[0] * Fac0[3] - Vec2[3] * Fac3[3] + Vec3[3] * Fac4[3]),
-            __m128 Mul03 = _mm_mul_ps(Vec0, Fac0);
-            __m128 Mul04 = _mm_mul_ps(Vec2, Fac3);
-            __m128 Mul05 = _mm_mul_ps(Vec3, Fac4);
-            __m128 Sub01 = _mm_sub_ps(Mul03, Mul04);
-            __m128 Add01 = _mm_add_ps(Sub01, Mul05);
-            __m128 Inv1 = _mm_mul_ps(SignA, Add01);
-
-            // col2
-            // + (Vec0[0] * Fac1[0] - Vec1[0] * Fac3[0] + Vec3[0] * Fac5[0]),
-            // - (Vec0[0] * Fac1[1] - Vec1[1] * Fac3[1] + Vec3[1] * Fac5[1]),
-            // + (Vec0[0] * Fac1[2] - Vec1[2] * Fac3[2] + Vec3[2] * Fac5[2]),
-            // - (Vec0[0] * Fac1[3] - Vec1[3] * Fac3[3] + Vec3[3] * Fac5[3]),
-            __m128 Mul06 = _mm_mul_ps(Vec0, Fac1);
-            __m128 Mul07 = _mm_mul_ps(Vec1, Fac3);
-            __m128 Mul08 = _mm_mul_ps(Vec3, Fac5);
-            __m128 Sub02 = _mm_sub_ps(Mul06, Mul07);
-            __m128 Add02 = _mm_add_ps(Sub02, Mul08);
-            __m128 Inv2 = _mm_mul_ps(SignB, Add02);
-
-            // col3
-            // - (Vec1[0] * Fac2[0] - Vec1[0] * Fac4[0] + Vec2[0] * Fac5[0]),
-            // + (Vec1[0] * Fac2[1] - Vec1[1] * Fac4[1] + Vec2[1] * Fac5[1]),
-            // - (Vec1[0] * Fac2[2] - Vec1[2] * Fac4[2] + Vec2[2] * Fac5[2]),
-            // + (Vec1[0] * Fac2[3] - Vec1[3] * Fac4[3] + Vec2[3] * Fac5[3]));
-            __m128 Mul09 = _mm_mul_ps(Vec0, Fac2);
-            __m128 Mul10 = _mm_mul_ps(Vec1, Fac4);
-            __m128 Mul11 = _mm_mul_ps(Vec2, Fac5);
-            __m128 Sub03 = _mm_sub_ps(Mul09, Mul10);
-            __m128 Add03 = _mm_add_ps(Sub03, Mul11);
-            __m128 Inv3 = _mm_mul_ps(SignA, Add03);
-
-            __m128 Row0 = _mm_shuffle_ps(Inv0, Inv1, _MM_SHUFFLE(0, 0, 0, 0));
-            __m128 Row1 = _mm_shuffle_ps(Inv2, Inv3, _MM_SHUFFLE(0, 0, 0, 0));
-            __m128 Row2 = _mm_shuffle_ps(Row0, Row1, _MM_SHUFFLE(2, 0, 2, 0));
-
-            //	valType Determinant = m[0][0] * Inverse[0][0]
-            //						+ m[0][1] * Inverse[1][0]
-            //						+ m[0][2] * Inverse[2][0]
-            //						+ m[0][3] * Inverse[3][0];
-            __m128 Det0 = Phanes::Core::Math::SIMD::vec4_dot(m1.c0.data, Row2);
-            return _mm_cvtss_f32(Det0);
-        }
-    };
-
-
-    template<>
-    struct compute_mat4_inv<float, false>
-    {
-        // From: GLM: https://github.com/g-truc/glm/blob/master/glm/simd/matrix.h (MIT License)
-        static FORCEINLINE bool map(Phanes::Core::Math::TMatrix4<float, true>& r, const Phanes::Core::Math::TMatrix4<float, true>& m1)
+
+    template<>
+    struct compute_mat4_mul_vec<float, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TVector4<float, true>& r, const Phanes::Core::Math::TMatrix4<float, true>& m1, const Phanes::Core::Math::TVector4<float, true>& v1)
         {
-            __m128 Fac0;
-            {
-                //	valType SubFactor00 = m[2][2] * m[3][3] - m[3][2] * m[2][3];
-                //	valType SubFactor00 = m[2][2] * m[3][3] - m[3][2] * m[2][3];
-                //	valType SubFactor06 = m[1][2] * m[3][3] - m[3][2] * m[1][3];
-                //	valType SubFactor13 = m[1][2] * m[2][3] - m[2][2] * m[1][3];
-
-                __m128 Swp0a = _mm_shuffle_ps(m1.c3.data, m1.c2.data, _MM_SHUFFLE(3, 3, 3, 3));
-                __m128 Swp0b = _mm_shuffle_ps(m1.c3.data, m1.c2.data, _MM_SHUFFLE(2, 2, 2, 2));
-
-                __m128 Swp00 = _mm_shuffle_ps(m1.c2.data, m1.c1.data, _MM_SHUFFLE(2, 2, 2, 2));
-                __m128 Swp01 = _mm_shuffle_ps(Swp0a, Swp0a, _MM_SHUFFLE(2, 0, 0, 0));
-                __m128 Swp02 = _mm_shuffle_ps(Swp0b, Swp0b, _MM_SHUFFLE(2, 0, 0, 0));
-                __m128 Swp03 = _mm_shuffle_ps(m1.c2.data, m1.c1.data, _MM_SHUFFLE(3, 3, 3, 3));
-
-                __m128 Mul00 = _mm_mul_ps(Swp00, Swp01);
-                __m128 Mul01 = _mm_mul_ps(Swp02, Swp03);
-                Fac0 = _mm_sub_ps(Mul00, Mul01);
-            }
+            // Broadcast each component and accumulate over the columns, so no horizontal add is needed.
+            __m128 s01 = Phanes::Core::Math::SIMD::vec4_fmadd(m1.c1.data, _mm_shuffle_ps(v1.data, v1.data, _MM_SHUFFLE(1, 1, 1, 1)), _mm_mul_ps(m1.c0.data, _mm_shuffle_ps(v1.data, v1.data, _MM_SHUFFLE(0, 0, 0, 0))));
+            __m128 s23 = Phanes::Core::Math::SIMD::vec4_fmadd(m1.c3.data, _mm_shuffle_ps(v1.data, v1.data, _MM_SHUFFLE(3, 3, 3, 3)), _mm_mul_ps(m1.c2.data, _mm_shuffle_ps(v1.data, v1.data, _MM_SHUFFLE(2, 2, 2, 2))));
 
-            __m128 Fac1;
-            {
-                //	valType SubFactor01 = m[2][1] * m[3][3] - m[3][1] * m[2][3];
-                //	valType SubFactor01 = m[2][1] * m[3][3] - m[3][1] * m[2][3];
-                //	valType SubFactor07 = m[1][1] * m[3][3] - m[3][1] * m[1][3];
-                //	valType SubFactor14 = m[1][1] * m[2][3] - m[2][1] * m[1][3];
-
-                __m128 Swp0a = _mm_shuffle_ps(m1.c3.data, m1.c2.data, _MM_SHUFFLE(3, 3, 3, 3));
-                __m128 Swp0b = _mm_shuffle_ps(m1.c3.data, m1.c2.data, _MM_SHUFFLE(1, 1, 1, 1));
-
-                __m128 Swp00 = _mm_shuffle_ps(m1.c2.data, m1.c1.data, _MM_SHUFFLE(1, 1, 1, 1));
-                __m128 Swp01 = _mm_shuffle_ps(Swp0a, Swp0a, _MM_SHUFFLE(2, 0, 0, 0));
-                __m128 Swp02 = _mm_shuffle_ps(Swp0b, Swp0b, _MM_SHUFFLE(2, 0, 0, 0));
-                __m128 Swp03 = _mm_shuffle_ps(m1.c2.data, m1.c1.data, _MM_SHUFFLE(3, 3, 3, 3));
-
-                __m128 Mul00 = _mm_mul_ps(Swp00, Swp01);
-                __m128 Mul01 = _mm_mul_ps(Swp02, Swp03);
-                Fac1 = _mm_sub_ps(Mul00, Mul01);
-            }
+            r.data = _mm_add_ps(s01, s23);
+        }
+    };
 
+    // =============== //
+    //   TQuaternion   //
+    // =============== //
 
-            __m128 Fac2;
-            {
-                //	valType SubFactor02 = m[2][1] * m[3][2] - m[3][1] * m[2][2];
-                //	valType SubFactor02 = m[2][1] * m[3][2] - m[3][1] * m[2][2];
-                //	valType SubFactor08 = m[1][1] * m[3][2] - m[3][1] * m[1][2];
-                //	valType SubFactor15 = m[1][1] * m[2][2] - m[2][1] * m[1][2];
-
-                __m128 Swp0a = _mm_shuffle_ps(m1.c3.data, m1.c2.data, _MM_SHUFFLE(2, 2, 2, 2));
-                __m128 Swp0b = _mm_shuffle_ps(m1.c3.data, m1.c2.data, _MM_SHUFFLE(1, 1, 1, 1));
-
-                __m128 Swp00 = _mm_shuffle_ps(m1.c2.data, m1.c1.data, _MM_SHUFFLE(1, 1, 1, 1));
-                __m128 Swp01 = _mm_shuffle_ps(Swp0a, Swp0a, _MM_SHUFFLE(2, 0, 0, 0));
-                __m128 Swp02 = _mm_shuffle_ps(Swp0b, Swp0b, _MM_SHUFFLE(2, 0, 0, 0));
-                __m128 Swp03 = _mm_shuffle_ps(m1.c2.data, m1.c1.data, _MM_SHUFFLE(2, 2, 2, 2));
-
-                __m128 Mul00 = _mm_mul_ps(Swp00, Swp01);
-                __m128 Mul01 = _mm_mul_ps(Swp02, Swp03);
-                Fac2 = _mm_sub_ps(Mul00, Mul01);
-            }
+    template<>
+    struct construct_quat<float, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TQuaternion<float, true>& q1, const Phanes::Core::Math::TQuaternion<float, true>& q2)
+        {
+            q1.comp = q2.comp;
+        }
 
-            __m128 Fac3;
-            {
-                //	valType SubFactor03 = m[2][0] * m[3][3] - m[3][0] * m[2][3];
-                //	valType SubFactor03 = m[2][0] * m[3][3] - m[3][0] * m[2][3];
-                //	valType SubFactor09 = m[1][0] * m[3][3] - m[3][0] * m[1][3];
-                //	valType SubFactor16 = m[1][0] * m[2][3] - m[2][0] * m[1][3];
-
-                __m128 Swp0a = _mm_shuffle_ps(m1.c3.data, m1.c2.data, _MM_SHUFFLE(3, 3, 3, 3));
-                __m128 Swp0b = _mm_shuffle_ps(m1.c3.data, m1.c2.data, _MM_SHUFFLE(0, 0, 0, 0));
-
-                __m128 Swp00 = _mm_shuffle_ps(m1.c2.data, m1.c1.data, _MM_SHUFFLE(0, 0, 0, 0));
-                __m128 Swp01 = _mm_shuffle_ps(Swp0a, Swp0a, _MM_SHUFFLE(2, 0, 0, 0));
-                __m128 Swp02 = _mm_shuffle_ps(Swp0b, Swp0b, _MM_SHUFFLE(2, 0, 0, 0));
-                __m128 Swp03 = _mm_shuffle_ps(m1.c2.data, m1.c1.data, _MM_SHUFFLE(3, 3, 3, 3));
-
-                __m128 Mul00 = _mm_mul_ps(Swp00, Swp01);
-                __m128 Mul01 = _mm_mul_ps(Swp02, Swp03);
-                Fac3 = _mm_sub_ps(Mul00, Mul01);
-            }
+        static FORCEINLINE void map(Phanes::Core::Math::TQuaternion<float, true>& q1, float x, float y, float z, float w)
+        {
+            q1.comp = _mm_setr_ps(x, y, z, w);
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TQuaternion<float, true>& q1, const Phanes::Core::Math::TVector3<float, true>& v1, float w)
+        {
+            q1.comp = _mm_insert_ps(v1.comp, _mm_set_ss(w), 0x30);
+        }
+
+        static FORCEINLINE void map(Phanes::Core::Math::TQuaternion<float, true>& q1, const float* comp)
+        {
+            q1.comp = _mm_loadu_ps(comp);
+        }
+    };
+
+
+    template<>
+    struct compute_quat_add<float, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TQuaternion<float, true>& r, const Phanes::Core::Math::TQuaternion<float, true>& q1, const Phanes::Core::Math::TQuaternion<float, true>& q2)
+        {
+            r.comp = _mm_add_ps(q1.comp, q2.comp);
+        }
+    };
+
+
+    template<>
+    struct compute_quat_sub<float, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TQuaternion<float, true>& r, const Phanes::Core::Math::TQuaternion<float, true>& q1, const Phanes::Core::Math::TQuaternion<float, true>& q2)
+        {
+            r.comp = _mm_sub_ps(q1.comp, q2.comp);
+        }
+    };
+
+
+    template<>
+    struct compute_quat_scale<float, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TQuaternion<float, true>& r, const Phanes::Core::Math::TQuaternion<float, true>& q1, float s)
+        {
+            r.comp = _mm_mul_ps(q1.comp, _mm_set1_ps(s));
+        }
+    };
 
-            __m128 Fac4;
+
+    template<>
+    struct compute_quat_mul<float, true>
+    {
+        // r = w1 * q2 + x1 * (w2, -z2, y2, -x2) + y1 * (z2, w2, -x2, -y2) + z1 * (-y2, x2, w2, -z2)
+        static FORCEINLINE void map(Phanes::Core::Math::TQuaternion<float, true>& r, const Phanes::Core::Math::TQuaternion<float, true>& q1, const Phanes::Core::Math::TQuaternion<float, true>& q2)
+        {
+            const __m128 a = q1.comp;
+            const __m128 b = q2.comp;
+
+            __m128 bx = _mm_xor_ps(_mm_shuffle_ps(b, b, _MM_SHUFFLE(0, 1, 2, 3)), _mm_setr_ps(0.0f, -0.0f, 0.0f, -0.0f));
+            __m128 by = _mm_xor_ps(_mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 0, 3, 2)), _mm_setr_ps(0.0f, 0.0f, -0.0f, -0.0f));
+            __m128 bz = _mm_xor_ps(_mm_shuffle_ps(b, b, _MM_SHUFFLE(2, 3, 0, 1)), _mm_setr_ps(-0.0f, 0.0f, 0.0f, -0.0f));
+
+            __m128 s = _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 3, 3, 3)), b);
+            s = Phanes::Core::Math::SIMD::vec4_fmadd(_mm_shuffle_ps(a, a, _MM_SHUFFLE(0, 0, 0, 0)), bx, s);
+            s = Phanes::Core::Math::SIMD::vec4_fmadd(_mm_shuffle_ps(a, a, _MM_SHUFFLE(1, 1, 1, 1)), by, s);
+
+            r.comp = Phanes::Core::Math::SIMD::vec4_fmadd(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 2, 2, 2)), bz, s);
+        }
+    };
+
+
+    template<>
+    struct compute_quat_dot<float, true>
+    {
+        static FORCEINLINE float map(const Phanes::Core::Math::TQuaternion<float, true>& q1, const Phanes::Core::Math::TQuaternion<float, true>& q2)
+        {
+            return Phanes::Core::Math::SIMD::vec4_dot_cvtf32(q1.comp, q2.comp);
+        }
+    };
+
+
+    template<>
+    struct compute_quat_normalize<float, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TQuaternion<float, true>& r, const Phanes::Core::Math::TQuaternion<float, true>& q1, EPrecision p)
+        {
+            r.comp = Phanes::Core::Math::SIMD::vec4_normalize(q1.comp, p);
+        }
+    };
+
+
+    template<>
+    struct compute_quat_conjugate<float, true>
+    {
+        static FORCEINLINE void map(Phanes::Core::Math::TQuaternion<float, true>& r, const Phanes::Core::Math::TQuaternion<float, true>& q1)
+        {
+            r.comp = _mm_xor_ps(q1.comp, _mm_setr_ps(-0.0f, -0.0f, -0.0f, 0.0f));
+        }
+    };
+
+
+    template<>
+    struct compute_quat_rotate<float, true>
+    {
+        // v' = v + w * t + u x t, with t = 2 * (u x v)
+        static FORCEINLINE void map(Phanes::Core::Math::TVector3<float, true>& r, const Phanes::Core::Math::TQuaternion<float, true>& q1, const Phanes::Core::Math::TVector3<float, true>& v1)
+        {
+            const __m128 u = q1.comp;
+
+            __m128 t = Phanes::Core::Math::SIMD::vec4_cross_p(u, v1.comp);
+            t = _mm_add_ps(t, t);
+
+            __m128 res = Phanes::Core::Math::SIMD::vec4_fmadd(_mm_shuffle_ps(u, u, _MM_SHUFFLE(3, 3, 3, 3)), t, v1.comp);
+            res = _mm_add_ps(res, Phanes::Core::Math::SIMD::vec4_cross_p(u, t));
+
+            // The w lane of the cross products is not exactly 0 with FMA.
+            r.comp = _mm_blend_ps(res, _mm_setzero_ps(), 0x8);
+        }
+    };
+
+
+    template<>
+    struct compute_quat_eq<float, true>
+    {
+        static FORCEINLINE bool map(const Phanes::Core::Math::TQuaternion<float, true>& q1, const Phanes::Core::Math::TQuaternion<float, true>& q2, float threshold)
+        {
+            return Phanes::Core::Math::SIMD::vec4_eq_mask(q1.comp, q2.comp, threshold) == 0xF;
+        }
+    };
+
+    // ================= //
+    //   Vector packets  //
+    // ================= //
+
+    template<size_t N> requires (N % 4 == 0)
+    struct compute_vec4p_load<float, N>
+    {
+        static FORCEINLINE void map(float* x, float* y, float* z, float* w, const float* v)
+        {
+            for (size_t i = 0; i < N; i += 4)
             {
-                //	valType SubFactor04 = m[2][0] * m[3][2] - m[3][0] * m[2][2];
-                //	valType SubFactor04 = m[2][0] * m[3][2] - m[3][0] * m[2][2];
-                //	valType SubFactor10 = m[1][0] * m[3][2] - m[3][0] * m[1][2];
-                //	valType SubFactor17 = m[1][0] * m[2][2] - m[2][0] * m[1][2];
-
-                __m128 Swp0a = _mm_shuffle_ps(m1.c3.data, m1.c2.data, _MM_SHUFFLE(2, 2, 2, 2));
-                __m128 Swp0b = _mm_shuffle_ps(m1.c3.data, m1.c2.data, _MM_SHUFFLE(0, 0, 0, 0));
-
-                __m128 Swp00 = _mm_shuffle_ps(m1.c2.data, m1.c1.data, _MM_SHUFFLE(0, 0, 0, 0));
-                __m128 Swp01 = _mm_shuffle_ps(Swp0a, Swp0a, _MM_SHUFFLE(2, 0, 0, 0));
-                __m128 Swp02 = _mm_shuffle_ps(Swp0b, Swp0b, _MM_SHUFFLE(2, 0, 0, 0));
-                __m128 Swp03 = _mm_shuffle_ps(m1.c2.data, m1.c1.data, _MM_SHUFFLE(2, 2, 2, 2));
-
-                __m128 Mul00 = _mm_mul_ps(Swp00, Swp01);
-                __m128 Mul01 = _mm_mul_ps(Swp02, Swp03);
-                Fac4 = _mm_sub_ps(Mul00, Mul01);
+                __m128 r0 = _mm_loadu_ps(v + i * 4);
+                __m128 r1 = _mm_loadu_ps(v + i * 4 + 4);
+                __m128 r2 = _mm_loadu_ps(v + i * 4 + 8);
+                __m128 r3 = _mm_loadu_ps(v + i * 4 + 12);
+
+                _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+                _mm_storeu_ps(x + i, r0);
+                _mm_storeu_ps(y + i, r1);
+                _mm_storeu_ps(z + i, r2);
+                _mm_storeu_ps(w + i, r3);
             }
+        }
+    };
 
-            __m128 Fac5;
+    template<size_t N> requires (N % 4 == 0)
+    struct compute_vec4p_store<float, N>
+    {
+        static FORCEINLINE void map(float* v, const float* x, const float* y, const float* z, const float* w)
+        {
+            for (size_t i = 0; i < N; i += 4)
             {
-                //	valType SubFactor05 = m[2][0] * m[3][1] - m[3][0] * m[2][1];
-                //	valType SubFactor05 = m[2][0] * m[3][1] - m[3][0] * m[2][1];
-                //	valType SubFactor12 = m[1][0] * m[3][1] - m[3][0] * m[1][1];
-                //	valType SubFactor18 = m[1][0] * m[2][1] - m[2][0] * m[1][1];
-
-                __m128 Swp0a = _mm_shuffle_ps(m1.c3.data, m1.c2.data, _MM_SHUFFLE(1, 1, 1, 1));
-                __m128 Swp0b = _mm_shuffle_ps(m1.c3.data, m1.c2.data, _MM_SHUFFLE(0, 0, 0, 0));
-
-                __m128 Swp00 = _mm_shuffle_ps(m1.c2.data, m1.c1.data, _MM_SHUFFLE(0, 0, 0, 0));
-                __m128 Swp01 = _mm_shuffle_ps(Swp0a, Swp0a, _MM_SHUFFLE(2, 0, 0, 0));
-                __m128 Swp02 = _mm_shuffle_ps(Swp0b, Swp0b, _MM_SHUFFLE(2, 0, 0, 0));
-                __m128 Swp03 = _mm_shuffle_ps(m1.c2.data, m1.c1.data, _MM_SHUFFLE(1, 1, 1, 1));
-
-                __m128 Mul00 = _mm_mul_ps(Swp00, Swp01);
-                __m128 Mul01 = _mm_mul_ps(Swp02, Swp03);
-                Fac5 = _mm_sub_ps(Mul00, Mul01);
-            }
+                __m128 r0 = _mm_loadu_ps(x + i);
+                __m128 r1 = _mm_loadu_ps(y + i);
+                __m128 r2 = _mm_loadu_ps(z + i);
+                __m128 r3 = _mm_loadu_ps(w + i);
 
-            __m128 SignA = _mm_set_ps(1.0f, -1.0f, 1.0f, -1.0f);
-            __m128 SignB = _mm_set_ps(-1.0f, 1.0f, -1.0f, 1.0f);
-
-            // m[1][0]
-            // m[0][0]
-            // m[0][0]
-            // m[0][0]
-            __m128 Temp0 = _mm_shuffle_ps(m1.c1.data, m1.c0.data, _MM_SHUFFLE(0, 0, 0, 0));
-            __m128 Vec0 = _mm_shuffle_ps(Temp0, Temp0, _MM_SHUFFLE(2, 2, 2, 0));
-
-            // m[1][1]
-            // m[0][1]
-            // m[0][1]
-            // m[0][1]
-            __m128 Temp1 = _mm_shuffle_ps(m1.c1.data, m1.c0.data, _MM_SHUFFLE(1, 1, 1, 1));
-            __m128 Vec1 = _mm_shuffle_ps(Temp1, Temp1, _MM_SHUFFLE(2, 2, 2, 0));
-
-            // m[1][2]
-            // m[0][2]
-            // m[0][2]
-            // m[0][2]
-            __m128 Temp2 = _mm_shuffle_ps(m1.c1.data, m1.c0.data, _MM_SHUFFLE(2, 2, 2, 2));
-            __m128 Vec2 = _mm_shuffle_ps(Temp2, Temp2, _MM_SHUFFLE(2, 2, 2, 0));
-
-            // m[1][3]
-            // m[0][3]
-            // m[0][3]
-            // m[0][3]
-            __m128 Temp3 = _mm_shuffle_ps(m1.c1.data, m1.c0.data, _MM_SHUFFLE(3, 3, 3, 3));
-            __m128 Vec3 = _mm_shuffle_ps(Temp3, Temp3, _MM_SHUFFLE(2, 2, 2, 0));
-
-            // col0
-            // + (Vec1[0] * Fac0[0] - Vec2[0] * Fac1[0] + Vec3[0] * Fac2[0]),
-            // - (Vec1[1] * Fac0[1] - Vec2[1] * Fac1[1] + Vec3[1] * Fac2[1]),
-            // + (Vec1[2] * Fac0[2] - Vec2[2] * Fac1[2] + Vec3[2] * Fac2[2]),
-            // - (Vec1[3] * Fac0[3] - Vec2[3] * Fac1[3] + Vec3[3] * Fac2[3]),
-            __m128 Mul00 = _mm_mul_ps(Vec1, Fac0);
-            __m128 Mul01 = _mm_mul_ps(Vec2, Fac1);
-            __m128 Mul02 = _mm_mul_ps(Vec3, Fac2);
-            __m128 Sub00 = _mm_sub_ps(Mul00, Mul01);
-            __m128 Add00 = _mm_add_ps(Sub00, Mul02);
-            __m128 Inv0 = _mm_mul_ps(SignB, Add00);
-
-            // col1
-            // - (Vec0[0] * Fac0[0] - Vec2[0] * Fac3[0] + Vec3[0] * Fac4[0]),
-            // + (Vec0[0] * Fac0[1] - Vec2[1] * Fac3[1] + Vec3[1] * Fac4[1]),
-            // - (Vec0[0] * Fac0[2] - Vec2[2] * Fac3[2] + Vec3[2] * Fac4[2]),
-            // + (Vec0[0] * Fac0[3] - Vec2[3] * Fac3[3] + Vec3[3] * Fac4[3]),
-            __m128 Mul03 = _mm_mul_ps(Vec0, Fac0);
-            __m128 Mul04 = _mm_mul_ps(Vec2, Fac3);
-            __m128 Mul05 = _mm_mul_ps(Vec3, Fac4);
-            __m128 Sub01 = _mm_sub_ps(Mul03, Mul04);
-            __m128 Add01 = _mm_add_ps(Sub01, Mul05);
-            __m128 Inv1 = _mm_mul_ps(SignA, Add01);
-
-            // col2
-            // + (Vec0[0] * Fac1[0] - Vec1[0] * Fac3[0] + Vec3[0] * Fac5[0]),
-            // - (Vec0[0] * Fac1[1] - Vec1[1] * Fac3[1] + Vec3[1] * Fac5[1]),
-            // + (Vec0[0] * Fac1[2] - Vec1[2] * Fac3[2] + Vec3[2] * Fac5[2]),
-            // - (Vec0[0] * Fac1[3] - Vec1[3] * Fac3[3] + Vec3[3] * Fac5[3]),
-            __m128 Mul06 = _mm_mul_ps(Vec0, Fac1);
-            __m128 Mul07 = _mm_mul_ps(Vec1, Fac3);
-            __m128 Mul08 = _mm_mul_ps(Vec3, Fac5);
-            __m128 Sub02 = _mm_sub_ps(Mul06, Mul07);
-            __m128 Add02 = _mm_add_ps(Sub02, Mul08);
-            __m128 Inv2 = _mm_mul_ps(SignB, Add02);
-
-            // col3
-            // - (Vec1[0] * Fac2[0] - Vec1[0] * Fac4[0] + Vec2[0] * Fac5[0]),
-            // + (Vec1[0] * Fac2[1] - Vec1[1] * Fac4[1] + Vec2[1] * Fac5[1]),
-            // - (Vec1[0] * Fac2[2] - Vec1[2] * Fac4[2] + Vec2[2] * Fac5[2]),
-            // + (Vec1[0] * Fac2[3] - Vec1[3] * Fac4[3] + Vec2[3] * Fac5[3]));
-            __m128 Mul09 = _mm_mul_ps(Vec0, Fac2);
-            __m128 Mul10 = _mm_mul_ps(Vec1, Fac4);
-            __m128 Mul11 = _mm_mul_ps(Vec2, Fac5);
-            __m128 Sub03 = _mm_sub_ps(Mul09, Mul10);
-            __m128 Add03 = _mm_add_ps(Sub03, Mul11);
-            __m128 Inv3 = _mm_mul_ps(SignA, Add03);
-
-            __m128 Row0 = _mm_shuffle_ps(Inv0, Inv1, _MM_SHUFFLE(0, 0, 0, 0));
-            __m128 Row1 = _mm_shuffle_ps(Inv2, Inv3, _MM_SHUFFLE(0, 0, 0, 0));
-            __m128 Row2 = _mm_shuffle_ps(Row0, Row1, _MM_SHUFFLE(2, 0, 2, 0));
-
-            //	valType Determinant = m[0][0] * Inverse[0][0]
-            //						+ m[0][1] * Inverse[1][0]
-            //						+ m[0][2] * Inverse[2][0]
-            //						+ m[0][3] * Inverse[3][0];
-            __m128 Det0 = Phanes::Core::Math::SIMD::vec4_dot(m1.c0.data, Row2);
-            __m128 Rcp0 = _mm_div_ps(_mm_set1_ps(1.0f), Det0);
-            //__m128 Rcp0 = _mm_rcp_ps(Det0);
-
-            //	Inverse /= Determinant;
-            r.c0.data = _mm_mul_ps(Inv0, Rcp0);
-            r.c1.data = _mm_mul_ps(Inv1, Rcp0);
-            r.c2.data = _mm_mul_ps(Inv2, Rcp0);
-            r.c3.data = _mm_mul_ps(Inv3, Rcp0);
-        }
-    };
-}
\ No newline at end of file
+                _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+                _mm_storeu_ps(v + i * 4, r0);
+                _mm_storeu_ps(v + i * 4 + 4, r1);
+                _mm_storeu_ps(v + i * 4 + 8, r2);
+                _mm_storeu_ps(v + i * 4 + 12, r3);
+            }
+        }
+    };
+}
@@ -256,6 +256,7 @@
 
 #ifdef P_FORCE_INTRINSICS
     
+#   undef __AVX512F__
 #   undef __AVX2__
 #   undef __AVX__
 #   undef __SSE__
@@ -264,8 +265,19 @@
 #       error P_INTRINSICS must be defined by the user, when P_FORCE_INTRINSICS is used.
 #   endif
 
+#elif defined(P_RUNTIME_DISPATCH)
+
+// Runtime dispatch compiles the register types against the SSE baseline. Wider kernels are selected after probing the CPU (see Dispatch.h).
+#   ifdef P_FORCE_FPU
+#       error P_RUNTIME_DISPATCH can not be used together with P_FORCE_FPU.
+#   endif
+
+#   define P_SSE__ 1
+
 #elif !defined(P_FORCE_FPU)
-#   ifdef __AVX2__
+#   if defined(__AVX512F__) && defined(__AVX512VL__) && defined(__AVX512DQ__)
+#       define P_AVX512__ 1
+#   elif defined(__AVX2__)
 #    define P_AVX2__ 1
 #   elif defined(__AVX__)
 #       define P_AVX__ 1
@@ -275,6 +287,10 @@
 
 #endif // !P_FORCE_INTRINSICS
 
+#ifdef P_AVX512__
+#   define P_AVX2__ 1
+#endif
+
 #ifdef P_AVX2__
 #   define P_AVX__ 1
 #endif
@@ -283,6 +299,11 @@
 #   define P_SSE__ 1
 #endif
 
+// Deactivate unset SIMD
+#ifndef P_AVX512__
+#   define P_AVX512__ 0
+#endif 
+
 // Deactivate unset SIMD
 #ifndef P_AVX2__
 #   define P_AVX2__ 0
@@ -301,22 +322,38 @@
 #   define P_NEON__ 0
 #endif
 
+// FMA3 is only used together with AVX2, as every AVX2 capable CPU also supports it.
+// MSVC does not define __FMA__, but allows FMA code generation with /arch:AVX2.
+#ifndef P_FMA__
+#   if P_AVX2__ && (defined(_MSC_VER) || defined(__FMA__))
+#       define P_FMA__ 1
+#   else
+#       define P_FMA__ 0
+#   endif
+#endif
+
 #define P_INTRINSICS_FPU    0
 #define P_INTRINSICS_SSE    1
 #define P_INTRINSICS_AVX    2
 #define P_INTRINSICS_AVX2   3
 #define P_INTRINSICS_NEON   4
+#define P_INTRINSICS_AVX512 5
 
 
 #if defined(P_FORCE_FPU) // Force, that no intrinsics may be used.
 #   define P_INTRINSICS P_INTRINSICS_FPU
+#   define P_AVX512__ 0
 #   define P_AVX2__ 0
 #   define P_AVX__ 0
 #   define P_SSE__ 0
 #   define P_SSE__ 0
+#   undef P_FMA__
+#   define P_FMA__ 0
 #else
 #   if (P_AVX__ == 1) && (P_AVX2__ == 0)
 #       define P_INTRINSICS P_INTRINSICS_AVX
+#   elif P_AVX512__ == 1
+#       define P_INTRINSICS P_INTRINSICS_AVX512
 #   elif P_AVX2__ == 1
 #       define P_INTRINSICS P_INTRINSICS_AVX2
 #   elif P_SSE__ == 1
@@ -328,3 +365,39 @@
 #       error No SIMD instruction set detected. Use P_FORCE_FPU to disable SIMD extensions.
 #   endif
 #endif
+
+
+// Runtime dispatch
+
+#ifdef P_RUNTIME_DISPATCH
+#   define P_DISPATCH__ 1
+#else
+#   define P_DISPATCH__ 0
+#endif
+
+// F16C support of the compile target, for the kernel table without runtime dispatch. MSVC has no switch for F16C, /arch:AVX2 implies it.
+
+#if !defined(P_FORCE_FPU) && (defined(__F16C__) || (defined(_MSC_VER) && defined(__AVX2__)))
+#   define P_F16C__ 1
+#else
+#   define P_F16C__ 0
+#endif
+
+// Allows kernels for a higher instruction set, than the one the translation unit is compiled for. 
+// MSVC does not need this, as it accepts every intrinsic regardless of /arch.
+
+#if defined(_MSC_VER)
+#   define P_TARGET_SSE
+#   define P_TARGET_AVX
+#   define P_TARGET_AVX2
+#   define P_TARGET_FMA
+#   define P_TARGET_AVX512
+#   define P_TARGET_F16C
+#else
+#   define P_TARGET_SSE    __attribute__((target("sse4.2")))
+#   define P_TARGET_AVX    __attribute__((target("avx")))
+#   define P_TARGET_AVX2   __attribute__((target("avx2")))
+#   define P_TARGET_FMA    __attribute__((target("avx2,fma")))
+#   define P_TARGET_AVX512 __attribute__((target("avx512f,avx512vl,avx512dq")))
+#   define P_TARGET_F16C   __attribute__((target("avx,f16c")))
+#endif
@@ -3,7 +3,9 @@
 
 #include "Core/public/Math/SIMD/Platform.h"
 
-#if P_INTRINSICS == P_INTRINSICS_AVX2
+#if P_INTRINSICS == P_INTRINSICS_AVX512
+#   include "PhanesVectorMathAVX512.hpp"
+#elif P_INTRINSICS == P_INTRINSICS_AVX2
 #   include "PhanesVectorMathAVX2.hpp"
 #elif P_INTRINSICS == P_INTRINSICS_AVX
 #   include "PhanesVectorMathAVX.hpp"
@@ -11,5 +13,7 @@
 #   include "PhanesVectorMathSSE.hpp"
 #elif P_INTRINSICS == P_INTRINSICS_NEON
 #   include "PhanesVectorMathNeon.hpp"
+#elif P_INTRINSICS == P_INTRINSICS_FPU
+#   include "PhanesVectorMathFPU.hpp"
 #endif
 
@@ -0,0 +1,86 @@
+#pragma once
+
+// Skinning of vertex arrays on the CPU. Kernels are selected through SIMD/Dispatch.h.
+//
+// Positions and normals are planar structure of arrays: x, y and z of vertex i are at v[i], v[pitch + i] and v[2 * pitch + i].
+// Every vertex has SkinInfluences bone influences, stored interleaved as bones[i * SkinInfluences + k] and weights[i * SkinInfluences + k].
+// Unused influences have weight 0 and any valid bone index. Output streams may alias the input streams.
+//
+// Linear blend skinning takes TMatrix4<float> palettes, or packed affine palettes of 12 floats per bone (the upper 3x4 block, column major).
+
+#include <cstddef>
+#include <cstdint>
+
+#include "Core/public/Math/Boilerplate.h"
+#include "Core/public/Math/SIMD/Dispatch.h"
+
+#include "Core/public/Math/Matrix4.hpp"
+#include "Core/public/Math/DualQuaternion.hpp"
+
+
+namespace Phanes::Core::Math
+{
+    static_assert(sizeof(TDualQuaternion<float, false>) == 8 * sizeof(float), "TDualQuaternion<float> must be tightly packed.");
+    static_assert(sizeof(TMatrix4<float, true>) == 16 * sizeof(float), "TMatrix4<float> must be tightly packed.");
+
+    /// <summary>
+    /// Number of bone influences per vertex.
+    /// </summary>
+    constexpr size_t SkinInfluences = SIMD::FPU::SkinInfluences;
+
+    /// <summary>
+    /// Skins vertices with dual quaternion linear blending. The blended transform stays rigid, so joints do not collapse when twisted.
+    /// </summary>
+    /// <param name="rp">Skinned positions</param>
+    /// <param name="rn">Skinned normals, or nullptr</param>
+    /// <param name="p">Bind pose positions</param>
+    /// <param name="nrm">Bind pose normals, or nullptr (if rn is nullptr)</param>
+    /// <param name="bones">Bone indices (SkinInfluences per vertex)</param>
+    /// <param name="weights">Bone weights (SkinInfluences per vertex, summing to 1)</param>
+    /// <param name="palette">Unit dual quaternions from bind pose to pose per bone</param>
+    /// <param name="n">Number of vertices</param>
+    /// <param name="pitch">Distance between the x, y and z arrays of the vertex streams in floats (at least n)</param>
+    template<bool S>
+    void BatchSkinDualQuaternion(float* rp, float* rn, const float* p, const float* nrm, const uint32_t* bones, const float* weights,
+                                 const TDualQuaternion<float, S>* palette, size_t n, size_t pitch)
+    {
+        SIMD::GetDispatchTable().dq_skin_array(rp, (nrm != nullptr) ? rn : nullptr, p, (rn != nullptr) ? nrm : nullptr, bones, weights, &palette->real.x, n, pitch);
+    }
+
+    /// <summary>
+    /// Skins vertices with linearly blended bone matrices. Normals are transformed by the blended matrix and renormalized, so palettes should not contain non uniform scale.
+    /// </summary>
+    /// <param name="rp">Skinned positions</param>
+    /// <param name="rn">Skinned normals, or nullptr</param>
+    /// <param name="p">Bind pose positions</param>
+    /// <param name="nrm">Bind pose normals, or nullptr (if rn is nullptr)</param>
+    /// <param name="bones">Bone indices (SkinInfluences per vertex)</param>
+    /// <param name="weights">Bone weights (SkinInfluences per vertex, summing to 1)</param>
+    /// <param name="palette">Affine matrices from bind pose to pose per bone. The last row is ignored.</param>
+    /// <param name="n">Number of vertices</param>
+    /// <param name="pitch">Distance between the x, y and z arrays of the vertex streams in floats (at least n)</param>
+    template<bool S>
+    void BatchSkinLinear(float* rp, float* rn, const float* p, const float* nrm, const uint32_t* bones, const float* weights,
+                         const TMatrix4<float, S>* palette, size_t n, size_t pitch)
+    {
+        SIMD::GetDispatchTable().lbs_skin_array(rp, (nrm != nullptr) ? rn : nullptr, p, (rn != nullptr) ? nrm : nullptr, bones, weights, &palette->data[0][0], 4, n, pitch);
+    }
+
+    /// <summary>
+    /// Skins vertices with linearly blended bone matrices, taken from a packed affine palette.
+    /// </summary>
+    /// <param name="rp">Skinned positions</param>
+    /// <param name="rn">Skinned normals, or nullptr</param>
+    /// <param name="p">Bind pose positions</param>
+    /// <param name="nrm">Bind pose normals, or nullptr (if rn is nullptr)</param>
+    /// <param name="bones">Bone indices (SkinInfluences per vertex)</param>
+    /// <param name="weights">Bone weights (SkinInfluences per vertex, summing to 1)</param>
+    /// <param name="palette">12 floats per bone: the four columns of the upper 3x4 block of the affine matrix</param>
+    /// <param name="n">Number of vertices</param>
+    /// <param name="pitch">Distance between the x, y and z arrays of the vertex streams in floats (at least n)</param>
+    inline void BatchSkinLinearAffine(float* rp, float* rn, const float* p, const float* nrm, const uint32_t* bones, const float* weights,
+                                      const float* palette, size_t n, size_t pitch)
+    {
+        SIMD::GetDispatchTable().lbs_skin_array(rp, (nrm != nullptr) ? rn : nullptr, p, (rn != nullptr) ? nrm : nullptr, bones, weights, palette, 3, n, pitch);
+    }
+}
@@ -0,0 +1,200 @@
+#pragma once
+
+// Sphere, defined by its center and radius.
+
+#include "Core/public/Math/Boilerplate.h"
+
+#include "Core/public/Math/MathCommon.hpp"
+#include "Core/public/Math/MathFwd.h"
+
+#include "Core/public/Math/Vector3.hpp"
+#include "Core/public/Math/Ray.hpp"
+#include "Core/public/Math/AABB.hpp"
+
+
+#ifndef SPHERE_H
+#define SPHERE_H
+
+namespace Phanes::Core::Math {
+
+    /// <summary>
+    /// Sphere.
+    /// </summary>
+    /// <typeparam name="T">Type of sphere</typeparam>
+    /// <typeparam name="S">Vector type is aligned</typeparam>
+    template<RealType T, bool S>
+    struct TSphere
+    {
+    public:
+
+        using Real = T;
+
+        /// <summary>
+        /// Center
+        /// </summary>
+        TVector3<Real, S> center;
+
+        /// <summary>
+        /// Radius
+        /// </summary>
+        Real radius;
+
+    public:
+
+        /// Default constructor
+        TSphere() = default;
+
+        /// <summary>
+        /// Construct sphere from center and radius.
+        /// </summary>
+        /// <param name="_center">Center</param>
+        /// <param name="_radius">Radius</param>
+        TSphere(const TVector3<Real, S>& _center, Real _radius)
+        {
+            this->center = _center;
+            this->radius = _radius;
+        }
+    };
+
+
+    // ===================== //
+    //   TSphere functions   //
+    // ===================== //
+
+
+    namespace Detail
+    {
+        // Squared distance of two points.
+        template<RealType T, bool S>
+        FORCEINLINE T sphere_sqr_distance(const TVector3<T, S>& p1, const TVector3<T, S>& p2)
+        {
+            const T x = p1.x - p2.x;
+            const T y = p1.y - p2.y;
+            const T z = p1.z - p2.z;
+
+            return x * x + y * y + z * z;
+        }
+    }
+
+    /// <summary>
+    /// Gets the smallest box containing the sphere.
+    /// </summary>
+    template<RealType T, bool S>
+    FORCEINLINE TAABB<T, S> GetAABB(const TSphere<T, S>& s1)
+    {
+        return TAABB<T, S>(TVector3<T, S>(s1.center.x - s1.radius, s1.center.y - s1.radius, s1.center.z - s1.radius),
+                           TVector3<T, S>(s1.center.x + s1.radius, s1.center.y + s1.radius, s1.center.z + s1.radius));
+    }
+
+    /// <summary>
+    /// Tests whether a point is inside the sphere or on its surface.
+    /// </summary>
+    template<RealType T, bool S>
+    FORCEINLINE bool Contains(const TSphere<T, S>& s1, const TVector3<T, S>& p1)
+    {
+        return Detail::sphere_sqr_distance(s1.center, p1) <= s1.radius * s1.radius;
+    }
+
+    /// <summary>
+    /// Tests whether two spheres overlap. Touching spheres overlap.
+    /// </summary>
+    template<RealType T, bool S>
+    FORCEINLINE bool Overlaps(const TSphere<T, S>& s1, const TSphere<T, S>& s2)
+    {
+        const T r = s1.radius + s2.radius;
+        return Detail::sphere_sqr_distance(s1.center, s2.center) <= r * r;
+    }
+
+    /// <summary>
+    /// Tests whether a sphere and a box overlap.
+    /// </summary>
+    template<RealType T, bool S>
+    FORCEINLINE bool Overlaps(const TSphere<T, S>& s1, const TAABB<T, S>& b1)
+    {
+        // Closest point of the box to the center.
+        const TVector3<T, S> p1(Clamp(s1.center.x, b1.min.x, b1.max.x),
+                                Clamp(s1.center.y, b1.min.y, b1.max.y),
+                                Clamp(s1.center.z, b1.min.z, b1.max.z));
+
+        return Contains(s1, p1);
+    }
+
+    /// <summary>
+    /// Tests whether a box and a sphere overlap.
+    /// </summary>
+    template<RealType T, bool S>
+    FORCEINLINE bool Overlaps(const TAABB<T, S>& b1, const TSphere<T, S>& s1)
+    {
+        return Overlaps(s1, b1);
+    }
+
+    /// <summary>
+    /// Gets the smallest sphere containing both spheres.
+    /// </summary>
+    template<RealType T, bool S>
+    TSphere<T, S> Merge(const TSphere<T, S>& s1, const TSphere<T, S>& s2)
+    {
+        const T d = sqrt(Detail::sphere_sqr_distance(s1.center, s2.center));
+
+        // One sphere contains the other.
+        if (d + s2.radius <= s1.radius)
+        {
+            return s1;
+        }
+        if (d + s1.radius <= s2.radius)
+        {
+            return s2;
+        }
+
+        const T r = (d + s1.radius + s2.radius) * (T)0.5;
+        const T t = (r - s1.radius) / d;
+
+        return TSphere<T, S>(TVector3<T, S>(s1.center.x + (s2.center.x - s1.center.x) * t,
+                                            s1.center.y + (s2.center.y - s1.center.y) * t,
+                                            s1.center.z + (s2.center.z - s1.center.z) * t), r);
+    }
+
+    /// <summary>
+    /// Intersects a ray with the sphere.
+    /// </summary>
+    /// <param name="s1">Sphere</param>
+    /// <param name="r1">Ray</param>
+    /// <param name="t">Smallest ray parameter of the intersection, that is not negative. 0, if the origin is inside.</param>
+    /// <returns>True, if the ray hits the sphere.</returns>
+    template<RealType T, bool S>
+    bool RayIntersect(const TSphere<T, S>& s1, const TRay<T, S>& r1, T& t)
+    {
+        const T ox = r1.origin.x - s1.center.x;
+        const T oy = r1.origin.y - s1.center.y;
+        const T oz = r1.origin.z - s1.center.z;
+
+        const T a = r1.direction.x * r1.direction.x + r1.direction.y * r1.direction.y + r1.direction.z * r1.direction.z;
+        const T b = ox * r1.direction.x + oy * r1.direction.y + oz * r1.direction.z;
+        const T c = ox * ox + oy * oy + oz * oz - s1.radius * s1.radius;
+
+        // Origin inside the sphere.
+        if (c <= (T)0.0)
+        {
+            t = (T)0.0;
+            return true;
+        }
+
+        // Origin outside and pointing away, or parallel.
+        if (b >= (T)0.0 || a < (T)P_FLT_INAC)
+        {
+            return false;
+        }
+
+        const T disc = b * b - a * c;
+        if (disc < (T)0.0)
+        {
+            return false;
+        }
+
+        t = (-b - sqrt(disc)) / a;
+        return true;
+    }
+
+} // Phanes::Core::Math
+
+#endif // !SPHERE_H
@@ -0,0 +1,259 @@
+#pragma once
+
+// Transform made of translation, rotation and scale, applied in the order scale, rotation, translation (M = T * R * S).
+//
+// TTransform is a plain value. The local to world and world to local matrices of whole hierarchies are cached by TTransformHierarchy (TransformHierarchy.hpp).
+
+#include "Core/public/Math/Boilerplate.h"
+#include "Core/public/Math/MathCommon.hpp"
+
+#include "Core/public/Math/MathFwd.h"
+
+#include "Core/public/Math/Vector3.hpp"
+#include "Core/public/Math/Matrix4.hpp"
+#include "Core/public/Math/Quaternion.hpp"
+
+
+#ifndef TRANSFORM_H
+#define TRANSFORM_H
+
+namespace Phanes::Core::Math
+{
+
+    /// <summary>
+    /// Translation, rotation and scale.
+    /// </summary>
+    /// <typeparam name="T">Type of transform</typeparam>
+    /// <typeparam name="S">Vector types are aligned</typeparam>
+    template<RealType T, bool S = false>
+    struct TTransform
+    {
+    public:
+
+        using Real = T;
+
+        /// <summary>
+        /// Translation
+        /// </summary>
+        TVector3<Real, S> location;
+
+        /// <summary>
+        /// Rotation (unit quaternion)
+        /// </summary>
+        TQuaternion<Real, S> rotation;
+
+        /// <summary>
+        /// Scale per axis. Components must not be 0 for the inverse transforms.
+        /// </summary>
+        TVector3<Real, S> scale;
+
+    public:
+
+        /// Default constructor
+        TTransform() = default;
+
+        /// <summary>
+        /// Construct transform from translation, rotation and scale.
+        /// </summary>
+        /// <param name="location">Translation</param>
+        /// <param name="rotation">Rotation (unit quaternion)</param>
+        /// <param name="scale">Scale per axis</param>
+        TTransform(const TVector3<Real, S>& location, const TQuaternion<Real, S>& rotation, const TVector3<Real, S>& scale) :
+            location(location),
+            rotation(rotation),
+            scale(scale)
+        {}
+
+        /// <summary>
+        /// Gets the identity transform.
+        /// </summary>
+        static TTransform<Real, S> Identity()
+        {
+            return TTransform<Real, S>(TVector3<Real, S>((Real)0.0, (Real)0.0, (Real)0.0), TQuaternion<Real, S>::Identity(), TVector3<Real, S>((Real)1.0, (Real)1.0, (Real)1.0));
+        }
+    };
+
+
+    namespace Detail
+    {
+        // Builds T * R * S from its components.
+        template<RealType T, bool S>
+        FORCEINLINE void transform_trs_matrix(TMatrix4<T, S>& r, T px, T py, T pz, T qx, T qy, T qz, T qw, T sx, T sy, T sz)
+        {
+            const T xx = qx * qx, yy = qy * qy, zz = qz * qz;
+            const T xy = qx * qy, xz = qx * qz, yz = qy * qz;
+            const T wx = qw * qx, wy = qw * qy, wz = qw * qz;
+
+            r = TMatrix4<T, S>(((T)1.0 - (T)2.0 * (yy + zz)) * sx, (T)2.0 * (xy - wz) * sy, (T)2.0 * (xz + wy) * sz, px,
+                               (T)2.0 * (xy + wz) * sx, ((T)1.0 - (T)2.0 * (xx + zz)) * sy, (T)2.0 * (yz - wx) * sz, py,
+                               (T)2.0 * (xz - wy) * sx, (T)2.0 * (yz + wx) * sy, ((T)1.0 - (T)2.0 * (xx + yy)) * sz, pz,
+                               (T)0.0, (T)0.0, (T)0.0, (T)1.0);
+        }
+
+        // Builds the inverse of T * R * S, which is S^-1 * R^T * T^-1. Needs no general matrix inversion.
+        template<RealType T, bool S>
+        FORCEINLINE void transform_trs_inverse_matrix(TMatrix4<T, S>& r, T px, T py, T pz, T qx, T qy, T qz, T qw, T sx, T sy, T sz)
+        {
+            const T xx = qx * qx, yy = qy * qy, zz = qz * qz;
+            const T xy = qx * qy, xz = qx * qz, yz = qy * qz;
+            const T wx = qw * qx, wy = qw * qy, wz = qw * qz;
+
+            const T isx = (T)1.0 / sx;
+            const T isy = (T)1.0 / sy;
+            const T isz = (T)1.0 / sz;
+
+            // Rows of R^T, scaled by 1 / s.
+            const T r00 = ((T)1.0 - (T)2.0 * (yy + zz)) * isx, r01 = (T)2.0 * (xy + wz) * isx, r02 = (T)2.0 * (xz - wy) * isx;
+            const T r10 = (T)2.0 * (xy - wz) * isy, r11 = ((T)1.0 - (T)2.0 * (xx + zz)) * isy, r12 = (T)2.0 * (yz + wx) * isy;
+            const T r20 = (T)2.0 * (xz + wy) * isz, r21 = (T)2.0 * (yz - wx) * isz, r22 = ((T)1.0 - (T)2.0 * (xx + yy)) * isz;
+
+            r = TMatrix4<T, S>(r00, r01, r02, -(r00 * px + r01 * py + r02 * pz),
+                               r10, r11, r12, -(r10 * px + r11 * py + r12 * pz),
+                               r20, r21, r22, -(r20 * px + r21 * py + r22 * pz),
+                               (T)0.0, (T)0.0, (T)0.0, (T)1.0);
+        }
+    }
+
+
+    // ======================== //
+    //   TTransform functions   //
+    // ======================== //
+
+
+    /// <summary>
+    /// Gets the local to world matrix (T * R * S).
+    /// </summary>
+    /// <param name="tr">Transform</param>
+    /// <returns>Affine matrix</returns>
+    template<RealType T, bool S>
+    TMatrix4<T, S> ToMatrix4(const TTransform<T, S>& tr)
+    {
+        TMatrix4<T, S> r;
+        Detail::transform_trs_matrix(r, tr.location.x, tr.location.y, tr.location.z,
+                                     tr.rotation.x, tr.rotation.y, tr.rotation.z, tr.rotation.w,
+                                     tr.scale.x, tr.scale.y, tr.scale.z);
+        return r;
+    }
+
+    /// <summary>
+    /// Gets the world to local matrix (S^-1 * R^T * T^-1).
+    /// </summary>
+    /// <param name="tr">Transform (scale not 0)</param>
+    /// <returns>Affine matrix</returns>
+    template<RealType T, bool S>
+    TMatrix4<T, S> ToInverseMatrix4(const TTransform<T, S>& tr)
+    {
+        TMatrix4<T, S> r;
+        Detail::transform_trs_inverse_matrix(r, tr.location.x, tr.location.y, tr.location.z,
+                                             tr.rotation.x, tr.rotation.y, tr.rotation.z, tr.rotation.w,
+                                             tr.scale.x, tr.scale.y, tr.scale.z);
+        return r;
+    }
+
+    /// <summary>
+    /// Transforms a point.
+    /// </summary>
+    /// <param name="tr">Transform</param>
+    /// <param name="p1">Point</param>
+    /// <returns>Transformed point</returns>
+    template<RealType T, bool S>
+    TVector3<T, S> TransformPoint(const TTransform<T, S>& tr, const TVector3<T, S>& p1)
+    {
+        return Rotate(tr.rotation, p1 * tr.scale) + tr.location;
+    }
+
+    /// <summary>
+    /// Transforms a direction. Translation does not apply.
+    /// </summary>
+    /// <param name="tr">Transform</param>
+    /// <param name="v1">Direction</param>
+    /// <returns>Transformed direction (not normalized)</returns>
+    template<RealType T, bool S>
+    TVector3<T, S> TransformDirection(const TTransform<T, S>& tr, const TVector3<T, S>& v1)
+    {
+        return Rotate(tr.rotation, v1 * tr.scale);
+    }
+
+    /// <summary>
+    /// Transforms a point back into the space of the transform.
+    /// </summary>
+    /// <param name="tr">Transform (scale not 0)</param>
+    /// <param name="p1">Point</param>
+    /// <returns>Point in local space</returns>
+    template<RealType T, bool S>
+    TVector3<T, S> InverseTransformPoint(const TTransform<T, S>& tr, const TVector3<T, S>& p1)
+    {
+        const TVector3<T, S> v = Rotate(Conjugate(tr.rotation), p1 - tr.location);
+        return TVector3<T, S>(v.x / tr.scale.x, v.y / tr.scale.y, v.z / tr.scale.z);
+    }
+
+    /// <summary>
+    /// Transforms a direction back into the space of the transform.
+    /// </summary>
+    /// <param name="tr">Transform (scale not 0)</param>
+    /// <param name="v1">Direction</param>
+    /// <returns>Direction in local space (not normalized)</returns>
+    template<RealType T, bool S>
+    TVector3<T, S> InverseTransformDirection(const TTransform<T, S>& tr, const TVector3<T, S>& v1)
+    {
+        const TVector3<T, S> v = Rotate(Conjugate(tr.rotation), v1);
+        return TVector3<T, S>(v.x / tr.scale.x, v.y / tr.scale.y, v.z / tr.scale.z);
+    }
+
+    /// <summary>
+    /// Concatenates two transforms, so that child is applied first.
+    /// </summary>
+    /// <param name="parent">Outer transform</param>
+    /// <param name="child">Inner transform</param>
+    /// <returns>Combined transform</returns>
+    /// <remarks>Non uniform parent scale with a rotated child produces shear, which a TTransform can not hold. The scales are multiplied per axis then. Use the matrices for exact results.</remarks>
+    template<RealType T, bool S>
+    TTransform<T, S> Combine(const TTransform<T, S>& parent, const TTransform<T, S>& child)
+    {
+        return TTransform<T, S>(TransformPoint(parent, child.location), Normalize(parent.rotation * child.rotation), parent.scale * child.scale);
+    }
+
+    /// <summary>
+    /// Interpolates two transforms. Locations and scales are interpolated linearly, rotations spherically.
+    /// </summary>
+    /// <param name="tr1">Start transform</param>
+    /// <param name="tr2">Destination transform</param>
+    /// <param name="t">Interpolation value (clamped between 0.0 and 1.0)</param>
+    /// <returns>Interpolated transform</returns>
+    template<RealType T, bool S>
+    TTransform<T, S> Lerp(const TTransform<T, S>& tr1, const TTransform<T, S>& tr2, T t)
+    {
+        t = Clamp(t, (T)0.0, (T)1.0);
+
+        return TTransform<T, S>(tr1.location + (tr2.location - tr1.location) * t,
+                                Slerp(tr1.rotation, tr2.rotation, t),
+                                tr1.scale + (tr2.scale - tr1.scale) * t);
+    }
+
+    /// <summary>
+    /// Tests two transforms for equality.
+    /// </summary>
+    /// <param name="tr1">Transform one</param>
+    /// <param name="tr2">Transform two</param>
+    /// <returns>True, if all components are equal within P_FLT_INAC.</returns>
+    template<RealType T, bool S>
+    bool operator== (const TTransform<T, S>& tr1, const TTransform<T, S>& tr2)
+    {
+        return tr1.location == tr2.location && tr1.rotation == tr2.rotation && tr1.scale == tr2.scale;
+    }
+
+    /// <summary>
+    /// Tests two transforms for inequality.
+    /// </summary>
+    /// <param name="tr1">Transform one</param>
+    /// <param name="tr2">Transform two</param>
+    /// <returns>True, if any component differs by P_FLT_INAC or more.</returns>
+    template<RealType T, bool S>
+    bool operator!= (const TTransform<T, S>& tr1, const TTransform<T, S>& tr2)
+    {
+        return !(tr1 == tr2);
+    }
+
+} // Phanes::Core::Math
+
+#endif // !TRANSFORM_H
@@ -0,0 +1,285 @@
+#pragma once
+
+// Hierarchy of transforms with cached local to world and world to local matrices.
+//
+// Local transforms are stored as structure of arrays, one array per component. Parents always have smaller indices than their children,
+// so one forward pass over the arrays updates a whole hierarchy: A node is recomputed, if it was changed itself or its parent was recomputed in the same pass.
+// The pass starts at the first changed node, and clean nodes only cost reading two flags.
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "Core/public/Math/Boilerplate.h"
+
+#include "Core/public/Math/MathCommon.hpp"
+#include "Core/public/Math/MathFwd.h"
+
+#include "Core/public/Math/Matrix4.hpp"
+#include "Core/public/Math/Quaternion.hpp"
+#include "Core/public/Math/Transform.hpp"
+
+
+#ifndef TRANSFORMHIERARCHY_H
+#define TRANSFORMHIERARCHY_H
+
+namespace Phanes::Core::Math {
+
+    /// <summary>
+    /// Transforms ordered parent before child.
+    /// </summary>
+    /// <typeparam name="T">Type of transforms</typeparam>
+    /// <typeparam name="S">Matrix type is aligned</typeparam>
+    template<RealType T, bool S>
+    struct TTransformHierarchy
+    {
+    public:
+
+        using Real = T;
+
+        /// <summary>
+        /// Parent of root nodes.
+        /// </summary>
+        static constexpr uint32_t NoParent = 0xFFFFFFFFu;
+
+        /// <summary>
+        /// Parent index per node (smaller than the node index), or NoParent.
+        /// </summary>
+        std::vector<uint32_t> parents;
+
+        /// <summary>
+        /// Local translations
+        /// </summary>
+        std::vector<Real> locationX, locationY, locationZ;
+
+        /// <summary>
+        /// Local rotations
+        /// </summary>
+        std::vector<Real> rotationX, rotationY, rotationZ, rotationW;
+
+        /// <summary>
+        /// Local scales
+        /// </summary>
+        std::vector<Real> scaleX, scaleY, scaleZ;
+
+        /// <summary>
+        /// Cached local to world matrices. Valid after UpdateTransforms.
+        /// </summary>
+        std::vector<TMatrix4<Real, S>> localToWorld;
+
+        /// <summary>
+        /// Cached world to local matrices. Valid after UpdateTransforms.
+        /// </summary>
+        std::vector<TMatrix4<Real, S>> worldToLocal;
+
+        /// <summary>
+        /// Set for nodes, whose local transform changed since the last update.
+        /// </summary>
+        std::vector<uint8_t> dirty;
+
+        /// <summary>
+        /// Smallest dirty index, or the number of nodes if none is dirty.
+        /// </summary>
+        size_t firstDirty = 0;
+
+    public:
+
+        /// Default constructor
+        TTransformHierarchy() = default;
+    };
+
+
+    // ================================= //
+    //   TTransformHierarchy functions   //
+    // ================================= //
+
+
+    /// <summary>
+    /// Gets the number of nodes.
+    /// </summary>
+    /// <param name="h">Hierarchy</param>
+    template<RealType T, bool S>
+    FORCEINLINE size_t GetSize(const TTransformHierarchy<T, S>& h)
+    {
+        return h.parents.size();
+    }
+
+    /// <summary>
+    /// Reserves memory for n nodes.
+    /// </summary>
+    /// <param name="h">Hierarchy</param>
+    /// <param name="n">Number of nodes</param>
+    template<RealType T, bool S>
+    void ReserveTransforms(TTransformHierarchy<T, S>& h, size_t n)
+    {
+        h.parents.reserve(n);
+        h.locationX.reserve(n); h.locationY.reserve(n); h.locationZ.reserve(n);
+        h.rotationX.reserve(n); h.rotationY.reserve(n); h.rotationZ.reserve(n); h.rotationW.reserve(n);
+        h.scaleX.reserve(n); h.scaleY.reserve(n); h.scaleZ.reserve(n);
+        h.localToWorld.reserve(n);
+        h.worldToLocal.reserve(n);
+        h.dirty.reserve(n);
+    }
+
+    /// <summary>
+    /// Sets the local transform of a node and marks it dirty.
+    /// </summary>
+    /// <param name="h">Hierarchy</param>
+    /// <param name="i">Node index</param>
+    /// <param name="local">Transform relative to the parent</param>
+    template<RealType T, bool S>
+    void SetLocalTransform(TTransformHierarchy<T, S>& h, uint32_t i, const TTransform<T, S>& local)
+    {
+        h.locationX[i] = local.location.x;
+        h.locationY[i] = local.location.y;
+        h.locationZ[i] = local.location.z;
+
+        h.rotationX[i] = local.rotation.x;
+        h.rotationY[i] = local.rotation.y;
+        h.rotationZ[i] = local.rotation.z;
+        h.rotationW[i] = local.rotation.w;
+
+        h.scaleX[i] = local.scale.x;
+        h.scaleY[i] = local.scale.y;
+        h.scaleZ[i] = local.scale.z;
+
+        h.dirty[i] = 1;
+        h.firstDirty = Min(h.firstDirty, (size_t)i);
+    }
+
+    /// <summary>
+    /// Gets the local transform of a node.
+    /// </summary>
+    /// <param name="h">Hierarchy</param>
+    /// <param name="i">Node index</param>
+    /// <returns>Transform relative to the parent</returns>
+    template<RealType T, bool S>
+    TTransform<T, S> GetLocalTransform(const TTransformHierarchy<T, S>& h, uint32_t i)
+    {
+        return TTransform<T, S>(TVector3<T, S>(h.locationX[i], h.locationY[i], h.locationZ[i]),
+                                TQuaternion<T, S>(h.rotationX[i], h.rotationY[i], h.rotationZ[i], h.rotationW[i]),
+                                TVector3<T, S>(h.scaleX[i], h.scaleY[i], h.scaleZ[i]));
+    }
+
+    /// <summary>
+    /// Appends a node.
+    /// </summary>
+    /// <param name="h">Hierarchy</param>
+    /// <param name="local">Transform relative to the parent</param>
+    /// <param name="parent">Index of an existing node, or NoParent. Other indices add a root node.</param>
+    /// <returns>Index of the new node. Indices stay valid, as nodes are never reordered.</returns>
+    template<RealType T, bool S>
+    uint32_t AddTransform(TTransformHierarchy<T, S>& h, const TTransform<T, S>& local, uint32_t parent = TTransformHierarchy<T, S>::NoParent)
+    {
+        const uint32_t i = (uint32_t)h.parents.size();
+
+        h.parents.push_back((parent < i) ? parent : TTransformHierarchy<T, S>::NoParent);
+
+        h.locationX.push_back(local.location.x);
+        h.locationY.push_back(local.location.y);
+        h.locationZ.push_back(local.location.z);
+
+        h.rotationX.push_back(local.rotation.x);
+        h.rotationY.push_back(local.rotation.y);
+        h.rotationZ.push_back(local.rotation.z);
+        h.rotationW.push_back(local.rotation.w);
+
+        h.scaleX.push_back(local.scale.x);
+        h.scaleY.push_back(local.scale.y);
+        h.scaleZ.push_back(local.scale.z);
+
+        h.localToWorld.emplace_back();
+        h.worldToLocal.emplace_back();
+
+        h.dirty.push_back(1);
+        h.firstDirty = Min(h.firstDirty, (size_t)i);
+
+        return i;
+    }
+
+    /// <summary>
+    /// Attaches a node to another parent. The local transform is kept, so the node moves in world space.
+    /// </summary>
+    /// <param name="h">Hierarchy</param>
+    /// <param name="i">Node index</param>
+    /// <param name="parent">New parent (smaller than i), or NoParent</param>
+    /// <returns>False, if parent does not precede i. The hierarchy is not changed then.</returns>
+    template<RealType T, bool S>
+    bool SetParent(TTransformHierarchy<T, S>& h, uint32_t i, uint32_t parent)
+    {
+        if (parent != TTransformHierarchy<T, S>::NoParent && parent >= i)
+        {
+            return false;
+        }
+
+        h.parents[i] = parent;
+        h.dirty[i] = 1;
+        h.firstDirty = Min(h.firstDirty, (size_t)i);
+
+        return true;
+    }
+
+    /// <summary>
+    /// Recomputes the cached matrices of all dirty nodes and their descendants.
+    /// </summary>
+    /// <param name="h">Hierarchy</param>
+    template<RealType T, bool S>
+    void UpdateTransforms(TTransformHierarchy<T, S>& h)
+    {
+        constexpr uint32_t noParent = TTransformHierarchy<T, S>::NoParent;
+
+        const size_t n = h.parents.size();
+        const size_t first = h.firstDirty;
+
+        if (first >= n)
+        {
+            return;
+        }
+
+        const uint32_t* parents = h.parents.data();
+        uint8_t* dirty = h.dirty.data();
+
+        TMatrix4<T, S> local;
+        TMatrix4<T, S> localInv;
+
+        for (size_t i = first; i < n; ++i)
+        {
+            const uint32_t p = parents[i];
+
+            // Parents precede their children, so dirty[p] is final here.
+            if (!dirty[i] && (p == noParent || !dirty[p]))
+            {
+                continue;
+            }
+
+            dirty[i] = 1;
+
+            Detail::transform_trs_matrix(local, h.locationX[i], h.locationY[i], h.locationZ[i],
+                                         h.rotationX[i], h.rotationY[i], h.rotationZ[i], h.rotationW[i],
+                                         h.scaleX[i], h.scaleY[i], h.scaleZ[i]);
+
+            Detail::transform_trs_inverse_matrix(localInv, h.locationX[i], h.locationY[i], h.locationZ[i],
+                                                 h.rotationX[i], h.rotationY[i], h.rotationZ[i], h.rotationW[i],
+                                                 h.scaleX[i], h.scaleY[i], h.scaleZ[i]);
+
+            if (p == noParent)
+            {
+                h.localToWorld[i] = local;
+                h.worldToLocal[i] = localInv;
+            }
+            else
+            {
+                h.localToWorld[i] = h.localToWorld[p] * local;
+                h.worldToLocal[i] = localInv * h.worldToLocal[p];
+            }
+        }
+
+        std::memset(dirty + first, 0, n - first);
+        h.firstDirty = n;
+    }
+
+} // Phanes::Core::Math
+
+#endif // !TRANSFORMHIERARCHY_H
@@ -0,0 +1,187 @@
+#pragma once
+
+// Triangle, defined by its three vertices. Counter clockwise winding, when looking at the front face.
+//
+// Blocks of triangles are intersected with TrianglePacket.hpp.
+
+#include <limits>
+
+#include "Core/public/Math/Boilerplate.h"
+
+#include "Core/public/Math/MathCommon.hpp"
+#include "Core/public/Math/MathFwd.h"
+
+#include "Core/public/Math/Vector3.hpp"
+#include "Core/public/Math/Ray.hpp"
+#include "Core/public/Math/AABB.hpp"
+
+
+#ifndef TRIANGLE_H
+#define TRIANGLE_H
+
+namespace Phanes::Core::Math {
+
+    /// <summary>
+    /// Triangle.
+    /// </summary>
+    /// <typeparam name="T">Type of triangle</typeparam>
+    /// <typeparam name="S">Vector type is aligned</typeparam>
+    template<RealType T, bool S>
+    struct TTriangle
+    {
+    public:
+
+        using Real = T;
+
+        /// <summary>
+        /// First vertex
+        /// </summary>
+        TVector3<Real, S> v0;
+
+        /// <summary>
+        /// Second vertex
+        /// </summary>
+        TVector3<Real, S> v1;
+
+        /// <summary>
+        /// Third vertex
+        /// </summary>
+        TVector3<Real, S> v2;
+
+    public:
+
+        /// Default constructor
+        TTriangle() = default;
+
+        /// <summary>
+        /// Construct triangle from its vertices.
+        /// </summary>
+        TTriangle(const TVector3<Real, S>& _v0, const TVector3<Real, S>& _v1, const TVector3<Real, S>& _v2)
+        {
+            this->v0 = _v0;
+            this->v1 = _v1;
+            this->v2 = _v2;
+        }
+    };
+
+
+    // ======================= //
+    //   TTriangle functions   //
+    // ======================= //
+
+
+    /// <summary>
+    /// Gets the unnormalized normal (v1 - v0) x (v2 - v0). Its length is twice the area.
+    /// </summary>
+    template<RealType T, bool S>
+    TVector3<T, S> GetNormal(const TTriangle<T, S>& tr1)
+    {
+        const T e1x = tr1.v1.x - tr1.v0.x, e1y = tr1.v1.y - tr1.v0.y, e1z = tr1.v1.z - tr1.v0.z;
+        const T e2x = tr1.v2.x - tr1.v0.x, e2y = tr1.v2.y - tr1.v0.y, e2z = tr1.v2.z - tr1.v0.z;
+
+        return TVector3<T, S>(e1y * e2z - e1z * e2y, e1z * e2x - e1x * e2z, e1x * e2y - e1y * e2x);
+    }
+
+    /// <summary>
+    /// Gets the smallest box containing the triangle.
+    /// </summary>
+    template<RealType T, bool S>
+    TAABB<T, S> GetAABB(const TTriangle<T, S>& tr1)
+    {
+        TAABB<T, S> b(tr1.v0, tr1.v0);
+        EncapsulateV(b, tr1.v1);
+        return EncapsulateV(b, tr1.v2);
+    }
+
+    /// <summary>
+    /// Gets the point at barycentric coordinates u (weight of v1) and v (weight of v2).
+    /// </summary>
+    template<RealType T, bool S>
+    TVector3<T, S> PointAt(const TTriangle<T, S>& tr1, T u, T v)
+    {
+        const T w = (T)1.0 - u - v;
+
+        return TVector3<T, S>(tr1.v0.x * w + tr1.v1.x * u + tr1.v2.x * v,
+                              tr1.v0.y * w + tr1.v1.y * u + tr1.v2.y * v,
+                              tr1.v0.z * w + tr1.v1.z * u + tr1.v2.z * v);
+    }
+
+    /// <summary>
+    /// Intersects a ray with the triangle (Moeller / Trumbore). Both faces are hit.
+    /// </summary>
+    /// <param name="tr1">Triangle</param>
+    /// <param name="r1">Ray</param>
+    /// <param name="t">Ray parameter of the intersection</param>
+    /// <param name="u">Barycentric coordinate of the intersection (weight of v1)</param>
+    /// <param name="v">Barycentric coordinate of the intersection (weight of v2)</param>
+    /// <returns>True, if the ray hits the triangle at t >= 0.</returns>
+    /// <remarks>Rays in the plane of the triangle and degenerate triangles are missed.</remarks>
+    template<RealType T, bool S>
+    bool RayIntersect(const TTriangle<T, S>& tr1, const TRay<T, S>& r1, T& t, T& u, T& v)
+    {
+        const T e1x = tr1.v1.x - tr1.v0.x, e1y = tr1.v1.y - tr1.v0.y, e1z = tr1.v1.z - tr1.v0.z;
+        const T e2x = tr1.v2.x - tr1.v0.x, e2y = tr1.v2.y - tr1.v0.y, e2z = tr1.v2.z - tr1.v0.z;
+
+        const T dx = r1.direction.x, dy = r1.direction.y, dz = r1.direction.z;
+
+        // p = d x e2
+        const T px = dy * e2z - dz * e2y;
+        const T py = dz * e2x - dx * e2z;
+        const T pz = dx * e2y - dy * e2x;
+
+        const T det = e1x * px + e1y * py + e1z * pz;
+        if (det == (T)0.0)
+        {
+            return false;
+        }
+
+        const T inv = (T)1.0 / det;
+
+        const T sx = r1.origin.x - tr1.v0.x, sy = r1.origin.y - tr1.v0.y, sz = r1.origin.z - tr1.v0.z;
+
+        const T bu = (sx * px + sy * py + sz * pz) * inv;
+        if (bu < (T)0.0 || bu > (T)1.0)
+        {
+            return false;
+        }
+
+        // q = s x e1
+        const T qx = sy * e1z - sz * e1y;
+        const T qy = sz * e1x - sx * e1z;
+        const T qz = sx * e1y - sy * e1x;
+
+        const T bv = (dx * qx + dy * qy + dz * qz) * inv;
+        if (bv < (T)0.0 || bu + bv > (T)1.0)
+        {
+            return false;
+        }
+
+        const T bt = (e2x * qx + e2y * qy + e2z * qz) * inv;
+        if (bt < (T)0.0)
+        {
+            return false;
+        }
+
+        t = bt;
+        u = bu;
+        v = bv;
+        return true;
+    }
+
+    /// <summary>
+    /// Intersects a ray with the triangle (Moeller / Trumbore). Both faces are hit.
+    /// </summary>
+    /// <param name="tr1">Triangle</param>
+    /// <param name="r1">Ray</param>
+    /// <param name="t">Ray parameter of the intersection</param>
+    /// <returns>True, if the ray hits the triangle at t >= 0.</returns>
+    template<RealType T, bool S>
+    FORCEINLINE bool RayIntersect(const TTriangle<T, S>& tr1, const TRay<T, S>& r1, T& t)
+    {
+        T u, v;
+        return RayIntersect(tr1, r1, t, u, v);
+    }
+
+} // Phanes::Core::Math
+
+#endif // !TRIANGLE_H
@@ -0,0 +1,190 @@
+#pragma once
+
+// Structure of arrays packet of N triangles, stored as first vertex and two edges (the operands of the Moeller / Trumbore test).
+//
+// One ray is tested against all N triangles, or N rays (TRayPacket) against one triangle. Lanes are independent, so the lane loops are
+// vectorized by the compiler, like in TPacket. Intersections write ray parameter and barycentrics per lane and return a lane mask.
+
+#include <cstddef>
+#include <limits>
+
+#include "Core/public/Math/Boilerplate.h"
+
+#include "Core/public/Math/MathCommon.hpp"
+#include "Core/public/Math/MathFwd.h"
+
+#include "Core/public/Math/Packet.hpp"
+#include "Core/public/Math/Vector3Packet.hpp"
+#include "Core/public/Math/Ray.hpp"
+#include "Core/public/Math/RayPacket.hpp"
+#include "Core/public/Math/Triangle.hpp"
+
+
+#ifndef TRIANGLEPACKET_H
+#define TRIANGLEPACKET_H
+
+namespace Phanes::Core::Math {
+
+    /// <summary>
+    /// N triangles in structure of arrays layout.
+    /// </summary>
+    /// <typeparam name="T">Type of triangle</typeparam>
+    /// <typeparam name="N">Number of triangles (power of two)</typeparam>
+    template<RealType T, size_t N>
+    struct TTrianglePacket
+    {
+    public:
+
+        using Real = T;
+
+        static constexpr size_t Width = N;
+
+        /// <summary>
+        /// First vertices
+        /// </summary>
+        TVector3Packet<Real, N> v0;
+
+        /// <summary>
+        /// Edges v1 - v0
+        /// </summary>
+        TVector3Packet<Real, N> e1;
+
+        /// <summary>
+        /// Edges v2 - v0
+        /// </summary>
+        TVector3Packet<Real, N> e2;
+
+    public:
+
+        /// Default constructor
+        TTrianglePacket() = default;
+    };
+
+
+    namespace Detail
+    {
+        // Lane mask of the Moeller / Trumbore test. Misses get t = infinity.
+        template<RealType T, size_t N>
+        FORCEINLINE unsigned int triangle_packet_hits(const TPacket<T, N>& det, const TPacket<T, N>& bt, const TPacket<T, N>& bu, const TPacket<T, N>& bv,
+                                                      T* t, T* u, T* v)
+        {
+            constexpr T inf = std::numeric_limits<T>::infinity();
+
+            unsigned int mask = 0;
+            for (size_t i = 0; i < N; ++i)
+            {
+                // Rays parallel to the triangle and degenerate lanes (det = 0) are masked explicitly, rather than relying on the inf / NaN of the division.
+                const bool hit = (det.data[i] != (T)0.0) & (bu.data[i] >= (T)0.0) & (bv.data[i] >= (T)0.0) & (bu.data[i] + bv.data[i] <= (T)1.0) & (bt.data[i] >= (T)0.0);
+
+                t[i] = hit ? bt.data[i] : inf;
+                u[i] = bu.data[i];
+                v[i] = bv.data[i];
+                mask |= (unsigned int)hit << i;
+            }
+
+            return mask;
+        }
+    }
+
+
+    // ============================== //
+    //   TTrianglePacket functions    //
+    // ============================== //
+
+
+    /// <summary>
+    /// Loads up to N triangles into a packet. Lanes past count are degenerate and never hit.
+    /// </summary>
+    /// <param name="r">Packet</param>
+    /// <param name="tris">Array of at least count triangles</param>
+    /// <param name="count">Number of triangles to load</param>
+    template<RealType T, size_t N, bool S>
+    void LoadPacket(TTrianglePacket<T, N>& r, const TTriangle<T, S>* tris, size_t count = N)
+    {
+        static_assert(N <= 32, "TTrianglePacket: Lane mask is limited to 32 lanes.");
+
+        for (size_t i = 0; i < N; ++i)
+        {
+            if (i < count)
+            {
+                const TTriangle<T, S>& tr = tris[i];
+
+                r.v0.x.data[i] = tr.v0.x;
+                r.v0.y.data[i] = tr.v0.y;
+                r.v0.z.data[i] = tr.v0.z;
+
+                r.e1.x.data[i] = tr.v1.x - tr.v0.x;
+                r.e1.y.data[i] = tr.v1.y - tr.v0.y;
+                r.e1.z.data[i] = tr.v1.z - tr.v0.z;
+
+                r.e2.x.data[i] = tr.v2.x - tr.v0.x;
+                r.e2.y.data[i] = tr.v2.y - tr.v0.y;
+                r.e2.z.data[i] = tr.v2.z - tr.v0.z;
+            }
+            else
+            {
+                r.v0.x.data[i] = r.v0.y.data[i] = r.v0.z.data[i] = (T)0.0;
+                r.e1.x.data[i] = r.e1.y.data[i] = r.e1.z.data[i] = (T)0.0;
+                r.e2.x.data[i] = r.e2.y.data[i] = r.e2.z.data[i] = (T)0.0;
+            }
+        }
+    }
+
+    /// <summary>
+    /// Intersects one ray with N triangles (Moeller / Trumbore). Both faces are hit.
+    /// </summary>
+    /// <param name="tris">Triangles</param>
+    /// <param name="r1">Ray</param>
+    /// <param name="t">N ray parameters. Lanes, that miss, are set to infinity.</param>
+    /// <param name="u">N barycentric coordinates (weight of v1). Only valid for hit lanes.</param>
+    /// <param name="v">N barycentric coordinates (weight of v2). Only valid for hit lanes.</param>
+    /// <returns>Bitmask with bit i set, if the ray hits triangle i at t >= 0.</returns>
+    template<RealType T, size_t N, bool S>
+    unsigned int RayIntersect(const TTrianglePacket<T, N>& tris, const TRay<T, S>& r1, T* t, T* u, T* v)
+    {
+        static_assert(N <= 32, "TTrianglePacket: Lane mask is limited to 32 lanes.");
+
+        const TVector3Packet<T, N> d(r1.direction);
+        const TVector3Packet<T, N> o(r1.origin);
+
+        const TVector3Packet<T, N> p = CrossP(d, tris.e2);
+        const TPacket<T, N> det = DotP(tris.e1, p);
+        const TPacket<T, N> inv = TPacket<T, N>((T)1.0) / det;
+
+        const TVector3Packet<T, N> s = o - tris.v0;
+        const TVector3Packet<T, N> q = CrossP(s, tris.e1);
+
+        return Detail::triangle_packet_hits(det, DotP(tris.e2, q) * inv, DotP(s, p) * inv, DotP(d, q) * inv, t, u, v);
+    }
+
+    /// <summary>
+    /// Intersects N rays with one triangle (Moeller / Trumbore). Both faces are hit.
+    /// </summary>
+    /// <param name="tr1">Triangle</param>
+    /// <param name="rays">Rays</param>
+    /// <param name="t">N ray parameters. Lanes, that miss, are set to infinity.</param>
+    /// <param name="u">N barycentric coordinates (weight of v1). Only valid for hit lanes.</param>
+    /// <param name="v">N barycentric coordinates (weight of v2). Only valid for hit lanes.</param>
+    /// <returns>Bitmask with bit i set, if ray i hits the triangle at t >= 0.</returns>
+    template<RealType T, size_t N, bool S>
+    unsigned int RayIntersect(const TTriangle<T, S>& tr1, const TRayPacket<T, N>& rays, T* t, T* u, T* v)
+    {
+        static_assert(N <= 32, "TRayPacket: Lane mask is limited to 32 lanes.");
+
+        const TVector3Packet<T, N> v0(tr1.v0);
+        const TVector3Packet<T, N> e1(TVector3<T, false>(tr1.v1.x - tr1.v0.x, tr1.v1.y - tr1.v0.y, tr1.v1.z - tr1.v0.z));
+        const TVector3Packet<T, N> e2(TVector3<T, false>(tr1.v2.x - tr1.v0.x, tr1.v2.y - tr1.v0.y, tr1.v2.z - tr1.v0.z));
+
+        const TVector3Packet<T, N> p = CrossP(rays.direction, e2);
+        const TPacket<T, N> det = DotP(e1, p);
+        const TPacket<T, N> inv = TPacket<T, N>((T)1.0) / det;
+
+        const TVector3Packet<T, N> s = rays.origin - v0;
+        const TVector3Packet<T, N> q = CrossP(s, e1);
+
+        return Detail::triangle_packet_hits(det, DotP(e2, q) * inv, DotP(s, p) * inv, DotP(rays.direction, q) * inv, t, u, v);
+    }
+
+} // Phanes::Core::Math
+
+#endif // !TRIANGLEPACKET_H
@@ -180,14 +180,14 @@ namespace Phanes::Core::Math
     template<RealType T, bool S>
     TVector2<T, S>& operator++(TVector2<T, S>& v1)
     {
-        Detail::compute_vec2_inc<T, S>::map(v1);
+        Detail::compute_vec2_inc<T, S>::map(v1, v1);
         return v1;
     }
 
     template<RealType T, bool S>
     TVector2<T, S>& operator--(TVector2<T, S>& v1)
     {
-        Detail::compute_vec2_inc<T, S>::map(v1);
+        Detail::compute_vec2_dec<T, S>::map(v1, v1);
         return v1;
     }
 
@@ -0,0 +1,130 @@
+#pragma once
+
+// Operations on arrays of TVector2<float>. Two vectors are processed per xmm register (four per ymm, eight per zmm).
+// Kernels are selected through SIMD/Dispatch.h.
+//
+// r may alias v1 or v2. The spans passed to one function must have the same size.
+
+#include <cassert>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+
+#include "Core/public/Math/Boilerplate.h"
+#include "Core/public/Math/SIMD/Dispatch.h"
+
+#include "Core/public/Math/Vector2.hpp"
+
+
+namespace Phanes::Core::Math
+{
+    static_assert(sizeof(TVector2<float, false>) == 2 * sizeof(float), "TVector2<float> must be tightly packed.");
+
+    /// <summary>
+    /// Adds vectors component-wise.
+    /// </summary>
+    /// <param name="r">Result</param>
+    /// <param name="v1">Vectors one</param>
+    /// <param name="v2">Vectors two</param>
+    /// <param name="n">Number of vectors</param>
+    template<bool S>
+    void BatchAdd(TVector2<float, S>* r, const TVector2<float, S>* v1, const TVector2<float, S>* v2, size_t n)
+    {
+        SIMD::GetDispatchTable().vec2_add_array(&r->x, &v1->x, &v2->x, n);
+    }
+
+    /// <summary>
+    /// Multiplies vectors component-wise.
+    /// </summary>
+    /// <param name="r">Result</param>
+    /// <param name="v1">Vectors one</param>
+    /// <param name="v2">Vectors two</param>
+    /// <param name="n">Number of vectors</param>
+    template<bool S>
+    void BatchMul(TVector2<float, S>* r, const TVector2<float, S>* v1, const TVector2<float, S>* v2, size_t n)
+    {
+        SIMD::GetDispatchTable().vec2_mul_array(&r->x, &v1->x, &v2->x, n);
+    }
+
+    /// <summary>
+    /// Interpolates between each vector pair.
+    /// </summary>
+    /// <param name="r">Interpolated vectors</param>
+    /// <param name="startVecs">Start vectors (t = 0)</param>
+    /// <param name="destVecs">Destination vectors (t = 1)</param>
+    /// <param name="n">Number of vectors</param>
+    /// <param name="t">Interpolation value. Clamped between 0 - 1, like Lerp.</param>
+    template<bool S>
+    void BatchLerp(TVector2<float, S>* r, const TVector2<float, S>* startVecs, const TVector2<float, S>* destVecs, size_t n, float t)
+    {
+        t = Phanes::Core::Math::Clamp(t, 0.0f, 1.0f);
+        SIMD::GetDispatchTable().vec2_lerp_array(&r->x, &startVecs->x, &destVecs->x, n, t);
+    }
+
+    /// <summary>
+    /// Normalizes vectors. Vectors with a length smaller than P_FLT_INAC are set to zero, like Normalize does.
+    /// </summary>
+    /// <param name="r">Normalized vectors</param>
+    /// <param name="v">Vectors</param>
+    /// <param name="n">Number of vectors</param>
+    template<bool S>
+    void BatchNormalize(TVector2<float, S>* r, const TVector2<float, S>* v, size_t n)
+    {
+        SIMD::GetDispatchTable().vec2_normalize_array(&r->x, &v->x, n, P_FLT_INAC);
+    }
+    // ========= //
+    //   Spans   //
+    // ========= //
+
+    /// <summary>
+    /// Adds vectors component-wise.
+    /// </summary>
+    /// <param name="r">Result</param>
+    /// <param name="v1">Vectors one</param>
+    /// <param name="v2">Vectors two</param>
+    template<bool S = false>
+    void BatchAdd(std::span<std::type_identity_t<TVector2<float, S>>> r, std::span<const std::type_identity_t<TVector2<float, S>>> v1, std::span<const std::type_identity_t<TVector2<float, S>>> v2)
+    {
+        assert(r.size() == v1.size() && r.size() == v2.size());
+        BatchAdd(r.data(), v1.data(), v2.data(), r.size());
+    }
+
+    /// <summary>
+    /// Multiplies vectors component-wise.
+    /// </summary>
+    /// <param name="r">Result</param>
+    /// <param name="v1">Vectors one</param>
+    /// <param name="v2">Vectors two</param>
+    template<bool S = false>
+    void BatchMul(std::span<std::type_identity_t<TVector2<float, S>>> r, std::span<const std::type_identity_t<TVector2<float, S>>> v1, std::span<const std::type_identity_t<TVector2<float, S>>> v2)
+    {
+        assert(r.size() == v1.size() && r.size() == v2.size());
+        BatchMul(r.data(), v1.data(), v2.data(), r.size());
+    }
+
+    /// <summary>
+    /// Interpolates between each vector pair.
+    /// </summary>
+    /// <param name="r">Interpolated vectors</param>
+    /// <param name="startVecs">Start vectors (t = 0)</param>
+    /// <param name="destVecs">Destination vectors (t = 1)</param>
+    /// <param name="t">Interpolation value. Clamped between 0 - 1, like Lerp.</param>
+    template<bool S = false>
+    void BatchLerp(std::span<std::type_identity_t<TVector2<float, S>>> r, std::span<const std::type_identity_t<TVector2<float, S>>> startVecs, std::span<const std::type_identity_t<TVector2<float, S>>> destVecs, float t)
+    {
+        assert(r.size() == startVecs.size() && r.size() == destVecs.size());
+        BatchLerp(r.data(), startVecs.data(), destVecs.data(), r.size(), t);
+    }
+
+    /// <summary>
+    /// Normalizes vectors. Vectors with a length smaller than P_FLT_INAC are set to zero, like Normalize does.
+    /// </summary>
+    /// <param name="r">Normalized vectors</param>
+    /// <param name="v">Vectors</param>
+    template<bool S = false>
+    void BatchNormalize(std::span<std::type_identity_t<TVector2<float, S>>> r, std::span<const std::type_identity_t<TVector2<float, S>>> v)
+    {
+        assert(r.size() == v.size());
+        BatchNormalize(r.data(), v.data(), r.size());
+    }
+}
\ No newline at end of file
@@ -1,7 +1,5 @@
 #pragma once
 
-// TODO: Slerp (using Quaternions)
-
 
 #include "Core/public/Math/Boilerplate.h"
 
@@ -325,6 +323,55 @@ namespace Phanes::Core::Math {
     template<RealType T, bool S>
     inline bool operator!= (const TVector3<T, S>& v1, const TVector3<T, S>& v2);
 
+    /**
+     * Compares two vectors component-wise with a tolerance.
+     *
+     * @param(v1) Vector one
+     * @param(v2) Vector two
+     * @param(threshold) Allowed difference per component
+     *
+     * @return Bitmask with bit 0 for x to bit 2 for z. A bit is set, if the components are equal.
+     */
+
+    template<RealType T, bool S>
+    int CompareEq(const TVector3<T, S>& v1, const TVector3<T, S>& v2, T threshold = P_FLT_INAC);
+
+    /**
+     * Compares two vectors component-wise.
+     *
+     * @param(v1) Vector one
+     * @param(v2) Vector two
+     *
+     * @return Bitmask with bit 0 for x to bit 2 for z. A bit is set, if the component of v1 is less than the one of v2.
+     */
+
+    template<RealType T, bool S>
+    int CompareLess(const TVector3<T, S>& v1, const TVector3<T, S>& v2);
+
+    /**
+     * Tests if all components of v1 are less than the ones of v2.
+     *
+     * @param(v1) Vector one
+     * @param(v2) Vector two
+     *
+     * @return True if all components are less, false if not.
+     */
+
+    template<RealType T, bool S>
+    FORCEINLINE bool AllLess(const TVector3<T, S>& v1, const TVector3<T, S>& v2) { return CompareLess(v1, v2) == 0x7; };
+
+    /**
+     * Tests if any component is near zero.
+     *
+     * @param(v1) Vector
+     * @param(threshold) Allowed difference to zero
+     *
+     * @return True if at least one component is near zero, false if not.
+     */
+
+    template<RealType T, bool S>
+    FORCEINLINE bool AnyNearZero(const TVector3<T, S>& v1, T threshold = P_FLT_INAC) { return CompareEq(v1, TVector3<T, S>((T)0.0), threshold) != 0; };
+
     template<RealType T, bool S>
     TVector3<T, S>& operator++(TVector3<T, S>& v1);
 
@@ -397,8 +444,8 @@ namespace Phanes::Core::Math {
     template<RealType T>
     TVector3<T, false> NormalizeV(TVector3<T, false>& v1)
     {
-        float vecNorm = Magnitude(v1);
-        v1 /= (vecNorm < P_FLT_INAC) ? 1 : vecNorm;
+        T vecNorm = Magnitude(v1);
+        v1 /= (vecNorm < P_FLT_INAC) ? (T)1.0 : vecNorm;
 
         return v1;
     }
@@ -511,10 +558,10 @@ namespace Phanes::Core::Math {
      * @return True if equal, false if not.
      */
 
-    template<RealType T>
-    inline bool Equals(const TVector3<T, false>& v1, const TVector3<T, false>& v2, T threshold = P_FLT_INAC)
+    template<RealType T, bool S>
+    inline bool Equals(const TVector3<T, S>& v1, const TVector3<T, S>& v2, T threshold = P_FLT_INAC)
     {
-        return (abs(v1.x - v2.x) < threshold && abs(v1.y - v2.y) < threshold && abs(v1.z - v2.z) < threshold);
+        return CompareEq(v1, v2, threshold) == 0x7;
     }
 
     /**
@@ -533,6 +580,54 @@ namespace Phanes::Core::Math {
         return v1;
     }
 
+    /**
+     * Normalizes vector. Vectors shorter than P_FLT_INAC are set to zero, like with the unaligned Normalize.
+     *
+     * @param(v1) Vector
+     * @param(p) Precision of the reciprocal square root
+     *
+     * @return Normalized vector
+     */
+
+    template<RealType T>
+    TVector3<T, true> Normalize(const TVector3<T, true>& v1, EPrecision p = EPrecision::Exact);
+
+    /**
+     * Normalizes vector. Vectors shorter than P_FLT_INAC are left unchanged.
+     *
+     * @param(v1) Vector
+     * @param(p) Precision of the reciprocal square root
+     *
+     * @note Result is stored in v1
+     */
+
+    template<RealType T>
+    TVector3<T, true> NormalizeV(TVector3<T, true>& v1, EPrecision p = EPrecision::Exact);
+
+    /**
+     * Gets the reciprocal of the components of vector.
+     *
+     * @param(v1) Vector
+     * @param(p) Precision of the reciprocal
+     *
+     * @return Vector with reciprocal of components
+     */
+
+    template<RealType T>
+    TVector3<T, true> CompInverse(const TVector3<T, true>& v1, EPrecision p = EPrecision::Exact);
+
+    /**
+     * Inverts the components of vector.
+     *
+     * @param(v1) Vector
+     * @param(p) Precision of the reciprocal
+     *
+     * @note Result is stored in v1
+     */
+
+    template<RealType T>
+    TVector3<T, true> CompInverseV(TVector3<T, true>& v1, EPrecision p = EPrecision::Exact);
+
     /**
      * Calculates the cross product between two vectors.
      *
@@ -1037,8 +1132,8 @@ namespace Phanes::Core::Math {
      * @return Cross product of v1 and v2
      */
 
-    template<RealType T>
-    TVector3<T, false> CrossP(const TVector3<T, false>& v1, const TVector3<T, false>& v2);
+    template<RealType T, bool S>
+    TVector3<T, S> CrossP(const TVector3<T, S>& v1, const TVector3<T, S>& v2);
 
     /**
      * Linearly interpolates between two vectors.
@@ -1272,31 +1367,68 @@ namespace Phanes::Core::Math {
     }
 
     /**
-     * Interpolate vector v1 to desitnation v2 using v1 constant s. The magnitude of the vector stays the same throughout the interpolation.
+     * Interpolate vector v1 to desitnation v2 with constant angular velocity. The magnitude is interpolated linearly, so unit vectors stay unit vectors.
      *
      * @param(v1) Starting vector
      * @param(v2) Destination vector
      * @param(t) 0.0 to 1.0 interpolation value
      *
-     * @return Interpolated unit vector
+     * @return Interpolated vector.
+     * @note Does not clamp t between 0.0 and 1.0.
+     * @note Opposite vectors are rotated around an arbitrary perpendicular axis.
      */
 
     template<RealType T>
-    TVector3<T, false> Slerp(const TVector3<T, false>& v1, const TVector3<T, false>& v2, T t) {};
+    TVector3<T, false> SlerpUnclamped(const TVector3<T, false>& v1, const TVector3<T, false>& v2, T t)
+    {
+        const T m1 = Magnitude(v1);
+        const T m2 = Magnitude(v2);
+
+        if (m1 < P_FLT_INAC || m2 < P_FLT_INAC)
+        {
+            return LerpUnclamped(v1, v2, t);
+        }
+
+        const TVector3<T, false> n1 = v1 / m1;
+        const TVector3<T, false> n2 = v2 / m2;
+        const T magnitude = m1 + (m2 - m1) * t;
+        const T cosAngle = Clamp(DotP(n1, n2), (T)-1.0, (T)1.0);
+
+        // Nearly parallel, sin(angle) runs towards 0.
+        if (cosAngle > (T)1.0 - P_FLT_INAC)
+        {
+            TVector3<T, false> r = LerpUnclamped(n1, n2, t);
+            return NormalizeV(r) * magnitude;
+        }
+
+        // Opposite, the plane of rotation is undefined.
+        if (cosAngle < (T)-1.0 + P_FLT_INAC)
+        {
+            TVector3<T, false> axis = (Abs(n1.x) < (T)0.9) ? CrossP(n1, TVector3<T, false>((T)1.0, (T)0.0, (T)0.0)) : CrossP(n1, TVector3<T, false>((T)0.0, (T)1.0, (T)0.0));
+            return RotateAroundAxis(n1, NormalizeV(axis), t * (T)P_PI) * magnitude;
+        }
+
+        const T angle = (T)acos(cosAngle);
+        const T invSin = (T)1.0 / (T)sin(angle);
+
+        return (n1 * ((T)sin(((T)1.0 - t) * angle) * invSin) + n2 * ((T)sin(t * angle) * invSin)) * magnitude;
+    }
 
     /**
-     * Interpolate vector v1 to desitnation v2 using v1 constant s. The magnitude of the vector stays the same throughout the interpolation.
+     * Interpolate vector v1 to desitnation v2 with constant angular velocity. The magnitude is interpolated linearly, so unit vectors stay unit vectors.
      *
      * @param(v1) Starting vector
      * @param(v2) Destination vector
      * @param(t) 0.0 to 1.0 interpolation value
      *
-     * @return Interpolated unit vector.
-     * @note Does not clamp s between 0.0 and 1.0.
+     * @return Interpolated vector
      */
 
     template<RealType T>
-    TVector3<T, false> SlerpUnclamped(const TVector3<T, false>& v1, const TVector3<T, false>& v2, T t) {};
+    TVector3<T, false> Slerp(const TVector3<T, false>& v1, const TVector3<T, false>& v2, T t)
+    {
+        return SlerpUnclamped(v1, v2, Clamp(t, (T)0.0, (T)1.0));
+    }
 
 } // phanes
 
@@ -178,6 +178,18 @@ namespace Phanes::Core::Math
         return Detail::compute_vec3_ieq<T, S>::map(v1, v2);
     }
 
+    template<RealType T, bool S>
+    int CompareEq(const TVector3<T, S>& v1, const TVector3<T, S>& v2, T threshold)
+    {
+        return Detail::compute_vec3_eq_mask<T, S>::map(v1, v2, threshold);
+    }
+
+    template<RealType T, bool S>
+    int CompareLess(const TVector3<T, S>& v1, const TVector3<T, S>& v2)
+    {
+        return Detail::compute_vec3_lt_mask<T, S>::map(v1, v2);
+    }
+
 
 
     // Inc- / Decrement
@@ -186,14 +198,14 @@ namespace Phanes::Core::Math
     template<RealType T, bool S>
     TVector3<T, S>& operator++(TVector3<T, S>& v1)
     {
-        Detail::compute_vec3_inc<T, S>::map(v1);
+        Detail::compute_vec3_inc<T, S>::map(v1, v1);
         return v1;
     }
 
     template<RealType T, bool S>
     TVector3<T, S>& operator--(TVector3<T, S>& v1)
     {
-        Detail::compute_vec3_inc<T, S>::map(v1);
+        Detail::compute_vec3_dec<T, S>::map(v1, v1);
         return v1;
     }
 
@@ -226,4 +238,40 @@ namespace Phanes::Core::Math
         Detail::compute_vec3_cross_p<T, S>::map(v1, v1, v2);
         return v1;
     }
-}
\ No newline at end of file
+
+    template<RealType T>
+    TVector3<T, true> Normalize(const TVector3<T, true>& v1, EPrecision p)
+    {
+        // Short vectors become zero, like with the unaligned Normalize. The functor leaves them unchanged for NormalizeV.
+        if (Detail::compute_vec4_dot<T, true>::map(v1, v1) < (T)(P_FLT_INAC * P_FLT_INAC))
+        {
+            return PZeroVector3(T, true);
+        }
+
+        TVector3<T, true> r;
+        Detail::compute_vec3_normalize<T, true>::map(r, v1, p);
+        return r;
+    }
+
+    template<RealType T>
+    TVector3<T, true> NormalizeV(TVector3<T, true>& v1, EPrecision p)
+    {
+        Detail::compute_vec3_normalize<T, true>::map(v1, v1, p);
+        return v1;
+    }
+
+    template<RealType T>
+    TVector3<T, true> CompInverse(const TVector3<T, true>& v1, EPrecision p)
+    {
+        TVector3<T, true> r;
+        Detail::compute_vec3_rcp<T, true>::map(r, v1, p);
+        return r;
+    }
+
+    template<RealType T>
+    TVector3<T, true> CompInverseV(TVector3<T, true>& v1, EPrecision p)
+    {
+        Detail::compute_vec3_rcp<T, true>::map(v1, v1, p);
+        return v1;
+    }
+}
@@ -0,0 +1,222 @@
+#pragma once
+
+// Operations on arrays of TVector3<float>. Kernels are selected through SIMD/Dispatch.h.
+//
+// The vectors are transposed to x, y and z registers internally, so that one instruction serves as many vectors as the register holds.
+// The spans passed to one function must have the same size. r may alias the inputs.
+
+#include <cassert>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+
+#include "Core/public/Math/Boilerplate.h"
+#include "Core/public/Math/SIMD/Dispatch.h"
+
+#include "Core/public/Math/Vector3.hpp"
+
+
+namespace Phanes::Core::Math
+{
+    static_assert(sizeof(TVector3<float, false>) == 4 * sizeof(float), "TVector3<float> must be padded to xyzw.");
+
+    /// <summary>
+    /// Gets the dot product of each vector pair.
+    /// </summary>
+    /// <param name="r">Dot products</param>
+    /// <param name="v1">Vectors one</param>
+    /// <param name="v2">Vectors two</param>
+    /// <param name="n">Number of vectors</param>
+    template<bool S>
+    void BatchDotP(float* r, const TVector3<float, S>* v1, const TVector3<float, S>* v2, size_t n)
+    {
+        SIMD::GetDispatchTable().vec3_dot_array(r, &v1->x, &v2->x, n);
+    }
+
+    /// <summary>
+    /// Gets the cross product of each vector pair.
+    /// </summary>
+    /// <param name="r">Cross products</param>
+    /// <param name="v1">Vectors one</param>
+    /// <param name="v2">Vectors two</param>
+    /// <param name="n">Number of vectors</param>
+    template<bool S>
+    void BatchCrossP(TVector3<float, S>* r, const TVector3<float, S>* v1, const TVector3<float, S>* v2, size_t n)
+    {
+        SIMD::GetDispatchTable().vec3_cross_array(&r->x, &v1->x, &v2->x, n);
+    }
+
+    /// <summary>
+    /// Normalizes vectors. Vectors with a length smaller than P_FLT_INAC are set to zero, like Normalize does.
+    /// </summary>
+    /// <param name="r">Normalized vectors</param>
+    /// <param name="v">Vectors</param>
+    /// <param name="n">Number of vectors</param>
+    /// <param name="p">Precision of the reciprocal square root</param>
+    template<bool S>
+    void BatchNormalize(TVector3<float, S>* r, const TVector3<float, S>* v, size_t n, EPrecision p = EPrecision::Exact)
+    {
+        if (p == EPrecision::Exact)
+        {
+            SIMD::GetDispatchTable().vec3_normalize_array(&r->x, &v->x, n, P_FLT_INAC);
+        }
+        else
+        {
+            SIMD::GetDispatchTable().vec3_normalize_est_array(&r->x, &v->x, n, P_FLT_INAC, p == EPrecision::Refined);
+        }
+    }
+
+    /// <summary>
+    /// Gets the length of each vector.
+    /// </summary>
+    /// <param name="r">Lengths</param>
+    /// <param name="v">Vectors</param>
+    /// <param name="n">Number of vectors</param>
+    template<bool S>
+    void BatchMagnitude(float* r, const TVector3<float, S>* v, size_t n)
+    {
+        SIMD::GetDispatchTable().vec3_magnitude_array(r, &v->x, n);
+    }
+
+    /// <summary>
+    /// Interpolates each vector pair linearly.
+    /// </summary>
+    /// <param name="r">Interpolated vectors</param>
+    /// <param name="start">Start vectors</param>
+    /// <param name="dest">Destination vectors</param>
+    /// <param name="n">Number of vectors</param>
+    /// <param name="t">Interpolation value. Clamped between 0 - 1, like Lerp.</param>
+    template<bool S>
+    void BatchLerp(TVector3<float, S>* r, const TVector3<float, S>* start, const TVector3<float, S>* dest, size_t n, float t)
+    {
+        t = Clamp(t, 0.0f, 1.0f);
+        SIMD::GetDispatchTable().vec4_lerp_array(&r->x, &start->x, &dest->x, n, t);
+    }
+
+    /// <summary>
+    /// Gets the component-wise minimum of all vectors.
+    /// </summary>
+    /// <param name="v">Vectors</param>
+    /// <param name="n">Number of vectors</param>
+    /// <returns>Minimum, or zero vector if n is 0.</returns>
+    template<bool S>
+    TVector3<float, S> BatchMinV(const TVector3<float, S>* v, size_t n)
+    {
+        float m[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+
+        if (n > 0)
+        {
+            SIMD::GetDispatchTable().vec4_min_reduce(m, &v->x, n);
+        }
+        return TVector3<float, S>(m[0], m[1], m[2]);
+    }
+
+    /// <summary>
+    /// Gets the component-wise maximum of all vectors.
+    /// </summary>
+    /// <param name="v">Vectors</param>
+    /// <param name="n">Number of vectors</param>
+    /// <returns>Maximum, or zero vector if n is 0.</returns>
+    template<bool S>
+    TVector3<float, S> BatchMaxV(const TVector3<float, S>* v, size_t n)
+    {
+        float m[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+
+        if (n > 0)
+        {
+            SIMD::GetDispatchTable().vec4_max_reduce(m, &v->x, n);
+        }
+        return TVector3<float, S>(m[0], m[1], m[2]);
+    }
+
+    // ========= //
+    //   Spans   //
+    // ========= //
+
+    /// <summary>
+    /// Gets the dot product of each vector pair.
+    /// </summary>
+    /// <param name="r">Dot products</param>
+    /// <param name="v1">Vectors one</param>
+    /// <param name="v2">Vectors two</param>
+    template<bool S = false>
+    void BatchDotP(std::span<float> r, std::span<const std::type_identity_t<TVector3<float, S>>> v1, std::span<const std::type_identity_t<TVector3<float, S>>> v2)
+    {
+        assert(r.size() == v1.size() && r.size() == v2.size());
+        BatchDotP(r.data(), v1.data(), v2.data(), r.size());
+    }
+
+    /// <summary>
+    /// Gets the cross product of each vector pair.
+    /// </summary>
+    /// <param name="r">Cross products</param>
+    /// <param name="v1">Vectors one</param>
+    /// <param name="v2">Vectors two</param>
+    template<bool S = false>
+    void BatchCrossP(std::span<std::type_identity_t<TVector3<float, S>>> r, std::span<const std::type_identity_t<TVector3<float, S>>> v1, std::span<const std::type_identity_t<TVector3<float, S>>> v2)
+    {
+        assert(r.size() == v1.size() && r.size() == v2.size());
+        BatchCrossP(r.data(), v1.data(), v2.data(), r.size());
+    }
+
+    /// <summary>
+    /// Normalizes vectors. Vectors with a length smaller than P_FLT_INAC are set to zero, like Normalize does.
+    /// </summary>
+    /// <param name="r">Normalized vectors</param>
+    /// <param name="v">Vectors</param>
+    /// <param name="p">Precision of the reciprocal square root</param>
+    template<bool S = false>
+    void BatchNormalize(std::span<std::type_identity_t<TVector3<float, S>>> r, std::span<const std::type_identity_t<TVector3<float, S>>> v, EPrecision p = EPrecision::Exact)
+    {
+        assert(r.size() == v.size());
+        BatchNormalize(r.data(), v.data(), r.size(), p);
+    }
+
+    /// <summary>
+    /// Gets the length of each vector.
+    /// </summary>
+    /// <param name="r">Lengths</param>
+    /// <param name="v">Vectors</param>
+    template<bool S = false>
+    void BatchMagnitude(std::span<float> r, std::span<const std::type_identity_t<TVector3<float, S>>> v)
+    {
+        assert(r.size() == v.size());
+        BatchMagnitude(r.data(), v.data(), r.size());
+    }
+
+    /// <summary>
+    /// Interpolates each vector pair linearly.
+    /// </summary>
+    /// <param name="r">Interpolated vectors</param>
+    /// <param name="start">Start vectors</param>
+    /// <param name="dest">Destination vectors</param>
+    /// <param name="t">Interpolation value. Clamped between 0 - 1, like Lerp.</param>
+    template<bool S = false>
+    void BatchLerp(std::span<std::type_identity_t<TVector3<float, S>>> r, std::span<const std::type_identity_t<TVector3<float, S>>> start, std::span<const std::type_identity_t<TVector3<float, S>>> dest, float t)
+    {
+        assert(r.size() == start.size() && r.size() == dest.size());
+        BatchLerp(r.data(), start.data(), dest.data(), r.size(), t);
+    }
+
+    /// <summary>
+    /// Gets the component-wise minimum of all vectors.
+    /// </summary>
+    /// <param name="v">Vectors</param>
+    /// <returns>Minimum, or zero vector if v is empty.</returns>
+    template<bool S = false>
+    TVector3<float, S> BatchMinV(std::span<const std::type_identity_t<TVector3<float, S>>> v)
+    {
+        return BatchMinV(v.data(), v.size());
+    }
+
+    /// <summary>
+    /// Gets the component-wise maximum of all vectors.
+    /// </summary>
+    /// <param name="v">Vectors</param>
+    /// <returns>Maximum, or zero vector if v is empty.</returns>
+    template<bool S = false>
+    TVector3<float, S> BatchMaxV(std::span<const std::type_identity_t<TVector3<float, S>>> v)
+    {
+        return BatchMaxV(v.data(), v.size());
+    }
+}
@@ -0,0 +1,120 @@
+#pragma once
+
+// Compact encodings of TVector3<float> arrays, e.g. for vertex buffers and snapshots. Kernels are selected through SIMD/Dispatch.h.
+//
+// TVector3<float> takes 16 bytes. Normals encode to 4 bytes (octahedral or 10:10:10:2), positions inside a box to 6 bytes (3x16 bit).
+// The spans passed to one function must hold the same number of vectors. Decoded TVector3 have w = 0. 10:10:10:2 works on TVector4, as w carries
+// the handedness of a tangent.
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+
+#include "Core/public/Math/Boilerplate.h"
+#include "Core/public/Math/SIMD/Dispatch.h"
+
+#include "Core/public/Math/Vector3.hpp"
+#include "Core/public/Math/Vector4.hpp"
+#include "Core/public/Math/AABB.hpp"
+
+
+namespace Phanes::Core::Math
+{
+    static_assert(sizeof(TVector3<float, false>) == 4 * sizeof(float), "TVector3<float> must be padded to xyzw.");
+    static_assert(sizeof(TVector4<float, false>) == 4 * sizeof(float), "TVector4<float> must be tightly packed.");
+
+    /// <summary>
+    /// Encodes unit vectors as octahedral coordinates, two snorm16 per vector (x in the low 16 bits). The angular error is below 0.004 degrees.
+    /// </summary>
+    /// <param name="r">Encoded vectors</param>
+    /// <param name="v">Unit vectors</param>
+    template<bool S = false>
+    void BatchEncodeOctahedral(std::span<uint32_t> r, std::span<const std::type_identity_t<TVector3<float, S>>> v)
+    {
+        assert(r.size() == v.size());
+        const size_t n = r.size();
+        SIMD::GetDispatchTable().vec3_encode_oct_array(r.data(), reinterpret_cast<const float*>(v.data()), n);
+    }
+
+    /// <summary>
+    /// Decodes octahedral coordinates to unit vectors.
+    /// </summary>
+    /// <param name="r">Unit vectors</param>
+    /// <param name="v">Encoded vectors</param>
+    template<bool S = false>
+    void BatchDecodeOctahedral(std::span<std::type_identity_t<TVector3<float, S>>> r, std::span<const uint32_t> v)
+    {
+        assert(r.size() == v.size());
+        const size_t n = r.size();
+        SIMD::GetDispatchTable().vec3_decode_oct_array(reinterpret_cast<float*>(r.data()), v.data(), n);
+    }
+
+    /// <summary>
+    /// Encodes vectors as snorm 10:10:10:2. x, y and z are clamped between -1 and 1. The 2 bit field holds w rounded to -1, 0 or 1, e.g. the handedness of a tangent.
+    /// </summary>
+    /// <param name="r">Encoded vectors</param>
+    /// <param name="v">Vectors</param>
+    template<bool S = false>
+    void BatchEncodeSNorm1010102(std::span<uint32_t> r, std::span<const std::type_identity_t<TVector4<float, S>>> v)
+    {
+        assert(r.size() == v.size());
+        const size_t n = r.size();
+        SIMD::GetDispatchTable().vec3_encode_1010102_array(r.data(), reinterpret_cast<const float*>(v.data()), n);
+    }
+
+    /// <summary>
+    /// Decodes snorm 10:10:10:2 vectors. w is set from the 2 bit field (-1, 0 or 1).
+    /// </summary>
+    /// <param name="r">Vectors</param>
+    /// <param name="v">Encoded vectors</param>
+    template<bool S = false>
+    void BatchDecodeSNorm1010102(std::span<std::type_identity_t<TVector4<float, S>>> r, std::span<const uint32_t> v)
+    {
+        assert(r.size() == v.size());
+        const size_t n = r.size();
+        SIMD::GetDispatchTable().vec3_decode_1010102_array(reinterpret_cast<float*>(r.data()), v.data(), n);
+    }
+
+    /// <summary>
+    /// Quantizes points to 16 bit per axis relative to a box. Points outside of the box are clamped to it.
+    /// </summary>
+    /// <param name="r">Quantized points (three values per point)</param>
+    /// <param name="v">Points</param>
+    /// <param name="box">Bounding box of the points</param>
+    template<bool S = false>
+    void BatchQuantize(std::span<uint16_t> r, std::span<const std::type_identity_t<TVector3<float, S>>> v, const TAABB<float, S>& box)
+    {
+        assert(r.size() == 3 * v.size());
+        const size_t n = v.size();
+
+        const float offset[3] = { box.min.x, box.min.y, box.min.z };
+        const float extent[3] = { box.max.x - box.min.x, box.max.y - box.min.y, box.max.z - box.min.z };
+
+        // Flat axes map to 0.
+        const float scale[3] = { (extent[0] > 0.0f) ? 65535.0f / extent[0] : 0.0f,
+                                 (extent[1] > 0.0f) ? 65535.0f / extent[1] : 0.0f,
+                                 (extent[2] > 0.0f) ? 65535.0f / extent[2] : 0.0f };
+
+        SIMD::GetDispatchTable().vec3_quantize_array(r.data(), reinterpret_cast<const float*>(v.data()), offset, scale, n);
+    }
+
+    /// <summary>
+    /// Dequantizes points quantized with BatchQuantize. The error per axis is at most half the box extent / 65535.
+    /// </summary>
+    /// <param name="r">Points</param>
+    /// <param name="v">Quantized points (three values per point)</param>
+    /// <param name="box">Box used for quantization</param>
+    template<bool S = false>
+    void BatchDequantize(std::span<std::type_identity_t<TVector3<float, S>>> r, std::span<const uint16_t> v, const TAABB<float, S>& box)
+    {
+        assert(3 * r.size() == v.size());
+        const size_t n = r.size();
+
+        const float offset[3] = { box.min.x, box.min.y, box.min.z };
+        const float scale[3] = { (box.max.x - box.min.x) / 65535.0f, (box.max.y - box.min.y) / 65535.0f, (box.max.z - box.min.z) / 65535.0f };
+
+        SIMD::GetDispatchTable().vec3_dequantize_array(reinterpret_cast<float*>(r.data()), v.data(), offset, scale, n);
+    }
+}
@@ -0,0 +1,496 @@
+#pragma once
+
+// Structure of arrays packet of N 3D vectors. Lane i of x, y, z forms vector i.
+
+#include <cstddef>
+
+#include "Core/public/Math/Boilerplate.h"
+
+#include "Core/public/Math/MathCommon.hpp"
+#include "Core/public/Math/MathFwd.h"
+
+#include "Core/public/Math/Packet.hpp"
+#include "Core/public/Math/Vector3.hpp"
+#include "Core/public/Math/Vector4Packet.hpp"
+
+
+#ifndef VECTOR3PACKET_H
+#define VECTOR3PACKET_H
+
+namespace Phanes::Core::Math {
+
+    /// <summary>
+    /// N 3D vectors in structure of arrays layout.
+    /// </summary>
+    /// <typeparam name="T">Type of vector</typeparam>
+    /// <typeparam name="N">Number of vectors (power of two)</typeparam>
+    template<RealType T, size_t N>
+    struct TVector3Packet
+    {
+    public:
+
+        using Real = T;
+
+        static constexpr size_t Width = N;
+
+        /// <summary>
+        /// X components
+        /// </summary>
+        TPacket<Real, N> x;
+
+
+        /// <summary>
+        /// Y components
+        /// </summary>
+        TPacket<Real, N> y;
+
+
+        /// <summary>
+        /// Z components
+        /// </summary>
+        TPacket<Real, N> z;
+
+
+    public:
+
+        /// Default constructor
+        TVector3Packet() = default;
+
+        /// <summary>
+        /// Broadcast one vector into all lanes.
+        /// </summary>
+        /// <param name="v">Vector</param>
+        template<bool S>
+        TVector3Packet(const TVector3<Real, S>& v)
+        {
+            this->x = TPacket<Real, N>(v.x);
+            this->y = TPacket<Real, N>(v.y);
+            this->z = TPacket<Real, N>(v.z);
+        }
+
+        /// <summary>
+        /// Construct from component packets.
+        /// </summary>
+        TVector3Packet(const TPacket<Real, N>& _x, const TPacket<Real, N>& _y, const TPacket<Real, N>& _z)
+        {
+            this->x = _x;
+            this->y = _y;
+            this->z = _z;
+        }
+    };
+
+
+    // ============================ //
+    //   TVector3Packet operators   //
+    // ============================ //
+
+
+    /// <summary>
+    /// Lane-wise addition.
+    /// </summary>
+    template<RealType T, size_t N>
+    FORCEINLINE TVector3Packet<T, N> operator+= (TVector3Packet<T, N>& v1, const TVector3Packet<T, N>& v2)
+    {
+        v1.x += v2.x;
+        v1.y += v2.y;
+        v1.z += v2.z;
+        return v1;
+    }
+
+    template<RealType T, size_t N>
+    FORCEINLINE TVector3Packet<T, N> operator+= (TVector3Packet<T, N>& v1, const TPacket<T, N>& s)
+    {
+        v1.x += s;
+        v1.y += s;
+        v1.z += s;
+        return v1;
+    }
+
+    template<RealType T, size_t N>
+    FORCEINLINE TVector3Packet<T, N> operator+= (TVector3Packet<T, N>& v1, T s)
+    {
+        return v1 += TPacket<T, N>(s);
+    }
+
+    template<RealType T, size_t N>
+    FORCEINLINE TVector3Packet<T, N> operator+ (const TVector3Packet<T, N>& v1, const TVector3Packet<T, N>& v2)
+    {
+        return TVector3Packet<T, N>(v1.x + v2.x, v1.y + v2.y, v1.z + v2.z);
+    }
+
+    template<RealType T, size_t N>
+    FORCEINLINE TVector3Packet<T, N> operator+ (const TVector3Packet<T, N>& v1, const TPacket<T, N>& s)
+    {
+        return TVector3Packet<T, N>(v1.x + s, v1.y + s, v1.z + s);
+    }
+
+    template<RealType T, size_t N>
+    FORCEINLINE TVector3Packet<T, N> operator+ (const TVector3Packet<T, N>& v1, T s)
+    {
+        return v1 + TPacket<T, N>(s);
+    }
+
+
+    /// <summary>
+    /// Lane-wise subtraction.
+    /// </summary>
+    template<RealType T, size_t N>
+    FORCEINLINE TVector3Packet<T, N> operator-= (TVector3Packet<T, N>& v1, const TVector3Packet<T, N>& v2)
+    {
+        v1.x -= v2.x;
+        v1.y -= v2.y;
+        v1.z -= v2.z;
+        return v1;
+    }
+
+    template<RealType T, size_t N>
+    FORCEINLINE TVector3Packet<T, N> operator-= (TVector3Packet<T, N>& v1, const TPacket<T, N>& s)
+    {
+        v1.x -= s;
+        v1.y -= s;
+        v1.z -= s;
+        return v1;
+    }
+
+    template<RealType T, size_t N>
+    FORCEINLINE TVector3Packet<T, N> operator-= (TVector3Packet<T, N>& v1, T s)
+    {
+        return v1 -= TPacket<T, N>(s);
+    }
+
+    template<RealType T, size_t N>
+    FORCEINLINE TVector3Packet<T, N> operator- (const TVector3Packet<T, N>& v1, const TVector3Packet<T, N>& v2)
+    {
+        return TVector3Packet<T, N>(v1.x - v2.x, v1.y - v2.y, v1.z - v2.z);
+    }
+
+    template<RealType T, size_t N>
+    FORCEINLINE TVector3Packet<T, N> operator- (const TVector3Packet<T, N>& v1, const TPacket<T, N>& s)
+    {
+        return TVector3Packet<T, N>(v1.x - s, v1.y - s, v1.z - s);
+    }
+
+    template<RealType T, size_t N>
+    FORCEINLINE TVector3Packet<T, N> operator- (const TVector3Packet<T, N>& v1, T s)
+    {
+        return v1 - TPacket<T, N>(s);
+    }
+
+
+    /// <summary>
+    /// Lane-wise multiplication.
+    /// </summary>
+    template<RealType T, size_t N>
+    FORCEINLINE TVector3Packet<T, N> operator*= (TVector3Packet<T, N>& v1, const TVector3Packet<T, N>& v2)
+    {
+        v1.x *= v2.x;
+        v1.y *= v2.y;
+        v1.z *= v2.z;
+        return v1;
+    }
+
+    template<RealType T, size_t N>
+    FORCEINLINE TVector3Packet<T, N> operator*= (TVector3Packet<T, N>& v1, const TPacket<T, N>& s)
+    {
+        v1.x *= s;
+        v1.y *= s;
+        v1.z *= s;
+        return v1;
+    }
+
+    template<RealType T, size_t N>
+    FORCEINLINE TVector3Packet<T, N> operator*= (TVector3Packet<T, N>& v1, T s)
+    {
+        return v1 *= TPacket<T, N>(s);
+    }
+
+    template<RealType T, size_t N>
+    FORCEINLINE TVector3Packet<T, N> operator* (const TVector3Packet<T, N>& v1, const TVector3Packet<T, N>& v2)
+    {
+        return TVector3Packet<T, N>(v1.x * v2.x, v1.y * v2.y, v1.z * v2.z);
+    }
+
+    template<RealType T, size_t N>
+    FORCEINLINE TVector3Packet<T, N> operator* (const TVector3Packet<T, N>& v1, const TPacket<T, N>& s)
+    {
+        return TVector3Packet<T, N>(v1.x * s, v1.y * s, v1.z * s);
+    }
+
+    template<RealType T, size_t N>
+    FORCEINLINE TVector3Packet<T, N> operator* (const TVector3Packet<T, N>& v1, T s)
+    {
+        return v1 * TPacket<T, N>(s);
+    }
+
+
+    /// <summary>
+    /// Lane-wise division.
+    /// </summary>
+    template<RealType T, size_t N>
+    FORCEINLINE TVector3Packet<T, N> operator/= (TVector3Packet<T, N>& v1, const TVector3Packet<T, N>& v2)
+    {
+        v1.x /= v2.x;
+        v1.y /= v2.y;
+        v1.z /= v2.z;
+        return v1;
+    }
+
+    template<RealType T, size_t N>
+    FORCEINLINE TVector3Packet<T, N> operator/= (TVector3Packet<T, N>& v1, const TPacket<T, N>& s)
+    {
+        v1.x /= s;
+        v1.y /= s;
+        v1.z /= s;
+        return v1;
+    }
+
+    template<RealType T, size_t N>
+    FORCEINLINE TVector3Packet<T, N> operator/= (TVector3Packet<T, N>& v1, T s)
+    {
+        return v1 /= TPacket<T, N>(s);
+    }
+
+    template<RealType T, size_t N>
+    FORCEINLINE TVector3Packet<T, N> operator/ (const TVector3Packet<T, N>& v1, const TVector3Packet<T, N>& v2)
+    {
+        return TVector3Packet<T, N>(v1.x / v2.x, v1.y / v2.y, v1.z / v2.z);
+    }
+
+    template<RealType T, size_t N>
+    FORCEINLINE TVector3Packet<T, N> operator/ (const TVector3Packet<T, N>& v1, const TPacket<T, N>& s)
+    {
+        return TVector3Packet<T, N>(v1.x / s, v1.y / s, v1.z / s);
+    }
+
+    template<RealType T, size_t N>
+    FORCEINLINE TVector3Packet<T, N> operator/ (const TVector3Packet<T, N>& v1, T s)
+    {
+        return v1 / TPacket<T, N>(s);
+    }
+
+
+    template<RealType T, size_t N>
+    FORCEINLINE TVector3Packet<T, N> operator* (T s, const TVector3Packet<T, N>& v1) { return v1 * s; }
+
+    template<RealType T, size_t N>
+    FORCEINLINE TVector3Packet<T, N> operator* (const TPacket<T, N>& s, const TVector3Packet<T, N>& v1) { return v1 * s; }
+
+    template<RealType T, size_t N>
+    FORCEINLINE TVector3Packet<T, N> operator- (const TVector3Packet<T, N>& v1)
+    {
+        return TVector3Packet<T, N>(-v1.x, -v1.y, -v1.z);
+    }
+
+    /// <summary>
+    /// Compares the vectors of each lane with a tolerance.
+    /// </summary>
+    /// <param name="v1">Vectors one</param>
+    /// <param name="v2">Vectors two</param>
+    /// <param name="threshold">Allowed difference per component</param>
+    /// <returns>Bitmask with bit i set, if the vectors in lane i are equal.</returns>
+    template<RealType T, size_t N>
+    FORCEINLINE unsigned int CompareEq(const TVector3Packet<T, N>& v1, const TVector3Packet<T, N>& v2, T threshold = P_FLT_INAC)
+    {
+        return CompareEq(v1.x, v2.x, threshold) & CompareEq(v1.y, v2.y, threshold) & CompareEq(v1.z, v2.z, threshold);
+    }
+
+    /// <summary>
+    /// Tests if the vectors of all lanes are equal. Uses P_FLT_INAC.
+    /// </summary>
+    template<RealType T, size_t N>
+    FORCEINLINE bool operator== (const TVector3Packet<T, N>& v1, const TVector3Packet<T, N>& v2)
+    {
+        return CompareEq(v1, v2) == PacketFullMask<N>();
+    }
+
+    /// <summary>
+    /// Tests if the vectors of any lane are inequal. Uses P_FLT_INAC.
+    /// </summary>
+    template<RealType T, size_t N>
+    FORCEINLINE bool operator!= (const TVector3Packet<T, N>& v1, const TVector3Packet<T, N>& v2)
+    {
+        return CompareEq(v1, v2) != PacketFullMask<N>();
+    }
+
+
+    // ============================ //
+    //   TVector3Packet functions   //
+    // ============================ //
+
+    /// <summary>
+    /// Loads N consecutive vectors.
+    /// </summary>
+    /// <param name="r">Packet</param>
+    /// <param name="v">Array of at least N vectors</param>
+    template<RealType T, size_t N, bool S>
+    FORCEINLINE void LoadPacket(TVector3Packet<T, N>& r, const TVector3<T, S>* v)
+    {
+        static_assert(sizeof(TVector3<T, S>) == 4 * sizeof(T), "TVector3 must be tightly packed.");
+
+
+        TPacket<T, N> w;
+        Detail::compute_vec4p_load<T, N>::map(r.x.data, r.y.data, r.z.data, w.data, &v->x);
+    }
+
+
+    /// <summary>
+    /// Stores the packet into N consecutive vectors.
+    /// </summary>
+    /// <param name="r">Array of at least N vectors</param>
+    /// <param name="v">Packet</param>
+    template<RealType T, size_t N, bool S>
+    FORCEINLINE void StorePacket(TVector3<T, S>* r, const TVector3Packet<T, N>& v)
+    {
+        static_assert(sizeof(TVector3<T, S>) == 4 * sizeof(T), "TVector3 must be tightly packed.");
+
+
+        const TPacket<T, N> w((T)0.0);
+        Detail::compute_vec4p_store<T, N>::map(&r->x, v.x.data, v.y.data, v.z.data, w.data);
+    }
+
+
+    /// <summary>
+    /// Gets the vector of one lane.
+    /// </summary>
+    /// <param name="v">Packet</param>
+    /// <param name="i">Lane</param>
+    /// <returns>Vector in lane i</returns>
+    template<RealType T, size_t N>
+    FORCEINLINE TVector3<T, false> GetLane(const TVector3Packet<T, N>& v, size_t i)
+    {
+        return TVector3<T, false>(v.x.data[i], v.y.data[i], v.z.data[i]);
+    }
+
+    /// <summary>
+    /// Sets the vector of one lane.
+    /// </summary>
+    /// <param name="v">Packet</param>
+    /// <param name="i">Lane</param>
+    /// <param name="v1">Vector</param>
+    template<RealType T, size_t N, bool S>
+    FORCEINLINE void SetLane(TVector3Packet<T, N>& v, size_t i, const TVector3<T, S>& v1)
+    {
+        v.x.data[i] = v1.x;
+        v.y.data[i] = v1.y;
+        v.z.data[i] = v1.z;
+    }
+
+    /// <summary>
+    /// Dot product of each lane.
+    /// </summary>
+    template<RealType T, size_t N>
+    FORCEINLINE TPacket<T, N> DotP(const TVector3Packet<T, N>& v1, const TVector3Packet<T, N>& v2)
+    {
+        return v1.x * v2.x + v1.y * v2.y + v1.z * v2.z;
+    }
+
+
+    /// <summary>
+    /// Cross product of each lane.
+    /// </summary>
+    template<RealType T, size_t N>
+    FORCEINLINE TVector3Packet<T, N> CrossP(const TVector3Packet<T, N>& v1, const TVector3Packet<T, N>& v2)
+    {
+        return TVector3Packet<T, N>(v1.y * v2.z - v1.z * v2.y,
+                                   v1.z * v2.x - v1.x * v2.z,
+                                   v1.x * v2.y - v1.y * v2.x);
+    }
+
+
+    /// <summary>
+    /// Square of magnitude of each lane.
+    /// </summary>
+    template<RealType T, size_t N>
+    FORCEINLINE TPacket<T, N> SqrMagnitude(const TVector3Packet<T, N>& v1)
+    {
+        return DotP(v1, v1);
+    }
+
+    /// <summary>
+    /// Magnitude of each lane.
+    /// </summary>
+    template<RealType T, size_t N>
+    FORCEINLINE TPacket<T, N> Magnitude(const TVector3Packet<T, N>& v1)
+    {
+        return Sqrt(DotP(v1, v1));
+    }
+
+    /// <summary>
+    /// Normalizes each lane. Vectors shorter than P_FLT_INAC are left unchanged.
+    /// </summary>
+    /// <param name="v1">Vectors</param>
+    /// <returns>v1</returns>
+    template<RealType T, size_t N>
+    TVector3Packet<T, N> NormalizeV(TVector3Packet<T, N>& v1)
+    {
+        TPacket<T, N> s = DotP(v1, v1);
+
+        for (size_t i = 0; i < N; ++i)
+        {
+            s.data[i] = (s.data[i] < (T)(P_FLT_INAC * P_FLT_INAC)) ? (T)1.0 : (T)1.0 / sqrt(s.data[i]);
+        }
+
+        return v1 *= s;
+    }
+
+    /// <summary>
+    /// Normalizes each lane. Vectors shorter than P_FLT_INAC are returned unchanged.
+    /// </summary>
+    /// <param name="v1">Vectors</param>
+    /// <returns>Normalized vectors</returns>
+    template<RealType T, size_t N>
+    FORCEINLINE TVector3Packet<T, N> Normalize(const TVector3Packet<T, N>& v1)
+    {
+        TVector3Packet<T, N> r = v1;
+        return NormalizeV(r);
+    }
+
+    /// <summary>
+    /// Linear interpolation of each lane.
+    /// </summary>
+    /// <param name="v1">Start vectors</param>
+    /// <param name="v2">End vectors</param>
+    /// <param name="t">Interpolation factors</param>
+    /// <returns>v1 + (v2 - v1) * t</returns>
+    template<RealType T, size_t N>
+    FORCEINLINE TVector3Packet<T, N> Lerp(const TVector3Packet<T, N>& v1, const TVector3Packet<T, N>& v2, const TPacket<T, N>& t)
+    {
+        return v1 + (v2 - v1) * t;
+    }
+
+    template<RealType T, size_t N>
+    FORCEINLINE TVector3Packet<T, N> Lerp(const TVector3Packet<T, N>& v1, const TVector3Packet<T, N>& v2, T t)
+    {
+        return v1 + (v2 - v1) * t;
+    }
+
+    /// <summary>
+    /// Component-wise minimum of each lane.
+    /// </summary>
+    template<RealType T, size_t N>
+    FORCEINLINE TVector3Packet<T, N> Min(const TVector3Packet<T, N>& v1, const TVector3Packet<T, N>& v2)
+    {
+        return TVector3Packet<T, N>(Min(v1.x, v2.x), Min(v1.y, v2.y), Min(v1.z, v2.z));
+    }
+
+    /// <summary>
+    /// Component-wise maximum of each lane.
+    /// </summary>
+    template<RealType T, size_t N>
+    FORCEINLINE TVector3Packet<T, N> Max(const TVector3Packet<T, N>& v1, const TVector3Packet<T, N>& v2)
+    {
+        return TVector3Packet<T, N>(Max(v1.x, v2.x), Max(v1.y, v2.y), Max(v1.z, v2.z));
+    }
+
+    /// <summary>
+    /// Negates each lane.
+    /// </summary>
+    template<RealType T, size_t N>
+    FORCEINLINE TVector3Packet<T, N> Negate(const TVector3Packet<T, N>& v1)
+    {
+        return -v1;
+    }
+
+} // Phanes::Core::Math
+
+#endif // !VECTOR3PACKET_H
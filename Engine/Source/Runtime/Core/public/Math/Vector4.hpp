@@ -201,7 +201,7 @@ namespace Phanes::Core::Math
     /// <param name="v2">Vector two</param>
     /// <returns>Computed vector.</returns>
     template<RealType T, bool A>
-    TVector4<T, A> operator+ (TVector4<T, A>& v1, const TVector4<T, A>& v2);
+    TVector4<T, A> operator+ (const TVector4<T, A>& v1, const TVector4<T, A>& v2);
 
     /// <summary>
     /// Vector - scalar addition.
@@ -212,7 +212,7 @@ namespace Phanes::Core::Math
     /// <param name="s">Scalar</param>
     /// <returns>Computed vector.</returns>
     template<RealType T, bool A>
-    TVector4<T, A> operator+ (TVector4<T, A>& v1, T s);
+    TVector4<T, A> operator+ (const TVector4<T, A>& v1, T s);
 
     /// <summary>
     /// Vector substraction.
@@ -223,7 +223,7 @@ namespace Phanes::Core::Math
     /// <param name="v2">Vector two</param>
     /// <returns>Computed vector.</returns>
     template<RealType T, bool A>
-    TVector4<T, A> operator- (TVector4<T, A>& v1, const TVector4<T, A>& v2);
+    TVector4<T, A> operator- (const TVector4<T, A>& v1, const TVector4<T, A>& v2);
 
     /// <summary>
     /// Vector - scalar substraction.
@@ -234,7 +234,7 @@ namespace Phanes::Core::Math
     /// <param name="s">Scalar</param>
     /// <returns>Computed vector.</returns>
     template<RealType T, bool A>
-    TVector4<T, A> operator- (TVector4<T, A>& v1, T s);
+    TVector4<T, A> operator- (const TVector4<T, A>& v1, T s);
 
     /// <summary>
     /// Vector - scalar multiplication.
@@ -245,7 +245,7 @@ namespace Phanes::Core::Math
     /// <param name="s">Scalar</param>
     /// <returns>Computed vector.</returns>
     template<RealType T, bool A>
-    TVector4<T, A> operator* (TVector4<T, A>& v1, T s);
+    TVector4<T, A> operator* (const TVector4<T, A>& v1, T s);
 
     /// <summary>
     /// Scale vector by another vector componentwise.
@@ -256,7 +256,7 @@ namespace Phanes::Core::Math
     /// <param name="v2">Vector two</param>
     /// <returns>Computed vector.</returns>
     template<RealType T, bool A>
-    TVector4<T, A> operator* (TVector4<T, A>& v1, const TVector4<T, A>& v2);
+    TVector4<T, A> operator* (const TVector4<T, A>& v1, const TVector4<T, A>& v2);
 
     /// <summary>
     /// Vector - scalar division.
@@ -267,7 +267,7 @@ namespace Phanes::Core::Math
     /// <param name="s">Scalar</param>
     /// <returns>Computed vector.</returns>
     template<RealType T, bool A>
-    TVector4<T, A> operator/ (TVector4<T, A>& v1, T s);
+    TVector4<T, A> operator/ (const TVector4<T, A>& v1, T s);
 
     /// <summary>
     /// Componentwise vector division.
@@ -278,7 +278,7 @@ namespace Phanes::Core::Math
     /// <param name="v2">Vector two</param>
     /// <returns>Computed vector.</returns>
     template<RealType T, bool A>
-    TVector4<T, A> operator/ (TVector4<T, A>& v1, const TVector4<T, A>& v2);
+    TVector4<T, A> operator/ (const TVector4<T, A>& v1, const TVector4<T, A>& v2);
 
 
 
@@ -307,6 +307,51 @@ namespace Phanes::Core::Math
     template<RealType T, bool A>
     bool operator!=(const TVector4<T, A>& v1, const TVector4<T, A>& v2);
 
+    /// <summary>
+    /// Compares two vectors component-wise with a tolerance.
+    /// </summary>
+    /// <typeparam name="T">Type of vector</typeparam>
+    /// <typeparam name="A">Vector is aligned?</typeparam>
+    /// <param name="v1">Vector one</param>
+    /// <param name="v2">Vector two</param>
+    /// <param name="threshold">Allowed difference per component</param>
+    /// <returns>Bitmask with bit 0 for x to bit 3 for w. A bit is set, if the components are equal.</returns>
+    template<RealType T, bool A>
+    int CompareEq(const TVector4<T, A>& v1, const TVector4<T, A>& v2, T threshold = P_FLT_INAC);
+
+    /// <summary>
+    /// Compares two vectors component-wise.
+    /// </summary>
+    /// <typeparam name="T">Type of vector</typeparam>
+    /// <typeparam name="A">Vector is aligned?</typeparam>
+    /// <param name="v1">Vector one</param>
+    /// <param name="v2">Vector two</param>
+    /// <returns>Bitmask with bit 0 for x to bit 3 for w. A bit is set, if the component of v1 is less than the one of v2.</returns>
+    template<RealType T, bool A>
+    int CompareLess(const TVector4<T, A>& v1, const TVector4<T, A>& v2);
+
+    /// <summary>
+    /// Tests if all components of v1 are less than the ones of v2.
+    /// </summary>
+    /// <typeparam name="T">Type of vector</typeparam>
+    /// <typeparam name="A">Vector is aligned?</typeparam>
+    /// <param name="v1">Vector one</param>
+    /// <param name="v2">Vector two</param>
+    /// <returns><code>True</code>, if all components are less.</returns>
+    template<RealType T, bool A>
+    FORCEINLINE bool AllLess(const TVector4<T, A>& v1, const TVector4<T, A>& v2) { return CompareLess(v1, v2) == 0xF; };
+
+    /// <summary>
+    /// Tests if any component is near zero.
+    /// </summary>
+    /// <typeparam name="T">Type of vector</typeparam>
+    /// <typeparam name="A">Vector is aligned?</typeparam>
+    /// <param name="v">Vector</param>
+    /// <param name="threshold">Allowed difference to zero</param>
+    /// <returns><code>True</code>, if at least one component is near zero.</returns>
+    template<RealType T, bool A>
+    FORCEINLINE bool AnyNearZero(const TVector4<T, A>& v, T threshold = P_FLT_INAC) { return CompareEq(v, TVector4<T, A>((T)0.0), threshold) != 0; };
+
 
     
     
@@ -458,7 +503,7 @@ namespace Phanes::Core::Math
     {
         T vecNorm = Magnitude(v1);
 
-        vecNorm = (vecNorm < P_FLT_INAC) ? Magnitude(v1) : (T)1.0;
+        vecNorm = (vecNorm < P_FLT_INAC) ? (T)1.0 : vecNorm;
 
         return v1 / vecNorm;
     }
@@ -475,7 +520,7 @@ namespace Phanes::Core::Math
     {
         T vecNorm = Magnitude(v1);
 
-        vecNorm = (vecNorm < P_FLT_INAC) ? Magnitude(v1) : (T)1.0;
+        vecNorm = (vecNorm < P_FLT_INAC) ? (T)1.0 : vecNorm;
 
         v1 /= vecNorm;
 
@@ -671,6 +716,64 @@ namespace Phanes::Core::Math
         return v1;
     }
 
+    /// <summary>
+    /// Get magnitude of vector.
+    /// </summary>
+    /// <typeparam name="T">Type of vector</typeparam>
+    /// <param name="v">Vector</param>
+    /// <returns>Magnitude of vector.</returns>
+    template<RealType T>
+    T Magnitude(const TVector4<T, true>& v);
+
+    /// <summary>
+    /// Get square of magnitude of vector.
+    /// </summary>
+    /// <typeparam name="T">Type of vector</typeparam>
+    /// <param name="v">Vector</param>
+    /// <returns>Square of magnitude of vector.</returns>
+    template<RealType T>
+    T SqrMagnitude(const TVector4<T, true>& v);
+
+    /// <summary>
+    /// Normalizes a vector. Vectors shorter than P_FLT_INAC are returned unchanged.
+    /// </summary>
+    /// <typeparam name="T">Type of vector</typeparam>
+    /// <param name="v1">Vector</param>
+    /// <param name="p">Precision of the reciprocal square root.</param>
+    /// <returns>Normalized vector</returns>
+    template<RealType T>
+    TVector4<T, true> Normalize(const TVector4<T, true>& v1, EPrecision p = EPrecision::Exact);
+
+    /// <summary>
+    /// Normalizes a vector. Vectors shorter than P_FLT_INAC are left unchanged.
+    /// </summary>
+    /// <typeparam name="T">Type of vector</typeparam>
+    /// <param name="v1">Vector</param>
+    /// <param name="p">Precision of the reciprocal square root.</param>
+    /// <returns>Copy of v1.</returns>
+    template<RealType T>
+    TVector4<T, true> NormalizeV(TVector4<T, true>& v1, EPrecision p = EPrecision::Exact);
+
+    /// <summary>
+    /// Gets the reciprocal of the components of a vector.
+    /// </summary>
+    /// <typeparam name="T">Type of vector</typeparam>
+    /// <param name="v1">Vector</param>
+    /// <param name="p">Precision of the reciprocal.</param>
+    /// <returns>Vector with reciprocal of components.</returns>
+    template<RealType T>
+    TVector4<T, true> CompInverse(const TVector4<T, true>& v1, EPrecision p = EPrecision::Exact);
+
+    /// <summary>
+    /// Inverses the components of vector.
+    /// </summary>
+    /// <typeparam name="T">Type of vector</typeparam>
+    /// <param name="v1">Vector</param>
+    /// <param name="p">Precision of the reciprocal.</param>
+    /// <returns>Copy of v1.</returns>
+    template<RealType T>
+    TVector4<T, true> CompInverseV(TVector4<T, true>& v1, EPrecision p = EPrecision::Exact);
+
     /// <summary>
     /// Clamp the vectors length to a magnitude.
     /// </summary>
@@ -98,7 +98,7 @@ namespace Phanes::Core::Math
     }
 
     template<RealType T, bool S>
-    TVector4<T, S> operator+(TVector4<T, S>& v1, const TVector4<T, S>& v2)
+    TVector4<T, S> operator+(const TVector4<T, S>& v1, const TVector4<T, S>& v2)
     {
         TVector4<T, S> r; 
         Detail::compute_vec4_add<T, S>::map(r, v1, v2);
@@ -106,7 +106,7 @@ namespace Phanes::Core::Math
     }
 
     template<RealType T, bool S>
-    TVector4<T, S> operator+(TVector4<T, S>& v1, T s)
+    TVector4<T, S> operator+(const TVector4<T, S>& v1, T s)
     {
         TVector4<T, S> r;
         Detail::compute_vec4_add<T, S>::map(r, v1, s);
@@ -114,7 +114,7 @@ namespace Phanes::Core::Math
     }
 
     template<RealType T, bool S>
-    TVector4<T, S> operator-(TVector4<T, S>& v1, const TVector4<T, S>& v2)
+    TVector4<T, S> operator-(const TVector4<T, S>& v1, const TVector4<T, S>& v2)
     {
         TVector4<T, S> r;
         Detail::compute_vec4_sub<T, S>::map(r, v1, v2);
@@ -122,7 +122,7 @@ namespace Phanes::Core::Math
     }
 
     template<RealType T, bool S>
-    TVector4<T, S> operator-(TVector4<T, S>& v1, T s)
+    TVector4<T, S> operator-(const TVector4<T, S>& v1, T s)
     {
         TVector4<T, S> r;
         Detail::compute_vec4_sub<T, S>::map(r, v1, s);
@@ -130,7 +130,7 @@ namespace Phanes::Core::Math
     }
 
     template<RealType T, bool S>
-    TVector4<T, S> operator*(TVector4<T, S>& v1, const TVector4<T, S>& v2)
+    TVector4<T, S> operator*(const TVector4<T, S>& v1, const TVector4<T, S>& v2)
     {
         TVector4<T, S> r;
         Detail::compute_vec4_mul<T, S>::map(r, v1, v2);
@@ -138,7 +138,7 @@ namespace Phanes::Core::Math
     }
 
     template<RealType T, bool S>
-    TVector4<T, S> operator*(TVector4<T, S>& v1, T s)
+    TVector4<T, S> operator*(const TVector4<T, S>& v1, T s)
     {
         TVector4<T, S> r;
         Detail::compute_vec4_mul<T, S>::map(r, v1, s);
@@ -146,7 +146,7 @@ namespace Phanes::Core::Math
     }
 
     template<RealType T, bool S>
-    TVector4<T, S> operator/(TVector4<T, S>& v1, const TVector4<T, S>& v2)
+    TVector4<T, S> operator/(const TVector4<T, S>& v1, const TVector4<T, S>& v2)
     {
         TVector4<T, S> r;
         Detail::compute_vec4_div<T, S>::map(r, v1, v2);
@@ -154,7 +154,7 @@ namespace Phanes::Core::Math
     }
 
     template<RealType T, bool S>
-    TVector4<T, S> operator/(TVector4<T, S>& v1, T s)
+    TVector4<T, S> operator/(const TVector4<T, S>& v1, T s)
     {
         TVector4<T, S> r;
         Detail::compute_vec4_div<T, S>::map(r, v1, s);
@@ -175,6 +175,18 @@ namespace Phanes::Core::Math
         return Detail::compute_vec4_ieq<T, S>::map(v1, v2);
     }
 
+    template<RealType T, bool S>
+    int CompareEq(const TVector4<T, S>& v1, const TVector4<T, S>& v2, T threshold)
+    {
+        return Detail::compute_vec4_eq_mask<T, S>::map(v1, v2, threshold);
+    }
+
+    template<RealType T, bool S>
+    int CompareLess(const TVector4<T, S>& v1, const TVector4<T, S>& v2)
+    {
+        return Detail::compute_vec4_lt_mask<T, S>::map(v1, v2);
+    }
+
     
     
     // Inc- / Decrement
@@ -183,14 +195,14 @@ namespace Phanes::Core::Math
     template<RealType T, bool S>
     TVector4<T, S>& operator++(TVector4<T, S>& v1)
     {
-        Detail::compute_vec4_inc<T, S>::map(v1);
+        Detail::compute_vec4_inc<T, S>::map(v1, v1);
         return v1;
     }
 
     template<RealType T, bool S>
     TVector4<T, S>& operator--(TVector4<T, S>& v1)
     {
-        Detail::compute_vec4_dec<T, S>::map(v1);
+        Detail::compute_vec4_dec<T, S>::map(v1, v1);
         return v1;
     }
 
@@ -209,6 +221,48 @@ namespace Phanes::Core::Math
     template<RealType T>
     T DotP(const TVector4<T, true>& v1, const TVector4<T, true>& v2)
     {
-        return vec4_dot_cvtf32(v1.data, v2.data);
+        return Detail::compute_vec4_dot<T, true>::map(v1, v2);
+    }
+
+    template<RealType T>
+    T Magnitude(const TVector4<T, true>& v)
+    {
+        return sqrt(DotP(v, v));
+    }
+
+    template<RealType T>
+    T SqrMagnitude(const TVector4<T, true>& v)
+    {
+        return DotP(v, v);
+    }
+
+    template<RealType T>
+    TVector4<T, true> Normalize(const TVector4<T, true>& v1, EPrecision p)
+    {
+        TVector4<T, true> r;
+        Detail::compute_vec4_normalize<T, true>::map(r, v1, p);
+        return r;
+    }
+
+    template<RealType T>
+    TVector4<T, true> NormalizeV(TVector4<T, true>& v1, EPrecision p)
+    {
+        Detail::compute_vec4_normalize<T, true>::map(v1, v1, p);
+        return v1;
+    }
+
+    template<RealType T>
+    TVector4<T, true> CompInverse(const TVector4<T, true>& v1, EPrecision p)
+    {
+        TVector4<T, true> r;
+        Detail::compute_vec4_rcp<T, true>::map(r, v1, p);
+        return r;
+    }
+
+    template<RealType T>
+    TVector4<T, true> CompInverseV(TVector4<T, true>& v1, EPrecision p)
+    {
+        Detail::compute_vec4_rcp<T, true>::map(v1, v1, p);
+        return v1;
     }
-}
\ No newline at end of file
+}
@@ -0,0 +1,327 @@
+#pragma once
+
+// Operations on arrays of TVector4<float>. Kernels are selected through SIMD/Dispatch.h.
+//
+// r may alias v1 or v2. The spans passed to one function must have the same size.
+
+#include <cassert>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+
+#include "Core/public/Math/Boilerplate.h"
+#include "Core/public/Math/SIMD/Dispatch.h"
+
+#include "Core/public/Math/Vector4.hpp"
+
+
+namespace Phanes::Core::Math
+{
+    static_assert(sizeof(TVector4<float, false>) == 4 * sizeof(float), "TVector4<float> must be tightly packed.");
+
+    /// <summary>
+    /// Adds vectors component-wise.
+    /// </summary>
+    /// <param name="r">Result</param>
+    /// <param name="v1">Vectors one</param>
+    /// <param name="v2">Vectors two</param>
+    /// <param name="n">Number of vectors</param>
+    template<bool S>
+    void BatchAdd(TVector4<float, S>* r, const TVector4<float, S>* v1, const TVector4<float, S>* v2, size_t n)
+    {
+        SIMD::GetDispatchTable().vec4_add_array(&r->x, &v1->x, &v2->x, n);
+    }
+
+    /// <summary>
+    /// Subtracts vectors component-wise.
+    /// </summary>
+    /// <param name="r">Result</param>
+    /// <param name="v1">Vectors one</param>
+    /// <param name="v2">Vectors two</param>
+    /// <param name="n">Number of vectors</param>
+    template<bool S>
+    void BatchSub(TVector4<float, S>* r, const TVector4<float, S>* v1, const TVector4<float, S>* v2, size_t n)
+    {
+        SIMD::GetDispatchTable().vec4_sub_array(&r->x, &v1->x, &v2->x, n);
+    }
+
+    /// <summary>
+    /// Multiplies vectors component-wise.
+    /// </summary>
+    /// <param name="r">Result</param>
+    /// <param name="v1">Vectors one</param>
+    /// <param name="v2">Vectors two</param>
+    /// <param name="n">Number of vectors</param>
+    template<bool S>
+    void BatchMul(TVector4<float, S>* r, const TVector4<float, S>* v1, const TVector4<float, S>* v2, size_t n)
+    {
+        SIMD::GetDispatchTable().vec4_mul_array(&r->x, &v1->x, &v2->x, n);
+    }
+
+    /// <summary>
+    /// Divides vectors component-wise.
+    /// </summary>
+    /// <param name="r">Result</param>
+    /// <param name="v1">Vectors one</param>
+    /// <param name="v2">Vectors two</param>
+    /// <param name="n">Number of vectors</param>
+    template<bool S>
+    void BatchDiv(TVector4<float, S>* r, const TVector4<float, S>* v1, const TVector4<float, S>* v2, size_t n)
+    {
+        SIMD::GetDispatchTable().vec4_div_array(&r->x, &v1->x, &v2->x, n);
+    }
+
+    /// <summary>
+    /// Gets the dot product of each vector pair.
+    /// </summary>
+    /// <param name="r">Dot products</param>
+    /// <param name="v1">Vectors one</param>
+    /// <param name="v2">Vectors two</param>
+    /// <param name="n">Number of vectors</param>
+    template<bool S>
+    void BatchDotP(float* r, const TVector4<float, S>* v1, const TVector4<float, S>* v2, size_t n)
+    {
+        SIMD::GetDispatchTable().vec4_dot_array(r, &v1->x, &v2->x, n);
+    }
+
+    /// <summary>
+    /// Compares each vector pair with a tolerance.
+    /// </summary>
+    /// <param name="r">Results</param>
+    /// <param name="v1">Vectors one</param>
+    /// <param name="v2">Vectors two</param>
+    /// <param name="n">Number of vectors</param>
+    /// <param name="threshold">Allowed difference per component</param>
+    template<bool S>
+    void BatchEquals(bool* r, const TVector4<float, S>* v1, const TVector4<float, S>* v2, size_t n, float threshold = P_FLT_INAC)
+    {
+        SIMD::GetDispatchTable().vec4_eq_array(r, &v1->x, &v2->x, n, threshold);
+    }
+
+    /// <summary>
+    /// Normalizes vectors. Vectors with a length smaller than P_FLT_INAC are set to zero.
+    /// </summary>
+    /// <param name="r">Normalized vectors</param>
+    /// <param name="v">Vectors</param>
+    /// <param name="n">Number of vectors</param>
+    /// <param name="p">Precision of the reciprocal square root</param>
+    template<bool S>
+    void BatchNormalize(TVector4<float, S>* r, const TVector4<float, S>* v, size_t n, EPrecision p = EPrecision::Exact)
+    {
+        if (p == EPrecision::Exact)
+        {
+            SIMD::GetDispatchTable().vec4_normalize_array(&r->x, &v->x, n, P_FLT_INAC);
+        }
+        else
+        {
+            SIMD::GetDispatchTable().vec4_normalize_est_array(&r->x, &v->x, n, P_FLT_INAC, p == EPrecision::Refined);
+        }
+    }
+
+    /// <summary>
+    /// Gets the length of each vector.
+    /// </summary>
+    /// <param name="r">Lengths</param>
+    /// <param name="v">Vectors</param>
+    /// <param name="n">Number of vectors</param>
+    template<bool S>
+    void BatchMagnitude(float* r, const TVector4<float, S>* v, size_t n)
+    {
+        SIMD::GetDispatchTable().vec4_magnitude_array(r, &v->x, n);
+    }
+
+    /// <summary>
+    /// Interpolates each vector pair linearly.
+    /// </summary>
+    /// <param name="r">Interpolated vectors</param>
+    /// <param name="start">Start vectors</param>
+    /// <param name="dest">Destination vectors</param>
+    /// <param name="n">Number of vectors</param>
+    /// <param name="t">Interpolation value. Clamped between 0 - 1, like Lerp.</param>
+    template<bool S>
+    void BatchLerp(TVector4<float, S>* r, const TVector4<float, S>* start, const TVector4<float, S>* dest, size_t n, float t)
+    {
+        t = Clamp(t, 0.0f, 1.0f);
+        SIMD::GetDispatchTable().vec4_lerp_array(&r->x, &start->x, &dest->x, n, t);
+    }
+
+    /// <summary>
+    /// Gets the component-wise minimum of all vectors.
+    /// </summary>
+    /// <param name="v">Vectors</param>
+    /// <param name="n">Number of vectors</param>
+    /// <returns>Minimum, or zero vector if n is 0.</returns>
+    template<bool S>
+    TVector4<float, S> BatchMinV(const TVector4<float, S>* v, size_t n)
+    {
+        float m[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+
+        if (n > 0)
+        {
+            SIMD::GetDispatchTable().vec4_min_reduce(m, &v->x, n);
+        }
+        return TVector4<float, S>(m[0], m[1], m[2], m[3]);
+    }
+
+    /// <summary>
+    /// Gets the component-wise maximum of all vectors.
+    /// </summary>
+    /// <param name="v">Vectors</param>
+    /// <param name="n">Number of vectors</param>
+    /// <returns>Maximum, or zero vector if n is 0.</returns>
+    template<bool S>
+    TVector4<float, S> BatchMaxV(const TVector4<float, S>* v, size_t n)
+    {
+        float m[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+
+        if (n > 0)
+        {
+            SIMD::GetDispatchTable().vec4_max_reduce(m, &v->x, n);
+        }
+        return TVector4<float, S>(m[0], m[1], m[2], m[3]);
+    }
+
+    // ========= //
+    //   Spans   //
+    // ========= //
+
+    /// <summary>
+    /// Adds vectors component-wise.
+    /// </summary>
+    /// <param name="r">Result</param>
+    /// <param name="v1">Vectors one</param>
+    /// <param name="v2">Vectors two</param>
+    template<bool S = false>
+    void BatchAdd(std::span<std::type_identity_t<TVector4<float, S>>> r, std::span<const std::type_identity_t<TVector4<float, S>>> v1, std::span<const std::type_identity_t<TVector4<float, S>>> v2)
+    {
+        assert(r.size() == v1.size() && r.size() == v2.size());
+        BatchAdd(r.data(), v1.data(), v2.data(), r.size());
+    }
+
+    /// <summary>
+    /// Subtracts vectors component-wise.
+    /// </summary>
+    /// <param name="r">Result</param>
+    /// <param name="v1">Vectors one</param>
+    /// <param name="v2">Vectors two</param>
+    template<bool S = false>
+    void BatchSub(std::span<std::type_identity_t<TVector4<float, S>>> r, std::span<const std::type_identity_t<TVector4<float, S>>> v1, std::span<const std::type_identity_t<TVector4<float, S>>> v2)
+    {
+        assert(r.size() == v1.size() && r.size() == v2.size());
+        BatchSub(r.data(), v1.data(), v2.data(), r.size());
+    }
+
+    /// <summary>
+    /// Multiplies vectors component-wise.
+    /// </summary>
+    /// <param name="r">Result</param>
+    /// <param name="v1">Vectors one</param>
+    /// <param name="v2">Vectors two</param>
+    template<bool S = false>
+    void BatchMul(std::span<std::type_identity_t<TVector4<float, S>>> r, std::span<const std::type_identity_t<TVector4<float, S>>> v1, std::span<const std::type_identity_t<TVector4<float, S>>> v2)
+    {
+        assert(r.size() == v1.size() && r.size() == v2.size());
+        BatchMul(r.data(), v1.data(), v2.data(), r.size());
+    }
+
+    /// <summary>
+    /// Divides vectors component-wise.
+    /// </summary>
+    /// <param name="r">Result</param>
+    /// <param name="v1">Vectors one</param>
+    /// <param name="v2">Vectors two</param>
+    template<bool S = false>
+    void BatchDiv(std::span<std::type_identity_t<TVector4<float, S>>> r, std::span<const std::type_identity_t<TVector4<float, S>>> v1, std::span<const std::type_identity_t<TVector4<float, S>>> v2)
+    {
+        assert(r.size() == v1.size() && r.size() == v2.size());
+        BatchDiv(r.data(), v1.data(), v2.data(), r.size());
+    }
+
+    /// <summary>
+    /// Gets the dot product of each vector pair.
+    /// </summary>
+    /// <param name="r">Dot products</param>
+    /// <param name="v1">Vectors one</param>
+    /// <param name="v2">Vectors two</param>
+    template<bool S = false>
+    void BatchDotP(std::span<float> r, std::span<const std::type_identity_t<TVector4<float, S>>> v1, std::span<const std::type_identity_t<TVector4<float, S>>> v2)
+    {
+        assert(r.size() == v1.size() && r.size() == v2.size());
+        BatchDotP(r.data(), v1.data(), v2.data(), r.size());
+    }
+
+    /// <summary>
+    /// Compares each vector pair with a tolerance.
+    /// </summary>
+    /// <param name="r">Results</param>
+    /// <param name="v1">Vectors one</param>
+    /// <param name="v2">Vectors two</param>
+    /// <param name="threshold">Allowed difference per component</param>
+    template<bool S = false>
+    void BatchEquals(std::span<bool> r, std::span<const std::type_identity_t<TVector4<float, S>>> v1, std::span<const std::type_identity_t<TVector4<float, S>>> v2, float threshold = P_FLT_INAC)
+    {
+        assert(r.size() == v1.size() && r.size() == v2.size());
+        BatchEquals(r.data(), v1.data(), v2.data(), r.size(), threshold);
+    }
+
+    /// <summary>
+    /// Normalizes vectors. Vectors with a length smaller than P_FLT_INAC are set to zero.
+    /// </summary>
+    /// <param name="r">Normalized vectors</param>
+    /// <param name="v">Vectors</param>
+    /// <param name="p">Precision of the reciprocal square root</param>
+    template<bool S = false>
+    void BatchNormalize(std::span<std::type_identity_t<TVector4<float, S>>> r, std::span<const std::type_identity_t<TVector4<float, S>>> v, EPrecision p = EPrecision::Exact)
+    {
+        assert(r.size() == v.size());
+        BatchNormalize(r.data(), v.data(), r.size(), p);
+    }
+
+    /// <summary>
+    /// Gets the length of each vector.
+    /// </summary>
+    /// <param name="r">Lengths</param>
+    /// <param name="v">Vectors</param>
+    template<bool S = false>
+    void BatchMagnitude(std::span<float> r, std::span<const std::type_identity_t<TVector4<float, S>>> v)
+    {
+        assert(r.size() == v.size());
+        BatchMagnitude(r.data(), v.data(), r.size());
+    }
+
+    /// <summary>
+    /// Interpolates each vector pair linearly.
+    /// </summary>
+    /// <param name="r">Interpolated vectors</param>
+    /// <param name="start">Start vectors</param>
+    /// <param name="dest">Destination vectors</param>
+    /// <param name="t">Interpolation value. Clamped between 0 - 1, like Lerp.</param>
+    template<bool S = false>
+    void BatchLerp(std::span<std::type_identity_t<TVector4<float, S>>> r, std::span<const std::type_identity_t<TVector4<float, S>>> start, std::span<const std::type_identity_t<TVector4<float, S>>> dest, float t)
+    {
+        assert(r.size() == start.size() && r.size() == dest.size());
+        BatchLerp(r.data(), start.data(), dest.data(), r.size(), t);
+    }
+
+    /// <summary>
+    /// Gets the component-wise minimum of all vectors.
+    /// </summary>
+    /// <param name="v">Vectors</param>
+    /// <returns>Minimum, or zero vector if v is empty.</returns>
+    template<bool S = false>
+    TVector4<float, S> BatchMinV(std::span<const std::type_identity_t<TVector4<float, S>>> v)
+    {
+        return BatchMinV(v.data(), v.size());
+    }
+
+    /// <summary>
+    /// Gets the component-wise maximum of all vectors.
+    /// </summary>
+    /// <param name="v">Vectors</param>
+    /// <returns>Maximum, or zero vector if v is empty.</returns>
+    template<bool S = false>
+    TVector4<float, S> BatchMaxV(std::span<const std::type_identity_t<TVector4<float, S>>> v)
+    {
+        return BatchMaxV(v.data(), v.size());
+    }
+}
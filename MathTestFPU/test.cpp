@@ -1,10 +1,52 @@
 #include "pch.h"
 
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <type_traits>
+#include <vector>
+
 #include "Core/public/Math/Include.h"
 
 namespace PMath = Phanes::Core::Math;
 using namespace Phanes::Core::Math::UnitLiterals;
 
+// Helpers shared by the test namespaces.
+
+PMath::TQuaternion<float, false> RandomRotation(std::mt19937& rng)
+{
+    std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+    return PMath::Normalize(PMath::TQuaternion<float, false>(dist(rng), dist(rng), dist(rng), dist(rng)));
+}
+
+void ExpectNear(const PMath::TVector3<float, false>& v1, const PMath::TVector3<float, false>& v2, float threshold)
+{
+    EXPECT_NEAR(v1.x, v2.x, threshold);
+    EXPECT_NEAR(v1.y, v2.y, threshold);
+    EXPECT_NEAR(v1.z, v2.z, threshold);
+}
+
+void ExpectNear(const PMath::TQuaternion<float, false>& q1, const PMath::TQuaternion<float, false>& q2, float threshold)
+{
+    EXPECT_NEAR(q1.x, q2.x, threshold);
+    EXPECT_NEAR(q1.y, q2.y, threshold);
+    EXPECT_NEAR(q1.z, q2.z, threshold);
+    EXPECT_NEAR(q1.w, q2.w, threshold);
+}
+
+void ExpectNear(const PMath::TMatrix4<float, false>& m1, const PMath::TMatrix4<float, false>& m2, float threshold)
+{
+    for (int i = 0; i < 4; ++i)
+    {
+        for (int j = 0; j < 4; ++j)
+        {
+            EXPECT_NEAR(m1(i, j), m2(i, j), threshold);
+        }
+    }
+}
+
 namespace VectorTests
 {
     TEST(Vector2, OperatorTests) 
@@ -231,6 +273,57 @@ namespace VectorTests
         EXPECT_FALSE(r != PMath::Vector3(0.6f, 0.775f, 1.4f));
     }
 
+    // The padding lane of aligned vectors must stay 0, or DotP picks it up.
+    TEST(Vector3, AlignedPaddingTests)
+    {
+        PMath::TVector3<float, true> v0(1.0f, 2.0f, 3.0f);
+        v0 += 1.0f;
+        EXPECT_FLOAT_EQ(PMath::DotP(v0, v0), 29.0f);
+
+        PMath::TVector3<float, true> v1(1.0f, 2.0f, 3.0f);
+        ++v1;
+        EXPECT_FLOAT_EQ(PMath::DotP(v1, v1), 29.0f);
+
+        PMath::TVector3<float, true> v2(1.0f, 2.0f, 3.0f);
+        v2 /= PMath::TVector3<float, true>(1.0f, 2.0f, 3.0f);
+        EXPECT_FLOAT_EQ(PMath::DotP(v2, v2), 3.0f);
+
+        v2 = PMath::TVector3<float, true>(2.0f, 4.0f, 6.0f) / 2.0f;
+        EXPECT_FLOAT_EQ(PMath::DotP(v2, v2), 14.0f);
+
+        // SSE builds have no aligned double vectors.
+#if P_INTRINSICS != P_INTRINSICS_SSE
+        PMath::TVector3<double, true> d0(1.0, 2.0, 3.0);
+        d0 += 1.0;
+        EXPECT_DOUBLE_EQ(PMath::DotP(d0, d0), 29.0);
+
+        PMath::TVector3<double, true> d1(1.0, 2.0, 3.0);
+        ++d1;
+        EXPECT_DOUBLE_EQ(PMath::DotP(d1, d1), 29.0);
+
+        PMath::TVector3<double, true> d2(1.0, 2.0, 3.0);
+        d2 /= PMath::TVector3<double, true>(1.0, 2.0, 3.0);
+        EXPECT_DOUBLE_EQ(PMath::DotP(d2, d2), 3.0);
+
+        --d2;
+        EXPECT_DOUBLE_EQ(PMath::DotP(d2, d2), 0.0);
+#endif
+    }
+
+    // Aligned and unaligned Normalize set vectors shorter than P_FLT_INAC to zero.
+    TEST(Vector3, NormalizeShortTests)
+    {
+        const PMath::TVector3<float, true> a = PMath::Normalize(PMath::TVector3<float, true>(1e-7f, 0.0f, 0.0f));
+        const PMath::TVector3<float, false> u = PMath::Normalize(PMath::TVector3<float, false>(1e-7f, 0.0f, 0.0f));
+
+        EXPECT_EQ(a.x, 0.0f);
+        EXPECT_EQ(u.x, 0.0f);
+
+        const PMath::TVector3<float, true> b = PMath::Normalize(PMath::TVector3<float, true>(3.0f, 4.0f, 0.0f));
+        EXPECT_FLOAT_EQ(b.x, 0.6f);
+        EXPECT_FLOAT_EQ(b.y, 0.8f);
+    }
+
     TEST(Vector3, FunctionTest)
     {
         PMath::Vector3 v0(2.4f, 3.1f, 5.6f);
@@ -294,4 +387,2055 @@ namespace VectorTests
         // Re-init vector
         v0 = PMath::Vector3(2.4f, 3.1f, 5.6f);
     }
-}
\ No newline at end of file
+
+    // Components just inside and just outside the tolerance. Aligned float and double use the SIMD masks.
+    template<typename T, bool S>
+    void ExpectVector3CompareMasks()
+    {
+        using V = PMath::TVector3<T, S>;
+
+        const T in = (T)0.009;
+        const T out = (T)0.011;
+        const V v((T)1.0, (T)-2.0, (T)3.0);
+
+        EXPECT_EQ(PMath::CompareEq(v, V(v.x + in, v.y + out, v.z - in), (T)0.01), 0x5);
+        EXPECT_EQ(PMath::CompareEq(v, V(v.x - out, v.y - in, v.z + out), (T)0.01), 0x2);
+        EXPECT_EQ(PMath::CompareEq(v, v, (T)0.01), 0x7);
+
+        // The default tolerance is P_FLT_INAC.
+        EXPECT_EQ(PMath::CompareEq(v, V(v.x + (T)0.5e-5, v.y + (T)2e-5, v.z)), 0x5);
+
+        // Equal components are not less.
+        EXPECT_EQ(PMath::CompareLess(v, V((T)1.0, (T)-1.0, (T)2.0)), 0x2);
+        EXPECT_EQ(PMath::CompareLess(v, V((T)1.001, (T)-3.0, (T)3.001)), 0x5);
+        EXPECT_TRUE(PMath::AllLess(v, V((T)1.001, (T)-1.999, (T)3.001)));
+        EXPECT_FALSE(PMath::AllLess(v, V((T)1.001, (T)-1.999, (T)3.0)));
+
+        EXPECT_TRUE(PMath::AnyNearZero(V((T)1.0, in, (T)2.0), (T)0.01));
+        EXPECT_TRUE(PMath::AnyNearZero(V((T)1.0, (T)2.0, -in), (T)0.01));
+        EXPECT_FALSE(PMath::AnyNearZero(V(out, -out, (T)2.0), (T)0.01));
+        EXPECT_TRUE(PMath::AnyNearZero(V((T)0.5e-5, (T)1.0, (T)1.0)));
+        EXPECT_FALSE(PMath::AnyNearZero(V((T)2e-5, (T)1.0, (T)1.0)));
+    }
+
+    template<typename T, bool S>
+    void ExpectVector4CompareMasks()
+    {
+        using V = PMath::TVector4<T, S>;
+
+        const T in = (T)0.009;
+        const T out = (T)0.011;
+        const V v((T)1.0, (T)-2.0, (T)3.0, (T)-4.0);
+
+        EXPECT_EQ(PMath::CompareEq(v, V(v.x + in, v.y + out, v.z - in, v.w - out), (T)0.01), 0x5);
+        EXPECT_EQ(PMath::CompareEq(v, V(v.x - out, v.y - in, v.z + out, v.w + in), (T)0.01), 0xA);
+        EXPECT_EQ(PMath::CompareEq(v, v, (T)0.01), 0xF);
+
+        // The default tolerance is P_FLT_INAC.
+        EXPECT_EQ(PMath::CompareEq(v, V(v.x + (T)0.5e-5, v.y + (T)2e-5, v.z, v.w - (T)2e-5)), 0x5);
+
+        // Equal components are not less.
+        EXPECT_EQ(PMath::CompareLess(v, V((T)1.0, (T)-1.0, (T)2.0, (T)-3.0)), 0xA);
+        EXPECT_EQ(PMath::CompareLess(v, V((T)1.001, (T)-3.0, (T)3.001, (T)-4.0)), 0x5);
+        EXPECT_TRUE(PMath::AllLess(v, V((T)1.001, (T)-1.999, (T)3.001, (T)-3.999)));
+        EXPECT_FALSE(PMath::AllLess(v, V((T)1.001, (T)-1.999, (T)3.001, (T)-4.0)));
+
+        EXPECT_TRUE(PMath::AnyNearZero(V((T)1.0, (T)2.0, (T)3.0, in), (T)0.01));
+        EXPECT_TRUE(PMath::AnyNearZero(V(-in, (T)1.0, (T)2.0, (T)3.0), (T)0.01));
+        EXPECT_FALSE(PMath::AnyNearZero(V(out, -out, (T)2.0, out), (T)0.01));
+        EXPECT_TRUE(PMath::AnyNearZero(V((T)1.0, (T)1.0, (T)1.0, (T)0.5e-5)));
+        EXPECT_FALSE(PMath::AnyNearZero(V((T)1.0, (T)1.0, (T)1.0, (T)2e-5)));
+    }
+
+    TEST(Vector3, CompareTests)
+    {
+        ExpectVector3CompareMasks<float, false>();
+        ExpectVector3CompareMasks<float, true>();
+
+        // SSE builds have no aligned double vectors.
+#if P_INTRINSICS != P_INTRINSICS_SSE
+        ExpectVector3CompareMasks<double, true>();
+#endif
+    }
+
+    TEST(Vector4, CompareTests)
+    {
+        ExpectVector4CompareMasks<float, false>();
+        ExpectVector4CompareMasks<float, true>();
+
+        // SSE builds have no aligned double vectors.
+#if P_INTRINSICS != P_INTRINSICS_SSE
+        ExpectVector4CompareMasks<double, true>();
+#endif
+    }
+}
+
+namespace MatrixTests
+{
+    TEST(Matrix4, ProductTests)
+    {
+        PMath::TMatrix4<float, true> m0(1.0f,  2.0f,  3.0f,  4.0f,
+                                        5.0f,  6.0f,  7.0f,  8.0f,
+                                        9.0f,  10.0f, 11.0f, 12.0f,
+                                        13.0f, 14.0f, 15.0f, 17.0f);
+
+        PMath::TMatrix4<float, true> m1(2.0f, 0.0f, 0.0f, 1.0f,
+                                        0.0f, 3.0f, 0.0f, 0.0f,
+                                        0.0f, 0.0f, 4.0f, 0.0f,
+                                        0.0f, 0.0f, 0.0f, 1.0f);
+
+        PMath::TMatrix4<float, true> m2 = m0 * m1;
+
+        EXPECT_FLOAT_EQ(m2(0, 0), 2.0f);
+        EXPECT_FLOAT_EQ(m2(1, 1), 18.0f);
+        EXPECT_FLOAT_EQ(m2(2, 2), 44.0f);
+        EXPECT_FLOAT_EQ(m2(0, 3), 5.0f);
+        EXPECT_FLOAT_EQ(m2(3, 3), 30.0f);
+
+        PMath::TVector4<float, true> v0 = m0 * PMath::TVector4<float, true>(1.0f, 2.0f, 3.0f, 4.0f);
+
+        EXPECT_FLOAT_EQ(v0.x, 30.0f);
+        EXPECT_FLOAT_EQ(v0.y, 70.0f);
+        EXPECT_FLOAT_EQ(v0.z, 110.0f);
+        EXPECT_FLOAT_EQ(v0.w, 154.0f);
+
+        m0 *= m1;
+        EXPECT_FLOAT_EQ(m0(3, 0), 26.0f);
+    }
+
+    TEST(Matrix3, InverseTests)
+    {
+        PMath::TMatrix3<float, true> m0(2.0f, 0.0f, 1.0f,
+                                        1.0f, 3.0f, 2.0f,
+                                        1.0f, 1.0f, 2.0f);
+
+        EXPECT_FLOAT_EQ(PMath::Determinant(m0), 6.0f);
+
+        PMath::TVector3<float, true> v0 = m0 * PMath::TVector3<float, true>(1.0f, 2.0f, 3.0f);
+
+        EXPECT_FLOAT_EQ(v0.x, 5.0f);
+        EXPECT_FLOAT_EQ(v0.y, 13.0f);
+        EXPECT_FLOAT_EQ(v0.z, 9.0f);
+
+        PMath::TMatrix3<float, true> m1;
+        EXPECT_TRUE(PMath::Inverse(m1, m0));
+
+        PMath::TMatrix3<float, true> m2 = m1 * m0;
+
+        for (int i = 0; i < 3; ++i)
+        {
+            for (int j = 0; j < 3; ++j)
+            {
+                EXPECT_NEAR(m2(i, j), (i == j) ? 1.0f : 0.0f, 1e-5f);
+            }
+        }
+
+        PMath::TMatrix3<float, true> m3(1.0f, 2.0f, 3.0f,
+                                        2.0f, 4.0f, 6.0f,
+                                        0.0f, 1.0f, 1.0f);
+
+        EXPECT_FALSE(PMath::InverseV(m3));
+        EXPECT_FLOAT_EQ(m3(1, 0), 2.0f);
+    }
+
+    // Every element, including the last row, is compared just inside and just outside P_FLT_INAC.
+    template<bool S>
+    void ExpectMatrix4Equality()
+    {
+        using Mat4 = PMath::TMatrix4<float, S>;
+
+        const Mat4 identity(1.0f, 0.0f, 0.0f, 0.0f,
+                            0.0f, 1.0f, 0.0f, 0.0f,
+                            0.0f, 0.0f, 1.0f, 0.0f,
+                            0.0f, 0.0f, 0.0f, 1.0f);
+
+        EXPECT_TRUE(identity == identity);
+        EXPECT_TRUE(PMath::IsIndentityMatrix(identity));
+
+        for (int i = 0; i < 4; ++i)
+        {
+            for (int j = 0; j < 4; ++j)
+            {
+                Mat4 m = identity;
+
+                m(i, j) += 0.5e-5f;
+                EXPECT_TRUE(m == identity) << i << ", " << j;
+                EXPECT_FALSE(m != identity) << i << ", " << j;
+                EXPECT_TRUE(PMath::IsIndentityMatrix(m)) << i << ", " << j;
+
+                m(i, j) += 1.5e-5f;
+                EXPECT_FALSE(m == identity) << i << ", " << j;
+                EXPECT_TRUE(m != identity) << i << ", " << j;
+                EXPECT_FALSE(PMath::IsIndentityMatrix(m)) << i << ", " << j;
+            }
+        }
+
+        // The last row of a projection differs from the identity in (3, 2) and (3, 3) only.
+        Mat4 p = identity;
+        p(3, 2) = -1.0f;
+        p(3, 3) = 0.0f;
+        EXPECT_FALSE(p == identity);
+        EXPECT_FALSE(PMath::IsIndentityMatrix(p));
+
+        p(3, 2) = 0.0f;
+        EXPECT_FALSE(PMath::IsIndentityMatrix(p));
+    }
+
+    template<bool S>
+    void ExpectMatrix3Equality()
+    {
+        using Mat3 = PMath::TMatrix3<float, S>;
+
+        const Mat3 identity(1.0f, 0.0f, 0.0f,
+                            0.0f, 1.0f, 0.0f,
+                            0.0f, 0.0f, 1.0f);
+
+        EXPECT_TRUE(identity == identity);
+        EXPECT_TRUE(PMath::IsIdentityMatrix(identity));
+
+        for (int i = 0; i < 3; ++i)
+        {
+            for (int j = 0; j < 3; ++j)
+            {
+                Mat3 m = identity;
+
+                m(i, j) += 0.5e-5f;
+                EXPECT_TRUE(m == identity) << i << ", " << j;
+                EXPECT_TRUE(PMath::IsIdentityMatrix(m)) << i << ", " << j;
+
+                m(i, j) += 1.5e-5f;
+                EXPECT_FALSE(m == identity) << i << ", " << j;
+                EXPECT_FALSE(PMath::IsIdentityMatrix(m)) << i << ", " << j;
+            }
+        }
+    }
+
+    TEST(Matrix4, EqualityTests)
+    {
+        ExpectMatrix4Equality<false>();
+        ExpectMatrix4Equality<true>();
+    }
+
+    TEST(Matrix3, EqualityTests)
+    {
+        ExpectMatrix3Equality<false>();
+        ExpectMatrix3Equality<true>();
+    }
+}
+
+namespace BVHTests
+{
+    using Box = PMath::TAABB<float, false>;
+    using Ray = PMath::TRay<float, false>;
+    using Vec = PMath::TVector3<float, false>;
+
+    // Boxes are the primitives. A hit is where the ray enters the box.
+    bool IntersectBox(const Box& b, const Ray& r, float& t)
+    {
+        float tExit;
+        return PMath::RayIntersect(b, r, t, tExit);
+    }
+
+    size_t MaxDepth(const PMath::TBVH<float, false>& bvh)
+    {
+        size_t depth = 0;
+        std::vector<std::pair<uint32_t, size_t>> stack = { { 0u, 1u } };
+
+        while (!stack.empty())
+        {
+            auto [i, d] = stack.back();
+            stack.pop_back();
+
+            depth = std::max(depth, d);
+            if (bvh.nodes[i].count == 0)
+            {
+                stack.push_back({ i + 1, d + 1 });
+                stack.push_back({ bvh.nodes[i].offset, d + 1 });
+            }
+        }
+
+        return depth;
+    }
+
+    // Compares closest hit, any hit and overlap queries against testing every box.
+    void ExpectBruteForceParity(const std::vector<Box>& boxes, const PMath::BVHBuildOptions& options, std::mt19937& rng)
+    {
+        std::uniform_real_distribution<float> dist(-60.0f, 60.0f);
+
+        PMath::TBVH<float, false> bvh = PMath::BuildBVH<float, false>(boxes, options);
+
+        // Every primitive is in exactly one leaf.
+        std::vector<int> seen(boxes.size(), 0);
+        for (const auto& node : bvh.nodes)
+        {
+            for (uint32_t i = node.offset; node.count > 0 && i < node.offset + node.count; ++i)
+            {
+                seen[bvh.indices[i]]++;
+            }
+        }
+        EXPECT_EQ(std::count(seen.begin(), seen.end(), 1), (std::ptrdiff_t)boxes.size());
+
+        auto intersect = [&](uint32_t i, const Ray& r, float& t) { return IntersectBox(boxes[i], r, t); };
+
+        for (int q = 0; q < 200; ++q)
+        {
+            Vec d(dist(rng), dist(rng), dist(rng));
+            if (q % 5 == 0)
+            {
+                d = Vec(dist(rng), 0.0f, 0.0f);
+            }
+            const Ray r(d, Vec(dist(rng), dist(rng), dist(rng)));
+
+            float tBest = std::numeric_limits<float>::infinity();
+            for (const Box& b : boxes)
+            {
+                float t;
+                if (IntersectBox(b, r, t))
+                {
+                    tBest = std::min(tBest, t);
+                }
+            }
+            const bool anyBest = tBest < std::numeric_limits<float>::infinity();
+
+            uint32_t hit = 0;
+            float t = -1.0f;
+            ASSERT_EQ(PMath::RayClosestHit(bvh, r, intersect, hit, t), anyBest);
+            if (anyBest)
+            {
+                EXPECT_FLOAT_EQ(t, tBest);
+
+                float tHit;
+                EXPECT_TRUE(IntersectBox(boxes[hit], r, tHit));
+                EXPECT_FLOAT_EQ(tHit, tBest);
+            }
+
+            EXPECT_EQ(PMath::RayAnyHit(bvh, r, intersect), anyBest);
+
+            Vec c(dist(rng), dist(rng), dist(rng));
+            const Box query(c, Vec(c.x + 20.0f, c.y + 20.0f, c.z + 20.0f));
+
+            std::vector<uint32_t> expected;
+            for (uint32_t i = 0; i < (uint32_t)boxes.size(); ++i)
+            {
+                if (PMath::Overlaps(boxes[i], query))
+                {
+                    expected.push_back(i);
+                }
+            }
+
+            std::vector<uint32_t> found;
+            const size_t count = PMath::OverlapQuery(bvh, query, [&](uint32_t i) { found.push_back(i); });
+            std::sort(found.begin(), found.end());
+
+            EXPECT_EQ(count, found.size());
+            EXPECT_EQ(found, expected);
+        }
+    }
+
+    TEST(BVH, BruteForceParity)
+    {
+        std::mt19937 rng(7);
+        std::uniform_real_distribution<float> pos(-50.0f, 50.0f);
+        std::uniform_real_distribution<float> size(0.1f, 4.0f);
+
+        for (size_t n : { 1, 2, 3, 9, 100, 2000 })
+        {
+            std::vector<Box> boxes(n);
+            for (Box& b : boxes)
+            {
+                Vec p(pos(rng), pos(rng), pos(rng));
+                b = Box(p, Vec(p.x + size(rng), p.y + size(rng), p.z + size(rng)));
+            }
+
+            PMath::BVHBuildOptions serial;
+            serial.maxThreadDepth = 0;
+            ExpectBruteForceParity(boxes, serial, rng);
+
+            PMath::BVHBuildOptions parallel;
+            parallel.parallelThreshold = 64;
+            ExpectBruteForceParity(boxes, parallel, rng);
+        }
+    }
+
+    TEST(BVH, DegenerateInput)
+    {
+        std::vector<Box> none;
+        PMath::TBVH<float, false> empty = PMath::BuildBVH<float, false>(none);
+
+        auto never = [](uint32_t, const Ray&, float&) { return true; };
+
+        uint32_t hit;
+        float t;
+        EXPECT_TRUE(empty.nodes.empty());
+        EXPECT_FALSE(PMath::IsValid(PMath::GetAABB(empty)));
+        EXPECT_FALSE(PMath::RayClosestHit(empty, Ray(Vec(1.0f, 0.0f, 0.0f), Vec(0.0f, 0.0f, 0.0f)), never, hit, t));
+        EXPECT_FALSE(PMath::RayAnyHit(empty, Ray(Vec(1.0f, 0.0f, 0.0f), Vec(0.0f, 0.0f, 0.0f)), never));
+        EXPECT_EQ(PMath::OverlapQuery(empty, Box(Vec(-1.0f, -1.0f, -1.0f), Vec(1.0f, 1.0f, 1.0f)), [](uint32_t) {}), 0u);
+
+        // Identical centroids can not be split by SAH and fall back to median splits.
+        std::vector<Box> same(1000, Box(Vec(1.0f, 2.0f, 3.0f), Vec(2.0f, 3.0f, 4.0f)));
+
+        std::mt19937 rng(11);
+        ExpectBruteForceParity(same, PMath::BVHBuildOptions(), rng);
+
+        PMath::TBVH<float, false> bvh = PMath::BuildBVH<float, false>(same);
+        EXPECT_LE(MaxDepth(bvh), 16u);
+        EXPECT_EQ(PMath::OverlapQuery(bvh, same[0], [](uint32_t) {}), same.size());
+    }
+
+    TEST(BVH, MedianSplitFallback)
+    {
+        // Boxes 2^5 apart: every SAH split peels off only the largest box, so without the median split fallback at depth 32 the tree would be 45 deep.
+        std::vector<Box> boxes(45);
+        for (size_t i = 0; i < boxes.size(); ++i)
+        {
+            const float x = std::ldexp(1.0f, 5 * (int)i - 120);
+            boxes[i] = Box(Vec(x, -1.0f, -1.0f), Vec(x * 1.5f, 1.0f, 1.0f));
+        }
+
+        PMath::BVHBuildOptions options;
+        options.maxLeafSize = 1;
+
+        PMath::TBVH<float, false> bvh = PMath::BuildBVH<float, false>(boxes, options);
+
+        const size_t depth = MaxDepth(bvh);
+        EXPECT_GT(depth, (size_t)PMath::Detail::BVHMedianDepth);
+        EXPECT_LT(depth, boxes.size());
+
+        std::mt19937 rng(13);
+        ExpectBruteForceParity(boxes, options, rng);
+
+        // A ray along the boxes passes through every level.
+        auto intersect = [&](uint32_t i, const Ray& r, float& t) { return IntersectBox(boxes[i], r, t); };
+
+        uint32_t hit;
+        float t;
+        ASSERT_TRUE(PMath::RayClosestHit(bvh, Ray(Vec(-1.0f, 0.0f, 0.0f), Vec(1e31f, 0.0f, 0.0f)), intersect, hit, t));
+        EXPECT_EQ(hit, (uint32_t)boxes.size() - 1);
+    }
+}
+
+namespace QuaternionTests
+{
+    using Quat = PMath::TQuaternion<float, false>;
+    using Vec = PMath::TVector3<float, false>;
+
+    // Slerp in double precision, as reference for the float implementations.
+    Quat ReferenceSlerp(const Quat& q1, const Quat& q2, float t)
+    {
+        double d = (double)q1.x * q2.x + (double)q1.y * q2.y + (double)q1.z * q2.z + (double)q1.w * q2.w;
+        const double s = (d < 0.0) ? -1.0 : 1.0;
+        d = std::min(std::abs(d), 1.0);
+
+        const double angle = std::acos(d);
+        double w1 = 1.0 - t;
+        double w2 = t;
+        if (angle > 1e-6)
+        {
+            w1 = std::sin((1.0 - t) * angle) / std::sin(angle);
+            w2 = std::sin(t * angle) / std::sin(angle);
+        }
+
+        return Quat((float)(w1 * q1.x + s * w2 * q2.x), (float)(w1 * q1.y + s * w2 * q2.y), (float)(w1 * q1.z + s * w2 * q2.z), (float)(w1 * q1.w + s * w2 * q2.w));
+    }
+
+    TEST(Quaternion, RotationTests)
+    {
+        std::mt19937 rng(3);
+        std::uniform_real_distribution<float> dist(-10.0f, 10.0f);
+
+        for (int i = 0; i < 500; ++i)
+        {
+            const Quat q = RandomRotation(rng);
+            const Vec v(dist(rng), dist(rng), dist(rng));
+
+            const Vec r = q * v;
+            ExpectNear(r, PMath::Rotate(q, v), 1e-4f);
+            ExpectNear(r, PMath::ToMatrix3(q) * v, 1e-4f);
+
+            PMath::TQuaternion<float, true> qa(q.x, q.y, q.z, q.w);
+            PMath::TVector3<float, true> ra = qa * PMath::TVector3<float, true>(v.x, v.y, v.z);
+            ExpectNear(Vec(ra.x, ra.y, ra.z), r, 1e-4f);
+
+            // Composition rotates by q2 first.
+            const Quat q2 = RandomRotation(rng);
+            ExpectNear((q * q2) * v, q * (q2 * v), 1e-3f);
+        }
+
+        // 90 degrees around z turns x into y.
+        const Quat z90 = PMath::QuaternionFromAxisAngle(Vec(0.0f, 0.0f, 1.0f), P_PI_FLT * 0.5f);
+        ExpectNear(z90 * Vec(1.0f, 0.0f, 0.0f), Vec(0.0f, 1.0f, 0.0f), 1e-6f);
+    }
+
+    TEST(Quaternion, MatrixRoundTripTests)
+    {
+        std::mt19937 rng(5);
+
+        std::vector<Quat> rotations = { Quat(0.0f, 0.0f, 0.0f, 1.0f), Quat(1.0f, 0.0f, 0.0f, 0.0f), Quat(0.0f, 1.0f, 0.0f, 0.0f), Quat(0.0f, 0.0f, 1.0f, 0.0f) };
+        for (int i = 0; i < 500; ++i)
+        {
+            rotations.push_back(RandomRotation(rng));
+        }
+
+        for (const Quat& q : rotations)
+        {
+            // q and -q are the same rotation.
+            Quat r = PMath::QuaternionFromMatrix(PMath::ToMatrix3(q));
+            if (PMath::DotP(r, q) < 0.0f)
+            {
+                r = -r;
+            }
+            ExpectNear(r, q, 1e-5f);
+
+            Quat r4 = PMath::QuaternionFromMatrix(PMath::ToMatrix4(q));
+            if (PMath::DotP(r4, q) < 0.0f)
+            {
+                r4 = -r4;
+            }
+            ExpectNear(r4, q, 1e-5f);
+        }
+    }
+
+    TEST(Quaternion, SlerpTests)
+    {
+        std::mt19937 rng(9);
+
+        std::vector<Quat> q1;
+        std::vector<Quat> q2;
+
+        for (int i = 0; i < 101; ++i)
+        {
+            const Quat a = RandomRotation(rng);
+            Quat b = RandomRotation(rng);
+
+            switch (i % 4)
+            {
+            case 1:
+                // Opposite signs, the same rotation: Slerp takes the short way and stays put.
+                b = -a;
+                break;
+            case 2:
+                // Nearly identical, sin(angle) is close to 0.
+                b = PMath::Normalize(Quat(a.x + 1e-4f, a.y, a.z, a.w));
+                break;
+            case 3:
+                // Nearly 180 degrees apart. At exactly 180 degrees the shortest path is ambiguous.
+                b = PMath::Normalize(Quat(-a.w, a.z, -a.y, a.x) + a * 0.01f);
+                break;
+            }
+
+            q1.push_back(a);
+            q2.push_back(b);
+        }
+
+        for (float t : { 0.0f, 0.25f, 0.5f, 0.9f, 1.0f })
+        {
+            std::vector<Quat> r(q1.size());
+            PMath::BatchSlerp(r.data(), q1.data(), q2.data(), r.size(), t);
+
+            for (size_t i = 0; i < q1.size(); ++i)
+            {
+                const Quat s = PMath::Slerp(q1[i], q2[i], t);
+
+                ExpectNear(s, ReferenceSlerp(q1[i], q2[i], t), 2e-4f);
+                ExpectNear(r[i], s, 2e-4f);
+                EXPECT_NEAR(PMath::Magnitude(r[i]), 1.0f, 1e-5f);
+            }
+        }
+
+        // t is clamped.
+        std::vector<Quat> r(q1.size());
+        PMath::BatchSlerp(r.data(), q1.data(), q2.data(), r.size(), 2.0f);
+        ExpectNear(r[0], PMath::Slerp(q1[0], q2[0], 1.0f), 2e-4f);
+
+        const Quat a = q1[1];
+        ExpectNear(PMath::Slerp(a, -a, 0.5f), a, 1e-5f);
+    }
+}
+
+namespace TransformTests
+{
+    using Transform = PMath::TTransform<float, false>;
+    using Hierarchy = PMath::TTransformHierarchy<float, false>;
+    using Mat4 = PMath::TMatrix4<float, false>;
+
+    Transform RandomTransform(std::mt19937& rng)
+    {
+        std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+        std::uniform_real_distribution<float> scale(0.5f, 2.0f);
+
+        return Transform(PMath::TVector3<float, false>(dist(rng) * 10.0f, dist(rng) * 10.0f, dist(rng) * 10.0f),
+                         RandomRotation(rng),
+                         PMath::TVector3<float, false>(scale(rng), scale(rng), scale(rng)));
+    }
+
+    // Recomputes every world matrix from the local transforms.
+    void ExpectHierarchyConsistent(const Hierarchy& h)
+    {
+        std::vector<Mat4> world(PMath::GetSize(h));
+
+        for (uint32_t i = 0; i < (uint32_t)world.size(); ++i)
+        {
+            const Mat4 local = PMath::ToMatrix4(PMath::GetLocalTransform(h, i));
+            world[i] = (h.parents[i] == Hierarchy::NoParent) ? local : world[h.parents[i]] * local;
+
+            ExpectNear(h.localToWorld[i], world[i], 1e-3f * (1.0f + PMath::Abs(world[i](0, 3)) + PMath::Abs(world[i](1, 3)) + PMath::Abs(world[i](2, 3))));
+
+            const Mat4 identity = h.localToWorld[i] * h.worldToLocal[i];
+            for (int r = 0; r < 4; ++r)
+            {
+                for (int c = 0; c < 4; ++c)
+                {
+                    EXPECT_NEAR(identity(r, c), (r == c) ? 1.0f : 0.0f, 1e-4f);
+                }
+            }
+        }
+    }
+
+    TEST(TransformHierarchy, DirtyPropagationTests)
+    {
+        std::mt19937 rng(17);
+
+        // 0 - 1 - 2 - 3 - 4 is a chain, 5 hangs off 1, 6 is a second root with child 7.
+        const uint32_t parents[] = { Hierarchy::NoParent, 0, 1, 2, 3, 1, Hierarchy::NoParent, 6 };
+
+        Hierarchy h;
+        for (uint32_t p : parents)
+        {
+            PMath::AddTransform(h, RandomTransform(rng), p);
+        }
+
+        PMath::UpdateTransforms(h);
+        ExpectHierarchyConsistent(h);
+
+        // Changing the inner node 2 must update 3 and 4, but leave the other branches alone.
+        const std::vector<Mat4> before = h.localToWorld;
+
+        PMath::SetLocalTransform(h, 2, RandomTransform(rng));
+        PMath::UpdateTransforms(h);
+        ExpectHierarchyConsistent(h);
+
+        for (uint32_t i : { 0u, 1u, 5u, 6u, 7u })
+        {
+            EXPECT_TRUE(std::memcmp(&h.localToWorld[i], &before[i], sizeof(Mat4)) == 0);
+        }
+        for (uint32_t i : { 2u, 3u, 4u })
+        {
+            EXPECT_FALSE(std::memcmp(&h.localToWorld[i], &before[i], sizeof(Mat4)) == 0);
+        }
+
+        // Reparenting a subtree updates it as well.
+        EXPECT_TRUE(PMath::SetParent(h, 7, 2));
+        EXPECT_FALSE(PMath::SetParent(h, 1, 4));
+        PMath::UpdateTransforms(h);
+        ExpectHierarchyConsistent(h);
+
+        // Several changes between updates, root first.
+        PMath::SetLocalTransform(h, 4, RandomTransform(rng));
+        PMath::SetLocalTransform(h, 0, RandomTransform(rng));
+        PMath::UpdateTransforms(h);
+        ExpectHierarchyConsistent(h);
+    }
+}
+
+namespace DualQuaternionTests
+{
+    using DualQuat = PMath::TDualQuaternion<float, false>;
+    using Vec = PMath::TVector3<float, false>;
+    using Vec4 = PMath::TVector4<float, false>;
+
+    DualQuat RandomRigidTransform(std::mt19937& rng)
+    {
+        std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+
+        return DualQuat(RandomRotation(rng), Vec(dist(rng) * 10.0f, dist(rng) * 10.0f, dist(rng) * 10.0f));
+    }
+
+    TEST(DualQuaternion, MatrixConsistencyTests)
+    {
+        std::mt19937 rng(19);
+        std::uniform_real_distribution<float> dist(-10.0f, 10.0f);
+
+        for (int i = 0; i < 500; ++i)
+        {
+            const DualQuat dq = RandomRigidTransform(rng);
+            const PMath::TMatrix4<float, false> m = PMath::ToMatrix4(dq);
+            const Vec p(dist(rng), dist(rng), dist(rng));
+
+            // Points are rotated, then translated. Directions are only rotated.
+            const Vec4 mp = m * Vec4(p.x, p.y, p.z, 1.0f);
+            ExpectNear(PMath::TransformPoint(dq, p), Vec(mp.x, mp.y, mp.z), 1e-3f);
+            ExpectNear(PMath::TransformPoint(dq, p), dq.real * p + PMath::GetTranslation(dq), 1e-3f);
+
+            const Vec4 md = m * Vec4(p.x, p.y, p.z, 0.0f);
+            ExpectNear(PMath::TransformDirection(dq, p), Vec(md.x, md.y, md.z), 1e-3f);
+
+            EXPECT_FLOAT_EQ(m(3, 3), 1.0f);
+            EXPECT_FLOAT_EQ(m(3, 0) + m(3, 1) + m(3, 2), 0.0f);
+
+            // The product applies dq2 first, like the matrix product.
+            const DualQuat dq2 = RandomRigidTransform(rng);
+            ExpectNear(PMath::TransformPoint(dq * dq2, p), PMath::TransformPoint(dq, PMath::TransformPoint(dq2, p)), 1e-3f);
+        }
+    }
+}
+
+namespace IntDivisionTests
+{
+    using IVec4 = PMath::TIntVector4<int, true>;
+
+    constexpr int IntMin = std::numeric_limits<int>::min();
+    constexpr int IntMax = std::numeric_limits<int>::max();
+
+    // Dividends around the edges of the single precision fast path (|x| < 2^23) and of the int range.
+    const std::vector<int> Dividends = {
+        0, 1, -1, 2, -2, 7, -7, 100, -100,
+        (1 << 23) - 1, -((1 << 23) - 1), 1 << 23, -(1 << 23), (1 << 23) + 1, -((1 << 23) + 1),
+        (1 << 24) + 1, -((1 << 24) + 1), 1 << 30, -(1 << 30),
+        1000000007, -1000000007, IntMax, IntMax - 1, IntMin, IntMin + 1
+    };
+
+    const std::vector<int> Divisors = {
+        1, -1, 2, -2, 3, -3, 7, -7, 641, -641,
+        (1 << 23) - 1, 1 << 23, -(1 << 23), 1 << 30, -(1 << 30), IntMax, -IntMax, IntMin
+    };
+
+    // INT_MIN / -1 overflows, like the built-in operator.
+    bool Overflows(int n, int d)
+    {
+        return n == IntMin && d == -1;
+    }
+
+    // -n without overflow. INT_MIN stays INT_MIN.
+    int Negate(int n)
+    {
+        return (n == IntMin) ? n : -n;
+    }
+
+    TEST(IntDivision, IntDivisorTests)
+    {
+        // INT_MIN with negative divisors whose magic number needs a correction of -1. Constant evaluation rejects signed overflow.
+        static_assert(IntMin / PMath::IntDivisor(-3) == IntMin / -3);
+        static_assert(IntMin / PMath::IntDivisor(-7) == IntMin / -7);
+        static_assert(IntMin / PMath::IntDivisor(-(1 << 30)) == IntMin / -(1 << 30));
+        static_assert(IntMin / PMath::IntDivisor(IntMin) == 1);
+        static_assert((IntMin + 1) / PMath::IntDivisor(-7) == (IntMin + 1) / -7);
+        static_assert(IntMin / PMath::IntDivisor(-IntMax) == IntMin / -IntMax);
+
+        for (int d : Divisors)
+        {
+            const PMath::IntDivisor divisor(d);
+
+            for (int n : Dividends)
+            {
+                if (!Overflows(n, d))
+                {
+                    EXPECT_EQ(n / divisor, n / d) << n << " / " << d;
+                }
+            }
+
+            for (size_t i = 0; i + 4 <= Dividends.size(); i += 4)
+            {
+                const int* n = &Dividends[i];
+                if (Overflows(n[0], d) || Overflows(n[1], d) || Overflows(n[2], d) || Overflows(n[3], d))
+                {
+                    continue;
+                }
+
+                IVec4 v(n[0], n[1], n[2], n[3]);
+                v /= divisor;
+
+                EXPECT_EQ(v.x, n[0] / d);
+                EXPECT_EQ(v.y, n[1] / d);
+                EXPECT_EQ(v.z, n[2] / d);
+                EXPECT_EQ(v.w, n[3] / d);
+            }
+        }
+    }
+
+    TEST(IntDivision, VectorDivisionTests)
+    {
+        for (int d : Divisors)
+        {
+            for (int n : Dividends)
+            {
+                if (Overflows(n, d))
+                {
+                    continue;
+                }
+
+                // The lanes mix the fast path and the double precision path.
+                IVec4 v(n, Negate(n), 5, 1 << 22);
+                v /= IVec4(d, d, d, 3);
+
+                EXPECT_EQ(v.x, n / d) << n << " / " << d;
+                EXPECT_EQ(v.y, Negate(n) / d) << Negate(n) << " / " << d;
+                EXPECT_EQ(v.z, 5 / d);
+                EXPECT_EQ(v.w, (1 << 22) / 3);
+
+                IVec4 s(n, n, n, n);
+                s /= d;
+                EXPECT_EQ(s.x, n / d);
+                EXPECT_EQ(s.w, n / d);
+            }
+        }
+
+        // Quotients just below an integer, where rounding to float would round up.
+        std::mt19937 rng(23);
+        std::uniform_int_distribution<int> small(1, (1 << 23) - 1);
+
+        for (int i = 0; i < 10000; ++i)
+        {
+            const int d = small(rng) % 4096 + 1;
+            const int n = (small(rng) / d) * d - 1;
+
+            IVec4 v(n, -n, n + 1, -(n + 1));
+            v /= IVec4(d, d, -d, -d);
+
+            EXPECT_EQ(v.x, n / d);
+            EXPECT_EQ(v.y, -n / d);
+            EXPECT_EQ(v.z, (n + 1) / -d);
+            EXPECT_EQ(v.w, -(n + 1) / -d);
+        }
+    }
+}
+
+namespace FrustumTests
+{
+    using Mat4 = PMath::TMatrix4<float, false>;
+    using Vec = PMath::TVector3<float, false>;
+    using Vec4 = PMath::TVector4<float, false>;
+
+    // Right handed perspective projection, looking down -z.
+    Mat4 Perspective(float fovY, float aspect, float zNear, float zFar, PMath::EClipDepth depth)
+    {
+        const float f = 1.0f / std::tan(fovY * 0.5f);
+
+        const float a = (depth == PMath::EClipDepth::ZeroToOne) ? zFar / (zNear - zFar) : (zFar + zNear) / (zNear - zFar);
+        const float b = (depth == PMath::EClipDepth::ZeroToOne) ? zNear * zFar / (zNear - zFar) : 2.0f * zNear * zFar / (zNear - zFar);
+
+        return Mat4(f / aspect, 0.0f, 0.0f,  0.0f,
+                    0.0f,       f,    0.0f,  0.0f,
+                    0.0f,       0.0f, a,     b,
+                    0.0f,       0.0f, -1.0f, 0.0f);
+    }
+
+    void ExpectMatchesClipSpace(PMath::EClipDepth depth)
+    {
+        std::mt19937 rng(29);
+        std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+
+        const PMath::TTransform<float, false> view(Vec(3.0f, -2.0f, 5.0f),
+                                                   PMath::Normalize(PMath::TQuaternion<float, false>(0.2f, -0.4f, 0.1f, 0.9f)),
+                                                   Vec(1.0f, 1.0f, 1.0f));
+
+        const Mat4 m = Perspective(1.0f, 1.5f, 0.5f, 50.0f, depth) * PMath::ToInverseMatrix4(view);
+        const PMath::TFrustum<float, false> f = PMath::ExtractFrustum(m, depth);
+
+        for (const auto& pl : f.planes)
+        {
+            EXPECT_NEAR(PMath::Magnitude(pl.normal), 1.0f, 1e-5f);
+        }
+
+        const float zMin = (depth == PMath::EClipDepth::ZeroToOne) ? 0.0f : -1.0f;
+
+        int inside = 0;
+        for (int i = 0; i < 20000; ++i)
+        {
+            // Points around the camera, in front of it and behind it. Every other point is close to the camera, to cover the near plane.
+            const float scale = (i % 2 == 0) ? 40.0f : 1.5f;
+            const Vec p = PMath::TransformPoint(view, Vec(dist(rng) * scale, dist(rng) * scale, dist(rng) * scale * 1.5f));
+            const Vec4 c = m * Vec4(p.x, p.y, p.z, 1.0f);
+
+            // Distance to the closest clip plane, relative to w. Skip points too close to a boundary for float precision.
+            const float margin = std::min({ c.w + c.x, c.w - c.x, c.w + c.y, c.w - c.y, c.z - zMin * c.w, c.w - c.z });
+            if (std::abs(margin) < 1e-3f * (1.0f + std::abs(c.w)))
+            {
+                continue;
+            }
+
+            const bool expected = margin > 0.0f;
+            inside += expected;
+
+            EXPECT_EQ(PMath::IsPointVisible(f, p), expected) << p.x << ", " << p.y << ", " << p.z;
+        }
+
+        // The samples cover both cases.
+        EXPECT_GT(inside, 100);
+        EXPECT_LT(inside, 19000);
+    }
+
+    TEST(Frustum, ExtractZeroToOneTests)
+    {
+        ExpectMatchesClipSpace(PMath::EClipDepth::ZeroToOne);
+    }
+
+    TEST(Frustum, ExtractMinusOneToOneTests)
+    {
+        ExpectMatchesClipSpace(PMath::EClipDepth::MinusOneToOne);
+    }
+}
+
+namespace TriangleTests
+{
+    using Ray = PMath::TRay<float, false>;
+    using Tri = PMath::TTriangle<float, false>;
+    using Vec = PMath::TVector3<float, false>;
+
+    constexpr size_t W = 8;
+
+    // Right triangle in the xy plane.
+    const Tri Unit(Vec(0.0f, 0.0f, 0.0f), Vec(1.0f, 0.0f, 0.0f), Vec(0.0f, 1.0f, 0.0f));
+
+    Tri RandomTriangle(std::mt19937& rng)
+    {
+        std::uniform_real_distribution<float> dist(-5.0f, 5.0f);
+        return Tri(Vec(dist(rng), dist(rng), dist(rng)), Vec(dist(rng), dist(rng), dist(rng)), Vec(dist(rng), dist(rng), dist(rng)));
+    }
+
+    // Ray from a random origin towards a random point around the triangle, so that about half of the rays hit it.
+    Ray RandomRay(const Tri& tr, std::mt19937& rng)
+    {
+        std::uniform_real_distribution<float> dist(-10.0f, 10.0f);
+        std::uniform_real_distribution<float> bary(-0.3f, 0.8f);
+
+        const Vec o(dist(rng), dist(rng), dist(rng));
+        const Vec target = PMath::PointAt(tr, bary(rng), bary(rng));
+
+        return Ray(Vec(target.x - o.x, target.y - o.y, target.z - o.z), o);
+    }
+
+    // Compares a packet lane with the scalar test. Lanes too close to an edge or the origin for float precision are skipped.
+    void ExpectLaneMatchesScalar(const Tri& tr, const Ray& r, bool hit, float t, float u, float v, int& hits, int& misses)
+    {
+        if (std::min({ std::abs(u), std::abs(v), std::abs(1.0f - u - v), std::abs(t) }) < 1e-3f)
+        {
+            return;
+        }
+
+        float et, eu, ev;
+        const bool expected = PMath::RayIntersect(tr, r, et, eu, ev);
+
+        ASSERT_EQ(hit, expected);
+        if (expected)
+        {
+            EXPECT_NEAR(t, et, 1e-4f * (1.0f + et));
+            EXPECT_NEAR(u, eu, 1e-4f);
+            EXPECT_NEAR(v, ev, 1e-4f);
+            ++hits;
+        }
+        else
+        {
+            EXPECT_EQ(t, std::numeric_limits<float>::infinity());
+            ++misses;
+        }
+    }
+
+    TEST(Triangle, RayIntersectTests)
+    {
+        float t, u, v;
+
+        // Front face.
+        ASSERT_TRUE(PMath::RayIntersect(Unit, Ray(Vec(0.0f, 0.0f, -1.0f), Vec(0.25f, 0.5f, 2.0f)), t, u, v));
+        EXPECT_FLOAT_EQ(t, 2.0f);
+        EXPECT_FLOAT_EQ(u, 0.25f);
+        EXPECT_FLOAT_EQ(v, 0.5f);
+
+        // Back face, with a direction that is not normalized.
+        ASSERT_TRUE(PMath::RayIntersect(Unit, Ray(Vec(0.0f, 0.0f, 4.0f), Vec(0.5f, 0.125f, -2.0f)), t, u, v));
+        EXPECT_FLOAT_EQ(t, 0.5f);
+        EXPECT_FLOAT_EQ(u, 0.5f);
+        EXPECT_FLOAT_EQ(v, 0.125f);
+
+        // Oblique ray. The hit point is at the barycentrics.
+        const Ray oblique(Vec(-1.0f, 2.0f, -3.0f), Vec(1.2f, -1.5f, 3.0f));
+        ASSERT_TRUE(PMath::RayIntersect(Unit, oblique, t, u, v));
+        const Vec p = PMath::PointAt(oblique, t);
+        const Vec b = PMath::PointAt(Unit, u, v);
+        EXPECT_NEAR(p.x, b.x, 1e-6f);
+        EXPECT_NEAR(p.y, b.y, 1e-6f);
+        EXPECT_NEAR(p.z, 0.0f, 1e-6f);
+        EXPECT_FLOAT_EQ(t, 1.0f);
+
+        // Misses outside each edge and behind the origin.
+        EXPECT_FALSE(PMath::RayIntersect(Unit, Ray(Vec(0.0f, 0.0f, -1.0f), Vec(-0.1f, 0.5f, 1.0f)), t, u, v));
+        EXPECT_FALSE(PMath::RayIntersect(Unit, Ray(Vec(0.0f, 0.0f, -1.0f), Vec(0.5f, -0.1f, 1.0f)), t, u, v));
+        EXPECT_FALSE(PMath::RayIntersect(Unit, Ray(Vec(0.0f, 0.0f, -1.0f), Vec(0.6f, 0.6f, 1.0f)), t, u, v));
+        EXPECT_FALSE(PMath::RayIntersect(Unit, Ray(Vec(0.0f, 0.0f, 1.0f), Vec(0.25f, 0.25f, 1.0f)), t, u, v));
+
+        // The overload without barycentrics agrees.
+        EXPECT_TRUE(PMath::RayIntersect(Unit, Ray(Vec(0.0f, 0.0f, -1.0f), Vec(0.25f, 0.5f, 3.0f)), t));
+        EXPECT_FLOAT_EQ(t, 3.0f);
+    }
+
+    TEST(Triangle, RayIntersectEdgeTests)
+    {
+        float t, u, v;
+
+        // Points on the edges and vertices are hit.
+        ASSERT_TRUE(PMath::RayIntersect(Unit, Ray(Vec(0.0f, 0.0f, -1.0f), Vec(0.5f, 0.0f, 1.0f)), t, u, v));
+        EXPECT_FLOAT_EQ(u, 0.5f);
+        EXPECT_FLOAT_EQ(v, 0.0f);
+
+        ASSERT_TRUE(PMath::RayIntersect(Unit, Ray(Vec(0.0f, 0.0f, -1.0f), Vec(0.0f, 0.5f, 1.0f)), t, u, v));
+        EXPECT_FLOAT_EQ(u, 0.0f);
+        EXPECT_FLOAT_EQ(v, 0.5f);
+
+        ASSERT_TRUE(PMath::RayIntersect(Unit, Ray(Vec(0.0f, 0.0f, -1.0f), Vec(0.5f, 0.5f, 1.0f)), t, u, v));
+        EXPECT_FLOAT_EQ(u + v, 1.0f);
+
+        ASSERT_TRUE(PMath::RayIntersect(Unit, Ray(Vec(0.0f, 0.0f, -1.0f), Vec(1.0f, 0.0f, 1.0f)), t, u, v));
+        EXPECT_FLOAT_EQ(u, 1.0f);
+        EXPECT_FLOAT_EQ(v, 0.0f);
+
+        // Origin in the plane of the triangle: hit at t = 0.
+        ASSERT_TRUE(PMath::RayIntersect(Unit, Ray(Vec(0.0f, 0.0f, 1.0f), Vec(0.25f, 0.25f, 0.0f)), t, u, v));
+        EXPECT_FLOAT_EQ(t, 0.0f);
+
+        // Rays parallel to the triangle, in its plane and above it.
+        EXPECT_FALSE(PMath::RayIntersect(Unit, Ray(Vec(1.0f, 0.0f, 0.0f), Vec(-1.0f, 0.25f, 0.0f)), t, u, v));
+        EXPECT_FALSE(PMath::RayIntersect(Unit, Ray(Vec(1.0f, 1.0f, 0.0f), Vec(-1.0f, -1.0f, 1.0f)), t, u, v));
+
+        // Degenerate triangles: collinear vertices and a point.
+        const Tri line(Vec(0.0f, 0.0f, 0.0f), Vec(1.0f, 1.0f, 0.0f), Vec(2.0f, 2.0f, 0.0f));
+        const Tri point(Vec(0.5f, 0.5f, 0.0f), Vec(0.5f, 0.5f, 0.0f), Vec(0.5f, 0.5f, 0.0f));
+
+        EXPECT_FALSE(PMath::RayIntersect(line, Ray(Vec(0.0f, 0.0f, -1.0f), Vec(1.0f, 1.0f, 1.0f)), t, u, v));
+        EXPECT_FALSE(PMath::RayIntersect(point, Ray(Vec(0.0f, 0.0f, -1.0f), Vec(0.5f, 0.5f, 1.0f)), t, u, v));
+    }
+
+    TEST(TrianglePacket, RayIntersectTests)
+    {
+        std::mt19937 rng(67);
+        int hits = 0, misses = 0;
+
+        for (int k = 0; k < 200; ++k)
+        {
+            // One ray against a packet. Every other packet is partially filled.
+            const size_t count = (k % 2 == 0) ? W : 1 + k % W;
+
+            Tri tris[W];
+            for (size_t i = 0; i < count; ++i)
+            {
+                tris[i] = RandomTriangle(rng);
+            }
+
+            PMath::TTrianglePacket<float, W> packet;
+            PMath::LoadPacket(packet, tris, count);
+
+            const Ray r = RandomRay(tris[k % count], rng);
+
+            float t[W], u[W], v[W];
+            const unsigned int mask = PMath::RayIntersect(packet, r, t, u, v);
+
+            for (size_t i = 0; i < W; ++i)
+            {
+                if (i < count)
+                {
+                    ExpectLaneMatchesScalar(tris[i], r, (mask >> i) & 1u, t[i], u[i], v[i], hits, misses);
+                }
+                else
+                {
+                    // Lanes past count are degenerate.
+                    EXPECT_EQ((mask >> i) & 1u, 0u) << "lane " << i;
+                    EXPECT_EQ(t[i], std::numeric_limits<float>::infinity());
+                }
+            }
+
+            // A packet of rays against one triangle.
+            Ray rays[W];
+            for (size_t i = 0; i < W; ++i)
+            {
+                rays[i] = RandomRay(tris[0], rng);
+            }
+
+            PMath::TRayPacket<float, W> rp;
+            PMath::LoadPacket(rp, rays);
+
+            const unsigned int rmask = PMath::RayIntersect(tris[0], rp, t, u, v);
+
+            for (size_t i = 0; i < W; ++i)
+            {
+                ExpectLaneMatchesScalar(tris[0], rays[i], (rmask >> i) & 1u, t[i], u[i], v[i], hits, misses);
+            }
+        }
+
+        // The samples cover both cases.
+        EXPECT_GT(hits, 500);
+        EXPECT_GT(misses, 500);
+    }
+}
+
+namespace PlaneTests
+{
+    using Plane = PMath::TPlane<float, false>;
+    using Line = PMath::TLine<float, false>;
+    using Ray = PMath::TRay<float, false>;
+    using Vec = PMath::TVector3<float, false>;
+
+    constexpr size_t W = 8;
+
+    Vec RandomVec(std::mt19937& rng, float scale)
+    {
+        std::uniform_real_distribution<float> dist(-scale, scale);
+        return Vec(dist(rng), dist(rng), dist(rng));
+    }
+
+    TEST(Plane, RayIntersectTests)
+    {
+        const Plane z2(Vec(0.0f, 0.0f, 1.0f), 2.0f);
+        float t;
+
+        ASSERT_TRUE(PMath::RayIntersect(z2, Ray(Vec(0.0f, 0.0f, 2.0f), Vec(1.0f, 1.0f, 0.0f)), t));
+        EXPECT_FLOAT_EQ(t, 1.0f);
+
+        // From the back side, at an angle.
+        ASSERT_TRUE(PMath::RayIntersect(z2, Ray(Vec(1.0f, 0.0f, -1.0f), Vec(0.0f, 0.0f, 5.0f)), t));
+        EXPECT_FLOAT_EQ(t, 3.0f);
+
+        Vec p;
+        ASSERT_TRUE(PMath::RayIntersect(z2, Ray(Vec(1.0f, 0.0f, -1.0f), Vec(0.0f, 0.0f, 5.0f)), p));
+        ExpectNear(p, Vec(3.0f, 0.0f, 2.0f), 1e-6f);
+
+        // Origin on the plane.
+        ASSERT_TRUE(PMath::RayIntersect(z2, Ray(Vec(0.0f, 1.0f, 1.0f), Vec(4.0f, 4.0f, 2.0f)), t));
+        EXPECT_FLOAT_EQ(t, 0.0f);
+
+        // Pointing away and parallel.
+        EXPECT_FALSE(PMath::RayIntersect(z2, Ray(Vec(0.0f, 0.0f, -1.0f), Vec(1.0f, 1.0f, 0.0f)), t));
+        EXPECT_FALSE(PMath::RayIntersect(z2, Ray(Vec(1.0f, 0.0f, 0.0f), Vec(1.0f, 1.0f, 0.0f)), t));
+        EXPECT_FALSE(PMath::RayIntersect(z2, Ray(Vec(1.0f, 0.0f, 0.0f), Vec(1.0f, 1.0f, 2.0f)), t));
+    }
+
+    TEST(Plane, IntersectTests)
+    {
+        const Plane x1(Vec(1.0f, 0.0f, 0.0f), 1.0f);
+        const Plane y2(Vec(0.0f, 1.0f, 0.0f), 2.0f);
+        const Plane z3(Vec(0.0f, 0.0f, 1.0f), 3.0f);
+        const Plane z5(Vec(0.0f, 0.0f, 1.0f), 5.0f);
+
+        // Two planes: the line lies in both and runs along the cross product of the normals.
+        Line l(Vec(0.0f, 0.0f, 0.0f), Vec(0.0f, 0.0f, 0.0f));
+        ASSERT_TRUE(PMath::PlanesIntersect2(x1, z3, l));
+        ExpectNear(l.base, Vec(1.0f, 0.0f, 3.0f), 1e-6f);
+        ExpectNear(l.direction, Vec(0.0f, -1.0f, 0.0f), 1e-6f);
+
+        const Plane oblique(PMath::Normalize(Vec(1.0f, 2.0f, -2.0f)), 1.5f);
+        ASSERT_TRUE(PMath::PlanesIntersect2(oblique, y2, l));
+        EXPECT_NEAR(PMath::Magnitude(l.direction), 1.0f, 1e-5f);
+        for (float s : { 0.0f, 1.0f, -4.0f })
+        {
+            const Vec q = l.base + l.direction * s;
+            EXPECT_NEAR(PMath::PointDistance(oblique, q), 0.0f, 1e-5f);
+            EXPECT_NEAR(PMath::PointDistance(y2, q), 0.0f, 1e-5f);
+        }
+
+        EXPECT_FALSE(PMath::PlanesIntersect2(z3, z5, l));
+
+        // Three planes.
+        Vec p;
+        ASSERT_TRUE(PMath::PlanesIntersect3(x1, y2, z3, p));
+        ExpectNear(p, Vec(1.0f, 2.0f, 3.0f), 1e-6f);
+
+        ASSERT_TRUE(PMath::PlanesIntersect3(oblique, y2, z5, p));
+        EXPECT_NEAR(PMath::PointDistance(oblique, p), 0.0f, 1e-5f);
+        EXPECT_NEAR(PMath::PointDistance(y2, p), 0.0f, 1e-5f);
+        EXPECT_NEAR(PMath::PointDistance(z5, p), 0.0f, 1e-5f);
+
+        EXPECT_FALSE(PMath::PlanesIntersect3(x1, z3, z5, p));
+
+        // Line and plane.
+        ASSERT_TRUE(PMath::LineIntersect(z3, Line(Vec(1.0f, 1.0f, 1.0f), Vec(0.0f, 2.0f, 0.0f)), p));
+        ExpectNear(p, Vec(3.0f, 5.0f, 3.0f), 1e-5f);
+
+        // Lines do not have a direction of travel, the intersection can be behind the base.
+        ASSERT_TRUE(PMath::LineIntersect(z3, Line(Vec(0.0f, 0.0f, 1.0f), Vec(1.0f, 1.0f, 7.0f)), p));
+        ExpectNear(p, Vec(1.0f, 1.0f, 3.0f), 1e-5f);
+
+        EXPECT_FALSE(PMath::LineIntersect(z3, Line(Vec(1.0f, 0.0f, 0.0f), Vec(0.0f, 0.0f, 0.0f)), p));
+    }
+
+    TEST(Plane, TransformTests)
+    {
+        // z = 1, scaled by 2 along z, rotated 90 degrees around x and moved along z, is y = -2.
+        const PMath::TTransform<float, false> tr(Vec(0.0f, 0.0f, 3.0f),
+                                                 PMath::QuaternionFromAxisAngle(Vec(1.0f, 0.0f, 0.0f), P_PI_FLT * 0.5f),
+                                                 Vec(1.0f, 1.0f, 2.0f));
+
+        const Plane r = PMath::Transform(Plane(Vec(0.0f, 0.0f, 1.0f), 1.0f), tr);
+        ExpectNear(r.normal, Vec(0.0f, -1.0f, 0.0f), 1e-6f);
+        EXPECT_NEAR(r.d, 2.0f, 1e-5f);
+
+        // Points on an oblique plane stay on the transformed plane under non-uniform scale.
+        std::mt19937 rng(71);
+        for (int k = 0; k < 20; ++k)
+        {
+            std::uniform_real_distribution<float> scale(0.5f, 2.0f);
+
+            const PMath::TTransform<float, false> t(RandomVec(rng, 10.0f), RandomRotation(rng), Vec(scale(rng), scale(rng), scale(rng)));
+
+            const Plane pl(PMath::Normalize(RandomVec(rng, 1.0f)), 2.0f);
+            const Plane tpl = PMath::Transform(pl, t);
+
+            EXPECT_NEAR(PMath::Magnitude(tpl.normal), 1.0f, 1e-5f);
+
+            for (int i = 0; i < 5; ++i)
+            {
+                // Project a random point onto the plane.
+                Vec q = RandomVec(rng, 5.0f);
+                q = q - pl.normal * PMath::PointDistance(pl, q);
+
+                EXPECT_NEAR(PMath::PointDistance(tpl, PMath::TransformPoint(t, q)), 0.0f, 1e-3f);
+            }
+        }
+    }
+
+    TEST(RayPacket, PlaneIntersectTests)
+    {
+        std::mt19937 rng(73);
+        int hits = 0, misses = 0;
+
+        for (int k = 0; k < 100; ++k)
+        {
+            Plane planes[3];
+            for (auto& pl : planes)
+            {
+                pl = Plane(PMath::Normalize(RandomVec(rng, 1.0f)), RandomVec(rng, 5.0f).x);
+            }
+
+            Ray rays[W];
+            for (size_t i = 0; i < W; ++i)
+            {
+                rays[i] = Ray(RandomVec(rng, 1.0f), RandomVec(rng, 10.0f));
+            }
+
+            // Lane 1 is parallel to the first plane.
+            rays[1].direction = PMath::CrossP(planes[0].normal, rays[1].direction);
+
+            PMath::TRayPacket<float, W> rp;
+            PMath::LoadPacket(rp, rays);
+
+            float distances[3 * W];
+            unsigned int masks[3];
+            PMath::RayIntersect<float, W>(std::span<const Plane>(planes), rp, distances, masks);
+
+            EXPECT_EQ(masks[0] & 2u, 0u);
+
+            for (size_t j = 0; j < 3; ++j)
+            {
+                // The set overload equals the one plane overload.
+                float d[W];
+                EXPECT_EQ(PMath::RayIntersect(planes[j], rp, d), masks[j]);
+
+                for (size_t i = 0; i < W; ++i)
+                {
+                    EXPECT_EQ(d[i], distances[j * W + i]);
+
+                    // Lanes with the origin close to the plane or a direction close to the parallel threshold are skipped, as float precision decides them.
+                    const float pr = PMath::DotP(planes[j].normal, rays[i].direction);
+                    const float pd = PMath::PointDistance(planes[j], rays[i].origin);
+                    if (std::abs(pd) < 1e-3f || std::abs(std::abs(pr) - P_FLT_INAC) < 1e-6f)
+                    {
+                        continue;
+                    }
+
+                    float t;
+                    const bool expected = PMath::RayIntersect(planes[j], rays[i], t);
+
+                    ASSERT_EQ(((masks[j] >> i) & 1u) != 0, expected) << "plane " << j << ", lane " << i;
+                    if (expected)
+                    {
+                        EXPECT_NEAR(d[i], t, 1e-4f * (1.0f + t));
+                        ++hits;
+                    }
+                    else
+                    {
+                        EXPECT_EQ(d[i], std::numeric_limits<float>::infinity());
+                        ++misses;
+                    }
+                }
+            }
+        }
+
+        // The samples cover both cases.
+        EXPECT_GT(hits, 500);
+        EXPECT_GT(misses, 500);
+    }
+}
+
+namespace PacketTests
+{
+    template<typename T>
+    T RandomReal(std::mt19937& rng)
+    {
+        return (T)std::uniform_real_distribution<double>(-10.0, 10.0)(rng);
+    }
+
+    // Tolerance relative to the magnitude of the expected value.
+    template<typename T>
+    void ExpectLaneNear(T a, T e, const char* what, size_t lane)
+    {
+        const T eps = std::is_same_v<T, float> ? (T)1e-5 : (T)1e-12;
+        EXPECT_NEAR(a, e, eps * ((T)1.0 + std::abs(e))) << what << ", lane " << lane;
+    }
+
+    template<typename T, size_t N>
+    void ExpectPacketMatchesScalar(std::mt19937& rng)
+    {
+        using P = PMath::TPacket<T, N>;
+
+        T a[N], b[N];
+        for (size_t i = 0; i < N; ++i)
+        {
+            a[i] = RandomReal<T>(rng);
+            b[i] = RandomReal<T>(rng);
+        }
+
+        // Lane 0 is equal within the tolerance, lane 1 just outside of it.
+        b[0] = a[0] + (T)0.5e-5;
+        if constexpr (N > 1)
+        {
+            b[1] = a[1] - (T)2e-5;
+        }
+
+        const P p1(a), p2(b);
+
+        const P sum = p1 + p2, diff = p1 - p2, prod = p1 * p2, quot = p1 / p2, sq = PMath::Sqrt(PMath::Abs(p1));
+        const P mn = PMath::Min(p1, p2), mx = PMath::Max(p1, p2), neg = -p1, scaled = p1 * (T)3.0;
+
+        unsigned int eq = 0, lt = 0;
+        for (size_t i = 0; i < N; ++i)
+        {
+            EXPECT_EQ(sum[i], a[i] + b[i]);
+            EXPECT_EQ(diff[i], a[i] - b[i]);
+            EXPECT_EQ(prod[i], a[i] * b[i]);
+            EXPECT_EQ(quot[i], a[i] / b[i]);
+            EXPECT_EQ(sq[i], std::sqrt(std::abs(a[i])));
+            EXPECT_EQ(mn[i], std::min(a[i], b[i]));
+            EXPECT_EQ(mx[i], std::max(a[i], b[i]));
+            EXPECT_EQ(neg[i], -a[i]);
+            EXPECT_EQ(scaled[i], a[i] * (T)3.0);
+
+            eq |= (unsigned int)(std::abs(a[i] - b[i]) < (T)P_FLT_INAC) << i;
+            lt |= (unsigned int)(a[i] < b[i]) << i;
+        }
+
+        EXPECT_EQ(eq & 1u, 1u);
+        EXPECT_EQ(eq & 2u, 0u);
+        EXPECT_EQ(PMath::CompareEq(p1, p2), eq);
+        EXPECT_EQ(PMath::CompareLess(p1, p2), lt);
+        EXPECT_EQ(PMath::CompareEq(p1, p1), PMath::PacketFullMask<N>());
+        EXPECT_EQ(PMath::CompareLess(p1, p1), 0u);
+    }
+
+    template<typename T, size_t N>
+    void ExpectVector3PacketMatchesScalar(std::mt19937& rng)
+    {
+        using V = PMath::TVector3<T, false>;
+        using VP = PMath::TVector3Packet<T, N>;
+
+        V a[N], b[N];
+        T t[N];
+        for (size_t i = 0; i < N; ++i)
+        {
+            a[i] = V(RandomReal<T>(rng), RandomReal<T>(rng), RandomReal<T>(rng));
+            b[i] = V(RandomReal<T>(rng), RandomReal<T>(rng), RandomReal<T>(rng));
+            t[i] = (RandomReal<T>(rng) + (T)10.0) / (T)20.0;
+        }
+
+        // Lane 0 is too short to normalize and lane 1 equal to b within the tolerance.
+        a[0] = V((T)1e-6, (T)-1e-6, (T)0.0);
+        if constexpr (N > 1)
+        {
+            a[1] = V(b[1].x + (T)0.5e-5, b[1].y, b[1].z - (T)0.5e-5);
+        }
+
+        VP p1, p2;
+        PMath::LoadPacket(p1, a);
+        PMath::LoadPacket(p2, b);
+
+        // Loading and storing round trips. Store writes w = 0.
+        V r[N];
+        PMath::StorePacket(r, p1);
+        for (size_t i = 0; i < N; ++i)
+        {
+            EXPECT_EQ(r[i].x, a[i].x);
+            EXPECT_EQ(r[i].y, a[i].y);
+            EXPECT_EQ(r[i].z, a[i].z);
+            EXPECT_EQ(r[i].w, (T)0.0);
+        }
+
+        const PMath::TPacket<T, N> dot = PMath::DotP(p1, p2);
+        const VP cross = PMath::CrossP(p1, p2);
+        const VP norm = PMath::Normalize(p1);
+        const VP lerp = PMath::Lerp(p1, p2, PMath::TPacket<T, N>(t));
+        const VP lerpS = PMath::Lerp(p1, p2, (T)0.25);
+
+        unsigned int eq = 0;
+        for (size_t i = 0; i < N; ++i)
+        {
+            const V l = PMath::GetLane(p1, i);
+            EXPECT_EQ(l.x, a[i].x);
+            EXPECT_EQ(l.y, a[i].y);
+            EXPECT_EQ(l.z, a[i].z);
+
+            ExpectLaneNear(dot[i], PMath::DotP(a[i], b[i]), "DotP", i);
+
+            const V c = PMath::CrossP(a[i], b[i]);
+            const V lc = PMath::GetLane(cross, i);
+            ExpectLaneNear(lc.x, c.x, "CrossP", i);
+            ExpectLaneNear(lc.y, c.y, "CrossP", i);
+            ExpectLaneNear(lc.z, c.z, "CrossP", i);
+
+            // Like NormalizeV, short vectors are unchanged.
+            V n = a[i];
+            PMath::NormalizeV(n);
+            const V ln = PMath::GetLane(norm, i);
+            ExpectLaneNear(ln.x, n.x, "Normalize", i);
+            ExpectLaneNear(ln.y, n.y, "Normalize", i);
+            ExpectLaneNear(ln.z, n.z, "Normalize", i);
+
+            const V e = PMath::Lerp(a[i], b[i], t[i]);
+            const V ll = PMath::GetLane(lerp, i);
+            ExpectLaneNear(ll.x, e.x, "Lerp", i);
+            ExpectLaneNear(ll.y, e.y, "Lerp", i);
+            ExpectLaneNear(ll.z, e.z, "Lerp", i);
+
+            const V es = PMath::Lerp(a[i], b[i], (T)0.25);
+            const V ls = PMath::GetLane(lerpS, i);
+            ExpectLaneNear(ls.x, es.x, "Lerp", i);
+            ExpectLaneNear(ls.y, es.y, "Lerp", i);
+            ExpectLaneNear(ls.z, es.z, "Lerp", i);
+
+            eq |= (unsigned int)(PMath::CompareEq(a[i], b[i]) == 0x7) << i;
+        }
+
+        EXPECT_EQ(PMath::CompareEq(p1, p2), eq);
+        EXPECT_EQ(PMath::CompareEq(p1, p1), PMath::PacketFullMask<N>());
+        EXPECT_TRUE(p1 == p1);
+        EXPECT_EQ(p1 != p2, eq != PMath::PacketFullMask<N>());
+
+        // SetLane only changes its lane.
+        VP p3 = p1;
+        PMath::SetLane(p3, N - 1, b[0]);
+        EXPECT_EQ(PMath::CompareEq(p3, p1), PMath::PacketFullMask<N>() & ~(1u << (N - 1)));
+        EXPECT_EQ(PMath::GetLane(p3, N - 1).x, b[0].x);
+    }
+
+    template<typename T, size_t N>
+    void ExpectVector4PacketMatchesScalar(std::mt19937& rng)
+    {
+        using V = PMath::TVector4<T, false>;
+        using VP = PMath::TVector4Packet<T, N>;
+
+        V a[N], b[N];
+        T t[N];
+        for (size_t i = 0; i < N; ++i)
+        {
+            a[i] = V(RandomReal<T>(rng), RandomReal<T>(rng), RandomReal<T>(rng), RandomReal<T>(rng));
+            b[i] = V(RandomReal<T>(rng), RandomReal<T>(rng), RandomReal<T>(rng), RandomReal<T>(rng));
+            t[i] = (RandomReal<T>(rng) + (T)10.0) / (T)20.0;
+        }
+
+        // Lane 0 is too short to normalize and lane 1 equal to b within the tolerance.
+        a[0] = V((T)1e-6, (T)-1e-6, (T)0.0, (T)1e-6);
+        if constexpr (N > 1)
+        {
+            a[1] = V(b[1].x + (T)0.5e-5, b[1].y, b[1].z - (T)0.5e-5, b[1].w);
+        }
+
+        VP p1, p2;
+        PMath::LoadPacket(p1, a);
+        PMath::LoadPacket(p2, b);
+
+        V r[N];
+        PMath::StorePacket(r, p1);
+        for (size_t i = 0; i < N; ++i)
+        {
+            EXPECT_EQ(r[i].x, a[i].x);
+            EXPECT_EQ(r[i].y, a[i].y);
+            EXPECT_EQ(r[i].z, a[i].z);
+            EXPECT_EQ(r[i].w, a[i].w);
+        }
+
+        const PMath::TPacket<T, N> dot = PMath::DotP(p1, p2);
+        const VP norm = PMath::Normalize(p1);
+        const VP lerp = PMath::Lerp(p1, p2, PMath::TPacket<T, N>(t));
+
+        unsigned int eq = 0;
+        for (size_t i = 0; i < N; ++i)
+        {
+            const V l = PMath::GetLane(p1, i);
+            EXPECT_EQ(l.x, a[i].x);
+            EXPECT_EQ(l.w, a[i].w);
+
+            ExpectLaneNear(dot[i], PMath::DotP(a[i], b[i]), "DotP", i);
+
+            // Like Normalize, short vectors are unchanged.
+            const V n = PMath::Normalize(a[i]);
+            const V ln = PMath::GetLane(norm, i);
+            ExpectLaneNear(ln.x, n.x, "Normalize", i);
+            ExpectLaneNear(ln.y, n.y, "Normalize", i);
+            ExpectLaneNear(ln.z, n.z, "Normalize", i);
+            ExpectLaneNear(ln.w, n.w, "Normalize", i);
+
+            // No scalar Lerp for TVector4.
+            const V e = a[i] + (b[i] - a[i]) * t[i];
+            const V ll = PMath::GetLane(lerp, i);
+            ExpectLaneNear(ll.x, e.x, "Lerp", i);
+            ExpectLaneNear(ll.y, e.y, "Lerp", i);
+            ExpectLaneNear(ll.z, e.z, "Lerp", i);
+            ExpectLaneNear(ll.w, e.w, "Lerp", i);
+
+            eq |= (unsigned int)(PMath::CompareEq(a[i], b[i]) == 0xF) << i;
+        }
+
+        EXPECT_EQ(PMath::CompareEq(p1, p2), eq);
+        EXPECT_EQ(PMath::CompareEq(p1, p1), PMath::PacketFullMask<N>());
+        EXPECT_TRUE(p1 == p1);
+        EXPECT_EQ(p1 != p2, eq != PMath::PacketFullMask<N>());
+
+        VP p3 = p1;
+        PMath::SetLane(p3, 0, b[N - 1]);
+        EXPECT_EQ(PMath::CompareEq(p3, p1), PMath::PacketFullMask<N>() & ~1u);
+        EXPECT_EQ(PMath::GetLane(p3, 0).w, b[N - 1].w);
+    }
+
+    // Two lanes use the generic loops, multiples of four the SSE / AVX transposes.
+    TEST(Packet, ScalarParityTests)
+    {
+        std::mt19937 rng(79);
+        for (int k = 0; k < 10; ++k)
+        {
+            ExpectPacketMatchesScalar<float, 2>(rng);
+            ExpectPacketMatchesScalar<float, 8>(rng);
+            ExpectPacketMatchesScalar<double, 4>(rng);
+        }
+    }
+
+    TEST(Vector3Packet, ScalarParityTests)
+    {
+        std::mt19937 rng(83);
+        for (int k = 0; k < 10; ++k)
+        {
+            ExpectVector3PacketMatchesScalar<float, 2>(rng);
+            ExpectVector3PacketMatchesScalar<float, 8>(rng);
+            ExpectVector3PacketMatchesScalar<double, 4>(rng);
+        }
+    }
+
+    TEST(Vector4Packet, ScalarParityTests)
+    {
+        std::mt19937 rng(89);
+        for (int k = 0; k < 10; ++k)
+        {
+            ExpectVector4PacketMatchesScalar<float, 2>(rng);
+            ExpectVector4PacketMatchesScalar<float, 8>(rng);
+            ExpectVector4PacketMatchesScalar<double, 4>(rng);
+        }
+    }
+}
+
+namespace PackingTests
+{
+    using Vec = PMath::TVector3<float, false>;
+    using Vec4 = PMath::TVector4<float, false>;
+
+    // Angle between two unit vectors in degrees. atan2 stays accurate for small angles, unlike acos.
+    float AngleDeg(const Vec& a, const Vec& b)
+    {
+        const Vec c = PMath::CrossP(a, b);
+        return std::atan2(std::sqrt(c.x * c.x + c.y * c.y + c.z * c.z), a.x * b.x + a.y * b.y + a.z * b.z) * 57.29578f;
+    }
+
+    std::vector<Vec> RandomUnitVectors(size_t n)
+    {
+        std::mt19937 rng(31);
+        std::normal_distribution<float> dist;
+
+        std::vector<Vec> v(n);
+        for (auto& e : v)
+        {
+            e = PMath::Normalize(Vec(dist(rng), dist(rng), dist(rng)));
+        }
+
+        // Axes, octant diagonals and the folding seam (z = 0).
+        const float d = 0.57735027f;
+        const Vec special[] = { Vec(1, 0, 0), Vec(-1, 0, 0), Vec(0, 1, 0), Vec(0, -1, 0), Vec(0, 0, 1), Vec(0, 0, -1),
+                                Vec(d, d, d), Vec(-d, d, -d), Vec(d, -d, -d), Vec(-d, -d, d),
+                                PMath::Normalize(Vec(1, 1, 0)), PMath::Normalize(Vec(-1, 1, 0)), PMath::Normalize(Vec(3, -1, 0)) };
+        v.insert(v.end(), std::begin(special), std::end(special));
+
+        return v;
+    }
+
+    TEST(Vector3Pack, OctahedralTests)
+    {
+        const std::vector<Vec> v = RandomUnitVectors(20000);
+        std::vector<uint32_t> enc(v.size());
+        std::vector<Vec> dec(v.size());
+
+        PMath::BatchEncodeOctahedral<false>(enc, v);
+        PMath::BatchDecodeOctahedral<false>(dec, enc);
+
+        float maxError = 0.0f;
+        for (size_t i = 0; i < v.size(); ++i)
+        {
+            maxError = std::max(maxError, AngleDeg(v[i], dec[i]));
+
+            EXPECT_NEAR(PMath::Magnitude(dec[i]), 1.0f, 1e-5f);
+            EXPECT_EQ(dec[i].w, 0.0f);
+        }
+
+        EXPECT_LE(maxError, 0.004f);
+    }
+
+    TEST(Vector3Pack, SNorm1010102Tests)
+    {
+        std::mt19937 rng(37);
+        std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+
+        // w is the handedness of a tangent.
+        std::vector<Vec4> v(20000);
+        for (size_t i = 0; i < v.size(); ++i)
+        {
+            v[i] = Vec4(dist(rng), dist(rng), dist(rng), (float)((int)(i % 3) - 1));
+        }
+        v[0] = Vec4(1.0f, -1.0f, 0.0f, 1.0f);
+
+        std::vector<uint32_t> enc(v.size());
+        std::vector<Vec4> dec(v.size());
+
+        PMath::BatchEncodeSNorm1010102<false>(enc, v);
+        PMath::BatchDecodeSNorm1010102<false>(dec, enc);
+
+        for (size_t i = 0; i < v.size(); ++i)
+        {
+            // Half a step of 1/511, plus float rounding.
+            EXPECT_LE(std::abs(dec[i].x - v[i].x), 0.5f / 511.0f + 1e-6f);
+            EXPECT_LE(std::abs(dec[i].y - v[i].y), 0.5f / 511.0f + 1e-6f);
+            EXPECT_LE(std::abs(dec[i].z - v[i].z), 0.5f / 511.0f + 1e-6f);
+            EXPECT_EQ(dec[i].w, v[i].w);
+        }
+
+        EXPECT_EQ(dec[0].x, 1.0f);
+        EXPECT_EQ(dec[0].y, -1.0f);
+        EXPECT_EQ(dec[0].z, 0.0f);
+    }
+}
+
+namespace DispatchTests
+{
+    using Table = PMath::SIMD::DispatchTable;
+
+    // Odd count, so the SIMD kernels run their remainder loops too.
+    constexpr size_t N = 37;
+
+    std::vector<float> Random(size_t n, float lo, float hi, unsigned seed)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> dist(lo, hi);
+
+        std::vector<float> v(n);
+        for (auto& e : v)
+        {
+            e = dist(rng);
+        }
+        return v;
+    }
+
+    // Unit xyzw vectors, e.g. quaternions. w = 0 makes unit 3d vectors.
+    std::vector<float> RandomUnit(size_t n, bool w, unsigned seed)
+    {
+        std::vector<float> v = Random(n * 4, -1.0f, 1.0f, seed);
+        for (size_t i = 0; i < n; ++i)
+        {
+            float* e = &v[i * 4];
+            e[3] = w ? e[3] : 0.0f;
+
+            const float l = std::sqrt(e[0] * e[0] + e[1] * e[1] + e[2] * e[2] + e[3] * e[3]);
+            for (size_t k = 0; k < 4; ++k)
+            {
+                e[k] /= l;
+            }
+        }
+        return v;
+    }
+
+    void ExpectNearArray(const std::vector<float>& a, const std::vector<float>& b, float tolerance, const char* kernel)
+    {
+        ASSERT_EQ(a.size(), b.size());
+        for (size_t i = 0; i < a.size(); ++i)
+        {
+            EXPECT_NEAR(a[i], b[i], tolerance * (1.0f + std::abs(b[i]))) << kernel << " [" << i << "]";
+        }
+    }
+
+    const Table& Dispatched()
+    {
+        return PMath::SIMD::GetDispatchTable();
+    }
+
+    const Table& Reference()
+    {
+        static const Table t = PMath::SIMD::BuildDispatchTable(PMath::SIMD::EInstructionSet::FPU, false);
+        return t;
+    }
+
+    TEST(Dispatch, MatrixParityTests)
+    {
+        const std::vector<float> a = Random(N * 16, -2.0f, 2.0f, 41);
+        const std::vector<float> b = Random(N * 16, -2.0f, 2.0f, 43);
+        const std::vector<float> v = Random(N * 4, -10.0f, 10.0f, 47);
+
+        std::vector<float> r(N * 16), e(N * 16);
+        Dispatched().mat4_mul_array(r.data(), a.data(), b.data(), N);
+        Reference().mat4_mul_array(e.data(), a.data(), b.data(), N);
+        ExpectNearArray(r, e, 1e-5f, "mat4_mul_array");
+
+        std::vector<float> rv(N * 4), ev(N * 4);
+        for (bool stream : { false, true })
+        {
+            Dispatched().mat4_transform_array(rv.data(), a.data(), v.data(), N, stream);
+            Reference().mat4_transform_array(ev.data(), a.data(), v.data(), N, stream);
+            ExpectNearArray(rv, ev, 1e-5f, "mat4_transform_array");
+
+            Dispatched().mat4_transform_point_array(rv.data(), a.data(), v.data(), N, stream);
+            Reference().mat4_transform_point_array(ev.data(), a.data(), v.data(), N, stream);
+            ExpectNearArray(rv, ev, 1e-5f, "mat4_transform_point_array");
+
+            Dispatched().mat4_transform_dir_array(rv.data(), a.data(), v.data(), N, stream);
+            Reference().mat4_transform_dir_array(ev.data(), a.data(), v.data(), N, stream);
+            ExpectNearArray(rv, ev, 1e-5f, "mat4_transform_dir_array");
+        }
+
+        // Determinant and inverse of a well conditioned matrix.
+        std::vector<float> m(a.begin(), a.begin() + 16);
+        for (size_t i = 0; i < 4; ++i)
+        {
+            m[i * 5] += 8.0f;
+        }
+
+        EXPECT_NEAR(Dispatched().mat4_det(m.data()), Reference().mat4_det(m.data()), 1e-5f * std::abs(Reference().mat4_det(m.data())));
+
+        std::vector<float> ri(16), ei(16);
+        EXPECT_TRUE(Dispatched().mat4_inv(ri.data(), m.data()));
+        EXPECT_TRUE(Reference().mat4_inv(ei.data(), m.data()));
+        ExpectNearArray(ri, ei, 1e-5f, "mat4_inv");
+    }
+
+    TEST(Dispatch, VectorParityTests)
+    {
+        const std::vector<float> a = Random(N * 4, -10.0f, 10.0f, 53);
+        const std::vector<float> b = Random(N * 4, 0.5f, 10.0f, 59);
+
+        std::vector<float> r(N * 4), e(N * 4);
+        std::vector<float> rs(N), es(N);
+
+        Dispatched().vec4_add_array(r.data(), a.data(), b.data(), N);
+        Reference().vec4_add_array(e.data(), a.data(), b.data(), N);
+        ExpectNearArray(r, e, 0.0f, "vec4_add_array");
+
+        Dispatched().vec4_div_array(r.data(), a.data(), b.data(), N);
+        Reference().vec4_div_array(e.data(), a.data(), b.data(), N);
+        ExpectNearArray(r, e, 1e-6f, "vec4_div_array");
+
+        Dispatched().vec4_dot_array(rs.data(), a.data(), b.data(), N);
+        Reference().vec4_dot_array(es.data(), a.data(), b.data(), N);
+        ExpectNearArray(rs, es, 1e-5f, "vec4_dot_array");
+
+        Dispatched().vec4_magnitude_array(rs.data(), a.data(), N);
+        Reference().vec4_magnitude_array(es.data(), a.data(), N);
+        ExpectNearArray(rs, es, 1e-5f, "vec4_magnitude_array");
+
+        Dispatched().vec4_normalize_array(r.data(), a.data(), N, 1e-6f);
+        Reference().vec4_normalize_array(e.data(), a.data(), N, 1e-6f);
+        ExpectNearArray(r, e, 1e-5f, "vec4_normalize_array");
+
+        // The estimate is accurate to about 12 bits, a Newton-Raphson step brings it close to the exact result.
+        Dispatched().vec4_normalize_est_array(r.data(), a.data(), N, 1e-6f, false);
+        Reference().vec4_normalize_array(e.data(), a.data(), N, 1e-6f);
+        ExpectNearArray(r, e, 1e-3f, "vec4_normalize_est_array");
+
+        Dispatched().vec4_normalize_est_array(r.data(), a.data(), N, 1e-6f, true);
+        ExpectNearArray(r, e, 1e-5f, "vec4_normalize_est_array (refined)");
+
+        Dispatched().vec4_lerp_array(r.data(), a.data(), b.data(), N, 0.3f);
+        Reference().vec4_lerp_array(e.data(), a.data(), b.data(), N, 0.3f);
+        ExpectNearArray(r, e, 1e-5f, "vec4_lerp_array");
+
+        std::vector<float> rm(4), em(4);
+        Dispatched().vec4_min_reduce(rm.data(), a.data(), N);
+        Reference().vec4_min_reduce(em.data(), a.data(), N);
+        ExpectNearArray(rm, em, 0.0f, "vec4_min_reduce");
+
+        Dispatched().vec4_max_reduce(rm.data(), a.data(), N);
+        Reference().vec4_max_reduce(em.data(), a.data(), N);
+        ExpectNearArray(rm, em, 0.0f, "vec4_max_reduce");
+
+        Dispatched().vec3_dot_array(rs.data(), a.data(), b.data(), N);
+        Reference().vec3_dot_array(es.data(), a.data(), b.data(), N);
+        ExpectNearArray(rs, es, 1e-5f, "vec3_dot_array");
+
+        Dispatched().vec3_cross_array(r.data(), a.data(), b.data(), N);
+        Reference().vec3_cross_array(e.data(), a.data(), b.data(), N);
+        ExpectNearArray(r, e, 1e-5f, "vec3_cross_array");
+
+        Dispatched().vec3_normalize_array(r.data(), a.data(), N, 1e-6f);
+        Reference().vec3_normalize_array(e.data(), a.data(), N, 1e-6f);
+        ExpectNearArray(r, e, 1e-5f, "vec3_normalize_array");
+
+        std::vector<float> r2(N * 2), e2(N * 2);
+        Dispatched().vec2_lerp_array(r2.data(), a.data(), b.data(), N, 0.7f);
+        Reference().vec2_lerp_array(e2.data(), a.data(), b.data(), N, 0.7f);
+        ExpectNearArray(r2, e2, 1e-5f, "vec2_lerp_array");
+
+        Dispatched().vec2_normalize_array(r2.data(), a.data(), N, 1e-6f);
+        Reference().vec2_normalize_array(e2.data(), a.data(), N, 1e-6f);
+        ExpectNearArray(r2, e2, 1e-5f, "vec2_normalize_array");
+
+        bool req[N], eeq[N];
+        Dispatched().vec4_eq_array(req, a.data(), a.data(), N, 1e-4f);
+        Reference().vec4_eq_array(eeq, a.data(), a.data(), N, 1e-4f);
+        for (size_t i = 0; i < N; ++i)
+        {
+            EXPECT_EQ(req[i], eeq[i]);
+        }
+    }
+
+    TEST(Dispatch, NormalizeShortTests)
+    {
+        // Every third vector is shorter than minLength, every sixth is zero.
+        std::vector<float> a = Random(N * 4, -10.0f, 10.0f, 61);
+        for (size_t i = 0; i < N; i += 3)
+        {
+            for (size_t c = 0; c < 4; ++c)
+            {
+                a[i * 4 + c] *= (i % 2 == 0) ? 0.0f : 1e-9f;
+            }
+        }
+
+        std::vector<float> r4(N * 4), r4e(N * 4), r4r(N * 4), r3(N * 4), r3e(N * 4), r3r(N * 4);
+        Dispatched().vec4_normalize_array(r4.data(), a.data(), N, 1e-6f);
+        Dispatched().vec4_normalize_est_array(r4e.data(), a.data(), N, 1e-6f, false);
+        Dispatched().vec4_normalize_est_array(r4r.data(), a.data(), N, 1e-6f, true);
+        Dispatched().vec3_normalize_array(r3.data(), a.data(), N, 1e-6f);
+        Dispatched().vec3_normalize_est_array(r3e.data(), a.data(), N, 1e-6f, false);
+        Dispatched().vec3_normalize_est_array(r3r.data(), a.data(), N, 1e-6f, true);
+
+        for (size_t i = 0; i < N; ++i)
+        {
+            for (const std::vector<float>* r : { &r4, &r4e, &r4r, &r3, &r3e, &r3r })
+            {
+                const float* x = r->data() + i * 4;
+                const float l2 = x[0] * x[0] + x[1] * x[1] + x[2] * x[2] + x[3] * x[3];
+
+                if (i % 3 == 0)
+                {
+                    EXPECT_EQ(l2, 0.0f) << "vector " << i;
+                }
+                else
+                {
+                    EXPECT_NEAR(l2, 1.0f, 1e-2f) << "vector " << i;
+                }
+            }
+        }
+    }
+
+    TEST(Dispatch, CullParityTests)
+    {
+        // Six unit length planes of a box around the origin.
+        const float planes[6 * 4] = { 1, 0, 0, 5,  -1, 0, 0, 5,  0, 1, 0, 4,  0, -1, 0, 4,  0, 0, 1, 3,  0, 0, -1, 3 };
+
+        // Centers and radius interleaved, xyzr.
+        std::vector<float> s = Random(N * 4, -8.0f, 8.0f, 61);
+        for (size_t i = 0; i < N; ++i)
+        {
+            s[i * 4 + 3] = std::abs(s[i * 4 + 3]) * 0.25f;
+        }
+
+        uint32_t r[(N + 31) / 32], e[(N + 31) / 32];
+        Dispatched().cull_sphere_array(r, planes, 6, s.data(), s.data() + 3, 4, N);
+        Reference().cull_sphere_array(e, planes, 6, s.data(), s.data() + 3, 4, N);
+        for (size_t i = 0; i < (N + 31) / 32; ++i)
+        {
+            EXPECT_EQ(r[i], e[i]);
+        }
+
+        // Boxes as min xyzw and max xyzw.
+        std::vector<float> mn = Random(N * 4, -8.0f, 8.0f, 67);
+        std::vector<float> mx(mn);
+        for (size_t i = 0; i < N * 4; ++i)
+        {
+            mx[i] += 0.5f + (float)(i % 3);
+        }
+
+        Dispatched().cull_aabb_array(r, planes, 6, mn.data(), mx.data(), 4, N);
+        Reference().cull_aabb_array(e, planes, 6, mn.data(), mx.data(), 4, N);
+        for (size_t i = 0; i < (N + 31) / 32; ++i)
+        {
+            EXPECT_EQ(r[i], e[i]);
+        }
+    }
+
+    TEST(Dispatch, QuaternionAndSkinningParityTests)
+    {
+        const std::vector<float> a = RandomUnit(N, true, 71);
+        const std::vector<float> b = RandomUnit(N, true, 73);
+
+        std::vector<float> r(N * 4), e(N * 4);
+        for (float t : { 0.0f, 0.25f, 0.5f, 1.0f })
+        {
+            Dispatched().quat_slerp_array(r.data(), a.data(), b.data(), N, t);
+            Reference().quat_slerp_array(e.data(), a.data(), b.data(), N, t);
+            ExpectNearArray(r, e, 1e-5f, "quat_slerp_array");
+        }
+
+        constexpr size_t bones = 5;
+        constexpr size_t pitch = N + 3;
+        constexpr size_t k = PMath::SIMD::FPU::SkinInfluences;
+
+        const std::vector<float> p = Random(pitch * 3, -2.0f, 2.0f, 79);
+        const std::vector<float> nrm = Random(pitch * 3, -1.0f, 1.0f, 83);
+
+        std::vector<uint32_t> idx(N * k);
+        std::vector<float> w = Random(N * k, 0.0f, 1.0f, 89);
+        for (size_t i = 0; i < N; ++i)
+        {
+            float sum = 0.0f;
+            for (size_t j = 0; j < k; ++j)
+            {
+                idx[i * k + j] = (uint32_t)((i + j * 3) % bones);
+                sum += w[i * k + j];
+            }
+            for (size_t j = 0; j < k; ++j)
+            {
+                w[i * k + j] /= sum;
+            }
+        }
+
+        // Unit dual quaternions: real part q, dual part 0.5 * t * q with t = (x, y, z, 0).
+        std::vector<float> dq(bones * 8);
+        const std::vector<float> q = RandomUnit(bones, true, 97);
+        const std::vector<float> tr = Random(bones * 3, -3.0f, 3.0f, 101);
+        for (size_t i = 0; i < bones; ++i)
+        {
+            const float* qi = &q[i * 4];
+            const float* ti = &tr[i * 3];
+            float* d = &dq[i * 8];
+
+            d[0] = qi[0]; d[1] = qi[1]; d[2] = qi[2]; d[3] = qi[3];
+            d[4] = 0.5f * ( ti[0] * qi[3] + ti[1] * qi[2] - ti[2] * qi[1]);
+            d[5] = 0.5f * (-ti[0] * qi[2] + ti[1] * qi[3] + ti[2] * qi[0]);
+            d[6] = 0.5f * ( ti[0] * qi[1] - ti[1] * qi[0] + ti[2] * qi[3]);
+            d[7] = 0.5f * (-ti[0] * qi[0] - ti[1] * qi[1] - ti[2] * qi[2]);
+        }
+
+        std::vector<float> rp(pitch * 3), rn(pitch * 3), ep(pitch * 3), en(pitch * 3);
+        Dispatched().dq_skin_array(rp.data(), rn.data(), p.data(), nrm.data(), idx.data(), w.data(), dq.data(), N, pitch);
+        Reference().dq_skin_array(ep.data(), en.data(), p.data(), nrm.data(), idx.data(), w.data(), dq.data(), N, pitch);
+        for (size_t c = 0; c < 3; ++c)
+        {
+            for (size_t i = 0; i < N; ++i)
+            {
+                EXPECT_NEAR(rp[c * pitch + i], ep[c * pitch + i], 1e-4f) << "dq_skin_array";
+                EXPECT_NEAR(rn[c * pitch + i], en[c * pitch + i], 1e-4f) << "dq_skin_array";
+            }
+        }
+
+        for (size_t columnStride : { 3, 4 })
+        {
+            const std::vector<float> m = Random(bones * 4 * columnStride, -2.0f, 2.0f, 103);
+
+            Dispatched().lbs_skin_array(rp.data(), rn.data(), p.data(), nrm.data(), idx.data(), w.data(), m.data(), columnStride, N, pitch);
+            Reference().lbs_skin_array(ep.data(), en.data(), p.data(), nrm.data(), idx.data(), w.data(), m.data(), columnStride, N, pitch);
+            for (size_t c = 0; c < 3; ++c)
+            {
+                for (size_t i = 0; i < N; ++i)
+                {
+                    EXPECT_NEAR(rp[c * pitch + i], ep[c * pitch + i], 1e-4f) << "lbs_skin_array";
+                    EXPECT_NEAR(rn[c * pitch + i], en[c * pitch + i], 1e-4f) << "lbs_skin_array";
+                }
+            }
+        }
+    }
+
+    TEST(Dispatch, ConversionParityTests)
+    {
+        // Normal, subnormal and out of range halves, ties and specials.
+        std::vector<float> f = Random(N * 4, -70000.0f, 70000.0f, 107);
+        const float special[] = { 0.0f, -0.0f, 1.0f, -2.5f, 65504.0f, 65520.0f, 1e-5f, -6e-8f, 1.00048828125f, std::numeric_limits<float>::infinity(),
+                                  -std::numeric_limits<float>::infinity(), std::numeric_limits<float>::quiet_NaN() };
+        for (size_t i = 0; i < std::size(special); ++i)
+        {
+            f[i] = special[i];
+        }
+        for (size_t i = std::size(special); i < N * 4; i += 3)
+        {
+            f[i] *= 1e-7f;
+        }
+
+        std::vector<uint16_t> rh(N * 4), eh(N * 4);
+        Dispatched().float_to_half_array(rh.data(), f.data(), N * 4);
+        Reference().float_to_half_array(eh.data(), f.data(), N * 4);
+        EXPECT_EQ(rh, eh);
+
+        Dispatched().vec3_float_to_half_array(rh.data(), f.data(), N);
+        Reference().vec3_float_to_half_array(eh.data(), f.data(), N);
+        EXPECT_EQ(std::vector<uint16_t>(rh.begin(), rh.begin() + N * 3), std::vector<uint16_t>(eh.begin(), eh.begin() + N * 3));
+
+        // Every half bit pattern.
+        std::vector<uint16_t> h(65536);
+        for (size_t i = 0; i < h.size(); ++i)
+        {
+            h[i] = (uint16_t)i;
+        }
+
+        std::vector<float> rf(h.size()), ef(h.size());
+        Dispatched().half_to_float_array(rf.data(), h.data(), h.size());
+        Reference().half_to_float_array(ef.data(), h.data(), h.size());
+        EXPECT_EQ(0, std::memcmp(rf.data(), ef.data(), rf.size() * sizeof(float)));
+
+        std::vector<float> rv(N * 4), ev(N * 4);
+        Dispatched().vec3_half_to_float_array(rv.data(), h.data(), N);
+        Reference().vec3_half_to_float_array(ev.data(), h.data(), N);
+        EXPECT_EQ(0, std::memcmp(rv.data(), ev.data(), rv.size() * sizeof(float)));
+    }
+
+    TEST(Dispatch, PackingParityTests)
+    {
+        const std::vector<float> n = RandomUnit(N, false, 109);
+
+        std::vector<uint32_t> r(N), e(N);
+        Dispatched().vec3_encode_oct_array(r.data(), n.data(), N);
+        Reference().vec3_encode_oct_array(e.data(), n.data(), N);
+        EXPECT_EQ(r, e);
+
+        std::vector<float> rv(N * 4), ev(N * 4);
+        Dispatched().vec3_decode_oct_array(rv.data(), e.data(), N);
+        Reference().vec3_decode_oct_array(ev.data(), e.data(), N);
+        ExpectNearArray(rv, ev, 1e-6f, "vec3_decode_oct_array");
+
+        std::vector<float> v = Random(N * 4, -1.2f, 1.2f, 113);
+        Dispatched().vec3_encode_1010102_array(r.data(), v.data(), N);
+        Reference().vec3_encode_1010102_array(e.data(), v.data(), N);
+        EXPECT_EQ(r, e);
+
+        Dispatched().vec3_decode_1010102_array(rv.data(), e.data(), N);
+        Reference().vec3_decode_1010102_array(ev.data(), e.data(), N);
+        ExpectNearArray(rv, ev, 0.0f, "vec3_decode_1010102_array");
+
+        const float offset[3] = { -1.2f, -1.2f, -1.2f };
+        const float scale[3] = { 65535.0f / 2.4f, 65535.0f / 2.4f, 65535.0f / 2.4f };
+        const float inv[3] = { 2.4f / 65535.0f, 2.4f / 65535.0f, 2.4f / 65535.0f };
+
+        std::vector<uint16_t> rq(N * 3), eq(N * 3);
+        Dispatched().vec3_quantize_array(rq.data(), v.data(), offset, scale, N);
+        Reference().vec3_quantize_array(eq.data(), v.data(), offset, scale, N);
+        EXPECT_EQ(rq, eq);
+
+        Dispatched().vec3_dequantize_array(rv.data(), eq.data(), offset, inv, N);
+        Reference().vec3_dequantize_array(ev.data(), eq.data(), offset, inv, N);
+        ExpectNearArray(rv, ev, 1e-6f, "vec3_dequantize_array");
+    }
+}